@@ -0,0 +1,635 @@
+// enchant_windows - adversarial input check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Feeds the provider the input most likely to find a cost that grows faster
+// than the input does: words at kMaxUTF8WordLengthInBytes and far past it,
+// invalid UTF-8, combining marks in the order canonicalization has to sort
+// the most, a backend with a huge suggestion list, a document in which every
+// word is misspelled, malformed and unusual tags, and thousands of
+// dictionaries opened and closed. It runs on a stand-in backend under each
+// set of policies a plugin is built with (provider_policies.h), so that
+// every conversion, cache and canonicalization is covered.
+//
+// Each case is timed at two sizes, the second eight times the first. Its
+// growth is the time per byte, suggestion, word or dictionary at the larger
+// size over that at the smaller: about 1 for a linear cost, 8 for a
+// quadratic one.
+//
+// Fails if a growth is over --max-growth; a word call takes more than
+// --max-word-us, turning away --huge-bytes more than --max-reject-us, or
+// requesting a tag more than --max-tag-us; a result is wrong; a suggestion
+// list is charged more than --max-list-bytes a suggestion, or anything stays
+// charged once it is freed; or the process grows by more than --max-leak-kb
+// over rounds of opening and closing dictionaries.
+//
+//   enchant_windows_bench adversarial [--suggestions 20000] [--words 4000]
+//       [--dicts 2000]
+
+#include "adversarial_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+#include "language_tags.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "windows_provider.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+struct AdversarialOptions
+{
+	size_t suggestions;
+	size_t words;
+	size_t dicts;
+	size_t huge_bytes;
+	double max_growth;
+	double max_word_us;
+	double max_reject_us;
+	double max_tag_us;
+	size_t max_list_bytes;
+	size_t max_leak_kb;
+
+	AdversarialOptions() :
+		suggestions(20000),
+		words(4000),
+		dicts(2000),
+		huge_bytes(1024 * 1024),
+		max_growth(3),
+		max_word_us(200),
+		max_reject_us(20),
+		max_tag_us(500),
+		max_list_bytes(64),
+		max_leak_kb(1024)
+	{}
+};
+
+static void adversarial_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench adversarial [options]\n"
+		"  --suggestions N      smaller suggestion list, the larger is 8 times it (default 20000)\n"
+		"  --words N            smaller misspelled document (default 4000)\n"
+		"  --dicts N            dictionaries opened and closed (default 2000)\n"
+		"  --huge-bytes N       length of the word to turn away (default 1048576)\n"
+		"  --max-growth F       growth allowed from the smaller size to the larger (default 3)\n"
+		"  --max-word-us N      time allowed for a call on a long word (default 200)\n"
+		"  --max-reject-us N    time allowed to turn away the huge word (default 20)\n"
+		"  --max-tag-us N       time allowed to request a dictionary (default 500)\n"
+		"  --max-list-bytes N   bytes a suggestion may be charged (default 64)\n"
+		"  --max-leak-kb N      growth allowed over the dictionary rounds (default 1024)\n",
+		stderr);
+}
+
+static bool parse_adversarial_options(int argc, char** argv, AdversarialOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--suggestions") options.suggestions = strtoul(v, nullptr, 10);
+		else if (arg == "--words") options.words = strtoul(v, nullptr, 10);
+		else if (arg == "--dicts") options.dicts = strtoul(v, nullptr, 10);
+		else if (arg == "--huge-bytes") options.huge_bytes = strtoul(v, nullptr, 10);
+		else if (arg == "--max-growth") options.max_growth = atof(v);
+		else if (arg == "--max-word-us") options.max_word_us = atof(v);
+		else if (arg == "--max-reject-us") options.max_reject_us = atof(v);
+		else if (arg == "--max-tag-us") options.max_tag_us = atof(v);
+		else if (arg == "--max-list-bytes") options.max_list_bytes = strtoul(v, nullptr, 10);
+		else if (arg == "--max-leak-kb") options.max_leak_kb = strtoul(v, nullptr, 10);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.suggestions >= 16 && options.words > 0 && options.dicts >= 8 &&
+		options.huge_bytes > 3 * kMaxUTF8WordLengthInBytes;
+}
+
+// What the stand-in backend says: every word is misspelled, with the first
+// 'served' of 'suggestions' handed out one at a time.
+struct AdversaryScript
+{
+	std::vector<std::u16string> suggestions;
+	size_t served;
+};
+
+class AdversaryBackend : public SpellBackend
+{
+public:
+	explicit AdversaryBackend(const AdversaryScript& script) : script(script) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t*) override { return 1; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t*) override
+	{
+		return std::make_unique<Checker>(script);
+	}
+
+private:
+	class Enumerator : public StringEnumerator
+	{
+	public:
+		explicit Enumerator(const AdversaryScript& script) : script(script), position(0), end(script.served) {}
+
+		bool next(std::u16string& out) override
+		{
+			if (position == end)
+				return false;
+			out = script.suggestions[position++];
+			return true;
+		}
+
+	private:
+		const AdversaryScript& script;
+		size_t position;
+		size_t end;
+	};
+
+	class Checker : public SpellChecker
+	{
+	public:
+		explicit Checker(const AdversaryScript& script) : script(script) {}
+
+		int check(const char16_t*) override { return 1; }
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override
+		{
+			return std::make_unique<Enumerator>(script);
+		}
+		bool add(const char16_t*) override { return true; }
+		bool ignore(const char16_t*) override { return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		const AdversaryScript& script;
+	};
+
+	const AdversaryScript& script;
+};
+
+// Suggestions as a backend might give them: mostly words, some with
+// non-ASCII letters, some with an unpaired surrogate, and one in sixteen too
+// long to be a word, which the provider leaves out.
+static std::vector<std::u16string> make_suggestions(size_t count)
+{
+	std::vector<std::u16string> suggestions;
+	suggestions.reserve(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		const std::string number = std::to_string(i);
+		std::u16string s(number.begin(), number.end());
+		if (i % 16 == 15)
+			s.append(kMaxWordLength, u'x');
+		else if (i % 16 == 7)
+			s.insert(s.begin(), u'\xD800');
+		else if (i % 4 == 1)
+			s.insert(s.begin(), u'\x00E9');
+		else
+			s.insert(s.begin(), u'w');
+		suggestions.push_back(std::move(s));
+	}
+	return suggestions;
+}
+
+// Words built by repeating 'unit' after 'prefix'.
+struct WordForm
+{
+	const char* name;
+	const char* prefix;
+	const char* unit;
+};
+
+static const WordForm kWordForms[] = {
+	{ "ascii", "", "abcdefghij" },
+	{ "latin-1", "", "\xC3\xA9" },
+	{ "3-byte", "", "\xE1\xB8\x81" },
+	// An acute (class 230) then a grave below (220), over and over: every
+	// grave has to be ordered ahead of all the acutes before it.
+	{ "marks", "a", "\xCC\x81\xCC\x96" },
+	{ "emoji", "", "\xF0\x9F\x99\x82" },
+	{ "continuation", "", "\x80" },
+	{ "bytes fe ff", "", "\xFE\xFF" },
+	{ "truncated", "", "\xE2\x82" },
+	{ "overlong", "", "\xC0\xAF" },
+	{ "surrogate", "", "\xED\xA0\x80" },
+};
+
+// 'form' 'bytes' long, padded at the start with ASCII where the units don't
+// fit exactly.
+static std::string make_word(const WordForm& form, size_t bytes)
+{
+	const size_t unit = strlen(form.unit);
+	const size_t units = (bytes - strlen(form.prefix)) / unit;
+	std::string word(bytes - strlen(form.prefix) - units * unit, 'a');
+	word += form.prefix;
+	for (size_t i = 0; i < units; ++i)
+		word += form.unit;
+	return word;
+}
+
+// The mean time of one call, from the quickest of five rounds of 'calls',
+// which is the one least disturbed by anything else running.
+template<typename F>
+static double ns_per_call(size_t calls, const F& call)
+{
+	double best = 0;
+	for (size_t round = 0; round < 5; ++round)
+	{
+		const Clock::time_point start = Clock::now();
+		for (size_t i = 0; i < calls; ++i)
+			call();
+		const double ns = static_cast<double>(elapsed_ns(start)) / calls;
+		if (round == 0 || ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+class AdversaryRun
+{
+public:
+	AdversaryRun(const char* policies, const AdversarialOptions& options, AdversaryScript& script, EnchantProvider* provider) :
+		policies(policies), options(options), script(script), provider(provider), failures(0)
+	{}
+
+	size_t run()
+	{
+		ProviderDict dict(provider, "en_US");
+		if (!dict.get())
+		{
+			fail("cannot request en_US");
+			return failures;
+		}
+		long_words(dict.get());
+		suggestion_lists(dict.get());
+		misspelled_document(dict.get());
+		odd_tags();
+		dictionaries();
+		return failures;
+	}
+
+private:
+	void fail(const std::string& what)
+	{
+		fprintf(stderr, "%s: %s\n", policies, what.c_str());
+		++failures;
+	}
+
+	void report(const char* name, double small, double large, double growth)
+	{
+		printf("%-8s %-26s %12.0f %12.0f %7.2f\n", policies, name, small, large, growth);
+		if (growth > options.max_growth)
+			fail(std::string(name) + ": grows faster than its input");
+	}
+
+	int check(EnchantDict* dict, const std::string& word) const
+	{
+		return dict->check(dict, word.data(), word.size());
+	}
+
+	// Null, or a list of 'count' that has been freed.
+	bool suggest(EnchantDict* dict, const std::string& word, size_t max, size_t& count) const
+	{
+		count = 0;
+		char** list = enchant_windows_dict_suggest_max(dict, word.data(), word.size(), max, &count);
+		provider->free_string_list(provider, list);
+		return list != nullptr;
+	}
+
+	// Words of each form an eighth of the longest length, the longest, three
+	// times it (which is still read, as canonicalizing might bring it within
+	// the limit), and the huge word.
+	void long_words(EnchantDict* dict)
+	{
+		const size_t large = kMaxUTF8WordLengthInBytes;
+		const size_t small = large / 8;
+		script.served = 8;
+		for (const WordForm& form : kWordForms)
+		{
+			const std::string shortWord = make_word(form, small);
+			const std::string longWord = make_word(form, large);
+			const std::string overWord = make_word(form, 3 * large);
+			const std::string hugeWord = make_word(form, options.huge_bytes);
+			const std::string name = std::string("word ") + form.name;
+
+			const int shortResult = check(dict, shortWord);
+			const int longResult = check(dict, longWord);
+			const int overResult = check(dict, overWord);
+			const int hugeResult = check(dict, hugeWord);
+			size_t count;
+			const bool hugeSuggested = suggest(dict, hugeWord, 0, count);
+			if (shortResult < 0 || shortResult > 1 || longResult < 0 || longResult > 1)
+				fail(name + ": a word within the longest length not checked");
+			if (overResult != -1 || hugeResult != -1 || hugeSuggested)
+				fail(name + ": a word past the longest length not turned away");
+
+			const double shortNs = ns_per_call(200, [&]() { check(dict, shortWord); });
+			const double longNs = ns_per_call(200, [&]() { check(dict, longWord); });
+			const double overNs = ns_per_call(20, [&]() { check(dict, overWord); });
+			const double suggestNs = ns_per_call(20, [&]() { suggest(dict, longWord, 0, count); });
+			const double hugeNs = ns_per_call(5, [&]() { check(dict, hugeWord); suggest(dict, hugeWord, 0, count); }) / 2;
+			report(name.c_str(), shortNs, longNs, longNs / (8 * shortNs));
+			if (std::max(std::max(longNs, overNs), suggestNs) > options.max_word_us * 1000)
+				fail(name + ": a long word is slow");
+			if (hugeNs > options.max_reject_us * 1000)
+				fail(name + ": the huge word is slow to turn away");
+		}
+	}
+
+	// All of a list, then one eight times as long, then the best five of
+	// that.
+	void suggestion_lists(EnchantDict* dict)
+	{
+		const std::string word = "sugestion";
+		double perSuggestion[2] = {};
+		for (size_t pass = 0; pass < 2; ++pass)
+		{
+			script.served = pass ? 8 * options.suggestions : options.suggestions;
+			const size_t expected = script.served - script.served / 16;
+			size_t count = 0;
+			char** list = enchant_windows_dict_suggest_max(dict, word.data(), word.size(), 0, &count);
+			EnchantWindowsDictMemory held;
+			const bool measured = enchant_windows_dict_memory_usage(dict, &held) == 0;
+			provider->free_string_list(provider, list);
+			EnchantWindowsDictMemory freed;
+			enchant_windows_dict_memory_usage(dict, &freed);
+
+			if (count != expected)
+				fail("suggestions: " + std::to_string(count) + " of " + std::to_string(expected) + " returned");
+			if (measured && held.current_bytes[ENCHANT_WINDOWS_MEMORY_STRING_ARENA] > options.max_list_bytes * std::max<size_t>(count, 1))
+				fail("suggestions: " + std::to_string(held.current_bytes[ENCHANT_WINDOWS_MEMORY_STRING_ARENA]) + " bytes charged for " + std::to_string(count));
+			if (freed.current_bytes[ENCHANT_WINDOWS_MEMORY_STRING_ARENA] != 0)
+				fail("suggestions: still charged once freed");
+			perSuggestion[pass] = ns_per_call(1, [&]() { suggest(dict, word, 0, count); }) / script.served;
+		}
+		report("suggestion list", perSuggestion[0], perSuggestion[1], perSuggestion[1] / perSuggestion[0]);
+
+		size_t count = 0;
+		const double topNs = ns_per_call(20, [&]() { suggest(dict, word, 5, count); });
+		if (count != 5 || topNs > options.max_word_us * 1000)
+			fail("suggestions: the best five of a huge list are slow or wrong");
+	}
+
+	// Distinct misspelled words, some with non-ASCII letters, and a
+	// suggestion list for one in sixteen: first --words of them, then eight
+	// times as many new ones.
+	void misspelled_document(EnchantDict* dict)
+	{
+		script.served = 8;
+		std::vector<std::string> words;
+		for (size_t i = 0; i < 9 * options.words; ++i)
+			words.push_back(i % 3 ? filler_word(i) : filler_word(i) + "\xC3\xA9");
+
+		EnchantWindowsDictMemory before;
+		EnchantWindowsDictMemory after;
+		double perWord[2] = {};
+		size_t wrong = 0;
+		size_t first = 0;
+		for (size_t pass = 0; pass < 2; ++pass)
+		{
+			const size_t last = first + (pass ? 8 : 1) * options.words;
+			const Clock::time_point start = Clock::now();
+			for (size_t i = first; i < last; ++i)
+			{
+				if (check(dict, words[i]) != 1)
+					++wrong;
+				size_t count;
+				if (i % 16 == 0 && (!suggest(dict, words[i], 0, count) || count != 8))
+					++wrong;
+			}
+			perWord[pass] = static_cast<double>(elapsed_ns(start)) / (last - first);
+			enchant_windows_dict_memory_usage(dict, pass ? &after : &before);
+			first = last;
+		}
+		report("misspelled document", perWord[0], perWord[1], perWord[1] / perWord[0]);
+		if (wrong)
+			fail("misspelled document: " + std::to_string(wrong) + " wrong results");
+		if (after.total_bytes > before.total_bytes)
+			fail("misspelled document: memory grows with the words checked");
+	}
+
+	// Tags that name a language in an unusual form, and ones that don't
+	// name one at all.
+	void odd_tags()
+	{
+		struct OddTag
+		{
+			std::string tag;
+			bool wellFormed;
+		};
+		const OddTag tags[] = {
+			{ "EN-us", true }, { "en_US.UTF-8@euro", true }, { "en-Latn-US", true },
+			{ "sr_Latn_RS", true }, { "es-419", true }, { "de-CH-1996", true },
+			{ "en-US-x-private", true }, { "zh-Hant-TW", true },
+			{ "", false }, { "_", false }, { "-", false }, { ".", false }, { "@", false },
+			{ "e", false }, { "en_", false }, { "en__US", false }, { "en US", false },
+			{ "123", false }, { "en-US-toolongsubtag", false }, { "\xC3\xA9n_US", false },
+			{ "en\tUS", false }, { "en-US\n", false }, { std::string(64 * 1024, 'a'), false },
+			{ "en-" + std::string(64 * 1024, '-'), false },
+		};
+
+		double worstNs = 0;
+		for (const OddTag& odd : tags)
+		{
+			bool opened = false;
+			int exists = 0;
+			const double ns = ns_per_call(3, [&]() {
+				EnchantDict* dict = provider->request_dict(provider, odd.tag.c_str());
+				opened = dict != nullptr;
+				if (dict)
+					provider->dispose_dict(provider, dict);
+				exists = provider->dictionary_exists(provider, odd.tag.c_str());
+			});
+			worstNs = std::max(worstNs, ns);
+			const std::string shown = odd.tag.size() > 24 ? odd.tag.substr(0, 24) + "..." : odd.tag;
+			if (opened != odd.wellFormed || (exists == 1) != odd.wellFormed)
+				fail("tag '" + shown + "' " + (odd.wellFormed ? "not opened" : "opened"));
+		}
+		printf("%-8s %-26s %12.0f\n", policies, "odd tags (worst)", worstNs);
+		if (worstNs > options.max_tag_us * 1000)
+			fail("odd tags: slow to request");
+	}
+
+	// --dicts dictionaries with tags never seen before, each closed before
+	// the next is opened. The provider only interns so many tags, so once
+	// its table is full the rest are converted every time instead; all of
+	// them still open, and so does a real tag first asked for afterwards.
+	// Then an eighth as many, and as many, open at once before any is
+	// closed, and rounds of the latter to see what is left behind.
+	void dictionaries()
+	{
+		std::vector<double> openedNs;
+		double refusedNs = 0;
+		for (size_t i = 0; i < options.dicts; ++i)
+		{
+			static const char kDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+			std::string tag = "en-US-v";
+			for (size_t n = i, k = 0; k < 5; ++k, n /= 36)
+				tag += kDigits[n % 36];
+
+			const Clock::time_point start = Clock::now();
+			EnchantDict* dict = provider->request_dict(provider, tag.c_str());
+			const bool opened = dict != nullptr;
+			if (opened)
+				provider->dispose_dict(provider, dict);
+			const double ns = static_cast<double>(elapsed_ns(start));
+			if (opened)
+				openedNs.push_back(ns);
+			else
+				refusedNs = std::max(refusedNs, ns);
+		}
+		printf("%-8s %-26s %9zu opened, %zu refused\n", policies, "distinct tags", openedNs.size(), options.dicts - openedNs.size());
+		// One of these not yet seen, if the earlier policies left any.
+		static const char* const kLateTags[] = { "nl_BE", "sv_FI", "fi_FI", "da_DK" };
+		const char* lateTag = nullptr;
+		for (size_t i = 0; i < sizeof(kLateTags) / sizeof(kLateTags[0]) && !lateTag; ++i)
+		{
+			if (find_language_tag(kLateTags[i]) == kNoLanguageTag)
+				lateTag = kLateTags[i];
+		}
+		if (openedNs.size() != options.dicts)
+			fail("distinct dictionaries: " + std::to_string(options.dicts - openedNs.size()) + " tags refused");
+		if (lateTag && !ProviderDict(provider, lateTag).get())
+			fail(std::string("distinct dictionaries: ") + lateTag + " not opened once the tags were all taken");
+		if (openedNs.size() < 8 || !ProviderDict(provider, "en_US").get())
+		{
+			fail("distinct dictionaries: known tags no longer open");
+		}
+		else
+		{
+			// The first and last eighth of those opened.
+			const size_t eighth = openedNs.size() / 8;
+			double distinctNs[2] = {};
+			for (size_t i = 0; i < eighth; ++i)
+			{
+				distinctNs[0] += openedNs[i] / eighth;
+				distinctNs[1] += openedNs[openedNs.size() - eighth + i] / eighth;
+			}
+			report("distinct dictionaries", distinctNs[0], distinctNs[1], distinctNs[1] / distinctNs[0]);
+		}
+		if (refusedNs > options.max_tag_us * 1000)
+			fail("distinct dictionaries: slow to refuse a tag");
+
+		double heldNs[2] = {};
+		for (size_t pass = 0; pass < 2; ++pass)
+			heldNs[pass] = hold_dictionaries(pass ? options.dicts : options.dicts / 8);
+		report("dictionaries held", heldNs[0], heldNs[1], heldNs[1] / heldNs[0]);
+
+		const size_t before = process_memory_bytes();
+		for (size_t round = 0; round < 4; ++round)
+			hold_dictionaries(options.dicts);
+		const size_t after = process_memory_bytes();
+		const size_t grownKb = after > before ? (after - before) / 1024 : 0;
+		printf("%-8s %-26s %9zu KB\n", policies, "dictionary rounds grew", grownKb);
+		if (grownKb > options.max_leak_kb)
+			fail("dictionaries: memory left behind by closed dictionaries");
+	}
+
+	// Time per dictionary to open 'count' and then close them all.
+	double hold_dictionaries(size_t count)
+	{
+		std::vector<EnchantDict*> dicts;
+		dicts.reserve(count);
+		const Clock::time_point start = Clock::now();
+		for (size_t i = 0; i < count; ++i)
+		{
+			EnchantDict* dict = provider->request_dict(provider, "en_US");
+			if (dict)
+				dicts.push_back(dict);
+		}
+		for (EnchantDict* dict : dicts)
+			provider->dispose_dict(provider, dict);
+		const double ns = static_cast<double>(elapsed_ns(start)) / count;
+		if (dicts.size() != count)
+			fail("dictionaries: " + std::to_string(count - dicts.size()) + " not opened");
+		return ns;
+	}
+
+	const char* policies;
+	const AdversarialOptions& options;
+	AdversaryScript& script;
+	EnchantProvider* provider;
+	size_t failures;
+};
+
+struct PolicySet
+{
+	const char* name;
+	EnchantProvider* (*create)(const SpellBackendFactory& create_backend);
+};
+
+// The policies of the plugins CMakeLists.txt builds.
+static const PolicySet kPolicySets[] = {
+	{ "default", windows_provider_create<DefaultProviderPolicies> },
+	{ "ascii", windows_provider_create<AsciiProviderPolicies> },
+	{ "cached", windows_provider_create<CachedProviderPolicies> },
+	{ "full", windows_provider_create<FullProviderPolicies> },
+};
+
+int adversarial_main(int argc, char** argv)
+{
+	AdversarialOptions options;
+	if (!parse_adversarial_options(argc, argv, options))
+	{
+		adversarial_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+	set_environment("ENCHANT_WINDOWS_SUGGEST_MAX", "");
+
+	AdversaryScript script;
+	script.suggestions = make_suggestions(8 * options.suggestions);
+	script.served = 0;
+
+	printf("%-8s %-26s %12s %12s %7s\n", "policies", "case", "small ns", "large ns", "growth");
+	size_t failures = 0;
+	for (const PolicySet& set : kPolicySets)
+	{
+		EnchantProvider* provider = set.create([&]() -> std::unique_ptr<SpellBackend> {
+			return std::make_unique<AdversaryBackend>(script);
+		});
+		if (!provider)
+		{
+			fprintf(stderr, "cannot create the %s provider\n", set.name);
+			return 2;
+		}
+		failures += AdversaryRun(set.name, options, script, provider).run();
+		provider->dispose(provider);
+	}
+	if (failures)
+		return 1;
+	printf("ok\n");
+	return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,964 @@
+// enchant_windows - benchmark harness shared by the provider benchmarks.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "bench_harness.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <intrin.h>
+#include <objbase.h>
+#include <psapi.h>
+#else
+#include <dirent.h>
+#include <dlfcn.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+typedef EnchantProvider* (*InitProviderFn)();
+
+PluginProvider::~PluginProvider()
+{
+	if (provider)
+		provider->dispose(provider);
+#ifdef _WIN32
+	if (module)
+		FreeLibrary(reinterpret_cast<HMODULE>(module));
+#else
+	if (module)
+		dlclose(module);
+#endif
+}
+
+bool PluginProvider::load(const std::string& path, std::string& error)
+{
+	return open(path, error) && create(error);
+}
+
+bool PluginProvider::open(const std::string& path, std::string& error)
+{
+#ifdef _WIN32
+	HMODULE handle = LoadLibraryA(path.c_str());
+	if (!handle)
+	{
+		error = "LoadLibrary failed for " + path;
+		return false;
+	}
+	module = handle;
+#else
+	module = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+	if (!module)
+	{
+		error = dlerror();
+		return false;
+	}
+#endif
+	if (!symbol("init_enchant_provider"))
+	{
+		error = "init_enchant_provider not exported by " + path;
+		return false;
+	}
+	return true;
+}
+
+bool PluginProvider::create(std::string& error)
+{
+	InitProviderFn init = reinterpret_cast<InitProviderFn>(symbol("init_enchant_provider"));
+	if (!init)
+	{
+		error = "no plugin loaded";
+		return false;
+	}
+
+	provider = init();
+	if (!provider)
+	{
+		error = "init_enchant_provider returned null";
+		return false;
+	}
+	return true;
+}
+
+void* PluginProvider::symbol(const char* name) const
+{
+	if (!module)
+		return nullptr;
+#ifdef _WIN32
+	return reinterpret_cast<void*>(GetProcAddress(reinterpret_cast<HMODULE>(module), name));
+#else
+	return dlsym(module, name);
+#endif
+}
+
+static const char kDefaultCorpus[] =
+	"The quick brown fox jumps over the lazy dog. Spelling checkers are used "
+	"every day by people writing letters, reports, chat messages and source "
+	"code comments. A good checker answers quickly while the user is typing, "
+	"offers useful suggestions when a word is wrong, and remembers the words "
+	"that the user has added to a personal dictionary. Performance matters "
+	"because the checker runs after every keystroke, often on long documents "
+	"with thousands of words, and any delay is visible as sluggish typing. "
+	"Languages differ in how words are formed: some join many parts into one "
+	"long compound, others mark meaning with accents or apostrophes. The "
+	"provider should therefore treat every word carefully, convert it between "
+	"encodings without waste, and avoid blocking the application's thread "
+	"for longer than necessary. Measuring these costs regularly, and "
+	"comparing the results against a stored baseline, keeps improvements "
+	"honest and catches regressions before they reach our users.";
+
+const std::string& default_corpus()
+{
+	static const std::string corpus(kDefaultCorpus);
+	return corpus;
+}
+
+std::string filler_word(size_t i)
+{
+	std::string word = "qz";
+	do
+	{
+		word += static_cast<char>('a' + i % 26);
+		i /= 26;
+	} while (i);
+	return word;
+}
+
+bool write_word_list(const std::string& path, const Workload& workload, size_t filler)
+{
+	std::set<std::string> words;
+	for (auto word : workload.correct)
+	{
+		for (auto& c : word)
+			c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+		words.insert(word);
+	}
+
+	std::ofstream out(path, std::ios::binary);
+	if (!out)
+		return false;
+	out << words.size() + filler << "\n";
+	for (const auto& word : words)
+		out << word << "\n";
+	for (size_t i = 0; i < filler; ++i)
+		out << filler_word(i) << "\n";
+	return static_cast<bool>(out);
+}
+
+bool read_file(const std::string& path, std::string& contents)
+{
+	std::ifstream in(path, std::ios::binary);
+	if (!in)
+		return false;
+	std::ostringstream ss;
+	ss << in.rdbuf();
+	contents = ss.str();
+	return true;
+}
+
+void set_environment(const char* name, const std::string& value)
+{
+#ifdef _WIN32
+	_putenv_s(name, value.c_str());
+#else
+	setenv(name, value.c_str(), 1);
+#endif
+}
+
+void make_directory(const std::string& path)
+{
+#ifdef _WIN32
+	_mkdir(path.c_str());
+#else
+	mkdir(path.c_str(), 0755);
+#endif
+}
+
+void remove_directory(const std::string& path)
+{
+#ifdef _WIN32
+	_rmdir(path.c_str());
+#else
+	rmdir(path.c_str());
+#endif
+}
+
+static std::string program;
+
+void set_program_path(const char* path)
+{
+	program = path;
+}
+
+const std::string& program_path()
+{
+	return program;
+}
+
+int run_command(const std::string& command)
+{
+#ifdef _WIN32
+	// cmd.exe strips the outer quotes of a command line that starts with one.
+	return system(("\"" + command + "\"").c_str());
+#else
+	const int status = system(command.c_str());
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#endif
+}
+
+void start_command(const std::string& command)
+{
+#ifdef _WIN32
+	const std::string line = "start \"\" /b " + command;
+#else
+	const std::string line = command + " &";
+#endif
+	if (system(line.c_str()) != 0)
+		fprintf(stderr, "cannot start %s\n", command.c_str());
+}
+
+std::vector<std::string> list_directory(const std::string& dir)
+{
+	std::vector<std::string> names;
+#ifdef _WIN32
+	WIN32_FIND_DATAA data;
+	HANDLE find = FindFirstFileA((dir + "\\*").c_str(), &data);
+	if (find == INVALID_HANDLE_VALUE)
+		return names;
+	do
+	{
+		if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+			names.push_back(data.cFileName);
+	} while (FindNextFileA(find, &data));
+	FindClose(find);
+#else
+	DIR* directory = opendir(dir.c_str());
+	if (!directory)
+		return names;
+	while (dirent* entry = readdir(directory))
+	{
+		if (entry->d_name[0] != '.')
+			names.push_back(entry->d_name);
+	}
+	closedir(directory);
+#endif
+	return names;
+}
+
+size_t process_memory_bytes()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS_EX counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters)))
+		return 0;
+	return counters.PrivateUsage;
+#else
+	// Resident pages, the second field.
+	std::ifstream statm("/proc/self/statm");
+	size_t size = 0;
+	size_t resident = 0;
+	if (!(statm >> size >> resident))
+		return 0;
+	return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+bool wait_readable(intptr_t fd, int timeout_ms)
+{
+	if (fd == -1)
+		return false;
+#ifdef _WIN32
+	return WaitForSingleObject(reinterpret_cast<HANDLE>(fd), static_cast<DWORD>(timeout_ms)) == WAIT_OBJECT_0;
+#else
+	struct pollfd pfd = { static_cast<int>(fd), POLLIN, 0 };
+	return poll(&pfd, 1, timeout_ms) == 1;
+#endif
+}
+
+ThreadPool::ThreadPool(size_t threads) :
+	stopping(false)
+{
+	for (size_t i = 0; i < threads; ++i)
+		this->threads.emplace_back(&ThreadPool::work, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	ready.notify_all();
+	for (auto& thread : threads)
+		thread.join();
+}
+
+void ThreadPool::execute(void (*run)(void* job), void* job, void* pool)
+{
+	ThreadPool* self = static_cast<ThreadPool*>(pool);
+	{
+		std::lock_guard<std::mutex> lock(self->mutex);
+		self->jobs.emplace_back(run, job);
+	}
+	self->ready.notify_one();
+}
+
+void ThreadPool::work()
+{
+#ifdef _WIN32
+	// The provider needs its jobs run in the multithreaded apartment.
+	CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+#endif
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;)
+	{
+		ready.wait(lock, [this]() { return stopping || !jobs.empty(); });
+		if (jobs.empty())
+			break;
+		auto job = jobs.front();
+		jobs.pop_front();
+		lock.unlock();
+		job.first(job.second);
+		lock.lock();
+	}
+#ifdef _WIN32
+	CoUninitialize();
+#endif
+}
+
+static bool is_word_byte(unsigned char c)
+{
+	// Treat all non-ASCII bytes as letters so UTF-8 words stay whole.
+	return c >= 0x80 || std::isalpha(c) || c == '\'';
+}
+
+Workload make_workload(const std::string& text)
+{
+	Workload workload;
+	size_t i = 0;
+	while (i < text.size())
+	{
+		while (i < text.size() && !is_word_byte(static_cast<unsigned char>(text[i])))
+			++i;
+		size_t start = i;
+		while (i < text.size() && is_word_byte(static_cast<unsigned char>(text[i])))
+			++i;
+		if (i > start)
+			workload.correct.push_back(text.substr(start, i - start));
+	}
+
+	for (const auto& word : workload.correct)
+	{
+		std::string wrong = word;
+		// Transpose two ASCII letters in the middle of the word; short words
+		// get a doubled letter instead.
+		if (wrong.size() >= 4 && static_cast<unsigned char>(wrong[1]) < 0x80 && static_cast<unsigned char>(wrong[2]) < 0x80)
+			std::swap(wrong[1], wrong[2]);
+		else
+			wrong.insert(wrong.begin() + wrong.size() / 2, wrong[wrong.size() / 2]);
+		if (wrong == word)
+			wrong += "x";
+		workload.misspelled.push_back(wrong);
+	}
+	return workload;
+}
+
+double percentile(std::vector<double>& values, double pct)
+{
+	if (values.empty())
+		return 0;
+	std::sort(values.begin(), values.end());
+	size_t rank = static_cast<size_t>(std::ceil(pct / 100.0 * values.size()));
+	if (rank == 0)
+		rank = 1;
+	return values[std::min(rank, values.size()) - 1];
+}
+
+double median(std::vector<double> values)
+{
+	return percentile(values, 50);
+}
+
+double CaseResult::median_throughput() const
+{
+	return median(batch_throughput);
+}
+
+double CaseResult::median_batch_p99() const
+{
+	return median(batch_p99_ns);
+}
+
+LatencyRecorder::LatencyRecorder(std::string name)
+{
+	result.name = std::move(name);
+}
+
+void LatencyRecorder::begin_batch()
+{
+	batch.clear();
+	batch_start = Clock::now();
+}
+
+void LatencyRecorder::end_batch()
+{
+	double seconds = elapsed_ns(batch_start) / 1e9;
+	if (batch.empty() || seconds <= 0)
+		return;
+	result.operations += batch.size();
+	result.batch_throughput.push_back(batch.size() / seconds);
+	all.insert(all.end(), batch.begin(), batch.end());
+	result.batch_p99_ns.push_back(percentile(batch, 99));
+}
+
+CaseResult LatencyRecorder::finish()
+{
+	result.p50_ns = percentile(all, 50);
+	result.p90_ns = percentile(all, 90);
+	result.p99_ns = percentile(all, 99);
+	result.max_ns = all.empty() ? 0 : all.back();
+	return result;
+}
+
+CaseResult summarize_latencies(std::string name, const std::vector<double>& ns, size_t batch_size)
+{
+	CaseResult result;
+	result.name = std::move(name);
+	result.operations = ns.size();
+	for (size_t i = 0; batch_size > 0 && i + batch_size <= ns.size(); i += batch_size)
+	{
+		std::vector<double> batch(ns.begin() + i, ns.begin() + i + batch_size);
+		result.batch_p99_ns.push_back(percentile(batch, 99));
+	}
+	std::vector<double> all(ns);
+	result.p50_ns = percentile(all, 50);
+	result.p90_ns = percentile(all, 90);
+	result.p99_ns = percentile(all, 99);
+	result.max_ns = all.empty() ? 0 : all.back();
+	return result;
+}
+
+static std::string cpu_model()
+{
+#ifdef _WIN32
+	int info[4] = {};
+	char brand[49] = {};
+	__cpuid(info, 0x80000000);
+	if (static_cast<unsigned>(info[0]) >= 0x80000004)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			__cpuid(info, 0x80000002 + i);
+			memcpy(brand + i * 16, info, sizeof(info));
+		}
+	}
+	return brand;
+#else
+	std::ifstream in("/proc/cpuinfo");
+	std::string line;
+	while (std::getline(in, line))
+	{
+		if (line.compare(0, 10, "model name") == 0)
+		{
+			size_t colon = line.find(':');
+			if (colon != std::string::npos)
+				return line.substr(line.find_first_not_of(' ', colon + 1));
+		}
+	}
+	return "unknown";
+#endif
+}
+
+std::map<std::string, std::string> environment_metadata()
+{
+	std::map<std::string, std::string> env;
+
+	char timestamp[32] = {};
+	time_t now = time(nullptr);
+	struct tm utc;
+#ifdef _WIN32
+	gmtime_s(&utc, &now);
+#else
+	gmtime_r(&now, &utc);
+#endif
+	strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", &utc);
+	env["timestamp"] = timestamp;
+
+#ifdef _WIN32
+	char host[256] = {};
+	DWORD hostLen = sizeof(host);
+	GetComputerNameA(host, &hostLen);
+	env["host"] = host;
+	OSVERSIONINFOA version = {};
+	version.dwOSVersionInfoSize = sizeof(version);
+#pragma warning(suppress: 4996)
+	GetVersionExA(&version);
+	env["os"] = "Windows " + std::to_string(version.dwMajorVersion) + "." + std::to_string(version.dwMinorVersion) + "." + std::to_string(version.dwBuildNumber);
+#else
+	char host[256] = {};
+	gethostname(host, sizeof(host) - 1);
+	env["host"] = host;
+	struct utsname uts;
+	if (uname(&uts) == 0)
+		env["os"] = std::string(uts.sysname) + " " + uts.release + " " + uts.machine;
+#endif
+
+	env["cpu"] = cpu_model();
+	env["hardware_concurrency"] = std::to_string(std::thread::hardware_concurrency());
+
+#if defined(_MSC_VER)
+	env["compiler"] = "MSVC " + std::to_string(_MSC_FULL_VER);
+#elif defined(__clang__)
+	env["compiler"] = "Clang " __clang_version__;
+#elif defined(__GNUC__)
+	env["compiler"] = "GCC " __VERSION__;
+#endif
+
+#ifdef NDEBUG
+	env["build"] = "release";
+#else
+	env["build"] = "debug";
+#endif
+	return env;
+}
+
+const CaseResult* Report::find(const std::string& name) const
+{
+	for (const auto& c : cases)
+	{
+		if (c.name == name)
+			return &c;
+	}
+	return nullptr;
+}
+
+// JSON output. Only what the report needs: objects, arrays, strings and
+// numbers.
+
+static std::string json_escape(const std::string& s)
+{
+	std::string out;
+	for (char ch : s)
+	{
+		unsigned char c = static_cast<unsigned char>(ch);
+		switch (c)
+		{
+		case '"': out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if (c < 0x20)
+			{
+				char buf[8];
+				snprintf(buf, sizeof(buf), "\\u%04x", c);
+				out += buf;
+			}
+			else
+			{
+				out += ch;
+			}
+		}
+	}
+	return out;
+}
+
+static std::string json_number(double value)
+{
+	char buf[32];
+	snprintf(buf, sizeof(buf), "%.17g", value);
+	return buf;
+}
+
+static std::string json_array(const std::vector<double>& values)
+{
+	std::string out = "[";
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		if (i)
+			out += ", ";
+		out += json_number(values[i]);
+	}
+	return out + "]";
+}
+
+bool write_report(const Report& report, const std::string& path)
+{
+	std::ostringstream out;
+	out << "{\n  \"format\": 1,\n  \"environment\": {";
+	bool first = true;
+	for (const auto& kv : report.environment)
+	{
+		out << (first ? "\n" : ",\n") << "    \"" << json_escape(kv.first) << "\": \"" << json_escape(kv.second) << "\"";
+		first = false;
+	}
+	out << "\n  },\n  \"cases\": [";
+	for (size_t i = 0; i < report.cases.size(); ++i)
+	{
+		const CaseResult& c = report.cases[i];
+		out << (i ? ",\n" : "\n") << "    {\n";
+		out << "      \"name\": \"" << json_escape(c.name) << "\",\n";
+		out << "      \"operations\": " << c.operations << ",\n";
+		out << "      \"throughput_ops\": " << json_number(c.median_throughput()) << ",\n";
+		out << "      \"p50_ns\": " << json_number(c.p50_ns) << ",\n";
+		out << "      \"p90_ns\": " << json_number(c.p90_ns) << ",\n";
+		out << "      \"p99_ns\": " << json_number(c.p99_ns) << ",\n";
+		out << "      \"max_ns\": " << json_number(c.max_ns) << ",\n";
+		out << "      \"extra\": {";
+		bool firstExtra = true;
+		for (const auto& kv : c.extra)
+		{
+			out << (firstExtra ? "" : ", ") << "\"" << json_escape(kv.first) << "\": " << json_number(kv.second);
+			firstExtra = false;
+		}
+		out << "},\n";
+		out << "      \"batch_throughput\": " << json_array(c.batch_throughput) << ",\n";
+		out << "      \"batch_p99_ns\": " << json_array(c.batch_p99_ns) << "\n";
+		out << "    }";
+	}
+	out << "\n  ]\n}\n";
+
+	if (path == "-")
+	{
+		fputs(out.str().c_str(), stdout);
+		return true;
+	}
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file)
+		return false;
+	file << out.str();
+	return static_cast<bool>(file);
+}
+
+// JSON input. A small recursive-descent reader, enough to load reports
+// written by write_report (and hand-edited copies of them).
+
+struct JsonValue
+{
+	enum Type { Null, Bool, Number, String, Array, Object } type;
+	double number;
+	std::string string;
+	std::vector<JsonValue> array;
+	std::vector<std::pair<std::string, JsonValue>> object;
+
+	JsonValue() : type(Null), number(0) {}
+
+	const JsonValue* get(const char* key) const
+	{
+		for (const auto& kv : object)
+		{
+			if (kv.first == key)
+				return &kv.second;
+		}
+		return nullptr;
+	}
+};
+
+class JsonReader
+{
+public:
+	explicit JsonReader(const std::string& text) : text(text), pos(0) {}
+
+	bool parse(JsonValue& value)
+	{
+		return parse_value(value) && (skip_ws(), pos == text.size());
+	}
+
+private:
+	void skip_ws()
+	{
+		while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+			++pos;
+	}
+
+	bool consume(char c)
+	{
+		skip_ws();
+		if (pos < text.size() && text[pos] == c)
+		{
+			++pos;
+			return true;
+		}
+		return false;
+	}
+
+	bool parse_string(std::string& out)
+	{
+		if (!consume('"'))
+			return false;
+		while (pos < text.size() && text[pos] != '"')
+		{
+			char c = text[pos++];
+			if (c == '\\' && pos < text.size())
+			{
+				char e = text[pos++];
+				switch (e)
+				{
+				case 'n': out += '\n'; break;
+				case 'r': out += '\r'; break;
+				case 't': out += '\t'; break;
+				case 'u':
+					// Reports only escape control characters.
+					if (pos + 4 > text.size())
+						return false;
+					out += static_cast<char>(strtol(text.substr(pos, 4).c_str(), nullptr, 16));
+					pos += 4;
+					break;
+				default: out += e; break;
+				}
+			}
+			else
+			{
+				out += c;
+			}
+		}
+		return consume('"');
+	}
+
+	bool parse_value(JsonValue& value)
+	{
+		skip_ws();
+		if (pos >= text.size())
+			return false;
+		char c = text[pos];
+		if (c == '{')
+		{
+			++pos;
+			value.type = JsonValue::Object;
+			if (consume('}'))
+				return true;
+			do
+			{
+				std::pair<std::string, JsonValue> member;
+				if (!parse_string(member.first) || !consume(':') || !parse_value(member.second))
+					return false;
+				value.object.push_back(std::move(member));
+			} while (consume(','));
+			return consume('}');
+		}
+		if (c == '[')
+		{
+			++pos;
+			value.type = JsonValue::Array;
+			if (consume(']'))
+				return true;
+			do
+			{
+				JsonValue element;
+				if (!parse_value(element))
+					return false;
+				value.array.push_back(std::move(element));
+			} while (consume(','));
+			return consume(']');
+		}
+		if (c == '"')
+		{
+			value.type = JsonValue::String;
+			return parse_string(value.string);
+		}
+		if (text.compare(pos, 4, "true") == 0 || text.compare(pos, 5, "false") == 0)
+		{
+			value.type = JsonValue::Bool;
+			value.number = text[pos] == 't' ? 1 : 0;
+			pos += text[pos] == 't' ? 4 : 5;
+			return true;
+		}
+		if (text.compare(pos, 4, "null") == 0)
+		{
+			pos += 4;
+			return true;
+		}
+		const char* begin = text.c_str() + pos;
+		char* end = nullptr;
+		value.type = JsonValue::Number;
+		value.number = strtod(begin, &end);
+		if (end == begin)
+			return false;
+		pos += end - begin;
+		return true;
+	}
+
+	const std::string& text;
+	size_t pos;
+};
+
+static std::vector<double> json_doubles(const JsonValue* value)
+{
+	std::vector<double> out;
+	if (value && value->type == JsonValue::Array)
+	{
+		for (const auto& v : value->array)
+			out.push_back(v.number);
+	}
+	return out;
+}
+
+static double json_double(const JsonValue* value)
+{
+	return value ? value->number : 0;
+}
+
+bool read_report(const std::string& path, Report& report, std::string& error)
+{
+	std::string text;
+	if (!read_file(path, text))
+	{
+		error = "cannot open " + path;
+		return false;
+	}
+
+	JsonValue root;
+	if (!JsonReader(text).parse(root) || root.type != JsonValue::Object)
+	{
+		error = "malformed JSON in " + path;
+		return false;
+	}
+
+	if (const JsonValue* env = root.get("environment"))
+	{
+		for (const auto& kv : env->object)
+			report.environment[kv.first] = kv.second.string;
+	}
+
+	const JsonValue* cases = root.get("cases");
+	if (!cases || cases->type != JsonValue::Array)
+	{
+		error = "no cases in " + path;
+		return false;
+	}
+	for (const auto& c : cases->array)
+	{
+		CaseResult result;
+		if (const JsonValue* name = c.get("name"))
+			result.name = name->string;
+		result.operations = static_cast<uint64_t>(json_double(c.get("operations")));
+		result.p50_ns = json_double(c.get("p50_ns"));
+		result.p90_ns = json_double(c.get("p90_ns"));
+		result.p99_ns = json_double(c.get("p99_ns"));
+		result.max_ns = json_double(c.get("max_ns"));
+		if (const JsonValue* extra = c.get("extra"))
+		{
+			for (const auto& kv : extra->object)
+				result.extra[kv.first] = kv.second.number;
+		}
+		result.batch_throughput = json_doubles(c.get("batch_throughput"));
+		result.batch_p99_ns = json_doubles(c.get("batch_p99_ns"));
+		report.cases.push_back(std::move(result));
+	}
+	return true;
+}
+
+double mann_whitney_less(const std::vector<double>& a, const std::vector<double>& b)
+{
+	const size_t n1 = a.size();
+	const size_t n2 = b.size();
+	if (n1 == 0 || n2 == 0)
+		return 1.0;
+
+	std::vector<std::pair<double, int>> all;
+	all.reserve(n1 + n2);
+	for (double v : a)
+		all.push_back(std::make_pair(v, 0));
+	for (double v : b)
+		all.push_back(std::make_pair(v, 1));
+	std::sort(all.begin(), all.end());
+
+	// Average ranks across ties, and accumulate the tie correction term.
+	const double n = static_cast<double>(n1 + n2);
+	double rankSumA = 0;
+	double tieTerm = 0;
+	for (size_t i = 0; i < all.size();)
+	{
+		size_t j = i;
+		while (j < all.size() && all[j].first == all[i].first)
+			++j;
+		double avgRank = (i + 1 + j) / 2.0;
+		for (size_t k = i; k < j; ++k)
+		{
+			if (all[k].second == 0)
+				rankSumA += avgRank;
+		}
+		double t = static_cast<double>(j - i);
+		tieTerm += t * t * t - t;
+		i = j;
+	}
+
+	const double u = rankSumA - n1 * (n1 + 1) / 2.0;
+	const double mean = n1 * n2 / 2.0;
+	const double variance = n1 * n2 / 12.0 * ((n + 1) - tieTerm / (n * (n - 1)));
+	if (variance <= 0)
+		return 1.0;
+
+	// Small U means 'a' ranks low. Continuity-corrected normal approximation.
+	const double z = (u - mean + 0.5) / std::sqrt(variance);
+	return 0.5 * std::erfc(-z / std::sqrt(2.0));
+}
+
+int compare_reports(const Report& baseline, const Report& current, const GateThresholds& thresholds)
+{
+	int regressions = 0;
+	for (const auto& cur : current.cases)
+	{
+		const CaseResult* base = baseline.find(cur.name);
+		if (!base)
+		{
+			printf("%-24s new case, no baseline\n", cur.name.c_str());
+			continue;
+		}
+
+		const double baseTput = base->median_throughput();
+		const double curTput = cur.median_throughput();
+		const double tputChange = baseTput > 0 ? (curTput - baseTput) / baseTput : 0;
+		const double tputP = mann_whitney_less(cur.batch_throughput, base->batch_throughput);
+		const bool tputRegressed = tputChange < -thresholds.max_throughput_regression && tputP < thresholds.alpha;
+
+		const double baseP99 = base->median_batch_p99();
+		const double curP99 = cur.median_batch_p99();
+		const double p99Change = baseP99 > 0 ? (curP99 - baseP99) / baseP99 : 0;
+		const double p99P = mann_whitney_less(base->batch_p99_ns, cur.batch_p99_ns);
+		const bool p99Regressed = p99Change > thresholds.max_p99_regression && p99P < thresholds.alpha;
+
+		printf("%-24s throughput %+7.2f%% (p=%.4f)%s  p99 %+7.2f%% (p=%.4f)%s\n",
+			cur.name.c_str(),
+			tputChange * 100, tputP, tputRegressed ? " REGRESSION" : "",
+			p99Change * 100, p99P, p99Regressed ? " REGRESSION" : "");
+
+		if (tputRegressed || p99Regressed)
+			++regressions;
+	}
+	return regressions;
+}
+
+} // namespace bench
@@ -0,0 +1,291 @@
+// enchant_windows - benchmark harness shared by the provider benchmarks.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_BENCH_HARNESS_H
+#define ENCHANT_WINDOWS_BENCH_HARNESS_H
+
+#include "enchant-provider.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bench {
+
+typedef std::chrono::steady_clock Clock;
+
+// Nanoseconds elapsed since 'start'.
+inline uint64_t elapsed_ns(Clock::time_point start)
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+// Store 'value' where the optimizer can't see it read, so the call that
+// made it isn't left out, without the timing depending on what it is.
+template<typename T>
+inline void do_not_optimize(const T& value)
+{
+	volatile T sink = value;
+	(void)sink;
+}
+
+// A provider plugin loaded the same way Enchant loads it: by finding
+// init_enchant_provider in the module and calling it.
+class PluginProvider
+{
+public:
+	PluginProvider() : module(nullptr), provider(nullptr) {}
+	~PluginProvider();
+
+	PluginProvider(const PluginProvider&) = delete;
+	PluginProvider& operator=(const PluginProvider&) = delete;
+
+	// Load the module at 'path' and create a provider. On failure returns
+	// false and fills in 'error'.
+	bool load(const std::string& path, std::string& error);
+
+	// The two halves of load, for setting the plugin up in between.
+	bool open(const std::string& path, std::string& error);
+	bool create(std::string& error);
+
+	EnchantProvider* get() const { return provider; }
+
+	// Look up an extension function exported by the plugin, or null.
+	void* symbol(const char* name) const;
+
+private:
+	void* module;
+	EnchantProvider* provider;
+};
+
+// An EnchantDict requested from a provider, disposed through the same
+// provider when it goes out of scope.
+class ProviderDict
+{
+public:
+	ProviderDict(EnchantProvider* provider, const char* tag) :
+		provider(provider),
+		dict(provider->request_dict(provider, tag))
+	{}
+	~ProviderDict()
+	{
+		if (dict)
+			provider->dispose_dict(provider, dict);
+	}
+
+	ProviderDict(const ProviderDict&) = delete;
+	ProviderDict& operator=(const ProviderDict&) = delete;
+
+	EnchantDict* get() const { return dict; }
+
+	int check(const std::string& word) const
+	{
+		return dict->check(dict, word.c_str(), word.size());
+	}
+
+	// Call suggest and hand the list straight back to the provider. Returns
+	// the number of suggestions.
+	size_t suggest(const std::string& word) const
+	{
+		size_t count = 0;
+		char** list = dict->suggest(dict, word.c_str(), word.size(), &count);
+		if (list)
+			provider->free_string_list(provider, list);
+		return list ? count : 0;
+	}
+
+private:
+	EnchantProvider* provider;
+	EnchantDict* dict;
+};
+
+// Words used to drive the provider.
+struct Workload
+{
+	std::vector<std::string> correct;
+	std::vector<std::string> misspelled;
+};
+
+// Split 'text' into words (runs of letters and apostrophes) and derive a
+// deterministic misspelling for each by transposing two inner letters.
+Workload make_workload(const std::string& text);
+
+// A word no corpus has: "qz" and 'i' in base 26.
+std::string filler_word(size_t i);
+
+// Write the corpus words, lowercased, and 'filler' filler words as a word
+// list at 'path', for the word list backend to load.
+bool write_word_list(const std::string& path, const Workload& workload, size_t filler);
+
+// A built-in English paragraph used when no corpus is given.
+const std::string& default_corpus();
+
+// Read a whole file. Returns false if it cannot be opened.
+bool read_file(const std::string& path, std::string& contents);
+
+// Set an environment variable for this process and the plugin.
+void set_environment(const char* name, const std::string& value);
+
+// Create a directory if it doesn't exist.
+void make_directory(const std::string& path);
+
+// Remove a directory if it is empty.
+void remove_directory(const std::string& path);
+
+// The benchmark executable, as main was started with, for running it again
+// in a child process.
+void set_program_path(const char* path);
+const std::string& program_path();
+
+// Run 'command' through the shell and return its exit status.
+int run_command(const std::string& command);
+
+// Start 'command' through the shell without waiting for it.
+void start_command(const std::string& command);
+
+// The names of the files in 'dir', or none if it can't be read.
+std::vector<std::string> list_directory(const std::string& dir);
+
+// Bytes of memory the process holds: private bytes on Windows, resident
+// bytes elsewhere. 0 if it can't be told.
+size_t process_memory_bytes();
+
+// Wait up to 'timeout_ms' for what enchant_windows_completion_fd returned to
+// become ready. Returns false on timeout or error.
+bool wait_readable(intptr_t fd, int timeout_ms);
+
+// A pool of threads standing in for an application's executor, to hand to
+// enchant_windows_set_executor along with the pool.
+class ThreadPool
+{
+public:
+	explicit ThreadPool(size_t threads);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	static void execute(void (*run)(void* job), void* job, void* pool);
+
+private:
+	void work();
+
+	std::mutex mutex;
+	std::condition_variable ready;
+	std::deque<std::pair<void (*)(void*), void*>> jobs;
+	bool stopping;
+	std::vector<std::thread> threads;
+};
+
+// Latency summary of one run of a benchmark case. Each batch contributes one
+// throughput sample and one p99 sample so that runs can be compared with a
+// rank test rather than a single number.
+struct CaseResult
+{
+	std::string name;
+	uint64_t operations;
+	std::vector<double> batch_throughput;  // operations per second
+	std::vector<double> batch_p99_ns;
+	double p50_ns;
+	double p90_ns;
+	double p99_ns;
+	double max_ns;
+	std::map<std::string, double> extra;
+
+	CaseResult() : operations(0), p50_ns(0), p90_ns(0), p99_ns(0), max_ns(0) {}
+
+	double median_throughput() const;
+	double median_batch_p99() const;
+};
+
+// Percentile (0..100) of 'values' by nearest rank. 'values' is sorted in place.
+double percentile(std::vector<double>& values, double pct);
+double median(std::vector<double> values);
+
+// Collects per-call latencies batch by batch and summarises them.
+class LatencyRecorder
+{
+public:
+	explicit LatencyRecorder(std::string name);
+
+	void begin_batch();
+	void record(uint64_t ns) { batch.push_back(static_cast<double>(ns)); }
+	void end_batch();
+
+	CaseResult finish();
+
+private:
+	CaseResult result;
+	std::vector<double> all;
+	std::vector<double> batch;
+	Clock::time_point batch_start;
+};
+
+// Summarise latencies recorded outside a LatencyRecorder, e.g. merged from
+// several threads. Every 'batch_size' consecutive samples contribute one
+// batch p99 sample; no throughput samples are produced.
+CaseResult summarize_latencies(std::string name, const std::vector<double>& ns, size_t batch_size);
+
+// Host, build and run metadata written alongside results.
+std::map<std::string, std::string> environment_metadata();
+
+// A full benchmark report.
+struct Report
+{
+	std::map<std::string, std::string> environment;
+	std::vector<CaseResult> cases;
+
+	const CaseResult* find(const std::string& name) const;
+};
+
+bool write_report(const Report& report, const std::string& path);
+bool read_report(const std::string& path, Report& report, std::string& error);
+
+// Two-sample Mann-Whitney U test. Returns the one-sided p-value for the
+// hypothesis that values in 'a' tend to be smaller than those in 'b', using
+// the normal approximation with tie correction.
+double mann_whitney_less(const std::vector<double>& a, const std::vector<double>& b);
+
+struct GateThresholds
+{
+	double max_throughput_regression;  // fraction, e.g. 0.05
+	double max_p99_regression;         // fraction, e.g. 0.10
+	double alpha;                      // significance level
+
+	GateThresholds() :
+		max_throughput_regression(0.05),
+		max_p99_regression(0.10),
+		alpha(0.01)
+	{}
+};
+
+// Compare 'current' against 'baseline'. A case regresses only if the median
+// moved past the threshold and the shift is significant at 'alpha'. Prints
+// a line per case and returns the number of regressions.
+int compare_reports(const Report& baseline, const Report& current, const GateThresholds& thresholds);
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,505 @@
+// enchant_windows - benchmark runner and regression gate.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Drives a provider plugin through its EnchantDict function table, writes
+// the results as JSON and optionally compares them against a stored baseline.
+//
+//   enchant_windows_bench --plugin libenchant_windows.dll --out run.json
+//   enchant_windows_bench --plugin ... --baseline baseline.json
+//   enchant_windows_bench typing --plugin ...   (see typing_load.cpp)
+//   enchant_windows_bench memory --plugin ...   (see memory_check.cpp)
+//   enchant_windows_bench train --plugin ...    (see pgo_training.cpp)
+//   enchant_windows_bench langid                (see langid_check.cpp)
+//   enchant_windows_bench reload --plugin ...   (see reload_check.cpp)
+//   enchant_windows_bench load --plugin ...     (see load_check.cpp)
+//   enchant_windows_bench journal --plugin ...  (see journal_check.cpp)
+//   enchant_windows_bench watchdog              (see watchdog_check.cpp)
+//   enchant_windows_bench canonical             (see canonical_check.cpp)
+//   enchant_windows_bench case                  (see case_check.cpp)
+//   enchant_windows_bench tags                  (see tags_check.cpp)
+//   enchant_windows_bench suggest               (see suggest_check.cpp)
+//   enchant_windows_bench complete              (see complete_check.cpp)
+//   enchant_windows_bench typos                 (see typos_check.cpp)
+//   enchant_windows_bench scripts               (see scripts_check.cpp)
+//   enchant_windows_bench context               (see context_check.cpp)
+//   enchant_windows_bench adversarial           (see adversarial_check.cpp)
+//   enchant_windows_bench slow                  (see slow_check.cpp)
+//   enchant_windows_bench policies              (see policies_check.cpp)
+//
+// Exit status is 0 on success, 1 if the gate found a regression and 2 on
+// usage or setup errors.
+
+#include "adversarial_check.h"
+#include "bench_harness.h"
+#include "canonical_check.h"
+#include "case_check.h"
+#include "complete_check.h"
+#include "context_check.h"
+#include "enchant-windows.h"
+#include "enchant-windows.hpp"
+#include "journal_check.h"
+#include "langid_check.h"
+#include "load_check.h"
+#include "memory_check.h"
+#include "perf_counters.h"
+#include "pgo_training.h"
+#include "policies_check.h"
+#include "reload_check.h"
+#include "scripts_check.h"
+#include "slow_check.h"
+#include "typing_load.h"
+#include "typos_check.h"
+#include "suggest_check.h"
+#include "tags_check.h"
+#include "watchdog_check.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace bench;
+
+struct Options
+{
+	std::string plugin;
+	std::string tag;
+	std::string corpus;
+	std::string out;
+	std::string baseline;
+	std::vector<std::string> cases;
+	size_t batches;
+	size_t batch_size;
+	size_t warmup;
+	size_t host_threads;
+	bool perf;
+	bool embed;
+	bool async;
+	GateThresholds thresholds;
+
+	Options() : tag("en_US"), batches(30), batch_size(200), warmup(200), host_threads(0), perf(true), embed(false), async(false) {}
+};
+
+static void usage()
+{
+	fputs(
+		"usage: enchant_windows_bench --plugin PATH [options]\n"
+		"       enchant_windows_bench typing --help\n"
+		"       enchant_windows_bench memory --help\n"
+		"       enchant_windows_bench train --help\n"
+		"       enchant_windows_bench langid --help\n"
+		"       enchant_windows_bench reload --help\n"
+		"       enchant_windows_bench load --help\n"
+		"       enchant_windows_bench journal --help\n"
+		"       enchant_windows_bench watchdog --help\n"
+		"       enchant_windows_bench canonical --help\n"
+		"       enchant_windows_bench case --help\n"
+		"       enchant_windows_bench tags --help\n"
+		"       enchant_windows_bench suggest --help\n"
+		"       enchant_windows_bench complete --help\n"
+		"       enchant_windows_bench typos --help\n"
+		"       enchant_windows_bench scripts --help\n"
+		"       enchant_windows_bench context --help\n"
+		"       enchant_windows_bench adversarial --help\n"
+		"       enchant_windows_bench slow --help\n"
+		"       enchant_windows_bench policies --help\n"
+		"  --tag TAG                  dictionary to request (default en_US)\n"
+		"  --corpus FILE              UTF-8 text to take words from\n"
+		"  --case NAME                run only this case (repeatable)\n"
+		"  --batches N                samples per case (default 30)\n"
+		"  --batch-size N             calls per sample (default 200)\n"
+		"  --warmup N                 untimed calls before each case (default 200)\n"
+		"  --out FILE                 write JSON results ('-' for stdout)\n"
+		"  --baseline FILE            compare against a previous --out file\n"
+		"  --max-throughput-regression F   allowed fractional drop (default 0.05)\n"
+		"  --max-p99-regression F          allowed fractional rise (default 0.10)\n"
+		"  --alpha F                  significance level (default 0.01)\n"
+		"  --no-perf                  do not read hardware performance counters\n"
+		"  --embed                    also run the embed_* cases through the C++ API\n"
+		"  --async                    also run the async_* cases through enchant_windows_dict_check_async\n"
+		"  --host-executor N          run the provider's work on a pool of N threads of ours\n",
+		stderr);
+}
+
+static bool parse_options(int argc, char** argv, Options& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		auto value = [&]() -> const char* {
+			return (i + 1 < argc) ? argv[++i] : nullptr;
+		};
+		const char* v = nullptr;
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (arg == "--no-perf")
+		{
+			options.perf = false;
+			continue;
+		}
+		if (arg == "--embed")
+		{
+			options.embed = true;
+			continue;
+		}
+		if (arg == "--async")
+		{
+			options.async = true;
+			continue;
+		}
+		if (!(v = value()))
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		if (arg == "--plugin") options.plugin = v;
+		else if (arg == "--tag") options.tag = v;
+		else if (arg == "--corpus") options.corpus = v;
+		else if (arg == "--case") options.cases.push_back(v);
+		else if (arg == "--batches") options.batches = strtoul(v, nullptr, 10);
+		else if (arg == "--batch-size") options.batch_size = strtoul(v, nullptr, 10);
+		else if (arg == "--warmup") options.warmup = strtoul(v, nullptr, 10);
+		else if (arg == "--host-executor") options.host_threads = strtoul(v, nullptr, 10);
+		else if (arg == "--out") options.out = v;
+		else if (arg == "--baseline") options.baseline = v;
+		else if (arg == "--max-throughput-regression") options.thresholds.max_throughput_regression = atof(v);
+		else if (arg == "--max-p99-regression") options.thresholds.max_p99_regression = atof(v);
+		else if (arg == "--alpha") options.thresholds.alpha = atof(v);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return !options.plugin.empty() && options.batches > 0 && options.batch_size > 0;
+}
+
+// One benchmark case: a name and an operation on the i'th input.
+struct BenchCase
+{
+	const char* name;
+	std::function<void(size_t)> op;
+};
+
+static CaseResult run_case(const BenchCase& bc, const Options& options, PerfCounters& counters)
+{
+	for (size_t i = 0; i < options.warmup; ++i)
+		bc.op(i);
+
+	LatencyRecorder recorder(bc.name);
+	counters.start();
+	size_t index = 0;
+	for (size_t b = 0; b < options.batches; ++b)
+	{
+		recorder.begin_batch();
+		for (size_t i = 0; i < options.batch_size; ++i, ++index)
+		{
+			Clock::time_point start = Clock::now();
+			bc.op(index);
+			recorder.record(elapsed_ns(start));
+		}
+		recorder.end_batch();
+	}
+	PerfCounters::Sample sample = counters.stop();
+
+	CaseResult result = recorder.finish();
+	PerfCounters::annotate(result, sample, result.operations);
+	fprintf(stderr, "%-24s %12.0f ops/s  p50 %9.0f ns  p99 %9.0f ns%s\n",
+		result.name.c_str(), result.median_throughput(), result.p50_ns, result.p99_ns,
+		PerfCounters::describe(sample, result.operations).c_str());
+	return result;
+}
+
+static bool selected(const Options& options, const char* name)
+{
+	if (options.cases.empty())
+		return true;
+	for (const auto& c : options.cases)
+	{
+		if (c == name)
+			return true;
+	}
+	return false;
+}
+
+int main(int argc, char** argv)
+{
+	set_program_path(argv[0]);
+	if (argc > 1 && strcmp(argv[1], "typing") == 0)
+		return typing_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "memory") == 0)
+		return memory_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "train") == 0)
+		return train_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "langid") == 0)
+		return langid_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "reload") == 0)
+		return reload_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "load") == 0)
+		return load_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "journal") == 0)
+		return journal_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "watchdog") == 0)
+		return watchdog_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "canonical") == 0)
+		return canonical_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "case") == 0)
+		return case_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "tags") == 0)
+		return tags_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "suggest") == 0)
+		return suggest_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "complete") == 0)
+		return complete_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "typos") == 0)
+		return typos_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "scripts") == 0)
+		return scripts_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "context") == 0)
+		return context_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "adversarial") == 0)
+		return adversarial_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "slow") == 0)
+		return slow_main(argc - 1, argv + 1);
+	if (argc > 1 && strcmp(argv[1], "policies") == 0)
+		return policies_main(argc - 1, argv + 1);
+
+	Options options;
+	if (!parse_options(argc, argv, options))
+	{
+		usage();
+		return 2;
+	}
+
+	std::string text = default_corpus();
+	if (!options.corpus.empty() && !read_file(options.corpus, text))
+	{
+		fprintf(stderr, "cannot read corpus %s\n", options.corpus.c_str());
+		return 2;
+	}
+	Workload workload = make_workload(text);
+	if (workload.correct.empty())
+	{
+		fprintf(stderr, "corpus contains no words\n");
+		return 2;
+	}
+
+	// Counters must be opened before the plugin creates its worker thread,
+	// so that thread inherits them.
+	PerfCounters counters;
+	if (options.perf && !counters.open())
+		fprintf(stderr, "performance counters unavailable; reporting latency only\n");
+
+	// Outlives the plugin, which runs its work here until disposed.
+	std::unique_ptr<ThreadPool> pool;
+	PluginProvider plugin;
+	std::string error;
+	if (!plugin.open(options.plugin, error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 2;
+	}
+	if (options.host_threads > 0)
+	{
+		auto setExecutor = reinterpret_cast<enchant_windows_set_executor_fn>(plugin.symbol("enchant_windows_set_executor"));
+		if (!setExecutor)
+		{
+			fprintf(stderr, "%s does not export enchant_windows_set_executor\n", options.plugin.c_str());
+			return 2;
+		}
+		pool = std::make_unique<ThreadPool>(options.host_threads);
+		setExecutor(&ThreadPool::execute, pool.get());
+	}
+	if (!plugin.create(error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 2;
+	}
+
+	Report report;
+	report.environment = environment_metadata();
+	report.environment["plugin"] = options.plugin;
+	report.environment["provider"] = plugin.get()->identify(plugin.get());
+	report.environment["tag"] = options.tag;
+	report.environment["corpus"] = options.corpus.empty() ? "built-in" : options.corpus;
+	report.environment["host_executor_threads"] = std::to_string(options.host_threads);
+	{
+		ProviderDict dict(plugin.get(), options.tag.c_str());
+		if (!dict.get())
+		{
+			fprintf(stderr, "provider has no dictionary for %s\n", options.tag.c_str());
+			return 2;
+		}
+
+		const auto& correct = workload.correct;
+		const auto& misspelled = workload.misspelled;
+
+		// A long word made of corpus words, to weight the cost of converting
+		// the text over the cost of getting it to the backend.
+		std::string longWord;
+		for (size_t i = 0; longWord.size() < 120 && i < correct.size(); ++i)
+			longWord += correct[i];
+
+		const BenchCase cases[] = {
+			{ "check_correct", [&](size_t i) { dict.check(correct[i % correct.size()]); } },
+			{ "check_misspelled", [&](size_t i) { dict.check(misspelled[i % misspelled.size()]); } },
+			// The same word over and over: the path a result cache serves.
+			{ "check_repeated", [&](size_t) { dict.check(correct[0]); } },
+			{ "check_long_word", [&](size_t) { dict.check(longWord); } },
+			{ "suggest", [&](size_t i) { dict.suggest(misspelled[i % misspelled.size()]); } },
+		};
+
+		for (const auto& bc : cases)
+		{
+			if (selected(options, bc.name))
+				report.cases.push_back(run_case(bc, options, counters));
+		}
+
+		// A paragraph's worth of words queued at once, then collected the
+		// way an event loop would: wait for the fd, then poll.
+		if (options.async)
+		{
+			auto checkAsync = reinterpret_cast<enchant_windows_dict_check_async_fn>(plugin.symbol("enchant_windows_dict_check_async"));
+			auto completionFd = reinterpret_cast<enchant_windows_completion_fd_fn>(plugin.symbol("enchant_windows_completion_fd"));
+			auto pollCompletions = reinterpret_cast<enchant_windows_poll_completions_fn>(plugin.symbol("enchant_windows_poll_completions"));
+			if (!checkAsync || !completionFd || !pollCompletions)
+			{
+				fprintf(stderr, "%s does not export the asynchronous check functions\n", options.plugin.c_str());
+				return 2;
+			}
+			const intptr_t fd = completionFd();
+
+			static const size_t kBatchWords = 16;
+			EnchantWindowsCompletion completions[kBatchWords];
+			bool lost = false;
+			auto checkBatch = [&](size_t i, bool async) {
+				const size_t start = i * kBatchWords;
+				if (!async)
+				{
+					for (size_t w = 0; w < kBatchWords; ++w)
+						dict.check(correct[(start + w) % correct.size()]);
+					return;
+				}
+				for (size_t w = 0; w < kBatchWords; ++w)
+				{
+					const std::string& word = correct[(start + w) % correct.size()];
+					checkAsync(dict.get(), word.c_str(), word.size(), nullptr);
+				}
+				size_t received = 0;
+				while (received < kBatchWords)
+				{
+					if (!wait_readable(fd, 5000))
+					{
+						lost = true;
+						return;
+					}
+					received += pollCompletions(completions, kBatchWords);
+				}
+			};
+
+			const BenchCase asyncCases[] = {
+				{ "sync_check_batch16", [&](size_t i) { checkBatch(i, false); } },
+				{ "async_check_batch16", [&](size_t i) { checkBatch(i, true); } },
+			};
+			for (const auto& bc : asyncCases)
+			{
+				if (!selected(options, bc.name))
+					continue;
+				CaseResult result = run_case(bc, options, counters);
+				result.extra["words_per_second"] = result.median_throughput() * kBatchWords;
+				report.cases.push_back(result);
+			}
+			if (lost)
+			{
+				fprintf(stderr, "asynchronous checks did not all complete\n");
+				return 1;
+			}
+		}
+	}
+
+	// The same work through enchant-windows.hpp, linked in rather than
+	// loaded, with the backend the plugin would pick.
+	if (options.embed)
+	{
+		auto provider = enchant_windows::Provider::create();
+		auto dict = provider ? provider->request_dict(options.tag) : nullptr;
+		if (!dict)
+		{
+			fprintf(stderr, "embedding API has no dictionary for %s\n", options.tag.c_str());
+			return 2;
+		}
+
+		std::vector<std::string_view> correct(workload.correct.begin(), workload.correct.end());
+		std::vector<std::string_view> misspelled(workload.misspelled.begin(), workload.misspelled.end());
+
+		// Batches of words from the corpus, as a server checking a
+		// paragraph at a time would send them.
+		static const size_t kBatchWords = 16;
+		std::vector<std::string_view> batchWords;
+		for (size_t i = 0; batchWords.size() < correct.size() + kBatchWords; ++i)
+			batchWords.push_back(correct[i % correct.size()]);
+		std::vector<int> batchResults(kBatchWords);
+
+		enchant_windows::Suggestions suggestions;
+		const BenchCase cases[] = {
+			{ "embed_check_correct", [&](size_t i) { dict->check(correct[i % correct.size()]); } },
+			{ "embed_check_misspelled", [&](size_t i) { dict->check(misspelled[i % misspelled.size()]); } },
+			{ "embed_check_batch16", [&](size_t i) {
+				const size_t start = (i * kBatchWords) % correct.size();
+				dict->check(enchant_windows::Span<const std::string_view>(&batchWords[start], kBatchWords), batchResults);
+			} },
+			{ "embed_suggest", [&](size_t i) { dict->suggest(misspelled[i % misspelled.size()], suggestions); } },
+		};
+
+		for (const auto& bc : cases)
+		{
+			if (!selected(options, bc.name))
+				continue;
+			CaseResult result = run_case(bc, options, counters);
+			if (strcmp(bc.name, "embed_check_batch16") == 0)
+				result.extra["words_per_second"] = result.median_throughput() * kBatchWords;
+			report.cases.push_back(result);
+		}
+	}
+
+	if (!options.out.empty() && !write_report(report, options.out))
+	{
+		fprintf(stderr, "cannot write %s\n", options.out.c_str());
+		return 2;
+	}
+
+	if (!options.baseline.empty())
+	{
+		Report baseline;
+		if (!read_report(options.baseline, baseline, error))
+		{
+			fprintf(stderr, "%s\n", error.c_str());
+			return 2;
+		}
+		int regressions = compare_reports(baseline, report, options.thresholds);
+		if (regressions > 0)
+		{
+			fprintf(stderr, "%d case(s) regressed against %s\n", regressions, options.baseline.c_str());
+			return 1;
+		}
+	}
+
+	return 0;
+}
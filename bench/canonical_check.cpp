@@ -0,0 +1,376 @@
+// enchant_windows - cache hit rate with and without canonical words.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Runs two providers in this process on a stand-in backend that knows the
+// words of data/langid/train: one caching verdicts for words as typed, one
+// caching them for canonical words (normalize.h). Both check the same
+// stream, the sentences of data/langid/test and data/langid/train over and
+// over, in which some words are retyped the way other input methods and
+// editors produce them: decomposed (NFD), with typographic apostrophes.
+// Reports each provider's cache hit rate, overall and on the words that have
+// such variants, what canonicalization costs per word, and how many
+// variants the first provider calls misspelled that aren't.
+//
+// Fails if canonical keys don't raise the hit rate on words with variants,
+// if any variant gets a different verdict from the word as first written,
+// or if NFC(NFD(word)) isn't the word for every word in the text.
+//
+//   enchant_windows_bench canonical [--data data/langid] [--variants 0.5] [--passes 20]
+
+#include "canonical_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+#include "normalize.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "windows_provider.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+
+namespace bench {
+
+static const char* const kCanonicalLanguages[] = { "de", "en", "es", "fr", "it", "nl", "pt", "sv" };
+
+struct CanonicalOptions
+{
+	std::string data;
+	double variants;
+	size_t passes;
+
+	CanonicalOptions() : data("data/langid"), variants(0.5), passes(20) {}
+};
+
+// Knows a fixed set of words, for any language.
+class VocabularyBackend : public SpellBackend
+{
+public:
+	explicit VocabularyBackend(const std::set<std::u16string>& words) : words(words) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t*) override { return 1; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t*) override
+	{
+		return std::make_unique<Checker>(words);
+	}
+
+private:
+	class Checker : public SpellChecker
+	{
+	public:
+		explicit Checker(const std::set<std::u16string>& words) : words(words) {}
+
+		int check(const char16_t* word) override { return words.count(word) ? 0 : 1; }
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override { return nullptr; }
+		bool add(const char16_t* word) override { words.insert(word); return true; }
+		bool ignore(const char16_t* word) override { words.insert(word); return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		std::set<std::u16string> words;
+	};
+
+	const std::set<std::u16string>& words;
+};
+
+// Verdicts cached for words as typed, and for canonical words, in caches
+// big enough for most of the text, so that what is measured is the keys.
+typedef ProviderPolicies<WorkerDispatch, VerdictCache<4096>, Utf8Conversion, CallCounters> AsTypedPolicies;
+typedef ProviderPolicies<WorkerDispatch, VerdictCache<4096>, Utf8Conversion, CallCounters, NfcCanonicalization> CanonicalPolicies;
+
+// A word in the stream: as first written, and as it is typed this time.
+struct StreamWord
+{
+	std::string written;
+	std::string typed;
+	bool has_variant;
+};
+
+static void canonical_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench canonical [options]\n"
+		"  --data DIR           train/ and test/ samples, <lang>.txt per language (default data/langid)\n"
+		"  --variants F         fraction of words with a variant that are retyped (default 0.5)\n"
+		"  --passes N           times the stream is checked (default 20)\n",
+		stderr);
+}
+
+static bool parse_canonical_options(int argc, char** argv, CanonicalOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--data") options.data = v;
+		else if (arg == "--variants") options.variants = atof(v);
+		else if (arg == "--passes") options.passes = strtoul(v, nullptr, 10);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.passes > 0 && options.variants >= 0 && options.variants <= 1;
+}
+
+// The words of a file of text. ASCII other than letters and apostrophes
+// separates words, as does Latin-1 punctuation (U+0080 to U+00BF, such as
+// an inverted question mark).
+static void split_words(const std::string& text, std::vector<std::string>& out)
+{
+	std::string word;
+	auto flush = [&]() {
+		while (!word.empty() && word.front() == '\'')
+			word.erase(word.begin());
+		while (!word.empty() && word.back() == '\'')
+			word.pop_back();
+		if (!word.empty())
+			out.push_back(word);
+		word.clear();
+	};
+
+	for (size_t i = 0; i < text.size(); ++i)
+	{
+		const unsigned char c = static_cast<unsigned char>(text[i]);
+		if (c == 0xC2 && i + 1 < text.size() && static_cast<unsigned char>(text[i + 1]) < 0xC0)
+		{
+			flush();
+			++i;
+		}
+		else if (c >= 0x80 || c == '\'' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+			word.push_back(text[i]);
+		else
+			flush();
+	}
+	flush();
+}
+
+static bool load_words(const std::string& dir, std::vector<std::string>& out)
+{
+	bool any = false;
+	for (const char* language : kCanonicalLanguages)
+	{
+		std::string contents;
+		if (!read_file(dir + "/" + language + ".txt", contents))
+			continue;
+		split_words(contents, out);
+		any = true;
+	}
+	return any;
+}
+
+// The word as another editor might have produced it: decomposed, with
+// typographic apostrophes. The same as the word if it has nothing to vary.
+static std::string variant_of(const std::string& word)
+{
+	std::string nfd;
+	to_nfd(word.data(), word.size(), nfd);
+	std::string variant;
+	for (char c : nfd)
+	{
+		if (c == '\'')
+			variant += "\xE2\x80\x99";
+		else
+			variant.push_back(c);
+	}
+	return variant;
+}
+
+static std::u16string to_u16(const std::string& word)
+{
+	std::u16string out(utf8_to_utf16(word.data(), word.size(), nullptr), u'\0');
+	utf8_to_utf16(word.data(), word.size(), &out[0]);
+	return out;
+}
+
+static double hit_rate(EnchantDict* dict)
+{
+	EnchantWindowsDictStats stats;
+	if (enchant_windows_dict_stats(dict, &stats) != 0 || stats.counts[ENCHANT_WINDOWS_STAT_CHECK] == 0)
+		return 0;
+	return static_cast<double>(stats.counts[ENCHANT_WINDOWS_STAT_CACHE_HIT]) / stats.counts[ENCHANT_WINDOWS_STAT_CHECK];
+}
+
+static unsigned long long cache_hits(EnchantDict* dict)
+{
+	EnchantWindowsDictStats stats;
+	if (enchant_windows_dict_stats(dict, &stats) != 0)
+		return 0;
+	return stats.counts[ENCHANT_WINDOWS_STAT_CACHE_HIT];
+}
+
+int canonical_main(int argc, char** argv)
+{
+	CanonicalOptions options;
+	if (!parse_canonical_options(argc, argv, options))
+	{
+		canonical_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+	// The stand-in backend knows words only as listed, so the cache mustn't
+	// answer for other capitalizations.
+	set_environment("ENCHANT_WINDOWS_CASE_REUSE", "0");
+
+	std::vector<std::string> vocabulary;
+	std::vector<std::string> text;
+	if (!load_words(options.data + "/train", vocabulary) || !load_words(options.data + "/test", text))
+	{
+		fprintf(stderr, "no samples in %s/train and %s/test\n", options.data.c_str(), options.data.c_str());
+		return 2;
+	}
+	text.insert(text.end(), vocabulary.begin(), vocabulary.end());
+
+	int failures = 0;
+	size_t roundTripFailures = 0;
+	for (const std::string& word : text)
+	{
+		std::string nfd;
+		std::string nfc;
+		to_nfd(word.data(), word.size(), nfd);
+		canonicalize(nfd.data(), nfd.size(), nfc);
+		if (nfc != word)
+			++roundTripFailures;
+	}
+	if (roundTripFailures)
+	{
+		fprintf(stderr, "%zu word(s) aren't their own NFC after decomposing\n", roundTripFailures);
+		++failures;
+	}
+
+	std::set<std::u16string> words;
+	for (const std::string& word : vocabulary)
+		words.insert(to_u16(word));
+
+	std::mt19937 random(1);
+	std::uniform_real_distribution<double> coin(0, 1);
+	std::vector<StreamWord> stream;
+	size_t retyped = 0;
+	for (size_t pass = 0; pass < options.passes; ++pass)
+	{
+		for (const std::string& word : text)
+		{
+			StreamWord entry;
+			entry.written = word;
+			const std::string variant = variant_of(word);
+			entry.has_variant = variant != word;
+			entry.typed = entry.has_variant && coin(random) < options.variants ? variant : word;
+			if (entry.typed != word)
+				++retyped;
+			stream.push_back(entry);
+		}
+	}
+
+	SpellBackendFactory factory = [&words]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<VocabularyBackend>(words);
+	};
+	EnchantProvider* asTyped = windows_provider_create<AsTypedPolicies>(factory);
+	EnchantProvider* canonical = windows_provider_create<CanonicalPolicies>(factory);
+	EnchantDict* asTypedDict = asTyped ? asTyped->request_dict(asTyped, "en_US") : nullptr;
+	EnchantDict* canonicalDict = canonical ? canonical->request_dict(canonical, "en_US") : nullptr;
+	if (!asTypedDict || !canonicalDict)
+	{
+		fprintf(stderr, "cannot create the providers\n");
+		return 2;
+	}
+
+	// Hits on words with variants, and verdicts on variants.
+	size_t variantWords = 0;
+	unsigned long long asTypedVariantHits = 0;
+	unsigned long long canonicalVariantHits = 0;
+	size_t falseMisspellings = 0;
+	size_t mismatches = 0;
+	uint64_t asTypedNs = 0;
+	uint64_t canonicalNs = 0;
+	for (const StreamWord& entry : stream)
+	{
+		const unsigned long long asTypedBefore = cache_hits(asTypedDict);
+		const unsigned long long canonicalBefore = cache_hits(canonicalDict);
+
+		Clock::time_point start = Clock::now();
+		const int asTypedResult = asTypedDict->check(asTypedDict, entry.typed.c_str(), entry.typed.size());
+		asTypedNs += elapsed_ns(start);
+		start = Clock::now();
+		const int canonicalResult = canonicalDict->check(canonicalDict, entry.typed.c_str(), entry.typed.size());
+		canonicalNs += elapsed_ns(start);
+
+		const int expected = words.count(to_u16(entry.written)) ? 0 : 1;
+		if (canonicalResult != expected)
+			++mismatches;
+		if (asTypedResult != expected)
+			++falseMisspellings;
+		if (entry.has_variant)
+		{
+			++variantWords;
+			asTypedVariantHits += cache_hits(asTypedDict) - asTypedBefore;
+			canonicalVariantHits += cache_hits(canonicalDict) - canonicalBefore;
+		}
+	}
+
+	// What the canonical form costs on its own.
+	std::string buffer;
+	const Clock::time_point start = Clock::now();
+	for (const StreamWord& entry : stream)
+	{
+		size_t len = entry.typed.size();
+		NfcCanonicalization::canonical(entry.typed.c_str(), len, buffer);
+	}
+	const double canonicalizeNs = static_cast<double>(elapsed_ns(start)) / stream.size();
+
+	const double asTypedRate = hit_rate(asTypedDict);
+	const double canonicalRate = hit_rate(canonicalDict);
+	const double asTypedVariantRate = variantWords ? static_cast<double>(asTypedVariantHits) / variantWords : 0;
+	const double canonicalVariantRate = variantWords ? static_cast<double>(canonicalVariantHits) / variantWords : 0;
+	fprintf(stderr, "%zu checks of %zu words (%zu known), %zu with variants, %zu retyped\n",
+		stream.size(), text.size(), words.size(), variantWords, retyped);
+	fprintf(stderr, "as typed:  hit rate %.1f%%, %.1f%% on words with variants, %.0f ns per check, %zu false misspellings\n",
+		100 * asTypedRate, 100 * asTypedVariantRate, static_cast<double>(asTypedNs) / stream.size(), falseMisspellings);
+	fprintf(stderr, "canonical: hit rate %.1f%%, %.1f%% on words with variants, %.0f ns per check, %zu wrong verdicts\n",
+		100 * canonicalRate, 100 * canonicalVariantRate, static_cast<double>(canonicalNs) / stream.size(), mismatches);
+	fprintf(stderr, "canonical form alone: %.1f ns per word\n", canonicalizeNs);
+
+	if (mismatches)
+	{
+		fprintf(stderr, "%zu variant(s) got a different verdict from the word as written\n", mismatches);
+		++failures;
+	}
+	if (retyped && canonicalVariantRate <= asTypedVariantRate)
+	{
+		fprintf(stderr, "canonical keys didn't raise the hit rate on words with variants\n");
+		++failures;
+	}
+
+	asTyped->dispose_dict(asTyped, asTypedDict);
+	canonical->dispose_dict(canonical, canonicalDict);
+	asTyped->dispose(asTyped);
+	canonical->dispose(canonical);
+	return failures ? 1 : 0;
+}
+
+} // namespace bench
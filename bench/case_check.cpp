@@ -0,0 +1,479 @@
+// enchant_windows - verdict reuse across capitalizations.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Runs two providers in this process on a stand-in backend with the
+// capitalization rules of Hunspell and the Windows spell checker: a word is
+// correct as listed, and a listed lowercase word also in Title Case and ALL
+// CAPS, and a listed Title Case word also in ALL CAPS. The backend knows the
+// words of data/langid/train, lowercase unless they were capitalized in the
+// middle of a sentence. Both providers check the sentences of data/langid
+// over and over, some of them shouted; one reuses cached lowercase verdicts
+// for other capitalizations (case_pattern.h), one has that turned off with
+// ENCHANT_WINDOWS_CASE_REUSE=0. Reports the backend calls each made, and the
+// time case_pattern takes per word with and without SIMD.
+//
+// Fails if reuse doesn't cut backend calls, if any verdict differs between
+// the two, if the SIMD and scalar classifiers ever disagree, or if the
+// rules for Turkish-like dotted I are wrong for a tag, however it is spelled.
+//
+//   enchant_windows_bench case [--data data/langid] [--shout 0.1] [--passes 20]
+
+#include "case_check.h"
+#include "bench_harness.h"
+#include "case_pattern.h"
+#include "enchant-windows.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "windows_provider.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+
+namespace bench {
+
+static const char* const kCaseLanguages[] = { "de", "en", "es", "fr", "it", "nl", "pt", "sv" };
+
+struct CaseOptions
+{
+	std::string data;
+	double shout;
+	size_t passes;
+
+	CaseOptions() : data("data/langid"), shout(0.1), passes(20) {}
+};
+
+// Capitals of ASCII and Latin-1 letters, in UTF-16, one way or the other.
+static bool is_capital(char16_t c)
+{
+	return (c >= u'A' && c <= u'Z') || (c >= 0xC0 && c <= 0xDE && c != 0xD7);
+}
+
+static bool is_small(char16_t c)
+{
+	return (c >= u'a' && c <= u'z') || (c >= 0xE0 && c <= 0xFE && c != 0xF7);
+}
+
+static std::u16string to_small(std::u16string word)
+{
+	for (char16_t& c : word)
+	{
+		if (is_capital(c))
+			c += 0x20;
+	}
+	return word;
+}
+
+// Knows a fixed set of words, and their capitalizations.
+class CasedVocabularyBackend : public SpellBackend
+{
+public:
+	CasedVocabularyBackend(const std::set<std::u16string>& words, std::atomic<size_t>& calls) : words(words), calls(calls) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t*) override { return 1; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t*) override
+	{
+		return std::make_unique<Checker>(words, calls);
+	}
+
+private:
+	class Checker : public SpellChecker
+	{
+	public:
+		Checker(const std::set<std::u16string>& words, std::atomic<size_t>& calls) : words(words), calls(calls) {}
+
+		int check(const char16_t* word) override
+		{
+			++calls;
+			const std::u16string as_is(word);
+			if (as_is.empty() || words.count(as_is))
+				return 0;
+
+			bool anySmall = false;
+			bool capitalAfter = false;
+			for (size_t i = 1; i < as_is.size(); ++i)
+			{
+				anySmall |= is_small(as_is[i]);
+				capitalAfter |= is_capital(as_is[i]);
+			}
+			const std::u16string small = to_small(as_is);
+			if (is_capital(as_is[0]) && !capitalAfter)
+				return words.count(small) ? 0 : 1;
+			if (capitalAfter && !anySmall)
+			{
+				std::u16string title = small;
+				title[0] = as_is[0];
+				return words.count(small) || words.count(title) ? 0 : 1;
+			}
+			return 1;
+		}
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override { return nullptr; }
+		bool add(const char16_t* word) override { words.insert(word); return true; }
+		bool ignore(const char16_t* word) override { words.insert(word); return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		std::set<std::u16string> words;
+		std::atomic<size_t>& calls;
+	};
+
+	const std::set<std::u16string>& words;
+	std::atomic<size_t>& calls;
+};
+
+typedef ProviderPolicies<WorkerDispatch, VerdictCache<4096>, Utf8Conversion, CallCounters, NfcCanonicalization> CaseCheckPolicies;
+
+static void case_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench case [options]\n"
+		"  --data DIR           train/ and test/ samples, <lang>.txt per language (default data/langid)\n"
+		"  --shout F            fraction of sentences in ALL CAPS (default 0.1)\n"
+		"  --passes N           times the sentences are checked (default 20)\n",
+		stderr);
+}
+
+static bool parse_case_options(int argc, char** argv, CaseOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--data") options.data = v;
+		else if (arg == "--shout") options.shout = atof(v);
+		else if (arg == "--passes") options.passes = strtoul(v, nullptr, 10);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.passes > 0 && options.shout >= 0 && options.shout <= 1;
+}
+
+// The words of a sentence, split as canonical_check.cpp does.
+static std::vector<std::string> sentence_words(const std::string& sentence)
+{
+	std::vector<std::string> out;
+	std::string word;
+	auto flush = [&]() {
+		while (!word.empty() && word.front() == '\'')
+			word.erase(word.begin());
+		while (!word.empty() && word.back() == '\'')
+			word.pop_back();
+		if (!word.empty())
+			out.push_back(word);
+		word.clear();
+	};
+
+	for (size_t i = 0; i < sentence.size(); ++i)
+	{
+		const unsigned char c = static_cast<unsigned char>(sentence[i]);
+		if (c == 0xC2 && i + 1 < sentence.size() && static_cast<unsigned char>(sentence[i + 1]) < 0xC0)
+		{
+			flush();
+			++i;
+		}
+		else if (c >= 0x80 || c == '\'' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+			word.push_back(sentence[i]);
+		else
+			flush();
+	}
+	flush();
+	return out;
+}
+
+static bool load_sentences(const std::string& dir, std::vector<std::vector<std::string>>& out)
+{
+	bool any = false;
+	for (const char* language : kCaseLanguages)
+	{
+		std::string contents;
+		if (!read_file(dir + "/" + language + ".txt", contents))
+			continue;
+		size_t start = 0;
+		while (start < contents.size())
+		{
+			size_t end = contents.find('\n', start);
+			if (end == std::string::npos)
+				end = contents.size();
+			std::vector<std::string> words = sentence_words(contents.substr(start, end - start));
+			if (!words.empty())
+				out.push_back(words);
+			start = end + 1;
+		}
+		any = true;
+	}
+	return any;
+}
+
+static std::u16string to_u16(const std::string& word)
+{
+	std::u16string out(utf8_to_utf16(word.data(), word.size(), nullptr), u'\0');
+	utf8_to_utf16(word.data(), word.size(), &out[0]);
+	return out;
+}
+
+// ALL CAPS, for the letters case_pattern folds.
+static std::string shouted(const std::string& word)
+{
+	std::string out = word;
+	for (size_t i = 0; i < out.size(); ++i)
+	{
+		const unsigned char c = static_cast<unsigned char>(out[i]);
+		if (c >= 'a' && c <= 'z')
+			out[i] = static_cast<char>(c - 0x20);
+		else if (c == 0xC3 && i + 1 < out.size())
+		{
+			const unsigned char trail = static_cast<unsigned char>(out[++i]);
+			if (trail >= 0xA0 && trail <= 0xBE && trail != 0xB7)
+				out[i] = static_cast<char>(trail - 0x20);
+		}
+	}
+	return out;
+}
+
+static const char* pattern_name(CasePattern pattern)
+{
+	switch (pattern)
+	{
+	case kCaseLower: return "lower";
+	case kCaseTitle: return "title";
+	case kCaseUpper: return "upper";
+	case kCaseMixed: return "mixed";
+	}
+	return "?";
+}
+
+// Random words of every length up to two SIMD blocks and more, of letters
+// and not, plus the stream's words: the SIMD classifier must agree with the
+// scalar one on pattern and folding.
+static size_t simd_disagreements(const std::vector<std::string>& stream)
+{
+	static const char alphabet[] = "aAbBzZ@[`{'-1iI";
+	std::mt19937 random(2);
+	std::vector<std::string> words = stream;
+	for (size_t len = 0; len <= 40; ++len)
+	{
+		for (size_t n = 0; n < 200; ++n)
+		{
+			std::string word;
+			for (size_t i = 0; i < len; ++i)
+				word.push_back(alphabet[random() % (sizeof(alphabet) - 1)]);
+			words.push_back(word);
+		}
+	}
+
+	const CaseRules plain = { true, false };
+	const CaseRules turkish = { true, true };
+	size_t disagreements = 0;
+	for (const std::string& word : words)
+	{
+		for (const CaseRules& rules : { plain, turkish })
+		{
+			std::string simd(word.size(), '\0');
+			std::string scalar(word.size(), '\0');
+			const CasePattern a = case_pattern(word.data(), word.size(), rules, &simd[0]);
+			const CasePattern b = case_pattern_scalar(word.data(), word.size(), rules, &scalar[0]);
+			if (a != b || ((a == kCaseTitle || a == kCaseUpper) && simd != scalar))
+			{
+				if (disagreements++ < 5)
+					fprintf(stderr, "'%s': %s with SIMD, %s without\n", word.c_str(), pattern_name(a), pattern_name(b));
+			}
+		}
+	}
+	return disagreements;
+}
+
+template<typename F>
+static double ns_per_word(const std::vector<std::string>& words, F classify)
+{
+	const CaseRules rules = { true, false };
+	char folded[kMaxUTF8WordLengthInBytes];
+	const Clock::time_point start = Clock::now();
+	for (const std::string& word : words)
+		do_not_optimize(classify(word.data(), word.size(), rules, folded));
+	return static_cast<double>(elapsed_ns(start)) / words.size();
+}
+
+// Whether dictionaries for tags however they are spelled get the dotted I
+// rules exactly when their language is Turkish, Azerbaijani or Crimean
+// Tatar. Returns the number that don't.
+static size_t dotted_i_mistakes()
+{
+	struct Expected
+	{
+		const char* tag;
+		bool dotted_i;
+	};
+	const Expected expected[] = {
+		{ "tr_TR.UTF-8", true }, { "TR-tr", true }, { "az_Latn_AZ", true }, { "crh", true },
+		{ "en_US", false }, { "trv", false }, { "cr-CA", false },
+	};
+	size_t mistakes = 0;
+	for (const Expected& entry : expected)
+	{
+		const LanguageTagRef language = resolve_language_tag(entry.tag);
+		if (!language || case_rules_for(*language).dotted_i != entry.dotted_i)
+		{
+			fprintf(stderr, "%s %s the dotted I rules\n", entry.tag, entry.dotted_i ? "doesn't get" : "gets");
+			++mistakes;
+		}
+	}
+	return mistakes;
+}
+
+int case_main(int argc, char** argv)
+{
+	CaseOptions options;
+	if (!parse_case_options(argc, argv, options))
+	{
+		case_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+
+	std::vector<std::vector<std::string>> train;
+	std::vector<std::vector<std::string>> sentences;
+	if (!load_sentences(options.data + "/train", train) || !load_sentences(options.data + "/test", sentences))
+	{
+		fprintf(stderr, "no samples in %s/train and %s/test\n", options.data.c_str(), options.data.c_str());
+		return 2;
+	}
+	sentences.insert(sentences.end(), train.begin(), train.end());
+
+	// Proper nouns as they are; a capital at the start of a sentence isn't
+	// part of the word.
+	std::set<std::u16string> words;
+	for (const auto& sentence : train)
+	{
+		for (size_t i = 0; i < sentence.size(); ++i)
+		{
+			const std::u16string word = to_u16(sentence[i]);
+			words.insert(i == 0 ? to_small(word) : word);
+		}
+	}
+
+	std::mt19937 random(1);
+	std::uniform_real_distribution<double> coin(0, 1);
+	std::vector<std::string> stream;
+	for (size_t pass = 0; pass < options.passes; ++pass)
+	{
+		for (const auto& sentence : sentences)
+		{
+			const bool shout = coin(random) < options.shout;
+			for (const std::string& word : sentence)
+				stream.push_back(shout ? shouted(word) : word);
+		}
+	}
+
+	std::atomic<size_t> plainCalls(0);
+	std::atomic<size_t> reuseCalls(0);
+	EnchantProvider* plain = windows_provider_create<CaseCheckPolicies>([&]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<CasedVocabularyBackend>(words, plainCalls);
+	});
+	EnchantProvider* reuse = windows_provider_create<CaseCheckPolicies>([&]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<CasedVocabularyBackend>(words, reuseCalls);
+	});
+	if (!plain || !reuse)
+	{
+		fprintf(stderr, "cannot create the providers\n");
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_CASE_REUSE", "0");
+	EnchantDict* plainDict = plain->request_dict(plain, "en_US");
+	set_environment("ENCHANT_WINDOWS_CASE_REUSE", "");
+	EnchantDict* reuseDict = reuse->request_dict(reuse, "en_US");
+	if (!plainDict || !reuseDict)
+	{
+		fprintf(stderr, "cannot create the dictionaries\n");
+		return 2;
+	}
+
+	size_t mismatches = 0;
+	size_t misspelled = 0;
+	size_t patterns[4] = {};
+	const CaseRules rules = { true, false };
+	for (const std::string& word : stream)
+	{
+		char folded[kMaxUTF8WordLengthInBytes];
+		++patterns[case_pattern(word.data(), word.size(), rules, folded)];
+		const int expected = plainDict->check(plainDict, word.c_str(), word.size());
+		const int got = reuseDict->check(reuseDict, word.c_str(), word.size());
+		if (expected > 0)
+			++misspelled;
+		if (got != expected)
+		{
+			if (mismatches++ < 5)
+				fprintf(stderr, "'%s' checks %d with reuse, %d without\n", word.c_str(), got, expected);
+		}
+	}
+
+	const size_t disagreements = simd_disagreements(stream);
+	const size_t dottedI = dotted_i_mistakes();
+	const double simdNs = ns_per_word(stream, case_pattern);
+	const double scalarNs = ns_per_word(stream, case_pattern_scalar);
+
+	fprintf(stderr, "%zu checks: %zu lowercase, %zu Title Case, %zu ALL CAPS, %zu mixed; %zu misspelled\n",
+		stream.size(), patterns[kCaseLower], patterns[kCaseTitle], patterns[kCaseUpper], patterns[kCaseMixed], misspelled);
+	fprintf(stderr, "backend calls: %zu without reuse, %zu with (%.1f%% fewer)\n",
+		plainCalls.load(), reuseCalls.load(),
+		plainCalls ? 100.0 * (1.0 - static_cast<double>(reuseCalls) / plainCalls) : 0.0);
+	fprintf(stderr, "case_pattern: %.1f ns per word with SIMD, %.1f ns without\n", simdNs, scalarNs);
+
+	int failures = 0;
+	if (mismatches)
+	{
+		fprintf(stderr, "%zu verdict(s) differ with reuse\n", mismatches);
+		++failures;
+	}
+	if (reuseCalls >= plainCalls)
+	{
+		fprintf(stderr, "reuse didn't cut backend calls\n");
+		++failures;
+	}
+	if (disagreements)
+	{
+		fprintf(stderr, "%zu word(s) classified differently with SIMD\n", disagreements);
+		++failures;
+	}
+	if (dottedI)
+	{
+		fprintf(stderr, "%zu tag(s) with the wrong case rules\n", dottedI);
+		++failures;
+	}
+
+	plain->dispose_dict(plain, plainDict);
+	reuse->dispose_dict(reuse, reuseDict);
+	plain->dispose(plain);
+	reuse->dispose(reuse);
+	return failures ? 1 : 0;
+}
+
+} // namespace bench
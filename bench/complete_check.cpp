@@ -0,0 +1,417 @@
+// enchant_windows - word completion check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Writes a frequency list of the words of data/langid/<lang> text, padded
+// out with made-up words that start like real ones, then types the test
+// sentences a keystroke at a time, asking enchant_windows_dict_complete for
+// completions after each. The list is read off the caller's thread once the
+// dictionary is requested, so the first call must return at once, with
+// nothing; reports how long that took, how long until completions came,
+// and the p50, p99 and worst time per keystroke after that. Checks the
+// completions for a sample of prefixes against a search of the whole list,
+// that capitals carry over, that personal words are offered and excluded
+// ones not, and that the embedding API gives the same answers.
+//
+// Fails if any check does, the p99 is over --max-p99-us, or the first call
+// takes over --max-first-ms.
+//
+//   enchant_windows_bench complete [--data data/langid] [--lang en] [--filler-words 100000]
+//       [--passes 20] [--max 5] [--max-p99-us 50] [--max-first-ms 5] [--dict-dir complete_dict]
+
+#include "complete_check.h"
+#include "bench_harness.h"
+#include "case_pattern.h"
+#include "enchant-windows.h"
+#include "enchant-windows.hpp"
+#include "provider_policies.h"
+#include "windows_provider.h"
+#include "wordlist_spell_backend.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <set>
+#include <thread>
+
+namespace bench {
+
+struct CompleteOptions
+{
+	std::string data;
+	std::string lang;
+	std::string dict_dir;
+	size_t filler_words;
+	size_t passes;
+	size_t max;
+	double max_p99_us;
+	double max_first_ms;
+
+	CompleteOptions() : data("data/langid"), lang("en"), dict_dir("complete_dict"), filler_words(100000), passes(20), max(5), max_p99_us(50), max_first_ms(5) {}
+};
+
+static void complete_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench complete [options]\n"
+		"  --data DIR           train/ and test/ samples, <lang>.txt per language (default data/langid)\n"
+		"  --lang L             language of the samples to use (default en)\n"
+		"  --filler-words N     made-up words added to the frequency list (default 100000)\n"
+		"  --passes N           times the test sentences are typed (default 20)\n"
+		"  --max N              completions asked for (default 5)\n"
+		"  --max-p99-us F       allowed p99 per keystroke (default 50)\n"
+		"  --max-first-ms F     allowed time for the first call (default 5)\n"
+		"  --dict-dir DIR       where to write the lists (default complete_dict)\n",
+		stderr);
+}
+
+static bool parse_complete_options(int argc, char** argv, CompleteOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--data") options.data = v;
+		else if (arg == "--lang") options.lang = v;
+		else if (arg == "--filler-words") options.filler_words = strtoul(v, nullptr, 10);
+		else if (arg == "--passes") options.passes = strtoul(v, nullptr, 10);
+		else if (arg == "--max") options.max = strtoul(v, nullptr, 10);
+		else if (arg == "--max-p99-us") options.max_p99_us = atof(v);
+		else if (arg == "--max-first-ms") options.max_first_ms = atof(v);
+		else if (arg == "--dict-dir") options.dict_dir = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.passes > 0 && options.max > 0 && !options.dict_dir.empty();
+}
+
+struct ListEntry
+{
+	std::string word;
+	unsigned long count;
+};
+
+// The frequency list as the index ranks it: most common first, then in
+// file order, and only the first of words that fold the same.
+static std::vector<ListEntry> make_list(const std::vector<std::string>& words, size_t filler)
+{
+	std::map<std::string, unsigned long> counts;
+	for (const std::string& word : words)
+		counts[word] += 1000;
+
+	// Made-up words under the prefixes of real ones, so that prefixes have
+	// thousands of words under them as in a real list.
+	std::vector<std::string> stems;
+	for (const auto& count : counts)
+		stems.push_back(count.first);
+	std::mt19937 random(1);
+	for (size_t i = 0; i < filler && !stems.empty(); ++i)
+	{
+		const std::string& stem = stems[random() % stems.size()];
+		std::string word = stem.substr(0, 1 + random() % stem.size());
+		for (size_t n = 2 + random() % 5; n > 0; --n)
+			word += static_cast<char>('a' + random() % 26);
+		counts.insert({ word, 1 + random() % 999 });
+	}
+
+	std::vector<ListEntry> list;
+	for (const auto& count : counts)
+		list.push_back({ count.first, count.second });
+	std::stable_sort(list.begin(), list.end(), [](const ListEntry& a, const ListEntry& b) { return a.count > b.count; });
+	return list;
+}
+
+static std::string folded(const std::string& word, const CaseRules& rules)
+{
+	std::string lower(word.size(), '\0');
+	const CasePattern pattern = case_pattern(word.data(), word.size(), rules, &lower[0]);
+	return pattern == kCaseTitle || pattern == kCaseUpper ? lower : word;
+}
+
+// The best 'max' words starting with 'prefix', by going through them all.
+static std::vector<std::string> reference_completions(const std::vector<ListEntry>& list, const std::string& prefix, size_t max, const CaseRules& rules)
+{
+	std::vector<std::string> out;
+	std::set<std::string> keys;
+	for (const ListEntry& entry : list)
+	{
+		const std::string key = folded(entry.word, rules);
+		if (!keys.insert(key).second)
+			continue;
+		if (key.compare(0, prefix.size(), prefix) == 0)
+		{
+			out.push_back(entry.word);
+			if (out.size() == max)
+				break;
+		}
+	}
+	return out;
+}
+
+static std::vector<std::string> completions(EnchantProvider* provider, EnchantDict* dict, const std::string& prefix, size_t max)
+{
+	std::vector<std::string> out;
+	size_t n = 0;
+	char** list = enchant_windows_dict_complete(dict, prefix.data(), prefix.size(), max, &n);
+	for (size_t i = 0; list && i < n; ++i)
+		out.push_back(list[i]);
+	if (list)
+		provider->free_string_list(provider, list);
+	return out;
+}
+
+// Ask 'complete' until it gives something, for up to ten seconds.
+template <typename Complete>
+static bool wait_for_completions(Complete complete)
+{
+	for (int i = 0; i < 10000; ++i)
+	{
+		if (complete())
+			return true;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return false;
+}
+
+static std::string joined(const std::vector<std::string>& words)
+{
+	std::string out;
+	for (const std::string& word : words)
+		out += (out.empty() ? "" : ",") + word;
+	return out;
+}
+
+int complete_main(int argc, char** argv)
+{
+	CompleteOptions options;
+	if (!parse_complete_options(argc, argv, options))
+	{
+		complete_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+	set_environment("ENCHANT_WINDOWS_CASE_REUSE", "");
+
+	std::string train;
+	std::string test;
+	if (!read_file(options.data + "/train/" + options.lang + ".txt", train) || !read_file(options.data + "/test/" + options.lang + ".txt", test))
+	{
+		fprintf(stderr, "no samples for %s in %s\n", options.lang.c_str(), options.data.c_str());
+		return 2;
+	}
+	const Workload trainWords = make_workload(train + "\n" + test);
+	const Workload typed = make_workload(test);
+	if (typed.correct.empty())
+	{
+		fprintf(stderr, "no words in %s/test/%s.txt\n", options.data.c_str(), options.lang.c_str());
+		return 2;
+	}
+
+	// Words as they would be in a dictionary: lowercase, bar proper nouns.
+	const std::string tag = options.lang + "_XX";
+	const LanguageTagRef language = resolve_language_tag(tag);
+	if (!language)
+	{
+		fprintf(stderr, "%s is not a language tag\n", options.lang.c_str());
+		return 2;
+	}
+	const CaseRules rules = case_rules_for(*language);
+	std::vector<std::string> words;
+	for (const std::string& word : trainWords.correct)
+	{
+		std::string lower(word.size(), '\0');
+		words.push_back(case_pattern(word.data(), word.size(), rules, &lower[0]) == kCaseTitle && word.size() > 1 ? lower : word);
+	}
+	const std::vector<ListEntry> list = make_list(words, options.filler_words);
+
+	make_directory(options.dict_dir);
+	{
+		std::ofstream out(options.dict_dir + "/" + tag + ".freq", std::ios::binary);
+		std::ofstream dic(options.dict_dir + "/" + tag + ".dic", std::ios::binary);
+		for (const ListEntry& entry : list)
+		{
+			out << entry.word << "\t" << entry.count << "\n";
+			dic << entry.word << "\n";
+		}
+		if (!out || !dic)
+		{
+			fprintf(stderr, "cannot write %s\n", options.dict_dir.c_str());
+			return 2;
+		}
+	}
+	set_environment("ENCHANT_WINDOWS_COMPLETION_PATH", options.dict_dir);
+	set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dict_dir);
+	set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>(create_wordlist_spell_backend);
+	EnchantDict* dict = provider ? provider->request_dict(provider, tag.c_str()) : nullptr;
+	if (!dict)
+	{
+		fprintf(stderr, "cannot create the provider\n");
+		return 2;
+	}
+
+	Clock::time_point start = Clock::now();
+	completions(provider, dict, "a", options.max);
+	const double firstMs = elapsed_ns(start) / 1e6;
+	const bool ready = wait_for_completions([&]() { return !completions(provider, dict, "a", options.max).empty(); });
+	const double loadMs = elapsed_ns(start) / 1e6;
+	if (!ready)
+	{
+		fprintf(stderr, "no completions after %.1f ms\n", loadMs);
+		return 1;
+	}
+	EnchantWindowsDictMemory memory;
+	enchant_windows_dict_memory_usage(dict, &memory);
+	const size_t cacheBytes = memory.current_bytes[ENCHANT_WINDOWS_MEMORY_CACHE];
+
+	// Each word typed out, a completion request per character.
+	std::vector<std::string> prefixes;
+	for (const std::string& word : typed.correct)
+	{
+		for (size_t i = 1; i <= word.size(); ++i)
+		{
+			if (i == word.size() || (static_cast<unsigned char>(word[i]) & 0xC0) != 0x80)
+				prefixes.push_back(word.substr(0, i));
+		}
+	}
+	std::vector<double> us;
+	size_t n = 0;
+	for (size_t pass = 0; pass < options.passes; ++pass)
+	{
+		for (const std::string& prefix : prefixes)
+		{
+			start = Clock::now();
+			char** got = enchant_windows_dict_complete(dict, prefix.data(), prefix.size(), options.max, &n);
+			if (got)
+				provider->free_string_list(provider, got);
+			us.push_back(elapsed_ns(start) / 1e3);
+		}
+	}
+	std::vector<double> sorted = us;
+	std::sort(sorted.begin(), sorted.end());
+	const double p50 = percentile(us, 50);
+	const double p99 = percentile(us, 99);
+
+	printf("%zu words in the list, cache with index %zu bytes, first call %.3f ms, read in %.1f ms\n",
+		list.size(), cacheBytes, firstMs, loadMs);
+	printf("%zu keystrokes: p50 %.2f us, p99 %.2f us, worst %.2f us\n", us.size(), p50, p99, sorted.back());
+
+	size_t failures = 0;
+	auto fail = [&](const std::string& what) {
+		if (failures++ < 10)
+			fprintf(stderr, "%s\n", what.c_str());
+	};
+
+	// Lowercase prefixes against the whole list, beyond the cached few too.
+	std::set<std::string> sample;
+	for (const std::string& prefix : prefixes)
+	{
+		if (folded(prefix, rules) == prefix)
+			sample.insert(prefix);
+	}
+	for (const char* extra : { "", "a", "th", "qq" })
+		sample.insert(extra);
+	for (const std::string& prefix : sample)
+	{
+		for (size_t max : { options.max, CompletionIndex::kCachedCompletions + 12 })
+		{
+			const std::vector<std::string> got = completions(provider, dict, prefix, max);
+			const std::vector<std::string> expected = reference_completions(list, prefix, max, rules);
+			if (got != expected)
+				fail("'" + prefix + "': " + joined(got) + " instead of " + joined(expected));
+		}
+	}
+
+	// Capitals carry over.
+	std::vector<std::string> lower = completions(provider, dict, "th", options.max);
+	const std::vector<std::string> title = completions(provider, dict, "Th", options.max);
+	const std::vector<std::string> upper = completions(provider, dict, "TH", options.max);
+	for (size_t i = 0; i < lower.size(); ++i)
+	{
+		std::string t = lower[i];
+		std::string u = lower[i];
+		t[0] = static_cast<char>(toupper(static_cast<unsigned char>(t[0])));
+		for (char& c : u)
+			c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+		if (i >= title.size() || title[i] != t || i >= upper.size() || upper[i] != u)
+			fail("'Th' and 'TH' don't match 'th': " + joined(title) + " " + joined(upper));
+	}
+
+	// Personal words are offered first, excluded ones not at all.
+	dict->add_to_personal(dict, "thqxzy", 6);
+	const std::vector<std::string> personal = completions(provider, dict, "thq", options.max);
+	if (personal.empty() || personal[0] != "thqxzy")
+		fail("personal word not offered: " + joined(personal));
+	if (!lower.empty())
+	{
+		dict->add_to_exclude(dict, lower[0].data(), lower[0].size());
+		const std::vector<std::string> excluded = completions(provider, dict, "th", options.max);
+		if (std::find(excluded.begin(), excluded.end(), lower[0]) != excluded.end() || excluded.size() != lower.size())
+			fail("excluded word still offered: " + joined(excluded));
+	}
+	provider->dispose_dict(provider, dict);
+	provider->dispose(provider);
+
+	// The embedding API reads the same list.
+	auto embedded = enchant_windows::Provider::create();
+	auto embeddedDict = embedded ? embedded->request_dict(tag) : nullptr;
+	enchant_windows::Suggestions suggestions;
+	std::vector<std::string> embeddedTitle;
+	if (embeddedDict && wait_for_completions([&]() { return embeddedDict->complete("Th", suggestions, options.max); }))
+	{
+		for (std::string_view s : suggestions)
+			embeddedTitle.push_back(std::string(s));
+	}
+	if (embeddedTitle != title)
+		fail("embedding API completions differ: " + joined(embeddedTitle));
+
+	if (failures)
+	{
+		fprintf(stderr, "%zu check(s) failed\n", failures);
+		return 1;
+	}
+	if (firstMs > options.max_first_ms)
+	{
+		fprintf(stderr, "first call took %.3f ms, over %.3f ms\n", firstMs, options.max_first_ms);
+		return 1;
+	}
+	if (p99 > options.max_p99_us)
+	{
+		fprintf(stderr, "p99 %.2f us over %.2f us\n", p99, options.max_p99_us);
+		return 1;
+	}
+	printf("ok\n");
+	return 0;
+}
+
+} // namespace bench
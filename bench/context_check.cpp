@@ -0,0 +1,353 @@
+// enchant_windows - real-word error check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Runs the held-out sentences of --test (one per line, every confusion
+// word in them used correctly) through a LanguageRouter and a
+// ContextChecker with the model in --model, over a word list of their words
+// written to --dict-dir. Counts the correct words flagged, then swaps each
+// confusion word for every other word in its set and counts how often the
+// swap is caught and the original offered. Then times the scoring pass over
+// the sentences as one document, and sentence by sentence as they would be
+// rescored while typing.
+//
+// Fails if fewer than --min-caught of the swaps are caught, more than
+// --max-flagged of the correct words are flagged, scoring takes more than
+// --max-word-ns a word, or the 99th percentile sentence more than
+// --max-sentence-us.
+//
+//   enchant_windows_bench context [--model data/ngram/en_US.ngram]
+//       [--test data/ngram/test/en.txt] [--dict-dir context_dict]
+
+#include "context_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.hpp"
+#include "ngram_model.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+struct ContextOptions
+{
+	std::string model;
+	std::string test;
+	std::string dict_dir;
+	size_t words;
+	double min_caught;
+	double max_flagged;
+	double max_word_ns;
+	double max_sentence_us;
+
+	ContextOptions() :
+		model("data/ngram/en_US.ngram"),
+		test("data/ngram/test/en.txt"),
+		dict_dir("context_dict"),
+		words(50000),
+		min_caught(0.75),
+		max_flagged(0.01),
+		max_word_ns(250),
+		max_sentence_us(20)
+	{
+	}
+};
+
+static void context_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench context [options]\n"
+		"  --model FILE         model to check with (default data/ngram/en_US.ngram)\n"
+		"  --test FILE          held-out sentences (default data/ngram/test/en.txt)\n"
+		"  --dict-dir DIR       where to write the word list (default context_dict)\n"
+		"  --words N            words in the document timed (default 50000)\n"
+		"  --min-caught F       fraction of swapped words to catch (default 0.75)\n"
+		"  --max-flagged F      fraction of correct words flagged allowed (default 0.01)\n"
+		"  --max-word-ns N      scoring time allowed per word (default 250)\n"
+		"  --max-sentence-us N  99th percentile time allowed per sentence (default 20)\n",
+		stderr);
+}
+
+static bool parse_context_options(int argc, char** argv, ContextOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--model") options.model = v;
+		else if (arg == "--test") options.test = v;
+		else if (arg == "--dict-dir") options.dict_dir = v;
+		else if (arg == "--words") options.words = strtoul(v, nullptr, 10);
+		else if (arg == "--min-caught") options.min_caught = atof(v);
+		else if (arg == "--max-flagged") options.max_flagged = atof(v);
+		else if (arg == "--max-word-ns") options.max_word_ns = atof(v);
+		else if (arg == "--max-sentence-us") options.max_sentence_us = atof(v);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.words > 0 && !options.dict_dir.empty();
+}
+
+static std::vector<std::string> read_sentences(const std::string& path)
+{
+	std::vector<std::string> lines;
+	std::string contents;
+	if (!read_file(path, contents))
+		return lines;
+	size_t start = 0;
+	while (start < contents.size())
+	{
+		size_t end = contents.find('\n', start);
+		if (end == std::string::npos)
+			end = contents.size();
+		std::string line = contents.substr(start, end - start);
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		if (!line.empty() && line[0] != '#')
+			lines.push_back(line);
+		start = end + 1;
+	}
+	return lines;
+}
+
+static std::string lowercase(std::string word)
+{
+	for (char& c : word)
+	{
+		if (c >= 'A' && c <= 'Z')
+			c = static_cast<char>(c + 0x20);
+	}
+	return word;
+}
+
+// 'word' with its first letter capitalized if 'like' has.
+static std::string cased_like(std::string word, std::string_view like)
+{
+	if (!like.empty() && like[0] >= 'A' && like[0] <= 'Z' && !word.empty() && word[0] >= 'a' && word[0] <= 'z')
+		word[0] = static_cast<char>(word[0] - 0x20);
+	return word;
+}
+
+// Every run of letters and apostrophes in the sentences, as written and in
+// lowercase, and every word of the model's sets, for a word list that
+// passes them all.
+static bool write_dictionary(const std::string& path, const std::vector<std::string>& sentences, const NgramModel& model)
+{
+	std::set<std::string> words;
+	for (const std::string& sentence : sentences)
+	{
+		std::string word;
+		for (size_t i = 0; i <= sentence.size(); ++i)
+		{
+			const char c = i < sentence.size() ? sentence[i] : ' ';
+			if (((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '\'')
+			{
+				word += c;
+				continue;
+			}
+			if (!word.empty())
+			{
+				words.insert(word);
+				words.insert(lowercase(word));
+			}
+			word.clear();
+		}
+	}
+	for (size_t set = 0; set < model.set_count(); ++set)
+	{
+		for (const std::string& word : model.set_words(static_cast<int>(set)))
+		{
+			words.insert(word);
+			words.insert(cased_like(word, "A"));
+		}
+	}
+	std::ofstream out(path, std::ios::binary);
+	for (const std::string& word : words)
+		out << word << "\n";
+	return static_cast<bool>(out);
+}
+
+int context_main(int argc, char** argv)
+{
+	ContextOptions options;
+	if (!parse_context_options(argc, argv, options))
+	{
+		context_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+
+	size_t failures = 0;
+	auto fail = [&](const char* what) {
+		fprintf(stderr, "%s\n", what);
+		++failures;
+	};
+
+	auto model = NgramModel::open(options.model);
+	const std::vector<std::string> sentences = read_sentences(options.test);
+	if (!model || sentences.empty())
+	{
+		fprintf(stderr, "cannot read %s or %s\n", options.model.c_str(), options.test.c_str());
+		return 2;
+	}
+	make_directory(options.dict_dir);
+	if (!write_dictionary(options.dict_dir + "/en_US.dic", sentences, *model))
+	{
+		fprintf(stderr, "cannot write to %s\n", options.dict_dir.c_str());
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dict_dir);
+	set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+	auto provider = enchant_windows::Provider::create();
+	auto dict = provider ? provider->request_dict("en_US") : nullptr;
+	auto context = dict ? enchant_windows::ContextChecker::create(*dict, options.model) : nullptr;
+	if (!context)
+	{
+		fprintf(stderr, "cannot load en_US from %s\n", options.dict_dir.c_str());
+		return 2;
+	}
+
+	enchant_windows::LanguageRouter router({ dict.get() });
+	std::vector<enchant_windows::LanguageRouter::Word> words;
+	std::vector<enchant_windows::ContextChecker::Error> errors;
+
+	// Accuracy: flags on the sentences as written, and on each swap.
+	size_t checked = 0;
+	size_t flagged = 0;
+	size_t swaps = 0;
+	size_t caught = 0;
+	std::vector<std::string> missed;
+	for (const std::string& sentence : sentences)
+	{
+		router.check(sentence, words);
+		context->check(sentence, words, errors);
+		checked += words.size();
+		flagged += errors.size();
+		for (const auto& error : errors)
+		{
+			fprintf(stderr, "flagged %.*s (for %s): %s\n", static_cast<int>(words[error.word].length),
+				sentence.data() + words[error.word].offset, error.correction.c_str(), sentence.c_str());
+		}
+
+		const std::vector<enchant_windows::LanguageRouter::Word> original = words;
+		for (size_t i = 0; i < original.size(); ++i)
+		{
+			const std::string_view written = std::string_view(sentence).substr(original[i].offset, original[i].length);
+			const std::string folded = lowercase(std::string(written));
+			const int set = model->confusion_set(NgramModel::word_hash(folded.data(), folded.size()));
+			if (set < 0)
+				continue;
+			for (const std::string& alternative : model->set_words(set))
+			{
+				if (alternative == folded)
+					continue;
+				std::string swapped = sentence;
+				swapped.replace(original[i].offset, original[i].length, cased_like(alternative, written));
+				router.check(swapped, words);
+				context->check(swapped, words, errors);
+				++swaps;
+				bool found = false;
+				for (const auto& error : errors)
+					found = found || (error.word == i && lowercase(error.correction) == folded);
+				if (found)
+					++caught;
+				else
+					missed.push_back(swapped);
+			}
+		}
+	}
+	for (const std::string& sentence : missed)
+		fprintf(stderr, "missed: %s\n", sentence.c_str());
+
+	// Throughput: the sentences as one document.
+	std::string document;
+	size_t documentWords = 0;
+	while (documentWords < options.words)
+	{
+		for (const std::string& sentence : sentences)
+		{
+			document += sentence;
+			document += ' ';
+		}
+		router.check(document, words);
+		documentWords = words.size();
+	}
+	Clock::time_point start = Clock::now();
+	router.check(document, words);
+	const double routeNs = static_cast<double>(elapsed_ns(start)) / words.size();
+	context->check(document, words, errors);
+	const size_t passes = 5;
+	start = Clock::now();
+	for (size_t pass = 0; pass < passes; ++pass)
+		context->check(document, words, errors);
+	const double wordNs = static_cast<double>(elapsed_ns(start)) / (passes * words.size());
+
+	// Latency: each sentence rescored, as after a keystroke.
+	std::vector<std::vector<enchant_windows::LanguageRouter::Word>> routed(sentences.size());
+	for (size_t s = 0; s < sentences.size(); ++s)
+		router.check(sentences[s], routed[s]);
+	LatencyRecorder recorder("context_sentence");
+	for (size_t batch = 0; batch < 20; ++batch)
+	{
+		recorder.begin_batch();
+		for (size_t s = 0; s < sentences.size(); ++s)
+		{
+			start = Clock::now();
+			context->check(sentences[s], routed[s], errors);
+			recorder.record(elapsed_ns(start));
+		}
+		recorder.end_batch();
+	}
+	const CaseResult latency = recorder.finish();
+
+	const double caughtShare = swaps ? static_cast<double>(caught) / swaps : 0.0;
+	const double flaggedShare = checked ? static_cast<double>(flagged) / checked : 1.0;
+	printf("model: %zu bytes mapped\n", model->mapped_bytes());
+	printf("swapped words caught: %zu/%zu (%.1f%%)\n", caught, swaps, caughtShare * 100);
+	printf("correct words flagged: %zu/%zu (%.2f%%)\n", flagged, checked, flaggedShare * 100);
+	printf("scoring: %.0f ns/word (routing and checking: %.0f ns/word)\n", wordNs, routeNs);
+	printf("sentence: p50 %.0f ns, p99 %.0f ns\n", latency.p50_ns, latency.p99_ns);
+	if (caughtShare < options.min_caught)
+		fail("too few swapped words caught");
+	if (flaggedShare > options.max_flagged)
+		fail("too many correct words flagged");
+	if (wordNs > options.max_word_ns)
+		fail("scoring too slow per word");
+	if (latency.p99_ns > options.max_sentence_us * 1000)
+		fail("scoring too slow per sentence");
+	if (failures)
+		return 1;
+	printf("ok\n");
+	return 0;
+}
+
+} // namespace bench
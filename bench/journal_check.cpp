@@ -0,0 +1,465 @@
+// enchant_windows - personal dictionary journal check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Adds words to a dictionary in a child process whose provider never gets
+// to pass them on to the backend, because the child runs the provider on an
+// executor that stops running its jobs, and then exits without disposing of
+// anything, as a crash would. Fails unless a dictionary opened afterwards
+// has all of those words from the journal. A second child holds words of
+// its own back the same way but stays running meanwhile, and fails the
+// check if they are taken from its journal before it exits, or not
+// afterwards. Then times adding words in bulk, which the caller shouldn't
+// wait on the backend for, against as many adds it waits on by checking the
+// word straight after, and fails unless the p99s of batches of the first
+// are below those of the second (a Mann-Whitney p-value at most --max-p),
+// or if any journal is left once they have all been made, or one is made
+// for a dictionary that is only read. Last, crashes with words added under
+// "en_US.UTF-8" and then "en-US", and fails unless a dictionary opened under
+// the other spelling gets them back, as the journal goes by the language.
+//
+//   enchant_windows_bench journal --plugin PATH [--words N]
+
+#include "journal_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+namespace bench {
+
+struct JournalOptions
+{
+	std::string plugin;
+	std::string dir;
+	std::string out;
+	std::string tag;
+	size_t words;
+	double max_p;
+	bool child;
+	bool holder;
+
+	JournalOptions() : dir("journal_check"), tag("en_US"), words(20000), max_p(0.01), child(false), holder(false) {}
+};
+
+static void journal_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench journal --plugin PATH [options]\n"
+		"  --dir DIR              where to put the word list and journal (default journal_check)\n"
+		"  --words N              words to add (default 20000)\n"
+		"  --max-p F              allowed p-value that adds are no faster than waiting (default 0.01)\n"
+		"  --out FILE             write JSON results ('-' for stdout)\n",
+		stderr);
+}
+
+static bool parse_journal_options(int argc, char** argv, JournalOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (arg == "--child")
+		{
+			options.child = true;
+			continue;
+		}
+		if (arg == "--holder")
+		{
+			options.child = options.holder = true;
+			continue;
+		}
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--plugin") options.plugin = v;
+		else if (arg == "--dir") options.dir = v;
+		else if (arg == "--words") options.words = strtoul(v, nullptr, 10);
+		else if (arg == "--max-p") options.max_p = atof(v);
+		else if (arg == "--out") options.out = v;
+		else if (arg == "--tag") options.tag = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return !options.plugin.empty() && !options.dir.empty() && options.words > 0;
+}
+
+// Runs jobs where they are handed over until stopped, then drops them.
+static std::atomic<bool> executor_running(true);
+static std::atomic<size_t> executor_jobs(0);
+
+static void stalling_executor(void (*run)(void* job), void* job, void*)
+{
+	++executor_jobs;
+	if (executor_running)
+		run(job);
+}
+
+// The child's exit status if the provider does its work in place instead.
+static const int kNotStallable = 3;
+
+// The holder's words come after every word the rest of the check uses.
+static const size_t kHolderWords = 100;
+
+static size_t holder_word(const JournalOptions& options, size_t i)
+{
+	return 2 * options.words + 1 + i;
+}
+
+static bool file_exists(const std::string& path)
+{
+	std::string contents;
+	return read_file(path, contents);
+}
+
+static bool make_file(const std::string& path)
+{
+	std::ofstream out(path, std::ios::binary);
+	return static_cast<bool>(out);
+}
+
+// Whether a file can be made in 'dir', which is to say it exists.
+static bool directory_exists(const std::string& dir)
+{
+	const std::string probe = dir + "/probe";
+	if (!make_file(probe))
+		return false;
+	remove(probe.c_str());
+	return true;
+}
+
+static bool is_journal(const std::string& name)
+{
+	static const std::string kSuffix = ".journal";
+	return name.size() > kSuffix.size() && name.compare(name.size() - kSuffix.size(), kSuffix.size(), kSuffix) == 0;
+}
+
+static size_t count_journals(const std::string& dir)
+{
+	size_t n = 0;
+	for (const std::string& name : list_directory(dir))
+		n += is_journal(name);
+	return n;
+}
+
+// How many of 'count' filler words from 'first' on a fresh dictionary for
+// 'tag' has, or -1 if there is none.
+static long words_found(const JournalOptions& options, const char* tag, size_t first, size_t count)
+{
+	PluginProvider plugin;
+	std::string error;
+	if (!plugin.load(options.plugin, error))
+		return -1;
+	ProviderDict dict(plugin.get(), tag);
+	if (!dict.get())
+		return -1;
+	long found = 0;
+	for (size_t i = 0; i < count; ++i)
+		found += dict.check(filler_word(first + i)) == 0;
+	return found;
+}
+
+static int journal_child(const JournalOptions& options)
+{
+	PluginProvider plugin;
+	std::string error;
+	if (!plugin.open(options.plugin, error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 2;
+	}
+	auto setExecutor = reinterpret_cast<enchant_windows_set_executor_fn>(plugin.symbol("enchant_windows_set_executor"));
+	if (!setExecutor || setExecutor(stalling_executor, nullptr) != 0 || !plugin.create(error))
+	{
+		fprintf(stderr, "cannot create the provider on an executor\n");
+		return 2;
+	}
+
+	EnchantProvider* provider = plugin.get();
+	EnchantDict* dict = provider->request_dict(provider, options.tag.c_str());
+	if (!dict)
+	{
+		fprintf(stderr, "plugin has no dictionary from %s; is it built with the word list backend?\n", options.dir.c_str());
+		return 2;
+	}
+
+	executor_running = false;
+	if (executor_jobs == 0)
+	{
+		if (options.holder)
+			make_file(options.dir + "/holder.ready");
+		_Exit(kNotStallable);
+	}
+	const size_t words = options.holder ? kHolderWords : options.words;
+	for (size_t i = 0; i < words; ++i)
+	{
+		const std::string word = filler_word(options.holder ? holder_word(options, i) : i);
+		dict->add_to_personal(dict, word.c_str(), word.size());
+	}
+
+	// Until the parent has looked, or long enough that it must have given
+	// up.
+	if (options.holder)
+	{
+		make_file(options.dir + "/holder.ready");
+		for (int waited = 0; waited < 1200 && !file_exists(options.dir + "/holder.release"); ++waited)
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	fflush(stderr);
+	_Exit(0);
+}
+
+int journal_main(int argc, char** argv)
+{
+	JournalOptions options;
+	if (!parse_journal_options(argc, argv, options))
+	{
+		journal_usage();
+		return 2;
+	}
+
+	const std::string journalDir = options.dir + "/journal";
+	const std::string readOnlyDir = options.dir + "/read_only";
+	if (!options.child)
+	{
+		make_directory(options.dir);
+		make_directory(journalDir);
+		for (const std::string& name : list_directory(journalDir))
+			remove((journalDir + "/" + name).c_str());
+		for (const std::string& name : list_directory(readOnlyDir))
+			remove((readOnlyDir + "/" + name).c_str());
+		remove_directory(readOnlyDir);
+		remove((options.dir + "/holder.ready").c_str());
+		remove((options.dir + "/holder.release").c_str());
+		if (!write_word_list(options.dir + "/en_US.dic", make_workload(default_corpus()), 0))
+		{
+			fprintf(stderr, "cannot write %s/en_US.dic\n", options.dir.c_str());
+			return 2;
+		}
+	}
+	set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+	set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dir);
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", journalDir);
+
+	if (options.child)
+		return journal_child(options);
+
+	int failures = 0;
+
+	// Only reading a dictionary makes nothing, not even the directory.
+	{
+		set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", readOnlyDir);
+		PluginProvider plugin;
+		std::string error;
+		if (plugin.load(options.plugin, error))
+		{
+			ProviderDict dict(plugin.get(), "en_US");
+			if (dict.get())
+				dict.check("the");
+		}
+		set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", journalDir);
+	}
+	if (directory_exists(readOnlyDir))
+	{
+		fprintf(stderr, "a dictionary that was only read made %s\n", readOnlyDir.c_str());
+		++failures;
+	}
+
+	// Running alongside this process from before the crash, with its own
+	// words held back.
+	const std::string child = "\"" + program_path() + "\" journal --plugin \"" + options.plugin + "\" --dir \"" +
+		options.dir + "\" --words " + std::to_string(options.words);
+	start_command(child + " --holder");
+	bool holding = false;
+	for (int waited = 0; waited < 600 && !holding; ++waited)
+	{
+		holding = file_exists(options.dir + "/holder.ready");
+		if (!holding)
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	if (!holding)
+	{
+		fprintf(stderr, "the holding child never got ready\n");
+		++failures;
+	}
+
+	const int childStatus = run_command(child + " --child");
+	if (childStatus != 0 && childStatus != kNotStallable)
+	{
+		fprintf(stderr, "child exited with %d\n", childStatus);
+		make_file(options.dir + "/holder.release");
+		return 2;
+	}
+	const bool stallable = childStatus == 0;
+	holding = holding && stallable;
+
+	std::vector<double> addNs;
+	std::vector<double> syncNs;
+	{
+		PluginProvider plugin;
+		std::string error;
+		if (!plugin.load(options.plugin, error))
+		{
+			fprintf(stderr, "%s\n", error.c_str());
+			return 2;
+		}
+		EnchantProvider* provider = plugin.get();
+		ProviderDict dict(provider, "en_US");
+		if (!dict.get())
+		{
+			fprintf(stderr, "plugin has no dictionary from %s\n", options.dir.c_str());
+			return 2;
+		}
+
+		size_t lost = 0;
+		for (size_t i = 0; i < options.words; ++i)
+		{
+			if (dict.check(filler_word(i)) != 0)
+				++lost;
+		}
+		if (lost && !stallable)
+			fprintf(stderr, "the provider does not run on an executor, so changes could not be held back from it\n");
+		else if (lost)
+		{
+			fprintf(stderr, "%zu of %zu words added before the crash were lost\n", lost, options.words);
+			++failures;
+		}
+		if (dict.check(filler_word(options.words)) == 0)
+		{
+			fprintf(stderr, "a word that was never added is correct\n");
+			++failures;
+		}
+		size_t taken = 0;
+		for (size_t i = 0; holding && i < kHolderWords; ++i)
+			taken += dict.check(filler_word(holder_word(options, i))) == 0;
+		if (taken)
+		{
+			fprintf(stderr, "%zu words were taken from the journal of a process that is still running\n", taken);
+			++failures;
+		}
+
+		// Words of their own, so none are already in the dictionary.
+		for (size_t i = 0; i < options.words; ++i)
+		{
+			const std::string word = filler_word(options.words + 1 + i);
+			Clock::time_point start = Clock::now();
+			dict.get()->add_to_personal(dict.get(), word.c_str(), word.size());
+			addNs.push_back(static_cast<double>(elapsed_ns(start)));
+		}
+		// As many again waited on, as they would be if the backend were
+		// called synchronously: the check is queued behind the add.
+		for (size_t i = 0; i < options.words; ++i)
+		{
+			const std::string word = filler_word(3 * options.words + 1 + i);
+			Clock::time_point start = Clock::now();
+			dict.get()->add_to_personal(dict.get(), word.c_str(), word.size());
+			dict.check(word);
+			syncNs.push_back(static_cast<double>(elapsed_ns(start)));
+		}
+		if (dict.check(filler_word(2 * options.words)) != 0)
+		{
+			fprintf(stderr, "the last word added is not correct\n");
+			++failures;
+		}
+	}
+
+	// Once the holder has gone, its words are the next process's. Its lock
+	// goes when it exits, which this process can't wait on, so it looks
+	// until they turn up.
+	if (holding)
+	{
+		make_file(options.dir + "/holder.release");
+		long found = 0;
+		for (int tries = 0; tries < 100 && found != static_cast<long>(kHolderWords); ++tries)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			found = words_found(options, "en_US", holder_word(options, 0), kHolderWords);
+		}
+		if (found != static_cast<long>(kHolderWords))
+		{
+			fprintf(stderr, "%ld of %zu words held back by a process that has exited were recovered\n", found, kHolderWords);
+			++failures;
+		}
+	}
+
+	// However the tag is spelt, the changes come back.
+	static const char* const kSpellings[][2] = { { "en_US.UTF-8", "en-US" }, { "en-US", "en_US.UTF-8" } };
+	for (size_t i = 0; stallable && i < sizeof(kSpellings) / sizeof(kSpellings[0]); ++i)
+	{
+		const int status = run_command(child + " --child --tag " + kSpellings[i][0]);
+		const long found = status == 0 ? words_found(options, kSpellings[i][1], 0, options.words) : -1;
+		if (found != static_cast<long>(options.words))
+		{
+			fprintf(stderr, "%ld of %zu words added under %s came back under %s\n",
+				found, options.words, kSpellings[i][0], kSpellings[i][1]);
+			++failures;
+		}
+	}
+
+	// A journal goes once the last dictionary for it has been freed, which
+	// is by the time the provider has been disposed of.
+	if (const size_t left = count_journals(journalDir))
+	{
+		fprintf(stderr, "%zu journals left after every change was made\n", left);
+		++failures;
+	}
+
+	CaseResult addResult = summarize_latencies("add_to_personal", addNs, 1000);
+	fprintf(stderr, "%-24s %9zu adds    p50 %7.0f ns  p99 %7.0f ns  max %9.0f ns\n",
+		addResult.name.c_str(), static_cast<size_t>(addResult.operations), addResult.p50_ns, addResult.p99_ns, addResult.max_ns);
+	CaseResult syncResult = summarize_latencies("add_and_wait", syncNs, 1000);
+	fprintf(stderr, "%-24s %9zu adds    p50 %7.0f ns  p99 %7.0f ns  max %9.0f ns\n",
+		syncResult.name.c_str(), static_cast<size_t>(syncResult.operations), syncResult.p50_ns, syncResult.p99_ns, syncResult.max_ns);
+	// Batch by batch rather than against a fixed bound, so a slow or busy
+	// machine slows both sides alike.
+	const double p = mann_whitney_less(addResult.batch_p99_ns, syncResult.batch_p99_ns);
+	if (p > options.max_p)
+	{
+		fprintf(stderr, "p99 of adding a word is not below that of waiting for it (p = %.4f, above %.4f)\n", p, options.max_p);
+		++failures;
+	}
+
+	if (!options.out.empty())
+	{
+		Report report;
+		report.environment = environment_metadata();
+		report.environment["plugin"] = options.plugin;
+		report.cases.push_back(addResult);
+		report.cases.push_back(syncResult);
+		if (!write_report(report, options.out))
+		{
+			fprintf(stderr, "cannot write %s\n", options.out.c_str());
+			return 2;
+		}
+	}
+
+	return failures ? 1 : 0;
+}
+
+} // namespace bench
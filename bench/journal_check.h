@@ -0,0 +1,29 @@
+// enchant_windows - personal dictionary journal check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_JOURNAL_CHECK_H
+#define ENCHANT_WINDOWS_JOURNAL_CHECK_H
+
+namespace bench {
+
+// Entry point for 'enchant_windows_bench journal ...'.
+int journal_main(int argc, char** argv);
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,294 @@
+// enchant_windows - language identification accuracy and throughput.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Identifies every sentence of the held-out samples in data/langid/test
+// (one sentence per line, a file per language) and fails if too few come
+// out right. Then times scoring with and without SIMD and, given
+// dictionaries with --tags, checking the samples shuffled together through
+// a LanguageRouter.
+//
+//   enchant_windows_bench langid [--data data/langid/test] [--tags en_US,de_DE]
+
+#include "langid_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.hpp"
+#include "langid.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+namespace bench {
+
+struct LangidOptions
+{
+	std::string data;
+	std::string tags;
+	std::string out;
+	double min_accuracy;
+	size_t batches;
+
+	LangidOptions() : data("data/langid/test"), min_accuracy(0.95), batches(30) {}
+};
+
+struct Sample
+{
+	std::string text;
+	size_t language;
+};
+
+static void langid_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench langid [options]\n"
+		"  --data DIR           held-out samples, <lang>.txt per language (default data/langid/test)\n"
+		"  --min-accuracy F     fraction of sentences that must be identified (default 0.95)\n"
+		"  --batches N          timed passes over the samples (default 30)\n"
+		"  --tags A,B,...       dictionaries to route the samples between\n"
+		"  --out FILE           write JSON results ('-' for stdout)\n",
+		stderr);
+}
+
+static bool parse_langid_options(int argc, char** argv, LangidOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--data") options.data = v;
+		else if (arg == "--min-accuracy") options.min_accuracy = atof(v);
+		else if (arg == "--batches") options.batches = strtoul(v, nullptr, 10);
+		else if (arg == "--tags") options.tags = v;
+		else if (arg == "--out") options.out = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.batches > 0;
+}
+
+// Every non-empty line of <data>/<lang>.txt, interleaved across languages
+// so that neighbouring samples differ.
+static std::vector<Sample> load_samples(const std::string& dir)
+{
+	std::vector<std::vector<std::string>> lines(kLangidLanguageCount);
+	for (size_t l = 0; l < kLangidLanguageCount; ++l)
+	{
+		std::string contents;
+		if (!read_file(dir + "/" + langid_language(l) + ".txt", contents))
+			continue;
+		size_t start = 0;
+		while (start < contents.size())
+		{
+			size_t end = contents.find('\n', start);
+			if (end == std::string::npos)
+				end = contents.size();
+			std::string line = contents.substr(start, end - start);
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back();
+			if (!line.empty())
+				lines[l].push_back(line);
+			start = end + 1;
+		}
+	}
+
+	std::vector<Sample> samples;
+	for (size_t row = 0; ; ++row)
+	{
+		bool any = false;
+		for (size_t l = 0; l < kLangidLanguageCount; ++l)
+		{
+			if (row < lines[l].size())
+			{
+				samples.push_back(Sample{ lines[l][row], l });
+				any = true;
+			}
+		}
+		if (!any)
+			break;
+	}
+	return samples;
+}
+
+typedef void (*ScoreFn)(std::string_view text, LangidScores& out);
+
+static CaseResult time_scoring(const char* name, ScoreFn score, const std::vector<Sample>& samples, size_t batches, size_t bytes)
+{
+	LangidScores scores;
+	for (const auto& sample : samples)
+		score(sample.text, scores);
+
+	LatencyRecorder recorder(name);
+	for (size_t b = 0; b < batches; ++b)
+	{
+		recorder.begin_batch();
+		for (const auto& sample : samples)
+		{
+			Clock::time_point start = Clock::now();
+			score(sample.text, scores);
+			recorder.record(elapsed_ns(start));
+		}
+		recorder.end_batch();
+	}
+
+	CaseResult result = recorder.finish();
+	result.extra["bytes_per_second"] = result.median_throughput() * bytes / samples.size();
+	fprintf(stderr, "%-24s %12.0f sentences/s  %7.1f MB/s  p50 %7.0f ns  p99 %7.0f ns\n",
+		result.name.c_str(), result.median_throughput(), result.extra["bytes_per_second"] / 1e6,
+		result.p50_ns, result.p99_ns);
+	return result;
+}
+
+int langid_main(int argc, char** argv)
+{
+	LangidOptions options;
+	if (!parse_langid_options(argc, argv, options))
+	{
+		langid_usage();
+		return 2;
+	}
+
+	std::vector<Sample> samples = load_samples(options.data);
+	if (samples.empty())
+	{
+		fprintf(stderr, "no samples in %s\n", options.data.c_str());
+		return 2;
+	}
+
+	Report report;
+	report.environment = environment_metadata();
+	report.environment["data"] = options.data;
+
+	// Accuracy over all the model's languages.
+	size_t right[kLangidLanguageCount] = {};
+	size_t total[kLangidLanguageCount] = {};
+	size_t bytes = 0;
+	for (const auto& sample : samples)
+	{
+		LangidScores scores;
+		langid_score(sample.text, scores);
+		int language = langid_best(scores, ~0u, 0);
+		++total[sample.language];
+		bytes += sample.text.size();
+		if (language == static_cast<int>(sample.language))
+			++right[sample.language];
+		else
+			fprintf(stderr, "%s identified as %s: %s\n", langid_language(sample.language),
+				language < 0 ? "nothing" : langid_language(language), sample.text.c_str());
+	}
+
+	CaseResult accuracy;
+	accuracy.name = "langid_accuracy";
+	size_t allRight = 0;
+	for (size_t l = 0; l < kLangidLanguageCount; ++l)
+	{
+		if (!total[l])
+			continue;
+		allRight += right[l];
+		accuracy.extra[std::string(langid_language(l)) + "_accuracy"] = static_cast<double>(right[l]) / total[l];
+		printf("%s: %zu/%zu\n", langid_language(l), right[l], total[l]);
+	}
+	const double overall = static_cast<double>(allRight) / samples.size();
+	accuracy.extra["accuracy"] = overall;
+	printf("overall: %zu/%zu (%.1f%%)\n", allRight, samples.size(), overall * 100);
+	report.cases.push_back(accuracy);
+
+	report.cases.push_back(time_scoring("langid_score", langid_score, samples, options.batches, bytes));
+	report.cases.push_back(time_scoring("langid_score_scalar", langid_score_scalar, samples, options.batches, bytes));
+
+	// The samples as one mixed document, checked through a router.
+	if (!options.tags.empty())
+	{
+		report.environment["tags"] = options.tags;
+		auto provider = enchant_windows::Provider::create();
+		if (!provider)
+		{
+			fprintf(stderr, "cannot create provider\n");
+			return 2;
+		}
+		std::vector<std::unique_ptr<enchant_windows::Dictionary>> dicts;
+		std::vector<enchant_windows::Dictionary*> routed;
+		size_t pos = 0;
+		while (pos <= options.tags.size())
+		{
+			size_t end = options.tags.find(',', pos);
+			if (end == std::string::npos)
+				end = options.tags.size();
+			std::string tag = options.tags.substr(pos, end - pos);
+			dicts.push_back(provider->request_dict(tag));
+			if (!dicts.back())
+			{
+				fprintf(stderr, "provider has no dictionary for %s\n", tag.c_str());
+				return 2;
+			}
+			routed.push_back(dicts.back().get());
+			pos = end + 1;
+		}
+
+		std::string document;
+		for (const auto& sample : samples)
+			document += sample.text + "\n";
+
+		enchant_windows::LanguageRouter router(routed);
+		std::vector<enchant_windows::LanguageRouter::Word> words;
+		router.check(document, words);
+
+		LatencyRecorder recorder("langid_route_check");
+		for (size_t b = 0; b < options.batches; ++b)
+		{
+			recorder.begin_batch();
+			Clock::time_point start = Clock::now();
+			router.check(document, words);
+			recorder.record(elapsed_ns(start));
+			recorder.end_batch();
+		}
+		CaseResult result = recorder.finish();
+		size_t misspelled = 0;
+		for (const auto& word : words)
+			misspelled += word.result > 0;
+		result.extra["words_per_second"] = result.median_throughput() * words.size();
+		result.extra["misspelled_fraction"] = static_cast<double>(misspelled) / words.size();
+		fprintf(stderr, "%-24s %12.0f words/s  %zu of %zu words misspelled\n",
+			result.name.c_str(), result.extra["words_per_second"], misspelled, words.size());
+		report.cases.push_back(result);
+	}
+
+	if (!options.out.empty() && !write_report(report, options.out))
+	{
+		fprintf(stderr, "cannot write %s\n", options.out.c_str());
+		return 2;
+	}
+
+	if (overall < options.min_accuracy)
+	{
+		fprintf(stderr, "accuracy %.3f is below %.3f\n", overall, options.min_accuracy);
+		return 1;
+	}
+	return 0;
+}
+
+} // namespace bench
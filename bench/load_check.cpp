@@ -0,0 +1,404 @@
+// enchant_windows - asynchronous dictionary loading check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Opens several dictionaries one after another with request_dict, then all
+// at once with enchant_windows_request_dict_async, and compares how long
+// the caller is held up each way. While the asynchronous ones load it
+// checks a word, adds one and queues an asynchronous check. Fails if
+// requests take longer than allowed to return, if a load fails, or if the
+// word added or the check queued during loading comes out wrong once it
+// has loaded. The dictionaries are word lists written from the corpus,
+// padded out with filler so they take a while to load. Last, runs the
+// provider core in this process on a one-thread executor, with a backend
+// whose English checks ask a German dictionary of the same provider, and
+// fails unless such a check, made from inside the provider's own job, comes
+// back.
+//
+//   enchant_windows_bench load --plugin PATH [--tags en_US,de_DE,...]
+
+#include "load_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "windows_provider.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <thread>
+
+namespace bench {
+
+struct LoadOptions
+{
+	std::string plugin;
+	std::string corpus;
+	std::string dict_dir;
+	std::string out;
+	std::vector<std::string> tags;
+	size_t filler_words;
+	double max_request_ms;
+
+	LoadOptions() : dict_dir("load_dict"), tags({ "en_US", "en_GB", "de_DE", "fr_FR" }), filler_words(200000), max_request_ms(5.0) {}
+};
+
+// English and German, where English checks of "nested" are passed on to
+// the German dictionary, as a backend falling back on another language
+// might.
+class NestingBackend : public SpellBackend
+{
+public:
+	explicit NestingBackend(std::atomic<EnchantDict*>& german) : german(german) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t* tag) override
+	{
+		return std::u16string(tag) == u"en-US" || std::u16string(tag) == u"de-DE";
+	}
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t* tag) override
+	{
+		return is_supported(tag) ? std::make_unique<Checker>(german) : nullptr;
+	}
+
+private:
+	class Checker : public SpellChecker
+	{
+	public:
+		explicit Checker(std::atomic<EnchantDict*>& german) : german(german) {}
+
+		int check(const char16_t* word) override
+		{
+			EnchantDict* dict = german;
+			if (std::u16string(word) != u"nested" || !dict)
+				return std::u16string(word) == u"hallo" ? 0 : 1;
+			return dict->check(dict, "hallo", 5);
+		}
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override { return nullptr; }
+		bool add(const char16_t*) override { return true; }
+		bool ignore(const char16_t*) override { return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		std::atomic<EnchantDict*>& german;
+	};
+
+	std::atomic<EnchantDict*>& german;
+};
+
+// Returns 0 if a check made from inside the provider's job on a one-thread
+// executor comes back right, 1 if it comes back wrong, and doesn't return
+// if it never comes back.
+static int check_nested_call()
+{
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	ThreadPool pool(1);
+	if (enchant_windows_set_executor(&ThreadPool::execute, &pool) != 0)
+	{
+		fprintf(stderr, "cannot set an executor\n");
+		return 1;
+	}
+	std::atomic<EnchantDict*> german(nullptr);
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>([&german]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<NestingBackend>(german);
+	});
+	EnchantDict* english = provider ? provider->request_dict(provider, "en_US") : nullptr;
+	german = provider ? provider->request_dict(provider, "de_DE") : nullptr;
+	if (!english || !german)
+	{
+		fprintf(stderr, "no dictionaries from the stand-in backend\n");
+		return 1;
+	}
+
+	std::atomic<bool> done(false);
+	int result = -1;
+	std::thread checker([&]() {
+		result = english->check(english, "nested", 6);
+		done = true;
+	});
+	for (int i = 0; i < 500 && !done; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	if (!done)
+	{
+		// Waiting on itself; nothing will let it go.
+		fprintf(stderr, "a check made from inside the provider's job on its executor never came back\n");
+		fflush(stderr);
+		_Exit(1);
+	}
+	checker.join();
+
+	provider->dispose_dict(provider, english);
+	provider->dispose_dict(provider, german);
+	provider->dispose(provider);
+	enchant_windows_set_executor(nullptr, nullptr);
+	if (result != 0)
+	{
+		fprintf(stderr, "a check passed on to another dictionary came back %d\n", result);
+		return 1;
+	}
+	return 0;
+}
+
+static void load_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench load --plugin PATH [options]\n"
+		"  --corpus FILE          UTF-8 text to take words from\n"
+		"  --dict-dir DIR         where to write the word lists (default load_dict)\n"
+		"  --tags A,B,...         dictionaries to open (default en_US,en_GB,de_DE,fr_FR)\n"
+		"  --filler-words N       extra words in each word list (default 200000)\n"
+		"  --max-request-ms F     allowed median time for an asynchronous request to return (default 5)\n"
+		"  --out FILE             write JSON results ('-' for stdout)\n",
+		stderr);
+}
+
+static bool parse_load_options(int argc, char** argv, LoadOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--plugin") options.plugin = v;
+		else if (arg == "--corpus") options.corpus = v;
+		else if (arg == "--dict-dir") options.dict_dir = v;
+		else if (arg == "--filler-words") options.filler_words = strtoul(v, nullptr, 10);
+		else if (arg == "--max-request-ms") options.max_request_ms = atof(v);
+		else if (arg == "--out") options.out = v;
+		else if (arg == "--tags")
+		{
+			options.tags.clear();
+			std::istringstream in(v);
+			std::string tag;
+			while (std::getline(in, tag, ','))
+			{
+				if (!tag.empty())
+					options.tags.push_back(tag);
+			}
+		}
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return !options.plugin.empty() && !options.dict_dir.empty() && !options.tags.empty();
+}
+
+int load_main(int argc, char** argv)
+{
+	LoadOptions options;
+	if (!parse_load_options(argc, argv, options))
+	{
+		load_usage();
+		return 2;
+	}
+
+	std::string text = default_corpus();
+	if (!options.corpus.empty() && !read_file(options.corpus, text))
+	{
+		fprintf(stderr, "cannot read corpus %s\n", options.corpus.c_str());
+		return 2;
+	}
+	const Workload workload = make_workload(text);
+	if (workload.correct.empty())
+	{
+		fprintf(stderr, "corpus contains no words\n");
+		return 2;
+	}
+
+	make_directory(options.dict_dir);
+	for (const auto& tag : options.tags)
+	{
+		if (!write_word_list(options.dict_dir + "/" + tag + ".dic", workload, options.filler_words))
+		{
+			fprintf(stderr, "cannot write %s/%s.dic\n", options.dict_dir.c_str(), tag.c_str());
+			return 2;
+		}
+	}
+	set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+	set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dict_dir);
+
+	PluginProvider plugin;
+	std::string error;
+	if (!plugin.load(options.plugin, error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 2;
+	}
+	auto requestAsync = reinterpret_cast<enchant_windows_request_dict_async_fn>(plugin.symbol("enchant_windows_request_dict_async"));
+	auto loadState = reinterpret_cast<enchant_windows_dict_load_state_fn>(plugin.symbol("enchant_windows_dict_load_state"));
+	auto checkAsync = reinterpret_cast<enchant_windows_dict_check_async_fn>(plugin.symbol("enchant_windows_dict_check_async"));
+	auto completionFd = reinterpret_cast<enchant_windows_completion_fd_fn>(plugin.symbol("enchant_windows_completion_fd"));
+	auto pollCompletions = reinterpret_cast<enchant_windows_poll_completions_fn>(plugin.symbol("enchant_windows_poll_completions"));
+	if (!requestAsync || !loadState || !checkAsync || !completionFd || !pollCompletions)
+	{
+		fprintf(stderr, "%s does not export asynchronous loading\n", options.plugin.c_str());
+		return 2;
+	}
+
+	EnchantProvider* provider = plugin.get();
+	int failures = 0;
+
+	// One after another, the caller waiting for each.
+	std::vector<double> syncNs;
+	Clock::time_point syncStart = Clock::now();
+	for (const auto& tag : options.tags)
+	{
+		Clock::time_point start = Clock::now();
+		ProviderDict dict(provider, tag.c_str());
+		syncNs.push_back(static_cast<double>(elapsed_ns(start)));
+		if (!dict.get())
+		{
+			fprintf(stderr, "plugin has no dictionary for %s; is it built with the word list backend?\n", tag.c_str());
+			return 2;
+		}
+	}
+	const double syncMs = elapsed_ns(syncStart) / 1e6;
+
+	// All at once, with a completion for each as it loads.
+	std::vector<EnchantDict*> dicts;
+	std::vector<double> requestNs;
+	Clock::time_point asyncStart = Clock::now();
+	for (size_t i = 0; i < options.tags.size(); ++i)
+	{
+		Clock::time_point start = Clock::now();
+		EnchantDict* dict = requestAsync(provider, options.tags[i].c_str(), reinterpret_cast<void*>(i + 1));
+		requestNs.push_back(static_cast<double>(elapsed_ns(start)));
+		if (!dict)
+		{
+			fprintf(stderr, "asynchronous request for %s failed\n", options.tags[i].c_str());
+			for (EnchantDict* d : dicts)
+				provider->dispose_dict(provider, d);
+			return 2;
+		}
+		dicts.push_back(dict);
+	}
+
+	// What the application can do while they load.
+	EnchantDict* first = dicts[0];
+	const std::string& added = workload.misspelled[0];
+	const std::string& queued = workload.correct[0];
+	const bool stillLoading = loadState(first) == ENCHANT_WINDOWS_DICT_LOADING;
+	Clock::time_point earlyStart = Clock::now();
+	const int earlyResult = first->check(first, queued.c_str(), queued.size());
+	const double earlyNs = static_cast<double>(elapsed_ns(earlyStart));
+	first->add_to_personal(first, added.c_str(), added.size());
+	checkAsync(first, queued.c_str(), queued.size(), nullptr);
+
+	// The queued check and a completion per dictionary.
+	size_t outstanding = dicts.size() + 1;
+	int queuedResult = 1;
+	int loadFailures = 0;
+	std::vector<EnchantWindowsCompletion> completions(outstanding);
+	while (outstanding > 0)
+	{
+		if (!wait_readable(completionFd(), 60000))
+		{
+			fprintf(stderr, "%zu completion(s) never arrived\n", outstanding);
+			return 1;
+		}
+		const size_t n = pollCompletions(completions.data(), completions.size());
+		for (size_t c = 0; c < n; ++c)
+		{
+			if (!completions[c].cookie)
+				queuedResult = completions[c].result;
+			else if (completions[c].result != 0)
+				++loadFailures;
+		}
+		outstanding -= std::min(n, outstanding);
+	}
+	const double asyncMs = elapsed_ns(asyncStart) / 1e6;
+
+	if (loadFailures)
+	{
+		fprintf(stderr, "%d dictionary load(s) failed\n", loadFailures);
+		++failures;
+	}
+	if (stillLoading && earlyResult != ENCHANT_WINDOWS_CHECK_PENDING)
+	{
+		fprintf(stderr, "check during loading returned %d, not pending\n", earlyResult);
+		++failures;
+	}
+	if (queuedResult != 0)
+	{
+		fprintf(stderr, "check queued during loading completed with %d\n", queuedResult);
+		++failures;
+	}
+	if (first->check(first, added.c_str(), added.size()) != 0)
+	{
+		fprintf(stderr, "'%s' was added during loading but is not correct\n", added.c_str());
+		++failures;
+	}
+	for (EnchantDict* dict : dicts)
+	{
+		if (loadState(dict) != ENCHANT_WINDOWS_DICT_READY)
+		{
+			fprintf(stderr, "a dictionary did not finish loading\n");
+			++failures;
+		}
+		provider->dispose_dict(provider, dict);
+	}
+
+	CaseResult syncResult = summarize_latencies("request_dict", syncNs, 1);
+	CaseResult requestResult = summarize_latencies("request_dict_async", requestNs, 1);
+	syncResult.extra["total_ms"] = syncMs;
+	requestResult.extra["total_ms"] = asyncMs;
+	requestResult.extra["early_check_ns"] = earlyNs;
+	fprintf(stderr, "%zu dictionaries: request_dict holds the caller %.1f ms in all (max %.1f ms each)\n",
+		options.tags.size(), syncMs, syncResult.max_ns / 1e6);
+	fprintf(stderr, "request_dict_async returns in %.3f ms (max %.3f ms), all loaded after %.1f ms; a check while loading took %.0f ns\n",
+		requestResult.p50_ns / 1e6, requestResult.max_ns / 1e6, asyncMs, earlyNs);
+
+	// The median, since the threads loading the first dictionaries can
+	// preempt a later request on a machine with few cores.
+	if (requestResult.p50_ns / 1e6 > options.max_request_ms)
+	{
+		fprintf(stderr, "asynchronous requests took %.3f ms, above %.3f ms\n", requestResult.p50_ns / 1e6, options.max_request_ms);
+		++failures;
+	}
+
+	failures += check_nested_call();
+
+	if (!options.out.empty())
+	{
+		Report report;
+		report.environment = environment_metadata();
+		report.environment["plugin"] = options.plugin;
+		report.environment["filler_words"] = std::to_string(options.filler_words);
+		report.cases.push_back(syncResult);
+		report.cases.push_back(requestResult);
+		if (!write_report(report, options.out))
+		{
+			fprintf(stderr, "cannot write %s\n", options.out.c_str());
+			return 2;
+		}
+	}
+
+	return failures ? 1 : 0;
+}
+
+} // namespace bench
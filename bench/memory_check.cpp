@@ -0,0 +1,263 @@
+// enchant_windows - per-dictionary memory bounds check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Runs a representative workload over several dictionaries, then reads each
+// one's byte accounting through enchant_windows_dict_memory_usage and fails
+// if a dictionary holds more than the allowed bytes, peaked above the
+// allowed peak, or still has string lists charged after all were freed.
+// With --dict-dir, the workload's words are written there as the word list
+// the plugin reads, so the check needs no dictionaries installed.
+//
+//   enchant_windows_bench memory --plugin PATH --dicts 8 [--dict-dir DIR]
+
+#include "memory_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+
+namespace bench {
+
+struct MemoryOptions
+{
+	std::string plugin;
+	std::string tag;
+	std::string corpus;
+	std::string out;
+	std::string dict_dir;
+	size_t dicts;
+	size_t rounds;
+	size_t held_lists;
+	size_t max_bytes;
+	size_t max_peak_bytes;
+
+	MemoryOptions() :
+		tag("en_US"),
+		dicts(8),
+		rounds(3),
+		held_lists(16),
+		max_bytes(16 * 1024),
+		max_peak_bytes(256 * 1024)
+	{}
+};
+
+static void memory_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench memory --plugin PATH [options]\n"
+		"  --tag TAG                   dictionary to request (default en_US)\n"
+		"  --corpus FILE               UTF-8 text to take words from\n"
+		"  --dicts N                   dictionaries to open (default 8)\n"
+		"  --rounds N                  passes over the corpus per dictionary (default 3)\n"
+		"  --held-lists N              suggestion lists held at once (default 16)\n"
+		"  --max-bytes-per-dict N      bound on bytes held after the workload (default 16384)\n"
+		"  --max-peak-bytes-per-dict N bound on peak bytes (default 262144)\n"
+		"  --dict-dir DIR              write the word list here and use the word list backend\n"
+		"  --out FILE                  write JSON results ('-' for stdout)\n",
+		stderr);
+}
+
+static bool parse_memory_options(int argc, char** argv, MemoryOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--plugin") options.plugin = v;
+		else if (arg == "--tag") options.tag = v;
+		else if (arg == "--corpus") options.corpus = v;
+		else if (arg == "--dicts") options.dicts = strtoul(v, nullptr, 10);
+		else if (arg == "--rounds") options.rounds = strtoul(v, nullptr, 10);
+		else if (arg == "--held-lists") options.held_lists = strtoul(v, nullptr, 10);
+		else if (arg == "--max-bytes-per-dict") options.max_bytes = strtoul(v, nullptr, 10);
+		else if (arg == "--max-peak-bytes-per-dict") options.max_peak_bytes = strtoul(v, nullptr, 10);
+		else if (arg == "--out") options.out = v;
+		else if (arg == "--dict-dir") options.dict_dir = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return !options.plugin.empty() && options.dicts > 0;
+}
+
+int memory_main(int argc, char** argv)
+{
+	MemoryOptions options;
+	if (!parse_memory_options(argc, argv, options))
+	{
+		memory_usage();
+		return 2;
+	}
+
+	std::string text = default_corpus();
+	if (!options.corpus.empty() && !read_file(options.corpus, text))
+	{
+		fprintf(stderr, "cannot read corpus %s\n", options.corpus.c_str());
+		return 2;
+	}
+	const Workload workload = make_workload(text);
+	if (!options.dict_dir.empty())
+	{
+		make_directory(options.dict_dir);
+		if (!write_word_list(options.dict_dir + "/" + options.tag + ".dic", workload, 0))
+		{
+			fprintf(stderr, "cannot write %s/%s.dic\n", options.dict_dir.c_str(), options.tag.c_str());
+			return 2;
+		}
+		set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+		set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dict_dir);
+	}
+
+	PluginProvider plugin;
+	std::string error;
+	if (!plugin.load(options.plugin, error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 2;
+	}
+	auto memoryUsage = reinterpret_cast<enchant_windows_dict_memory_usage_fn>(plugin.symbol("enchant_windows_dict_memory_usage"));
+	auto categoryName = reinterpret_cast<enchant_windows_memory_category_name_fn>(plugin.symbol("enchant_windows_memory_category_name"));
+	if (!memoryUsage || !categoryName)
+	{
+		fprintf(stderr, "%s does not export memory accounting\n", options.plugin.c_str());
+		return 2;
+	}
+
+	EnchantProvider* provider = plugin.get();
+	std::vector<std::unique_ptr<ProviderDict>> dicts;
+	for (size_t d = 0; d < options.dicts; ++d)
+	{
+		dicts.emplace_back(new ProviderDict(provider, options.tag.c_str()));
+		if (!dicts.back()->get())
+		{
+			fprintf(stderr, "provider has no dictionary for %s\n", options.tag.c_str());
+			return 2;
+		}
+	}
+
+	// Hold a window of suggestion lists the way a client showing several
+	// suggestion menus would, so the string arena has something to count.
+	std::deque<char**> held;
+	size_t heldArenaBytes = 0;
+	for (size_t round = 0; round < options.rounds; ++round)
+	{
+		for (const auto& dict : dicts)
+		{
+			for (const auto& word : workload.correct)
+				dict->check(word);
+			for (const auto& word : workload.misspelled)
+			{
+				dict->check(word);
+				size_t count = 0;
+				char** list = dict->get()->suggest(dict->get(), word.c_str(), word.size(), &count);
+				if (!list)
+					continue;
+				held.push_back(list);
+				if (held.size() > options.held_lists)
+				{
+					provider->free_string_list(provider, held.front());
+					held.pop_front();
+				}
+			}
+
+			EnchantWindowsDictMemory usage;
+			if (memoryUsage(dict->get(), &usage) == 0)
+				heldArenaBytes = std::max(heldArenaBytes, usage.current_bytes[ENCHANT_WINDOWS_MEMORY_STRING_ARENA]);
+		}
+	}
+	for (char** list : held)
+		provider->free_string_list(provider, list);
+	held.clear();
+
+	int failures = 0;
+	CaseResult result;
+	result.name = "memory";
+	result.extra["held_string_arena_bytes"] = static_cast<double>(heldArenaBytes);
+	for (size_t d = 0; d < dicts.size(); ++d)
+	{
+		EnchantWindowsDictMemory usage;
+		if (memoryUsage(dicts[d]->get(), &usage) != 0)
+		{
+			fprintf(stderr, "dict %zu: memory usage query failed\n", d);
+			++failures;
+			continue;
+		}
+
+		printf("dict %zu: %zu bytes (peak %zu)", d, usage.total_bytes, usage.peak_total_bytes);
+		for (int c = 0; c < ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT; ++c)
+		{
+			printf(", %s %zu/%zu", categoryName(c), usage.current_bytes[c], usage.peak_bytes[c]);
+			double& current = result.extra[std::string(categoryName(c)) + "_bytes"];
+			double& peak = result.extra[std::string(categoryName(c)) + "_peak_bytes"];
+			current = std::max(current, static_cast<double>(usage.current_bytes[c]));
+			peak = std::max(peak, static_cast<double>(usage.peak_bytes[c]));
+		}
+		printf("\n");
+		result.extra["total_bytes"] = std::max(result.extra["total_bytes"], static_cast<double>(usage.total_bytes));
+		result.extra["peak_total_bytes"] = std::max(result.extra["peak_total_bytes"], static_cast<double>(usage.peak_total_bytes));
+
+		if (usage.total_bytes > options.max_bytes)
+		{
+			fprintf(stderr, "dict %zu: %zu bytes exceeds bound of %zu\n", d, usage.total_bytes, options.max_bytes);
+			++failures;
+		}
+		if (usage.peak_total_bytes > options.max_peak_bytes)
+		{
+			fprintf(stderr, "dict %zu: peak of %zu bytes exceeds bound of %zu\n", d, usage.peak_total_bytes, options.max_peak_bytes);
+			++failures;
+		}
+		if (usage.current_bytes[ENCHANT_WINDOWS_MEMORY_STRING_ARENA] != 0)
+		{
+			fprintf(stderr, "dict %zu: %zu string list bytes still charged after all lists were freed\n",
+				d, usage.current_bytes[ENCHANT_WINDOWS_MEMORY_STRING_ARENA]);
+			++failures;
+		}
+	}
+
+	if (!options.out.empty())
+	{
+		Report report;
+		report.environment = environment_metadata();
+		report.environment["plugin"] = options.plugin;
+		report.environment["tag"] = options.tag;
+		report.environment["dicts"] = std::to_string(options.dicts);
+		report.cases.push_back(result);
+		if (!write_report(report, options.out))
+		{
+			fprintf(stderr, "cannot write %s\n", options.out.c_str());
+			return 2;
+		}
+	}
+
+	return failures ? 1 : 0;
+}
+
+} // namespace bench
@@ -0,0 +1,216 @@
+// enchant_windows - hardware performance counters for the benchmarks.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "perf_counters.h"
+#include "bench_harness.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+const char* PerfCounters::name(Counter counter)
+{
+	switch (counter)
+	{
+	case Cycles: return "cycles";
+	case Instructions: return "instructions";
+	case CacheMisses: return "cache_misses";
+	case BranchMisses: return "branch_misses";
+	case ContextSwitches: return "context_switches";
+	default: return "unknown";
+	}
+}
+
+PerfCounters::PerfCounters()
+{
+	for (int i = 0; i < kCounterCount; ++i)
+		fds[i] = -1;
+}
+
+#ifdef __linux__
+
+PerfCounters::~PerfCounters()
+{
+	for (int i = 0; i < kCounterCount; ++i)
+	{
+		if (fds[i] >= 0)
+			close(fds[i]);
+	}
+}
+
+static int open_counter(uint32_t type, uint64_t config, bool userOnly)
+{
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.inherit = 1;
+	attr.exclude_kernel = userOnly ? 1 : 0;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+bool PerfCounters::open()
+{
+	// Unprivileged users can usually only count user space, which is what
+	// we want for the hardware events anyway.
+	fds[Cycles] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, true);
+	fds[Instructions] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, true);
+	fds[CacheMisses] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, true);
+	fds[BranchMisses] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, true);
+	// Context switches happen in the kernel, so excluding it would count
+	// nothing. Software events are permitted at the default paranoia level.
+	fds[ContextSwitches] = open_counter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, false);
+	return available();
+}
+
+void PerfCounters::start()
+{
+	for (int i = 0; i < kCounterCount; ++i)
+	{
+		if (fds[i] >= 0)
+		{
+			ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+			ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+}
+
+PerfCounters::Sample PerfCounters::stop()
+{
+	Sample sample;
+	for (int i = 0; i < kCounterCount; ++i)
+	{
+		if (fds[i] >= 0)
+			ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+	}
+	for (int i = 0; i < kCounterCount; ++i)
+	{
+		sample.valid[i] = false;
+		sample.value[i] = 0;
+		if (fds[i] < 0)
+			continue;
+
+		// value, time enabled, time running. Scale up if the kernel had
+		// to multiplex the counter with others.
+		uint64_t data[3] = {};
+		if (read(fds[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0)
+			continue;
+		sample.valid[i] = true;
+		sample.value[i] = data[2] < data[1]
+			? static_cast<uint64_t>(static_cast<double>(data[0]) * data[1] / data[2])
+			: data[0];
+	}
+	return sample;
+}
+
+#else
+
+PerfCounters::~PerfCounters() {}
+
+bool PerfCounters::open()
+{
+	return false;
+}
+
+void PerfCounters::start() {}
+
+PerfCounters::Sample PerfCounters::stop()
+{
+	Sample sample;
+	for (int i = 0; i < kCounterCount; ++i)
+	{
+		sample.valid[i] = false;
+		sample.value[i] = 0;
+	}
+	return sample;
+}
+
+#endif
+
+bool PerfCounters::available() const
+{
+	for (int i = 0; i < kCounterCount; ++i)
+	{
+		if (fds[i] >= 0)
+			return true;
+	}
+	return false;
+}
+
+void PerfCounters::annotate(CaseResult& result, const Sample& sample, uint64_t operations)
+{
+	if (operations == 0)
+		return;
+	for (int i = 0; i < kCounterCount; ++i)
+	{
+		if (sample.valid[i])
+			result.extra[std::string(name(static_cast<Counter>(i))) + "_per_op"] = static_cast<double>(sample.value[i]) / operations;
+	}
+	if (sample.valid[Cycles] && sample.valid[Instructions] && sample.value[Cycles] > 0)
+		result.extra["ipc"] = static_cast<double>(sample.value[Instructions]) / sample.value[Cycles];
+	if (sample.valid[ContextSwitches])
+		result.extra["context_switches"] = static_cast<double>(sample.value[ContextSwitches]);
+}
+
+std::string PerfCounters::describe(const Sample& sample, uint64_t operations)
+{
+	if (operations == 0)
+		return std::string();
+	std::string out;
+	char buf[64];
+	if (sample.valid[Cycles] && sample.valid[Instructions] && sample.value[Cycles] > 0)
+	{
+		snprintf(buf, sizeof(buf), "  IPC %.2f", static_cast<double>(sample.value[Instructions]) / sample.value[Cycles]);
+		out += buf;
+	}
+	if (sample.valid[Cycles])
+	{
+		snprintf(buf, sizeof(buf), "  cyc/op %.0f", static_cast<double>(sample.value[Cycles]) / operations);
+		out += buf;
+	}
+	if (sample.valid[CacheMisses])
+	{
+		snprintf(buf, sizeof(buf), "  llc-miss/op %.2f", static_cast<double>(sample.value[CacheMisses]) / operations);
+		out += buf;
+	}
+	if (sample.valid[BranchMisses])
+	{
+		snprintf(buf, sizeof(buf), "  br-miss/op %.2f", static_cast<double>(sample.value[BranchMisses]) / operations);
+		out += buf;
+	}
+	if (sample.valid[ContextSwitches])
+	{
+		snprintf(buf, sizeof(buf), "  cs/op %.2f", static_cast<double>(sample.value[ContextSwitches]) / operations);
+		out += buf;
+	}
+	return out;
+}
+
+} // namespace bench
@@ -0,0 +1,81 @@
+// enchant_windows - hardware performance counters for the benchmarks.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_PERF_COUNTERS_H
+#define ENCHANT_WINDOWS_PERF_COUNTERS_H
+
+#include <cstdint>
+#include <string>
+
+namespace bench {
+
+struct CaseResult;
+
+// Process-wide counters read through perf_event_open on Linux. The counters
+// are inherited by threads created after open(), so they include the
+// provider's dispatcher thread as long as they are opened before the plugin
+// is loaded. Elsewhere, or when the kernel refuses, they are simply absent.
+class PerfCounters
+{
+public:
+	enum Counter
+	{
+		Cycles,
+		Instructions,
+		CacheMisses,
+		BranchMisses,
+		ContextSwitches,
+		kCounterCount
+	};
+
+	struct Sample
+	{
+		bool valid[kCounterCount];
+		uint64_t value[kCounterCount];
+	};
+
+	PerfCounters();
+	~PerfCounters();
+
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+
+	// Open whichever counters the host allows. Returns false if none are.
+	bool open();
+	bool available() const;
+
+	// Zero and enable all counters.
+	void start();
+	// Disable all counters and read them.
+	Sample stop();
+
+	static const char* name(Counter counter);
+
+	// Add per-operation counts, IPC and context switches to 'result.extra'.
+	static void annotate(CaseResult& result, const Sample& sample, uint64_t operations);
+
+	// One-line summary for console output; empty if nothing was counted.
+	static std::string describe(const Sample& sample, uint64_t operations);
+
+private:
+	int fds[kCounterCount];
+};
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,215 @@
+// enchant_windows - profile-guided optimization training run.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+// Drives an instrumented build of the plugin through the paths worth
+// optimizing for, in roughly the proportions editors use them: mostly
+// checks, some suggestions, and a little dictionary churn and personal
+// dictionary traffic. The plugin is told to use a word list written from
+// the corpus, so the profile doesn't depend on which Windows languages are
+// installed and is the same on every platform.
+//
+//   enchant_windows_bench train --plugin PATH [--dict-dir DIR]
+
+#include "pgo_training.h"
+#include "bench_harness.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+
+namespace bench {
+
+struct TrainOptions
+{
+	std::string plugin;
+	std::string corpus;
+	std::string dict_dir;
+	size_t iterations;
+
+	TrainOptions() : dict_dir("pgo_dict"), iterations(20) {}
+};
+
+static void train_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench train --plugin PATH [options]\n"
+		"  --corpus FILE        UTF-8 text to take words from\n"
+		"  --dict-dir DIR       where to write the training word list (default pgo_dict)\n"
+		"  --iterations N       passes over the workload (default 20)\n",
+		stderr);
+}
+
+static bool parse_train_options(int argc, char** argv, TrainOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--plugin") options.plugin = v;
+		else if (arg == "--corpus") options.corpus = v;
+		else if (arg == "--dict-dir") options.dict_dir = v;
+		else if (arg == "--iterations") options.iterations = strtoul(v, nullptr, 10);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return !options.plugin.empty() && !options.dict_dir.empty();
+}
+
+// Write the corpus words, lowercased, as en_US.dic in 'dir'.
+static bool write_training_dictionary(const std::string& dir, const Workload& workload)
+{
+	make_directory(dir);
+	std::set<std::string> words;
+	for (auto word : workload.correct)
+	{
+		for (auto& c : word)
+			c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+		words.insert(word);
+	}
+
+	std::ofstream out(dir + "/en_US.dic", std::ios::binary);
+	if (!out)
+		return false;
+	out << words.size() << "\n";
+	for (const auto& word : words)
+		out << word << "\n";
+	return static_cast<bool>(out);
+}
+
+static std::string capitalized(std::string word)
+{
+	if (!word.empty())
+		word[0] = static_cast<char>(toupper(static_cast<unsigned char>(word[0])));
+	return word;
+}
+
+int train_main(int argc, char** argv)
+{
+	TrainOptions options;
+	if (!parse_train_options(argc, argv, options))
+	{
+		train_usage();
+		return 2;
+	}
+
+	std::string text = default_corpus();
+	if (!options.corpus.empty() && !read_file(options.corpus, text))
+	{
+		fprintf(stderr, "cannot read corpus %s\n", options.corpus.c_str());
+		return 2;
+	}
+	const Workload workload = make_workload(text);
+	if (workload.correct.empty())
+	{
+		fprintf(stderr, "corpus contains no words\n");
+		return 2;
+	}
+
+	if (!write_training_dictionary(options.dict_dir, workload))
+	{
+		fprintf(stderr, "cannot write %s/en_US.dic\n", options.dict_dir.c_str());
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+	set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dict_dir);
+
+	PluginProvider plugin;
+	std::string error;
+	if (!plugin.load(options.plugin, error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 2;
+	}
+	EnchantProvider* provider = plugin.get();
+
+	size_t checks = 0;
+	size_t suggestions = 0;
+	size_t churn = 0;
+	for (size_t iteration = 0; iteration < options.iterations; ++iteration)
+	{
+		ProviderDict dict(provider, "en_US");
+		if (!dict.get())
+		{
+			fprintf(stderr, "plugin has no training dictionary; is it built with the word list backend?\n");
+			return 2;
+		}
+
+		// Checks: mostly correct words, as typed text mostly is, with some
+		// capitalized and some misspelled.
+		for (size_t pass = 0; pass < 4; ++pass)
+		{
+			for (const auto& word : workload.correct)
+				dict.check(word);
+			checks += workload.correct.size();
+		}
+		for (size_t i = 0; i < workload.correct.size(); i += 4)
+		{
+			dict.check(capitalized(workload.correct[i]));
+			++checks;
+		}
+		for (const auto& word : workload.misspelled)
+			dict.check(word);
+		checks += workload.misspelled.size();
+
+		// Suggestions for a share of the misspellings.
+		for (size_t i = 0; i < workload.misspelled.size(); i += 3)
+		{
+			dict.suggest(workload.misspelled[i]);
+			++suggestions;
+		}
+
+		// Personal dictionary traffic.
+		const std::string& added = workload.misspelled[iteration % workload.misspelled.size()];
+		const std::string& replacement = workload.correct[iteration % workload.correct.size()];
+		dict.get()->add_to_personal(dict.get(), added.c_str(), added.size());
+		dict.get()->add_to_exclude(dict.get(), added.c_str(), added.size());
+		dict.get()->store_replacement(dict.get(), added.c_str(), added.size(), replacement.c_str(), replacement.size());
+
+		// Dictionary churn, as when documents in several languages are opened.
+		for (size_t i = 0; i < 4; ++i)
+		{
+			ProviderDict other(provider, "en_US");
+			other.check(workload.correct[i % workload.correct.size()]);
+			++churn;
+		}
+		provider->dictionary_exists(provider, "en_US");
+		provider->dictionary_exists(provider, "xx_XX");
+		size_t count = 0;
+		char** dicts = provider->list_dicts(provider, &count);
+		if (dicts)
+			provider->free_string_list(provider, dicts);
+	}
+
+	printf("trained with %zu checks, %zu suggestions and %zu dictionary requests\n", checks, suggestions, churn);
+	return 0;
+}
+
+} // namespace bench
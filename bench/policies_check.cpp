@@ -0,0 +1,260 @@
+// enchant_windows - policy overhead check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Backs up "a disabled policy compiles out": times checks through the
+// provider core built with DefaultProviderPolicies against the same checks
+// made the way the provider made them before it had policies, converted to
+// UTF-16 and dispatched straight to the worker thread. Both run in this
+// process on one stand-in backend that knows the corpus words, in batches
+// that take turns, the same words in the same order.
+//
+// Fails if the default configuration's median throughput is more than
+// --max-overhead below the baseline's and a Mann-Whitney U test over the
+// per-batch throughputs finds the difference significant at --alpha.
+//
+//   enchant_windows_bench policies [--batches 30] [--batch-size 500]
+
+#include "policies_check.h"
+#include "bench_harness.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "utf.h"
+#include "windows_provider.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+
+namespace bench {
+
+struct PoliciesOptions
+{
+	std::string out;
+	size_t batches;
+	size_t batch_size;
+	double max_overhead;
+	double alpha;
+
+	PoliciesOptions() : batches(30), batch_size(500), max_overhead(0.15), alpha(0.01) {}
+};
+
+static void policies_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench policies [options]\n"
+		"  --batches N            samples per case (default 30)\n"
+		"  --batch-size N         checks per sample (default 500)\n"
+		"  --max-overhead F       allowed fraction of throughput lost to the policies (default 0.15)\n"
+		"  --alpha F              significance level of the comparison (default 0.01)\n"
+		"  --out FILE             write JSON results ('-' for stdout)\n",
+		stderr);
+}
+
+static bool parse_policies_options(int argc, char** argv, PoliciesOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--batches") options.batches = strtoul(v, nullptr, 10);
+		else if (arg == "--batch-size") options.batch_size = strtoul(v, nullptr, 10);
+		else if (arg == "--max-overhead") options.max_overhead = atof(v);
+		else if (arg == "--alpha") options.alpha = atof(v);
+		else if (arg == "--out") options.out = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.batches > 1 && options.batch_size > 0;
+}
+
+static std::u16string to_utf16(const std::string& word)
+{
+	std::u16string out(utf8_to_utf16(word.data(), word.size(), nullptr), u'\0');
+	utf8_to_utf16(word.data(), word.size(), &out[0]);
+	return out;
+}
+
+// en-US, knowing 'words'.
+class KnownWordsBackend : public SpellBackend
+{
+public:
+	explicit KnownWordsBackend(const std::set<std::u16string>& words) : words(words) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t* tag) override { return std::u16string(tag) == u"en-US"; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t* tag) override
+	{
+		return is_supported(tag) ? std::make_unique<Checker>(words) : nullptr;
+	}
+
+private:
+	class Checker : public SpellChecker
+	{
+	public:
+		explicit Checker(const std::set<std::u16string>& words) : words(words) {}
+
+		int check(const char16_t* word) override { return words.count(word) ? 0 : 1; }
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override { return nullptr; }
+		bool add(const char16_t*) override { return true; }
+		bool ignore(const char16_t*) override { return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		const std::set<std::u16string>& words;
+	};
+
+	const std::set<std::u16string>& words;
+};
+
+// A check as the provider made it before it had policies.
+static int baseline_check(SpellChecker& checker, const std::string& word)
+{
+	return WorkerDispatch::dispatch([&checker, &word]() -> int {
+		const size_t len = utf8_to_utf16(word.data(), word.size(), nullptr);
+		auto utf16Word = std::make_unique<char16_t[]>(len + 1);
+		utf8_to_utf16(word.data(), word.size(), utf16Word.get());
+		utf16Word[len] = 0;
+		return checker.check(utf16Word.get());
+	});
+}
+
+int policies_main(int argc, char** argv)
+{
+	PoliciesOptions options;
+	if (!parse_policies_options(argc, argv, options))
+	{
+		policies_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+
+	const Workload workload = make_workload(default_corpus());
+	std::set<std::u16string> known;
+	std::vector<std::string> words;
+	for (size_t i = 0; i < workload.correct.size(); ++i)
+	{
+		known.insert(to_utf16(workload.correct[i]));
+		words.push_back(workload.correct[i]);
+		words.push_back(workload.misspelled[i]);
+	}
+
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>([&known]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<KnownWordsBackend>(known);
+	});
+	EnchantDict* dict = provider ? provider->request_dict(provider, "en_US") : nullptr;
+	if (!dict)
+	{
+		fprintf(stderr, "no dictionary from the stand-in backend\n");
+		return 2;
+	}
+	WorkerDispatch::addref();
+	KnownWordsBackend backend(known);
+	std::unique_ptr<SpellChecker> checker = WorkerDispatch::dispatch([&backend]() {
+		return backend.create_spell_checker(u"en-US");
+	});
+
+	size_t mismatches = 0;
+	for (const std::string& word : words)
+	{
+		if (dict->check(dict, word.data(), word.size()) != baseline_check(*checker, word))
+			++mismatches;
+	}
+
+	LatencyRecorder baseline("baseline_check");
+	LatencyRecorder policies("default_policies_check");
+	size_t next = 0;
+	for (size_t b = 0; b < options.batches; ++b)
+	{
+		// Each goes first every other batch.
+		for (int turn = 0; turn < 2; ++turn)
+		{
+			const bool first = (turn == 0) == (b % 2 == 0);
+			LatencyRecorder& recorder = first ? baseline : policies;
+			size_t at = next;
+			recorder.begin_batch();
+			for (size_t i = 0; i < options.batch_size; ++i)
+			{
+				const std::string& word = words[at++ % words.size()];
+				Clock::time_point start = Clock::now();
+				if (first)
+					do_not_optimize(baseline_check(*checker, word));
+				else
+					do_not_optimize(dict->check(dict, word.data(), word.size()));
+				recorder.record(elapsed_ns(start));
+			}
+			recorder.end_batch();
+		}
+		next += options.batch_size;
+	}
+
+	WorkerDispatch::dispatch([&checker]() { checker.reset(); });
+	WorkerDispatch::release();
+	provider->dispose_dict(provider, dict);
+	provider->dispose(provider);
+
+	CaseResult baselineResult = baseline.finish();
+	CaseResult policiesResult = policies.finish();
+	const double ratio = policiesResult.median_throughput() / baselineResult.median_throughput();
+	const double p = mann_whitney_less(policiesResult.batch_throughput, baselineResult.batch_throughput);
+	for (const CaseResult* result : { &baselineResult, &policiesResult })
+	{
+		fprintf(stderr, "%-24s %10.0f checks/s  p50 %7.0f ns  p99 %7.0f ns\n",
+			result->name.c_str(), result->median_throughput(), result->p50_ns, result->p99_ns);
+	}
+	fprintf(stderr, "default policies at %.1f%% of the baseline's throughput (p = %.4f that it is lower)\n", 100.0 * ratio, p);
+
+	int failures = 0;
+	if (mismatches)
+	{
+		fprintf(stderr, "%zu check(s) differ from the baseline's\n", mismatches);
+		++failures;
+	}
+	if (ratio < 1.0 - options.max_overhead && p < options.alpha)
+	{
+		fprintf(stderr, "the default policies cost more than %.0f%% of the baseline's throughput\n", 100.0 * options.max_overhead);
+		++failures;
+	}
+
+	if (!options.out.empty())
+	{
+		Report report;
+		report.environment = environment_metadata();
+		report.cases.push_back(baselineResult);
+		report.cases.push_back(policiesResult);
+		if (!write_report(report, options.out))
+		{
+			fprintf(stderr, "cannot write %s\n", options.out.c_str());
+			return 2;
+		}
+	}
+
+	return failures ? 1 : 0;
+}
+
+} // namespace bench
@@ -0,0 +1,254 @@
+// enchant_windows - check latency while a dictionary is reloaded.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Checks words on one thread while another reloads the dictionary over and
+// over with enchant_windows_dict_reload, and compares the check latency
+// during reloads with the latency between them and with how long checks
+// would be held up if the dictionary were loaded where they run. Fails
+// if checks during a reload are slower than allowed, or if a word added to
+// the dictionary is lost by the reload. The dictionary is a word list
+// written from the corpus, padded out with filler so it takes a while to
+// load.
+//
+//   enchant_windows_bench reload --plugin PATH [--filler-words N] [--reloads N]
+
+#include "reload_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace bench {
+
+struct ReloadOptions
+{
+	std::string plugin;
+	std::string corpus;
+	std::string dict_dir;
+	std::string out;
+	size_t filler_words;
+	size_t reloads;
+	double max_p99_ratio;
+
+	ReloadOptions() : dict_dir("reload_dict"), filler_words(200000), reloads(10), max_p99_ratio(5.0) {}
+};
+
+static void reload_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench reload --plugin PATH [options]\n"
+		"  --corpus FILE        UTF-8 text to take words from\n"
+		"  --dict-dir DIR       where to write the word list (default reload_dict)\n"
+		"  --filler-words N     extra words in the word list (default 200000)\n"
+		"  --reloads N          reloads to time checks across (default 10)\n"
+		"  --max-p99-ratio F    allowed p99 during reloads over p99 between them (default 5)\n"
+		"  --out FILE           write JSON results ('-' for stdout)\n",
+		stderr);
+}
+
+static bool parse_reload_options(int argc, char** argv, ReloadOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--plugin") options.plugin = v;
+		else if (arg == "--corpus") options.corpus = v;
+		else if (arg == "--dict-dir") options.dict_dir = v;
+		else if (arg == "--filler-words") options.filler_words = strtoul(v, nullptr, 10);
+		else if (arg == "--reloads") options.reloads = strtoul(v, nullptr, 10);
+		else if (arg == "--max-p99-ratio") options.max_p99_ratio = atof(v);
+		else if (arg == "--out") options.out = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return !options.plugin.empty() && !options.dict_dir.empty() && options.reloads > 0;
+}
+
+int reload_main(int argc, char** argv)
+{
+	ReloadOptions options;
+	if (!parse_reload_options(argc, argv, options))
+	{
+		reload_usage();
+		return 2;
+	}
+
+	std::string text = default_corpus();
+	if (!options.corpus.empty() && !read_file(options.corpus, text))
+	{
+		fprintf(stderr, "cannot read corpus %s\n", options.corpus.c_str());
+		return 2;
+	}
+	const Workload workload = make_workload(text);
+	if (workload.correct.empty())
+	{
+		fprintf(stderr, "corpus contains no words\n");
+		return 2;
+	}
+
+	make_directory(options.dict_dir);
+	if (!write_word_list(options.dict_dir + "/en_US.dic", workload, options.filler_words))
+	{
+		fprintf(stderr, "cannot write %s/en_US.dic\n", options.dict_dir.c_str());
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+	set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dict_dir);
+
+	PluginProvider plugin;
+	std::string error;
+	if (!plugin.load(options.plugin, error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 2;
+	}
+	auto reload = reinterpret_cast<enchant_windows_dict_reload_fn>(plugin.symbol("enchant_windows_dict_reload"));
+	auto waitForReload = reinterpret_cast<enchant_windows_dict_wait_for_reload_fn>(plugin.symbol("enchant_windows_dict_wait_for_reload"));
+	if (!reload || !waitForReload)
+	{
+		fprintf(stderr, "%s does not export reloading\n", options.plugin.c_str());
+		return 2;
+	}
+
+	EnchantProvider* provider = plugin.get();
+	int failures = 0;
+
+	// Loading the word list from cold is what a reload done where checks
+	// run would hold them up for.
+	Clock::time_point coldStart = Clock::now();
+	ProviderDict dict(provider, "en_US");
+	const double coldMs = elapsed_ns(coldStart) / 1e6;
+	if (!dict.get())
+	{
+		fprintf(stderr, "plugin has no dictionary from %s; is it built with the word list backend?\n", options.dict_dir.c_str());
+		return 2;
+	}
+
+	const std::string& added = workload.misspelled[0];
+	dict.get()->add_to_personal(dict.get(), added.c_str(), added.size());
+
+	std::atomic<bool> reloading(false);
+	std::atomic<bool> done(false);
+	std::vector<double> reloadNs;
+	int reloadFailures = 0;
+	std::thread reloader([&]() {
+		for (size_t r = 0; r < options.reloads; ++r)
+		{
+			// Some time between reloads for the steady-state samples.
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			reloading = true;
+			Clock::time_point start = Clock::now();
+			if (reload(dict.get()) != 0 || waitForReload(dict.get()) != 0)
+				++reloadFailures;
+			reloadNs.push_back(static_cast<double>(elapsed_ns(start)));
+			reloading = false;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		done = true;
+	});
+
+	std::vector<double> during;
+	std::vector<double> between;
+	for (size_t i = 0; !done; ++i)
+	{
+		const std::string& word = workload.correct[i % workload.correct.size()];
+		bool before = reloading;
+		Clock::time_point start = Clock::now();
+		dict.check(word);
+		double ns = static_cast<double>(elapsed_ns(start));
+		if (before && reloading)
+			during.push_back(ns);
+		else if (!before && !reloading)
+			between.push_back(ns);
+	}
+	reloader.join();
+
+	if (reloadFailures)
+	{
+		fprintf(stderr, "%d reload(s) failed\n", reloadFailures);
+		++failures;
+	}
+	if (dict.check(added) != 0)
+	{
+		fprintf(stderr, "'%s' was added before the reloads but is no longer correct\n", added.c_str());
+		++failures;
+	}
+	if (options.filler_words && dict.check(filler_word(options.filler_words - 1)) != 0)
+	{
+		fprintf(stderr, "reloaded dictionary is missing words\n");
+		++failures;
+	}
+	if (during.empty() || between.empty())
+	{
+		fprintf(stderr, "no checks were timed %s reloads\n", during.empty() ? "during" : "between");
+		return 2;
+	}
+
+	CaseResult duringResult = summarize_latencies("check_during_reload", during, 1000);
+	CaseResult betweenResult = summarize_latencies("check_between_reloads", between, 1000);
+	const double reloadMs = median(reloadNs) / 1e6;
+	duringResult.extra["reload_ms"] = reloadMs;
+	duringResult.extra["cold_load_ms"] = coldMs;
+	for (const CaseResult* r : { &betweenResult, &duringResult })
+	{
+		fprintf(stderr, "%-24s %9zu checks  p50 %7.0f ns  p99 %7.0f ns  max %9.0f ns\n",
+			r->name.c_str(), static_cast<size_t>(r->operations), r->p50_ns, r->p99_ns, r->max_ns);
+	}
+	fprintf(stderr, "reload takes %.1f ms in the background; loading the dictionary in place would hold checks for %.1f ms\n",
+		reloadMs, coldMs);
+
+	const double ratio = duringResult.p99_ns / betweenResult.p99_ns;
+	if (ratio > options.max_p99_ratio)
+	{
+		fprintf(stderr, "p99 during reloads is %.1fx that between them, above %.1fx\n", ratio, options.max_p99_ratio);
+		++failures;
+	}
+
+	if (!options.out.empty())
+	{
+		Report report;
+		report.environment = environment_metadata();
+		report.environment["plugin"] = options.plugin;
+		report.environment["filler_words"] = std::to_string(options.filler_words);
+		report.cases.push_back(betweenResult);
+		report.cases.push_back(duringResult);
+		if (!write_report(report, options.out))
+		{
+			fprintf(stderr, "cannot write %s\n", options.out.c_str());
+			return 2;
+		}
+	}
+
+	return failures ? 1 : 0;
+}
+
+} // namespace bench
@@ -0,0 +1,482 @@
+// enchant_windows - script classification check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+// Checks the script classifier (src/unicode_script.h) and what it saves.
+// Classifies every code point, alone, between ASCII letters, across a
+// 16-byte block boundary and repeated, plus random bytes, with and without
+// SIMD, and fails if the two ever differ or a sample of each script comes
+// out wrong, or the scripts of a dictionary for a tag, however it is
+// spelled, are. Times both on words of each script. Then sends chat-like
+// traffic, most of it in scripts English isn't written in, through an
+// en_US dictionary on a stand-in backend that counts its checks, with
+// skipping on and off (ENCHANT_WINDOWS_SCRIPT_SKIP=0). Finally checks a
+// LanguageRouter over English and Russian word lists in --dict-dir sends
+// Cyrillic words in an English sentence to the Russian dictionary and skips
+// emoji and Han, and that the English dictionary on its own takes Cyrillic
+// and Han as correct, checked one at a time or in a batch.
+//
+// Fails on any misclassification, if the backend is asked about a word in
+// a script English isn't written in while skipping, or if skipping is no
+// faster.
+//
+//   enchant_windows_bench scripts [--words 20000] [--dict-dir scripts_dict]
+
+#include "scripts_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+#include "enchant-windows.hpp"
+#include "language_tags.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "unicode_script.h"
+#include "windows_provider.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+struct ScriptsOptions
+{
+	size_t words;
+	std::string dict_dir;
+
+	ScriptsOptions() : words(20000), dict_dir("scripts_dict") {}
+};
+
+// Letters to make words of in each script, and how common words in it are
+// in the chat traffic, out of 100.
+struct ScriptSample
+{
+	UnicodeScript script;
+	uint32_t first;
+	uint32_t last;
+	unsigned share;
+};
+
+static const ScriptSample kSamples[] = {
+	{ kScriptLatin, 'a', 'z', 45 },
+	{ kScriptGreek, 0x3B1, 0x3C9, 0 },
+	{ kScriptCyrillic, 0x430, 0x44F, 10 },
+	{ kScriptArmenian, 0x561, 0x586, 0 },
+	{ kScriptHebrew, 0x5D0, 0x5EA, 0 },
+	{ kScriptArabic, 0x627, 0x64A, 5 },
+	{ kScriptDevanagari, 0x915, 0x939, 0 },
+	{ kScriptThai, 0xE01, 0xE2E, 5 },
+	{ kScriptHangul, 0xAC00, 0xD7A3, 5 },
+	{ kScriptKana, 0x3041, 0x3093, 5 },
+	{ kScriptHan, 0x4E00, 0x9FFF, 10 },
+	{ kScriptEmoji, 0x1F600, 0x1F64F, 10 },
+	{ kScriptOther, 0x10D0, 0x10FA, 5 },  // Georgian
+};
+
+static void scripts_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench scripts [options]\n"
+		"  --words N            words per script, and of chat traffic (default 20000)\n"
+		"  --dict-dir DIR       where to write the router's word lists (default scripts_dict)\n",
+		stderr);
+}
+
+static bool parse_scripts_options(int argc, char** argv, ScriptsOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--words") options.words = strtoul(v, nullptr, 10);
+		else if (arg == "--dict-dir") options.dict_dir = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.words > 0 && !options.dict_dir.empty();
+}
+
+static void append_utf8(std::string& out, uint32_t c)
+{
+	if (c < 0x80)
+	{
+		out += static_cast<char>(c);
+	}
+	else if (c < 0x800)
+	{
+		out += static_cast<char>(0xC0 | (c >> 6));
+		out += static_cast<char>(0x80 | (c & 0x3F));
+	}
+	else if (c < 0x10000)
+	{
+		out += static_cast<char>(0xE0 | (c >> 12));
+		out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		out += static_cast<char>(0x80 | (c & 0x3F));
+	}
+	else
+	{
+		out += static_cast<char>(0xF0 | (c >> 18));
+		out += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+		out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		out += static_cast<char>(0x80 | (c & 0x3F));
+	}
+}
+
+static std::string make_word(const ScriptSample& sample, std::mt19937& random)
+{
+	std::string word;
+	const size_t letters = sample.script == kScriptEmoji ? 1 + random() % 3 : 2 + random() % 8;
+	for (size_t i = 0; i < letters; ++i)
+		append_utf8(word, sample.first + random() % (sample.last - sample.first + 1));
+	return word;
+}
+
+// Counts of words the classifiers disagree on, and that come out wrong.
+static size_t check_classifier()
+{
+	size_t failures = 0;
+	auto compare = [&](const std::string& word) {
+		const ScriptSet simd = word_scripts(word.data(), word.size());
+		const ScriptSet scalar = word_scripts_scalar(word.data(), word.size());
+		if (simd != scalar && failures++ < 10)
+			fprintf(stderr, "%zu bytes: %x with SIMD, %x without\n", word.size(), simd, scalar);
+	};
+
+	for (uint32_t c = 0; c < 0x110000; ++c)
+	{
+		if (c >= 0xD800 && c < 0xE000)
+			continue;
+		std::string alone;
+		append_utf8(alone, c);
+		compare(alone);
+		compare("ab" + alone + "cd");
+		compare(std::string(15, 'x') + alone);
+		compare(alone + alone + alone + alone + alone + alone);
+	}
+
+	std::mt19937 random(1);
+	for (size_t i = 0; i < 200000; ++i)
+	{
+		std::string bytes(1 + random() % 40, '\0');
+		for (char& b : bytes)
+			b = static_cast<char>(random());
+		compare(bytes);
+	}
+
+	for (const ScriptSample& sample : kSamples)
+	{
+		for (size_t i = 0; i < 100; ++i)
+		{
+			const std::string word = make_word(sample, random);
+			if (word_scripts(word.data(), word.size()) != script_bit(sample.script) && failures++ < 10)
+				fprintf(stderr, "%s word %s is %x\n", script_name(sample.script), word.c_str(), word_scripts(word.data(), word.size()));
+		}
+	}
+	static const char* const kNoScript[] = { "2024", "--", "\xE2\x80\x99", "\xC2\xA9", "\xE3\x80\x82", "\xCC\x81" };
+	for (const char* word : kNoScript)
+	{
+		if (word_scripts(word, strlen(word)) != 0 && failures++ < 10)
+			fprintf(stderr, "%s has a script\n", word);
+	}
+	return failures;
+}
+
+// The scripts of dictionaries for tags however they are spelled, once
+// canonicalized. Returns the number that are wrong.
+static size_t check_dictionary_scripts()
+{
+	struct Expected
+	{
+		const char* tag;
+		ScriptSet scripts;
+	};
+	const Expected expected[] = {
+		{ "ru_RU.UTF-8", script_bit(kScriptCyrillic) },
+		{ "EN-us", script_bit(kScriptLatin) },
+		{ "sr_latn_RS", script_bit(kScriptLatin) },
+		{ "sr-Cyrl", script_bit(kScriptCyrillic) },
+		{ "zh_hant_TW", script_bit(kScriptHan) },
+		{ "xx_YY", kAllScripts },
+	};
+	size_t failures = 0;
+	for (const Expected& entry : expected)
+	{
+		const LanguageTagRef language = resolve_language_tag(entry.tag);
+		const ScriptSet scripts = language ? dictionary_scripts(language->bcp47) : 0;
+		if (scripts != entry.scripts)
+		{
+			fprintf(stderr, "a dictionary for %s is written in %x, not %x\n", entry.tag, scripts, entry.scripts);
+			++failures;
+		}
+	}
+	return failures;
+}
+
+static double time_classifier(const std::vector<std::string>& words, ScriptSet (*classify)(const char*, size_t))
+{
+	// Enough passes to run for a while whatever the number of words.
+	const size_t passes = 1 + 400000 / words.size();
+	const Clock::time_point start = Clock::now();
+	for (size_t pass = 0; pass < passes; ++pass)
+	{
+		for (const std::string& word : words)
+			do_not_optimize(classify(word.data(), word.size()));
+	}
+	return static_cast<double>(elapsed_ns(start)) / (passes * words.size());
+}
+
+// Every word is misspelled; checks are counted.
+class MisspellingBackend : public SpellBackend
+{
+public:
+	explicit MisspellingBackend(std::atomic<size_t>& checks) : checks(checks) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t*) override { return 1; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t*) override
+	{
+		return std::make_unique<Checker>(checks);
+	}
+
+private:
+	class Checker : public SpellChecker
+	{
+	public:
+		explicit Checker(std::atomic<size_t>& checks) : checks(checks) {}
+
+		int check(const char16_t*) override
+		{
+			++checks;
+			return 1;
+		}
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override { return nullptr; }
+		bool add(const char16_t*) override { return true; }
+		bool ignore(const char16_t*) override { return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		std::atomic<size_t>& checks;
+	};
+
+	std::atomic<size_t>& checks;
+};
+
+struct TrafficRun
+{
+	size_t checks;
+	size_t misspelled;
+	double ns_per_word;
+};
+
+static TrafficRun run_traffic(EnchantDict* dict, const std::vector<std::string>& words, std::atomic<size_t>& checks)
+{
+	TrafficRun run = {};
+	checks = 0;
+	const Clock::time_point start = Clock::now();
+	for (const std::string& word : words)
+	{
+		if (dict->check(dict, word.data(), word.size()) > 0)
+			++run.misspelled;
+	}
+	run.ns_per_word = static_cast<double>(elapsed_ns(start)) / words.size();
+	run.checks = checks;
+	return run;
+}
+
+// Returns the number of words routed wrongly.
+static size_t check_router(const ScriptsOptions& options)
+{
+	make_directory(options.dict_dir);
+	{
+		std::ofstream en(options.dict_dir + "/en_US.dic", std::ios::binary);
+		en << "hello\nworld\ncat\n";
+		std::ofstream ru(options.dict_dir + "/ru_RU.dic", std::ios::binary);
+		ru << "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82\n\xD0\xBC\xD0\xB8\xD1\x80\n";
+	}
+	set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dict_dir);
+	set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+	auto provider = enchant_windows::Provider::create();
+	auto en = provider ? provider->request_dict("en_US") : nullptr;
+	auto ru = provider ? provider->request_dict("ru_RU") : nullptr;
+	if (!en || !ru)
+	{
+		fprintf(stderr, "cannot load the word lists in %s\n", options.dict_dir.c_str());
+		return 1;
+	}
+
+	struct Expected
+	{
+		const char* word;
+		enchant_windows::Dictionary* dictionary;
+		int result;
+	};
+	const Expected expected[] = {
+		{ "hello", en.get(), 0 },
+		{ "wrld", en.get(), 1 },
+		{ "\xF0\x9F\x98\x80", nullptr, 0 },
+		{ "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82", ru.get(), 0 },
+		{ "\xD0\xBC\xD0\xB8\xD1\x80\xD1\x80", ru.get(), 1 },
+		{ "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", nullptr, 0 },
+		{ "cat", en.get(), 0 },
+	};
+	std::string text;
+	for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i)
+		text += std::string(expected[i].word) + (i == 2 ? ". " : " ");
+
+	enchant_windows::LanguageRouter router({ en.get(), ru.get() });
+	std::vector<enchant_windows::LanguageRouter::Word> words;
+	router.check(text, words);
+	size_t wrong = 0;
+	for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i)
+	{
+		const bool right = i < words.size() && text.compare(words[i].offset, words[i].length, expected[i].word) == 0 &&
+			words[i].dictionary == expected[i].dictionary && words[i].result == expected[i].result;
+		if (!right)
+		{
+			fprintf(stderr, "router got %s wrong\n", expected[i].word);
+			++wrong;
+		}
+	}
+	if (words.size() != sizeof(expected) / sizeof(expected[0]))
+		++wrong;
+
+	const std::string_view outside[] = { expected[4].word, expected[5].word };
+	int batch[2] = { -1, -1 };
+	en->check(enchant_windows::Span<const std::string_view>(outside, 2), enchant_windows::Span<int>(batch, 2));
+	for (size_t i = 0; i < 2; ++i)
+	{
+		if (en->check(outside[i]) != 0 || batch[i] != 0)
+		{
+			fprintf(stderr, "the English dictionary did not skip %s\n", std::string(outside[i]).c_str());
+			++wrong;
+		}
+	}
+	return wrong;
+}
+
+int scripts_main(int argc, char** argv)
+{
+	ScriptsOptions options;
+	if (!parse_scripts_options(argc, argv, options))
+	{
+		scripts_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+	set_environment("ENCHANT_WINDOWS_SCRIPT_SKIP", "");
+
+	size_t failures = 0;
+	auto fail = [&](const char* what) {
+		fprintf(stderr, "%s\n", what);
+		++failures;
+	};
+
+	if (check_classifier())
+		fail("script classification wrong");
+	if (check_dictionary_scripts())
+		fail("dictionary scripts wrong");
+
+	std::mt19937 random(2);
+	printf("%-12s %8s %10s %12s\n", "script", "bytes", "ns/word", "scalar ns");
+	for (const ScriptSample& sample : kSamples)
+	{
+		std::vector<std::string> words;
+		size_t bytes = 0;
+		for (size_t i = 0; i < options.words; ++i)
+		{
+			words.push_back(make_word(sample, random));
+			bytes += words.back().size();
+		}
+		const double simd = time_classifier(words, word_scripts);
+		const double scalar = time_classifier(words, word_scripts_scalar);
+		printf("%-12s %8.1f %10.1f %12.1f\n", script_name(sample.script), static_cast<double>(bytes) / words.size(), simd, scalar);
+	}
+
+	// Chat traffic: words of each script in proportion to its share.
+	std::vector<std::string> traffic;
+	size_t latin = 0;
+	for (size_t i = 0; i < options.words; ++i)
+	{
+		unsigned pick = random() % 100;
+		for (const ScriptSample& sample : kSamples)
+		{
+			if (pick < sample.share)
+			{
+				traffic.push_back(make_word(sample, random));
+				latin += sample.script == kScriptLatin;
+				break;
+			}
+			pick -= sample.share;
+		}
+	}
+
+	std::atomic<size_t> checks(0);
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>([&]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<MisspellingBackend>(checks);
+	});
+	EnchantDict* dict = provider ? provider->request_dict(provider, "en_US") : nullptr;
+	if (!dict)
+	{
+		fprintf(stderr, "cannot create the provider\n");
+		return 2;
+	}
+	const TrafficRun skipping = run_traffic(dict, traffic, checks);
+	provider->dispose_dict(provider, dict);
+	set_environment("ENCHANT_WINDOWS_SCRIPT_SKIP", "0");
+	dict = provider->request_dict(provider, "en_US");
+	set_environment("ENCHANT_WINDOWS_SCRIPT_SKIP", "");
+	const TrafficRun checking = dict ? run_traffic(dict, traffic, checks) : TrafficRun();
+	if (dict)
+		provider->dispose_dict(provider, dict);
+	provider->dispose(provider);
+
+	printf("%zu words of chat, %zu in Latin script\n", traffic.size(), latin);
+	printf("%-12s %10s %10s %10s\n", "", "checks", "flagged", "ns/word");
+	printf("%-12s %10zu %10zu %10.0f\n", "skipping", skipping.checks, skipping.misspelled, skipping.ns_per_word);
+	printf("%-12s %10zu %10zu %10.0f\n", "checking", checking.checks, checking.misspelled, checking.ns_per_word);
+	if (skipping.checks != latin || skipping.misspelled != latin)
+		fail("backend asked about words in other scripts");
+	if (checking.checks != traffic.size())
+		fail("ENCHANT_WINDOWS_SCRIPT_SKIP=0 not applied");
+	if (skipping.ns_per_word >= checking.ns_per_word)
+		fail("skipping is no faster");
+
+	if (check_router(options))
+		fail("router sent words to the wrong dictionary");
+	if (failures)
+		return 1;
+	printf("ok\n");
+	return 0;
+}
+
+} // namespace bench
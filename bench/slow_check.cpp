@@ -0,0 +1,313 @@
+// enchant_windows - slow-call log check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Runs the provider core in this process on the word list backend with the
+// slow-call log taking every call. Makes --calls checks, suggestions and
+// dictionary_exists calls in turn, more than the ring holds, and fails
+// unless the ring has the most recent 256, oldest first, numbered one after
+// another, each with its call's operation, language, length and FNV-1a
+// hash. Then fails if a call under the threshold is logged, or one made with
+// the log off; if capturing words every Nth entry doesn't keep exactly those
+// words; if the asynchronous check, completion, asynchronous load and reload
+// aren't logged; or if the dump doesn't have a line per entry.
+//
+//   enchant_windows_bench slow [--calls 300] [--dict-dir slow_dict]
+
+#include "slow_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+#include "provider_policies.h"
+#include "windows_provider.h"
+#include "wordlist_spell_backend.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace bench {
+
+struct SlowOptions
+{
+	std::string dict_dir;
+	size_t calls;
+
+	SlowOptions() : dict_dir("slow_dict"), calls(300) {}
+};
+
+static void slow_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench slow [options]\n"
+		"  --calls N            calls made with every one logged (default 300)\n"
+		"  --dict-dir DIR       where to write the word list and dump (default slow_dict)\n",
+		stderr);
+}
+
+static bool parse_slow_options(int argc, char** argv, SlowOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--calls") options.calls = strtoul(v, nullptr, 10);
+		else if (arg == "--dict-dir") options.dict_dir = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.calls > 0 && !options.dict_dir.empty();
+}
+
+// Entries the ring keeps.
+static const size_t kRingEntries = 256;
+
+// What a logged call should look like.
+struct ExpectedCall
+{
+	int op;
+	std::string word;
+	bool hasWord;
+};
+
+// FNV-1a, 64-bit, worked out here rather than trusted to the log.
+static unsigned long long fnv1a(const std::string& word)
+{
+	unsigned long long hash = 14695981039346656037ull;
+	for (unsigned char c : word)
+		hash = (hash ^ c) * 1099511628211ull;
+	return hash;
+}
+
+static std::vector<EnchantWindowsSlowCall> slow_calls()
+{
+	std::vector<EnchantWindowsSlowCall> entries(kRingEntries + 1);
+	entries.resize(enchant_windows_slow_calls(entries.data(), entries.size()));
+	return entries;
+}
+
+static unsigned long long last_sequence()
+{
+	const std::vector<EnchantWindowsSlowCall> entries = slow_calls();
+	return entries.empty() ? 0 : entries.back().sequence;
+}
+
+// Whether an entry after 'since' is for 'op'.
+static bool logged_since(unsigned long long since, int op)
+{
+	for (const EnchantWindowsSlowCall& entry : slow_calls())
+	{
+		if (entry.sequence > since && entry.op == op)
+			return true;
+	}
+	return false;
+}
+
+static std::string op_name(int op)
+{
+	const char* name = enchant_windows_op_name(op);
+	return name ? name : std::to_string(op);
+}
+
+static void check_word(EnchantDict* dict, const std::string& word)
+{
+	dict->check(dict, word.data(), word.size());
+}
+
+static void suggest_word(EnchantProvider* provider, EnchantDict* dict, const std::string& word)
+{
+	size_t n = 0;
+	char** list = dict->suggest(dict, word.data(), word.size(), &n);
+	if (list)
+		provider->free_string_list(provider, list);
+}
+
+int slow_main(int argc, char** argv)
+{
+	SlowOptions options;
+	if (!parse_slow_options(argc, argv, options))
+	{
+		slow_usage();
+		return 2;
+	}
+	make_directory(options.dict_dir);
+	if (!write_word_list(options.dict_dir + "/en_US.dic", make_workload(default_corpus()), 0))
+	{
+		fprintf(stderr, "cannot write %s/en_US.dic\n", options.dict_dir.c_str());
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_COMPLETION_PATH", options.dict_dir);
+	set_environment("ENCHANT_WINDOWS_WORDLIST_PATH", options.dict_dir);
+	set_environment("ENCHANT_WINDOWS_BACKEND", "wordlist");
+
+	size_t failures = 0;
+	auto fail = [&](const std::string& what) {
+		if (failures++ < 10)
+			fprintf(stderr, "%s\n", what.c_str());
+	};
+
+	if (enchant_windows_set_slow_call_log(0, ENCHANT_WINDOWS_CAPTURE_WORD + 1, 1) != -1 ||
+		enchant_windows_set_slow_call_log(0, ENCHANT_WINDOWS_CAPTURE_HASH, 0) != -1)
+		fail("out of range settings were taken");
+	enchant_windows_set_slow_call_log(0, ENCHANT_WINDOWS_CAPTURE_HASH, 1);
+
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>(create_wordlist_spell_backend);
+	EnchantDict* dict = provider ? provider->request_dict(provider, "en_US") : nullptr;
+	if (!dict)
+	{
+		fprintf(stderr, "cannot create the provider\n");
+		return 2;
+	}
+
+	// More calls than the ring holds, each logged.
+	std::vector<ExpectedCall> expected;
+	const unsigned long long first = last_sequence() + 1;
+	for (size_t i = 0; i < options.calls; ++i)
+	{
+		const std::string word = filler_word(i);
+		switch (i % 3)
+		{
+		case 0:
+			check_word(dict, word);
+			expected.push_back({ ENCHANT_WINDOWS_OP_CHECK, word, true });
+			break;
+		case 1:
+			suggest_word(provider, dict, word);
+			expected.push_back({ ENCHANT_WINDOWS_OP_SUGGEST, word, true });
+			break;
+		default:
+			provider->dictionary_exists(provider, "en_US");
+			expected.push_back({ ENCHANT_WINDOWS_OP_DICTIONARY_EXISTS, "en_US", false });
+			break;
+		}
+	}
+	std::vector<EnchantWindowsSlowCall> ring = slow_calls();
+	ring.erase(std::remove_if(ring.begin(), ring.end(),
+		[first](const EnchantWindowsSlowCall& entry) { return entry.sequence < first; }), ring.end());
+	const size_t kept = std::min(options.calls, kRingEntries);
+	if (ring.size() != kept)
+		fail(std::to_string(ring.size()) + " entries kept of " + std::to_string(options.calls) + " calls");
+	for (size_t i = 0; i < ring.size() && i < kept; ++i)
+	{
+		const size_t call = options.calls - kept + i;
+		const ExpectedCall& want = expected[call];
+		const EnchantWindowsSlowCall& got = ring[i];
+		const std::string where = "entry " + std::to_string(i) + " (call " + std::to_string(call) + "): ";
+		if (got.sequence != first + call)
+			fail(where + "sequence " + std::to_string(got.sequence) + " instead of " + std::to_string(first + call));
+		if (got.op != want.op)
+			fail(where + "op " + op_name(got.op) + " instead of " + op_name(want.op));
+		if (strcmp(got.tag, "en_US") != 0)
+			fail(where + "tag '" + got.tag + "'");
+		if (want.hasWord && (got.capture != ENCHANT_WINDOWS_CAPTURE_HASH || got.word_hash != fnv1a(want.word) ||
+				got.word_length != want.word.size()))
+			fail(where + "hash or length of '" + want.word + "' wrong");
+		if (!want.hasWord && got.capture != ENCHANT_WINDOWS_CAPTURE_NONE)
+			fail(where + "a call without a word has a capture");
+	}
+
+	// Under the threshold, and with the log off.
+	unsigned long long before = last_sequence();
+	enchant_windows_set_slow_call_log(60000000, ENCHANT_WINDOWS_CAPTURE_HASH, 1);
+	check_word(dict, "quick");
+	enchant_windows_set_slow_call_log(ENCHANT_WINDOWS_SLOW_CALL_OFF, ENCHANT_WINDOWS_CAPTURE_HASH, 1);
+	check_word(dict, "off");
+	if (last_sequence() != before)
+		fail("a call under the threshold or with the log off was logged");
+
+	// Every fourth entry keeps its word.
+	const unsigned kSampleEvery = 4;
+	enchant_windows_set_slow_call_log(0, ENCHANT_WINDOWS_CAPTURE_WORD, kSampleEvery);
+	before = last_sequence();
+	for (size_t i = 0; i < 2 * kSampleEvery; ++i)
+		check_word(dict, "sampled" + std::to_string(i));
+	for (const EnchantWindowsSlowCall& entry : slow_calls())
+	{
+		if (entry.sequence <= before)
+			continue;
+		const std::string word = "sampled" + std::to_string(entry.sequence - before - 1);
+		const bool sampled = (entry.sequence - 1) % kSampleEvery == 0;
+		if (sampled && (entry.capture != ENCHANT_WINDOWS_CAPTURE_WORD || word != entry.word || entry.word_hash != fnv1a(word)))
+			fail("sampled entry " + std::to_string(entry.sequence) + " has '" + entry.word + "' instead of '" + word + "'");
+		if (!sampled && (entry.capture != ENCHANT_WINDOWS_CAPTURE_NONE || entry.word_hash != 0 || entry.word[0]))
+			fail("entry " + std::to_string(entry.sequence) + " kept its word without being sampled");
+	}
+	if (last_sequence() != before + 2 * kSampleEvery)
+		fail("sampled calls missing from the log");
+
+	// The calls that don't wait on the backend, and the loads.
+	enchant_windows_set_slow_call_log(0, ENCHANT_WINDOWS_CAPTURE_HASH, 1);
+	before = last_sequence();
+	enchant_windows_dict_check_async(dict, "async", 5, nullptr);
+	if (!logged_since(before, ENCHANT_WINDOWS_OP_CHECK_ASYNC))
+		fail("asynchronous check not logged");
+	size_t n = 0;
+	char** completions = enchant_windows_dict_complete(dict, "th", 2, 5, &n);
+	if (completions)
+		provider->free_string_list(provider, completions);
+	if (!logged_since(before, ENCHANT_WINDOWS_OP_COMPLETE))
+		fail("completion not logged");
+	EnchantDict* loading = enchant_windows_request_dict_async(provider, "en_US", nullptr);
+	if (!loading || !logged_since(before, ENCHANT_WINDOWS_OP_REQUEST_DICT_ASYNC))
+		fail("asynchronous load not logged");
+	if (loading)
+		enchant_windows_dict_wait_for_reload(loading);
+	before = last_sequence();
+	if (enchant_windows_dict_reload(dict) != 0 || enchant_windows_dict_wait_for_reload(dict) != 0 ||
+		!logged_since(before, ENCHANT_WINDOWS_OP_RELOAD))
+		fail("reload not logged");
+	if (loading)
+		provider->dispose_dict(provider, loading);
+
+	// A line for each entry.
+	const std::string dump = options.dict_dir + "/slow.log";
+	remove(dump.c_str());
+	const int dumped = enchant_windows_dump_slow_calls(dump.c_str());
+	std::ifstream in(dump);
+	std::string line;
+	int lines = 0;
+	while (std::getline(in, line))
+		lines += line.find("enchant_windows: slow call ") == 0;
+	if (dumped != static_cast<int>(std::min<unsigned long long>(last_sequence(), kRingEntries)) || lines != dumped)
+		fail("dumped " + std::to_string(dumped) + " entries in " + std::to_string(lines) + " lines");
+
+	provider->dispose_dict(provider, dict);
+	provider->dispose(provider);
+
+	printf("%zu calls, %zu kept, last %llu\n", options.calls, ring.size(), last_sequence());
+	if (failures)
+	{
+		fprintf(stderr, "%zu check(s) failed\n", failures);
+		return 1;
+	}
+	printf("ok\n");
+	return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,259 @@
+// enchant_windows - top-K suggestion check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Runs a provider on a stand-in backend whose suggestion lists are read one
+// string at a time, as IEnumString is, and counts the strings read. Asks
+// for suggestions over and over, all of them and then only the best few
+// through enchant_windows_dict_suggest_max, and reports the time per call,
+// the strings read and the bytes of each list handed out. Then checks that
+// ENCHANT_WINDOWS_SUGGEST_MAX sets the default for dictionaries requested
+// afterwards.
+//
+// Fails if the best few aren't the start of the full list, if more strings
+// are read than returned, if the default isn't applied, or if asking for
+// fewer isn't faster and smaller.
+//
+//   enchant_windows_bench suggest [--suggestions 40] [--max 5] [--calls 20000]
+
+#include "suggest_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "windows_provider.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+struct SuggestOptions
+{
+	size_t suggestions;
+	size_t max;
+	size_t calls;
+
+	SuggestOptions() : suggestions(40), max(5), calls(20000) {}
+};
+
+// Every word is misspelled and has the same suggestions, handed out lazily.
+class ListBackend : public SpellBackend
+{
+public:
+	ListBackend(const std::vector<std::u16string>& suggestions, std::atomic<size_t>& reads) : suggestions(suggestions), reads(reads) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t*) override { return 1; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t*) override
+	{
+		return std::make_unique<Checker>(suggestions, reads);
+	}
+
+private:
+	class Enumerator : public StringEnumerator
+	{
+	public:
+		Enumerator(const std::vector<std::u16string>& strings, std::atomic<size_t>& reads) : strings(strings), reads(reads), position(0) {}
+
+		bool next(std::u16string& out) override
+		{
+			if (position == strings.size())
+				return false;
+			++reads;
+			out = strings[position++];
+			return true;
+		}
+
+	private:
+		const std::vector<std::u16string>& strings;
+		std::atomic<size_t>& reads;
+		size_t position;
+	};
+
+	class Checker : public SpellChecker
+	{
+	public:
+		Checker(const std::vector<std::u16string>& suggestions, std::atomic<size_t>& reads) : suggestions(suggestions), reads(reads) {}
+
+		int check(const char16_t*) override { return 1; }
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override
+		{
+			return std::make_unique<Enumerator>(suggestions, reads);
+		}
+		bool add(const char16_t*) override { return true; }
+		bool ignore(const char16_t*) override { return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		const std::vector<std::u16string>& suggestions;
+		std::atomic<size_t>& reads;
+	};
+
+	const std::vector<std::u16string>& suggestions;
+	std::atomic<size_t>& reads;
+};
+
+static void suggest_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench suggest [options]\n"
+		"  --suggestions N      suggestions the backend has for each word (default 40)\n"
+		"  --max N              suggestions asked for (default 5)\n"
+		"  --calls N            timed calls each way (default 20000)\n",
+		stderr);
+}
+
+static bool parse_suggest_options(int argc, char** argv, SuggestOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--suggestions") options.suggestions = strtoul(v, nullptr, 10);
+		else if (arg == "--max") options.max = strtoul(v, nullptr, 10);
+		else if (arg == "--calls") options.calls = strtoul(v, nullptr, 10);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.calls > 0 && options.max > 0 && options.max < options.suggestions;
+}
+
+struct SuggestRun
+{
+	double ns_per_call;
+	size_t reads_per_call;
+	size_t list_bytes;
+	std::vector<std::string> first;
+};
+
+// 'calls' suggestions for the same word, 'max' at a time (0 for the
+// default), and the first list returned.
+static SuggestRun run_suggest(EnchantProvider* provider, EnchantDict* dict, size_t max, size_t calls, std::atomic<size_t>& reads)
+{
+	SuggestRun run = {};
+	static const char word[] = "sugestion";
+	size_t n = 0;
+	char** list = enchant_windows_dict_suggest_max(dict, word, strlen(word), max, &n);
+	EnchantWindowsDictMemory memory;
+	if (enchant_windows_dict_memory_usage(dict, &memory) == 0)
+		run.list_bytes = memory.current_bytes[ENCHANT_WINDOWS_MEMORY_STRING_ARENA];
+	for (size_t i = 0; list && i < n; ++i)
+		run.first.push_back(list[i]);
+	provider->free_string_list(provider, list);
+
+	reads = 0;
+	const Clock::time_point start = Clock::now();
+	for (size_t i = 0; i < calls; ++i)
+	{
+		list = enchant_windows_dict_suggest_max(dict, word, strlen(word), max, &n);
+		provider->free_string_list(provider, list);
+	}
+	run.ns_per_call = static_cast<double>(elapsed_ns(start)) / calls;
+	run.reads_per_call = reads / calls;
+	return run;
+}
+
+int suggest_main(int argc, char** argv)
+{
+	SuggestOptions options;
+	if (!parse_suggest_options(argc, argv, options))
+	{
+		suggest_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+	set_environment("ENCHANT_WINDOWS_SUGGEST_MAX", "");
+
+	std::vector<std::u16string> suggestions;
+	for (size_t i = 0; i < options.suggestions; ++i)
+	{
+		const std::string s = "suggestion" + std::to_string(i);
+		suggestions.push_back(std::u16string(s.begin(), s.end()));
+	}
+
+	std::atomic<size_t> reads(0);
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>([&]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<ListBackend>(suggestions, reads);
+	});
+	EnchantDict* dict = provider ? provider->request_dict(provider, "en_US") : nullptr;
+	if (!dict)
+	{
+		fprintf(stderr, "cannot create the provider\n");
+		return 2;
+	}
+
+	const SuggestRun all = run_suggest(provider, dict, 0, options.calls, reads);
+	const SuggestRun top = run_suggest(provider, dict, options.max, options.calls, reads);
+	provider->dispose_dict(provider, dict);
+
+	// The default, for dictionaries requested after it is set.
+	set_environment("ENCHANT_WINDOWS_SUGGEST_MAX", std::to_string(options.max));
+	dict = provider->request_dict(provider, "en_US");
+	set_environment("ENCHANT_WINDOWS_SUGGEST_MAX", "");
+	size_t defaulted = 0;
+	char** list = dict ? dict->suggest(dict, "sugestion", strlen("sugestion"), &defaulted) : nullptr;
+	provider->free_string_list(provider, list);
+	size_t overridden = 0;
+	list = dict ? enchant_windows_dict_suggest_max(dict, "sugestion", strlen("sugestion"), options.max + 1, &overridden) : nullptr;
+	provider->free_string_list(provider, list);
+	if (dict)
+		provider->dispose_dict(provider, dict);
+	provider->dispose(provider);
+
+	printf("%-8s %10s %8s %10s\n", "asked", "ns/call", "reads", "bytes");
+	printf("%-8s %10.0f %8zu %10zu\n", "all", all.ns_per_call, all.reads_per_call, all.list_bytes);
+	printf("%-8zu %10.0f %8zu %10zu\n", options.max, top.ns_per_call, top.reads_per_call, top.list_bytes);
+
+	size_t failures = 0;
+	auto fail = [&](const char* what) {
+		fprintf(stderr, "%s\n", what);
+		++failures;
+	};
+	if (all.first.size() != options.suggestions)
+		fail("full list is short");
+	if (top.first.size() != options.max || !std::equal(top.first.begin(), top.first.end(), all.first.begin()))
+		fail("best few aren't the start of the full list");
+	if (top.reads_per_call != options.max)
+		fail("read more than returned");
+	if (defaulted != options.max || overridden != options.max + 1)
+		fail("ENCHANT_WINDOWS_SUGGEST_MAX not applied");
+	if (top.ns_per_call >= all.ns_per_call || top.list_bytes >= all.list_bytes)
+		fail("asking for fewer is no faster or smaller");
+	if (failures)
+		return 1;
+	printf("ok\n");
+	return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,273 @@
+// enchant_windows - language tag registry check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Checks the language tag registry (language_tags.h): that spellings of a
+// tag canonicalize and intern to the same ID, that malformed tags are
+// refused, and that fallback chains come out as documented. Then runs a
+// provider on a stand-in backend that only has de-DE and en-GB, and checks
+// that de_CH and en_AU get those dictionaries while fr_CA, and everything
+// with ENCHANT_WINDOWS_TAG_FALLBACK=0, gets none. Last, times what the
+// provider did each time it needed a tag for the backend, copy the tag into
+// a new UTF-16 buffer with '_' turned into '-', against what it does now:
+// find the tag's ID once, on request_dict, and from then on (reloading,
+// recovering from a hung backend, falling back) go by ID.
+//
+// Fails if any check does, or if going by ID isn't faster than copying.
+//
+//   enchant_windows_bench tags [--lookups 1000000]
+
+#include "tags_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+#include "language_tags.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "windows_provider.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+
+namespace bench {
+
+// Has a fixed set of languages, and counts the ones it is asked about.
+class LanguageSetBackend : public SpellBackend
+{
+public:
+	LanguageSetBackend(const std::set<std::u16string>& languages) : languages(languages) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t* tag) override { return languages.count(tag) ? 1 : 0; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t* tag) override
+	{
+		if (!languages.count(tag))
+			return nullptr;
+		return std::make_unique<Checker>();
+	}
+
+private:
+	class Checker : public SpellChecker
+	{
+	public:
+		int check(const char16_t*) override { return 0; }
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override { return nullptr; }
+		bool add(const char16_t*) override { return true; }
+		bool ignore(const char16_t*) override { return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+	};
+
+	std::set<std::u16string> languages;
+};
+
+static void tags_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench tags [options]\n"
+		"  --lookups N          timed lookups of each kind (default 1000000)\n",
+		stderr);
+}
+
+static size_t failures = 0;
+
+static void expect(bool ok, const char* what, const std::string& detail)
+{
+	if (ok)
+		return;
+	fprintf(stderr, "%s: %s\n", what, detail.c_str());
+	++failures;
+}
+
+static std::string fallback_chain(LanguageTagId id)
+{
+	std::string chain;
+	for (LanguageTagId fallback : language_tag(id).fallbacks)
+	{
+		if (!chain.empty())
+			chain += ",";
+		chain += language_tag(fallback).bcp47;
+	}
+	return chain;
+}
+
+static void check_registry()
+{
+	static const struct { const char* tag; const char* bcp47; } kCanonical[] = {
+		{ "en_US", "en-US" },
+		{ "EN_us", "en-US" },
+		{ "en-US", "en-US" },
+		{ "de_CH.UTF-8", "de-CH" },
+		{ "sr_Latn_RS", "sr-Latn-RS" },
+		{ "zh_hant_tw", "zh-Hant-TW" },
+		{ "ca_ES@valencia", "ca-ES" },
+		{ "es_419", "es-419" },
+	};
+	for (const auto& c : kCanonical)
+	{
+		const LanguageTagId id = intern_language_tag(c.tag);
+		expect(id != kNoLanguageTag, "not interned", c.tag);
+		if (id == kNoLanguageTag)
+			continue;
+		const LanguageTag& tag = language_tag(id);
+		expect(tag.bcp47 == c.bcp47, "canonical form", std::string(c.tag) + " is " + tag.bcp47);
+		expect(find_language_tag(c.bcp47) == id, "different ID", c.tag);
+		std::string enchant = c.bcp47;
+		for (char& ch : enchant)
+			ch = ch == '-' ? '_' : ch;
+		expect(tag.enchant == enchant, "Enchant form", tag.enchant);
+		expect(tag.windows == std::u16string(tag.bcp47.begin(), tag.bcp47.end()), "Windows form", tag.bcp47);
+	}
+
+	for (const char* bad : { "", "e", "e_US", "en US", "en__US", "_US", "en_US_", "toolongtag_US", "én_US" })
+		expect(intern_language_tag(bad) == kNoLanguageTag, "malformed tag interned", bad);
+	expect(find_language_tag("xx_YY") == kNoLanguageTag, "found before interning", "xx_YY");
+
+	static const struct { const char* tag; const char* chain; } kFallbacks[] = {
+		{ "de_CH", "de-DE,de" },
+		{ "de_DE", "de" },
+		{ "de", "" },
+		{ "en_AU", "en-GB,en-US,en" },
+		{ "en_GB", "en-US,en" },
+		{ "es_AR", "es-MX,es-ES,es" },
+		{ "pt_AO", "pt-PT,pt-BR,pt" },
+		{ "fr_CA", "fr-FR,fr" },
+		{ "sr_Latn_RS", "sr-Latn,sr" },
+		{ "xx_YY", "xx" },
+	};
+	for (const auto& f : kFallbacks)
+	{
+		const LanguageTagId id = intern_language_tag(f.tag);
+		const std::string chain = id == kNoLanguageTag ? "(not interned)" : fallback_chain(id);
+		expect(chain == f.chain, "fallbacks", std::string(f.tag) + " has " + chain + ", not " + f.chain);
+	}
+}
+
+static void check_provider()
+{
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>([]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<LanguageSetBackend>(std::set<std::u16string>{ u"de-DE", u"en-GB" });
+	});
+	if (!provider)
+	{
+		expect(false, "cannot create the provider", "");
+		return;
+	}
+
+	static const struct { const char* tag; bool exists; bool without_fallback; } kRequests[] = {
+		{ "de_DE", true, true },
+		{ "de_CH", true, false },
+		{ "en_AU", true, false },
+		{ "en_US", false, false },
+		{ "fr_CA", false, false },
+		{ "e_US", false, false },
+	};
+	for (int fallback = 1; fallback >= 0; --fallback)
+	{
+		set_environment("ENCHANT_WINDOWS_TAG_FALLBACK", fallback ? "" : "0");
+		for (const auto& r : kRequests)
+		{
+			const bool expected = fallback ? r.exists : r.without_fallback;
+			const std::string detail = std::string(r.tag) + (fallback ? "" : " without fallback");
+			expect((provider->dictionary_exists(provider, r.tag) == 1) == expected, "dictionary_exists", detail);
+			EnchantDict* dict = provider->request_dict(provider, r.tag);
+			expect((dict != nullptr) == expected, "request_dict", detail);
+			if (dict)
+			{
+				expect(dict->check(dict, "word", 4) == 0, "check", detail);
+				provider->dispose_dict(provider, dict);
+			}
+		}
+	}
+	set_environment("ENCHANT_WINDOWS_TAG_FALLBACK", "");
+	provider->dispose(provider);
+}
+
+static std::unique_ptr<char16_t[]> old_windows_language(const char* tag)
+{
+	const size_t len = strlen(tag);
+	std::unique_ptr<char16_t[]> out(new char16_t[len + 1]);
+	for (size_t i = 0; i <= len; ++i)
+		out[i] = tag[i] == '_' ? u'-' : static_cast<char16_t>(tag[i]);
+	return out;
+}
+
+int tags_main(int argc, char** argv)
+{
+	size_t lookups = 1000000;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--lookups") == 0 && i + 1 < argc)
+			lookups = strtoul(argv[++i], nullptr, 10);
+		else
+		{
+			tags_usage();
+			return 2;
+		}
+	}
+	if (lookups == 0)
+	{
+		tags_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+
+	check_registry();
+	check_provider();
+
+	static const char* const kTags[] = { "en_US", "de_DE", "fr_FR", "en_GB", "pt_BR", "es_ES", "nl_NL", "sv_SE" };
+	for (const char* tag : kTags)
+		intern_language_tag(tag);
+
+	LanguageTagId ids[8];
+	for (size_t i = 0; i < 8; ++i)
+		ids[i] = find_language_tag(kTags[i]);
+
+	size_t sink = 0;
+	Clock::time_point start = Clock::now();
+	for (size_t i = 0; i < lookups; ++i)
+		sink += find_language_tag(kTags[i % 8]);
+	const double findNs = static_cast<double>(elapsed_ns(start)) / lookups;
+
+	start = Clock::now();
+	for (size_t i = 0; i < lookups; ++i)
+		sink += language_tag(ids[i % 8]).windows[2];
+	const double idNs = static_cast<double>(elapsed_ns(start)) / lookups;
+
+	start = Clock::now();
+	for (size_t i = 0; i < lookups; ++i)
+		sink += old_windows_language(kTags[i % 8])[2];
+	const double copyNs = static_cast<double>(elapsed_ns(start)) / lookups;
+
+	printf("copy and convert %6.1f ns\n", copyNs);
+	printf("find by tag      %6.1f ns\n", findNs);
+	printf("by ID            %6.1f ns\n", idNs);
+	expect(idNs < copyNs, "going by ID no faster than copying", std::to_string(idNs) + " ns");
+	if (sink == 0)
+		printf("\n");
+
+	if (failures)
+	{
+		fprintf(stderr, "%zu check(s) failed\n", failures);
+		return 1;
+	}
+	printf("ok\n");
+	return 0;
+}
+
+} // namespace bench
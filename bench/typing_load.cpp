@@ -0,0 +1,449 @@
+// enchant_windows - as-you-type load generator.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Simulates several users typing into editors that spell check as they go.
+// Each user is a thread issuing events with exponentially distributed gaps
+// (an open-loop Poisson arrival process). Latency is measured from when an
+// event was due, not when it was issued, so a provider that falls behind is
+// charged for the queueing delay it causes.
+//
+//   enchant_windows_bench typing --plugin PATH --users 8 --rate 10
+
+#include "typing_load.h"
+#include "bench_harness.h"
+#include "perf_counters.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+
+namespace bench {
+
+const char* typing_event_name(TypingEvent::Kind kind)
+{
+	switch (kind)
+	{
+	case TypingEvent::Keystroke: return "keystroke";
+	case TypingEvent::Backspace: return "backspace";
+	case TypingEvent::Recheck: return "recheck";
+	case TypingEvent::Suggest: return "suggest";
+	default: return "unknown";
+	}
+}
+
+// Length of the UTF-8 sequence starting with lead byte 'c'.
+static size_t utf8_sequence_length(unsigned char c)
+{
+	if (c < 0x80) return 1;
+	if ((c & 0xE0) == 0xC0) return 2;
+	if ((c & 0xF0) == 0xE0) return 3;
+	if ((c & 0xF8) == 0xF0) return 4;
+	return 1;
+}
+
+static bool is_word_byte(unsigned char c)
+{
+	return c >= 0x80 || isalpha(c) || c == '\'';
+}
+
+static TypingEvent check_event(TypingEvent::Kind kind, const std::string& word)
+{
+	TypingEvent event;
+	event.kind = kind;
+	event.calls.push_back(TypingCall{ TypingCall::Check, word });
+	return event;
+}
+
+std::vector<TypingEvent> make_typing_trace(const std::string& corpus, const TypingTraceOptions& options)
+{
+	std::mt19937 rng(options.seed);
+	std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+	std::vector<TypingEvent> trace;
+	std::vector<std::string> line;
+	size_t wordsSinceRecheck = 0;
+
+	auto recheck = [&]() {
+		if (line.empty())
+			return;
+		TypingEvent event;
+		event.kind = TypingEvent::Recheck;
+		for (const auto& word : line)
+			event.calls.push_back(TypingCall{ TypingCall::Check, word });
+		trace.push_back(std::move(event));
+		wordsSinceRecheck = 0;
+	};
+
+	size_t i = 0;
+	while (i < corpus.size())
+	{
+		// Punctuation between words. A sentence end finishes the line.
+		bool sentenceEnd = false;
+		while (i < corpus.size() && !is_word_byte(static_cast<unsigned char>(corpus[i])))
+		{
+			char c = corpus[i++];
+			if (c == '.' || c == '!' || c == '?' || c == '\n')
+				sentenceEnd = true;
+		}
+		if (sentenceEnd)
+		{
+			recheck();
+			line.clear();
+		}
+
+		size_t start = i;
+		while (i < corpus.size() && is_word_byte(static_cast<unsigned char>(corpus[i])))
+			++i;
+		if (i == start)
+			continue;
+		const std::string word = corpus.substr(start, i - start);
+
+		// Pick where (if anywhere) the user fumbles a key.
+		size_t typoAt = std::string::npos;
+		if (chance(rng) < options.typo_rate)
+			typoAt = static_cast<size_t>(chance(rng) * word.size());
+		bool leaveTypo = chance(rng) < options.leave_typo_rate;
+
+		std::string typed;
+		for (size_t pos = 0; pos < word.size();)
+		{
+			size_t len = std::min(utf8_sequence_length(static_cast<unsigned char>(word[pos])), word.size() - pos);
+			std::string ch = word.substr(pos, len);
+			if (typoAt != std::string::npos && pos >= typoAt)
+			{
+				// Hit the neighbouring key instead.
+				std::string wrong(1, (ch[0] >= 'a' && ch[0] < 'z') ? static_cast<char>(ch[0] + 1) : 'x');
+				trace.push_back(check_event(TypingEvent::Keystroke, typed + wrong));
+				if (leaveTypo)
+				{
+					ch = wrong;
+				}
+				else
+				{
+					trace.push_back(check_event(TypingEvent::Backspace, typed));
+				}
+				typoAt = std::string::npos;
+			}
+			typed += ch;
+			trace.push_back(check_event(TypingEvent::Keystroke, typed));
+			pos += len;
+		}
+
+		// The space after the word completes it.
+		trace.push_back(check_event(TypingEvent::Keystroke, typed));
+		if (typed != word && chance(rng) < options.suggest_rate)
+		{
+			TypingEvent event;
+			event.kind = TypingEvent::Suggest;
+			event.calls.push_back(TypingCall{ TypingCall::Suggest, typed });
+			trace.push_back(std::move(event));
+		}
+
+		line.push_back(typed);
+		if (++wordsSinceRecheck >= options.recheck_words)
+			recheck();
+	}
+	recheck();
+	return trace;
+}
+
+struct TypingOptions
+{
+	std::string plugin;
+	std::string tag;
+	std::string corpus;
+	std::string out;
+	std::string baseline;
+	size_t users;
+	double rate;
+	double duration;
+	double budget_ms;
+	bool dict_per_user;
+	bool perf;
+	TypingTraceOptions trace;
+	GateThresholds thresholds;
+
+	TypingOptions() :
+		tag("en_US"),
+		users(4),
+		rate(8),
+		duration(10),
+		budget_ms(16),
+		dict_per_user(false),
+		perf(true)
+	{}
+};
+
+static void typing_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench typing --plugin PATH [options]\n"
+		"  --tag TAG            dictionary to request (default en_US)\n"
+		"  --corpus FILE        UTF-8 text the simulated users type\n"
+		"  --users N            concurrent typists (default 4)\n"
+		"  --rate R             events per second per user, 0 = back to back (default 8)\n"
+		"  --duration S         seconds to run (default 10)\n"
+		"  --budget-ms MS       interactive budget per event (default 16)\n"
+		"  --dict-per-user      request a separate EnchantDict for each user\n"
+		"  --no-perf            do not read hardware performance counters\n"
+		"  --typo-rate F        chance of a typo per word (default 0.08)\n"
+		"  --suggest-rate F     chance of a suggest on a kept typo (default 0.5)\n"
+		"  --recheck-words N    recheck the line every N words (default 12)\n"
+		"  --seed N             trace random seed (default 1)\n"
+		"  --out FILE           write JSON results ('-' for stdout)\n"
+		"  --baseline FILE      compare p99 latency against a previous --out file\n",
+		stderr);
+}
+
+static bool parse_typing_options(int argc, char** argv, TypingOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (arg == "--dict-per-user")
+		{
+			options.dict_per_user = true;
+			continue;
+		}
+		if (arg == "--no-perf")
+		{
+			options.perf = false;
+			continue;
+		}
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--plugin") options.plugin = v;
+		else if (arg == "--tag") options.tag = v;
+		else if (arg == "--corpus") options.corpus = v;
+		else if (arg == "--users") options.users = strtoul(v, nullptr, 10);
+		else if (arg == "--rate") options.rate = atof(v);
+		else if (arg == "--duration") options.duration = atof(v);
+		else if (arg == "--budget-ms") options.budget_ms = atof(v);
+		else if (arg == "--typo-rate") options.trace.typo_rate = atof(v);
+		else if (arg == "--suggest-rate") options.trace.suggest_rate = atof(v);
+		else if (arg == "--recheck-words") options.trace.recheck_words = strtoul(v, nullptr, 10);
+		else if (arg == "--seed") options.trace.seed = static_cast<uint32_t>(strtoul(v, nullptr, 10));
+		else if (arg == "--out") options.out = v;
+		else if (arg == "--baseline") options.baseline = v;
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return !options.plugin.empty() && options.users > 0 && options.duration > 0;
+}
+
+// Latencies gathered by one simulated user, by event kind.
+struct UserSamples
+{
+	std::vector<double> latency[TypingEvent::kKindCount];
+};
+
+static void run_user(
+	EnchantProvider* provider,
+	EnchantDict* sharedDict,
+	const TypingOptions& options,
+	const std::vector<TypingEvent>& trace,
+	size_t firstEvent,
+	uint32_t seed,
+	Clock::time_point end,
+	UserSamples& samples)
+{
+	std::unique_ptr<ProviderDict> ownDict;
+	EnchantDict* dict = sharedDict;
+	if (!dict)
+	{
+		ownDict.reset(new ProviderDict(provider, options.tag.c_str()));
+		dict = ownDict->get();
+		if (!dict)
+			return;
+	}
+
+	std::mt19937 rng(seed);
+	std::exponential_distribution<double> gap(options.rate > 0 ? options.rate : 1.0);
+
+	Clock::time_point due = Clock::now();
+	for (size_t n = firstEvent; ; ++n)
+	{
+		if (options.rate > 0)
+		{
+			due += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(gap(rng)));
+			std::this_thread::sleep_until(due);
+		}
+		else
+		{
+			due = Clock::now();
+		}
+		if (due >= end)
+			break;
+
+		const TypingEvent& event = trace[n % trace.size()];
+		for (const auto& call : event.calls)
+		{
+			if (call.op == TypingCall::Check)
+			{
+				dict->check(dict, call.word.c_str(), call.word.size());
+			}
+			else
+			{
+				size_t count = 0;
+				char** list = dict->suggest(dict, call.word.c_str(), call.word.size(), &count);
+				if (list)
+					provider->free_string_list(provider, list);
+			}
+		}
+		samples.latency[event.kind].push_back(static_cast<double>(elapsed_ns(due)));
+	}
+}
+
+int typing_main(int argc, char** argv)
+{
+	TypingOptions options;
+	if (!parse_typing_options(argc, argv, options))
+	{
+		typing_usage();
+		return 2;
+	}
+
+	std::string text = default_corpus();
+	if (!options.corpus.empty() && !read_file(options.corpus, text))
+	{
+		fprintf(stderr, "cannot read corpus %s\n", options.corpus.c_str());
+		return 2;
+	}
+	const std::vector<TypingEvent> trace = make_typing_trace(text, options.trace);
+	if (trace.empty())
+	{
+		fprintf(stderr, "corpus contains no words\n");
+		return 2;
+	}
+
+	PerfCounters counters;
+	if (options.perf && !counters.open())
+		fprintf(stderr, "performance counters unavailable; reporting latency only\n");
+
+	PluginProvider plugin;
+	std::string error;
+	if (!plugin.load(options.plugin, error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 2;
+	}
+
+	std::unique_ptr<ProviderDict> shared;
+	if (!options.dict_per_user)
+	{
+		shared.reset(new ProviderDict(plugin.get(), options.tag.c_str()));
+		if (!shared->get())
+		{
+			fprintf(stderr, "provider has no dictionary for %s\n", options.tag.c_str());
+			return 2;
+		}
+	}
+
+	std::vector<UserSamples> samples(options.users);
+	std::vector<std::thread> users;
+	counters.start();
+	const Clock::time_point start = Clock::now();
+	const Clock::time_point end = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.duration));
+	for (size_t u = 0; u < options.users; ++u)
+	{
+		// Spread the users over the trace so they are not typing in lockstep.
+		size_t first = u * trace.size() / options.users;
+		users.emplace_back(run_user, plugin.get(), shared ? shared->get() : nullptr, std::cref(options),
+			std::cref(trace), first, options.trace.seed + 1 + static_cast<uint32_t>(u), end, std::ref(samples[u]));
+	}
+	for (auto& t : users)
+		t.join();
+	const double seconds = elapsed_ns(start) / 1e9;
+	const PerfCounters::Sample sample = counters.stop();
+
+	Report report;
+	report.environment = environment_metadata();
+	report.environment["plugin"] = options.plugin;
+	report.environment["provider"] = plugin.get()->identify(plugin.get());
+	report.environment["tag"] = options.tag;
+	report.environment["corpus"] = options.corpus.empty() ? "built-in" : options.corpus;
+	report.environment["users"] = std::to_string(options.users);
+	report.environment["rate"] = std::to_string(options.rate);
+	report.environment["budget_ms"] = std::to_string(options.budget_ms);
+
+	const double budgetNs = options.budget_ms * 1e6;
+	std::vector<double> allLatencies;
+	fprintf(stderr, "%-18s %9s %10s %10s %10s %12s\n", "event", "count", "p50 us", "p99 us", "max us", "over budget");
+	auto summarize = [&](const std::string& name, const std::vector<double>& latencies) {
+		CaseResult result = summarize_latencies("typing_" + name, latencies, 50);
+		size_t over = std::count_if(latencies.begin(), latencies.end(), [&](double ns) { return ns > budgetNs; });
+		double overFraction = latencies.empty() ? 0 : static_cast<double>(over) / latencies.size();
+		result.extra["budget_ns"] = budgetNs;
+		result.extra["over_budget_fraction"] = overFraction;
+		result.extra["events_per_second"] = latencies.size() / seconds;
+		fprintf(stderr, "%-18s %9zu %10.1f %10.1f %10.1f %11.2f%%\n", name.c_str(), latencies.size(),
+			result.p50_ns / 1e3, result.p99_ns / 1e3, result.max_ns / 1e3, overFraction * 100);
+		report.cases.push_back(std::move(result));
+	};
+	for (int kind = 0; kind < TypingEvent::kKindCount; ++kind)
+	{
+		std::vector<double> latencies;
+		for (const auto& user : samples)
+			latencies.insert(latencies.end(), user.latency[kind].begin(), user.latency[kind].end());
+		allLatencies.insert(allLatencies.end(), latencies.begin(), latencies.end());
+		summarize(typing_event_name(static_cast<TypingEvent::Kind>(kind)), latencies);
+	}
+	summarize("all", allLatencies);
+	PerfCounters::annotate(report.cases.back(), sample, allLatencies.size());
+	std::string counterSummary = PerfCounters::describe(sample, allLatencies.size());
+	if (!counterSummary.empty())
+		fprintf(stderr, "per event:%s\n", counterSummary.c_str());
+
+	if (!options.out.empty() && !write_report(report, options.out))
+	{
+		fprintf(stderr, "cannot write %s\n", options.out.c_str());
+		return 2;
+	}
+
+	if (!options.baseline.empty())
+	{
+		Report baseline;
+		if (!read_report(options.baseline, baseline, error))
+		{
+			fprintf(stderr, "%s\n", error.c_str());
+			return 2;
+		}
+		int regressions = compare_reports(baseline, report, options.thresholds);
+		if (regressions > 0)
+		{
+			fprintf(stderr, "%d event type(s) regressed against %s\n", regressions, options.baseline.c_str());
+			return 1;
+		}
+	}
+	return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,72 @@
+// enchant_windows - as-you-type load generator.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_TYPING_LOAD_H
+#define ENCHANT_WINDOWS_TYPING_LOAD_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// One provider call made in response to an editor event.
+struct TypingCall
+{
+	enum Op { Check, Suggest } op;
+	std::string word;
+};
+
+// What an editor does after one user action.
+struct TypingEvent
+{
+	enum Kind { Keystroke, Backspace, Recheck, Suggest, kKindCount } kind;
+	std::vector<TypingCall> calls;
+};
+
+const char* typing_event_name(TypingEvent::Kind kind);
+
+struct TypingTraceOptions
+{
+	double typo_rate;       // chance a word gets a typo that is then backspaced
+	size_t recheck_words;   // recheck the current line every N words
+	double suggest_rate;    // chance the user asks for suggestions on a typo left in
+	double leave_typo_rate; // chance a typo is left in rather than corrected
+	uint32_t seed;
+
+	TypingTraceOptions() :
+		typo_rate(0.08),
+		recheck_words(12),
+		suggest_rate(0.5),
+		leave_typo_rate(0.3),
+		seed(1)
+	{}
+};
+
+// Turn 'corpus' into the stream of events an editor would see while a user
+// types it: a check of the partial word after every keystroke, backspaces
+// when fixing typos, periodic rechecks of the whole line and occasional
+// suggest requests on words left misspelled.
+std::vector<TypingEvent> make_typing_trace(const std::string& corpus, const TypingTraceOptions& options);
+
+// Entry point for 'enchant_windows_bench typing ...'.
+int typing_main(int argc, char** argv);
+
+} // namespace bench
+
+#endif
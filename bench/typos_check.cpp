@@ -0,0 +1,382 @@
+// enchant_windows - typo table check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+// Checks the compiled typo tables (src/typo_table.h) against the lists they
+// were generated from, and what they save the provider. For each language:
+// every typo in <typos>/<lang>.txt has to find its correction, in lowercase,
+// Title Case and capitals; every word of the <samples> text, which is spelled
+// correctly, has to find nothing; and the sample in <typos>/test/<lang>.txt
+// gives the share of typos seen that the table corrects, weighted by how
+// often each was seen. Then a provider on a stand-in backend, which counts
+// the suggestion lists it is asked for, has to put a typo's correction first
+// and only once, answer a request for one suggestion without the backend,
+// and leave the table out when ENCHANT_WINDOWS_TYPO_TABLE is 0. One
+// suggestion for a typo is timed both ways.
+//
+// Fails on any wrong lookup, coverage under --min-coverage in any language,
+// or if the table is no faster.
+//
+//   enchant_windows_bench typos [--typos data/typos] [--samples data/langid]
+//                               [--min-coverage 0.9] [--calls 20000]
+
+#include "typos_check.h"
+#include "bench_harness.h"
+#include "case_pattern.h"
+#include "enchant-windows.h"
+#include "language_tags.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "typo_table.h"
+#include "windows_provider.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+struct TyposOptions
+{
+	std::string typos;
+	std::string samples;
+	double min_coverage;
+	size_t calls;
+
+	TyposOptions() : typos("data/typos"), samples("data/langid"), min_coverage(0.9), calls(20000) {}
+};
+
+static const char* const kTypoLanguages[] = { "en", "de", "fr", "es" };
+
+// Every word is misspelled, with the same few suggestions.
+class CountingBackend : public SpellBackend
+{
+public:
+	explicit CountingBackend(std::atomic<size_t>& lists) : lists(lists) {}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override { return nullptr; }
+	int is_supported(const char16_t*) override { return 1; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t*) override
+	{
+		return std::make_unique<Checker>(lists);
+	}
+
+private:
+	class Enumerator : public StringEnumerator
+	{
+	public:
+		Enumerator() : position(0) {}
+
+		bool next(std::u16string& out) override
+		{
+			static const char16_t* const kSuggestions[] = { u"tea", u"the", u"ten" };
+			if (position == sizeof(kSuggestions) / sizeof(kSuggestions[0]))
+				return false;
+			out = kSuggestions[position++];
+			return true;
+		}
+
+	private:
+		size_t position;
+	};
+
+	class Checker : public SpellChecker
+	{
+	public:
+		explicit Checker(std::atomic<size_t>& lists) : lists(lists) {}
+
+		int check(const char16_t*) override { return 1; }
+		std::unique_ptr<StringEnumerator> suggest(const char16_t*) override
+		{
+			++lists;
+			return std::make_unique<Enumerator>();
+		}
+		bool add(const char16_t*) override { return true; }
+		bool ignore(const char16_t*) override { return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		std::atomic<size_t>& lists;
+	};
+
+	std::atomic<size_t>& lists;
+};
+
+static void typos_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench typos [options]\n"
+		"  --typos DIR          <lang>.txt typo lists and test/<lang>.txt samples (default data/typos)\n"
+		"  --samples DIR        train/ and test/ text, <lang>.txt per language (default data/langid)\n"
+		"  --min-coverage F     least share of sampled typos corrected (default 0.9)\n"
+		"  --calls N            timed suggestions each way (default 20000)\n",
+		stderr);
+}
+
+static bool parse_typos_options(int argc, char** argv, TyposOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--typos") options.typos = v;
+		else if (arg == "--samples") options.samples = v;
+		else if (arg == "--min-coverage") options.min_coverage = strtod(v, nullptr);
+		else if (arg == "--calls") options.calls = strtoul(v, nullptr, 10);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return options.calls > 0;
+}
+
+// The tab-separated lines of 'contents' with 'fields' fields, skipping
+// comments and blank lines.
+static std::vector<std::vector<std::string>> read_fields(const std::string& contents, size_t fields)
+{
+	std::vector<std::vector<std::string>> rows;
+	std::istringstream in(contents);
+	std::string line;
+	while (std::getline(in, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		if (line.empty() || line[0] == '#')
+			continue;
+		std::vector<std::string> row;
+		size_t start = 0;
+		for (size_t tab; (tab = line.find('\t', start)) != std::string::npos; start = tab + 1)
+			row.push_back(line.substr(start, tab - start));
+		row.push_back(line.substr(start));
+		if (row.size() == fields)
+			rows.push_back(row);
+	}
+	return rows;
+}
+
+static bool corrects_to(const TypoTable* table, const std::string& word, const CaseRules& rules, const std::string& expected)
+{
+	std::string got;
+	return correct_typo(table, word.data(), word.size(), rules, got) && got == expected;
+}
+
+struct LanguageResult
+{
+	size_t typos;
+	size_t wrong;
+	size_t words;
+	size_t false_hits;
+	double coverage;
+};
+
+static bool check_language(const TyposOptions& options, const char* lang, LanguageResult& result, std::vector<std::string>& typos)
+{
+	result = LanguageResult();
+	std::string list;
+	std::string sample;
+	std::string train;
+	std::string test;
+	if (!read_file(options.typos + "/" + lang + ".txt", list) || !read_file(options.typos + "/test/" + lang + ".txt", sample) ||
+		!read_file(options.samples + "/train/" + lang + ".txt", train) || !read_file(options.samples + "/test/" + lang + ".txt", test))
+	{
+		fprintf(stderr, "no typo lists or samples for %s\n", lang);
+		return false;
+	}
+
+	const std::string tag = std::string(lang) + "_XX";
+	const LanguageTagRef language = resolve_language_tag(tag);
+	const TypoTable* table = language ? typo_table_for(*language) : nullptr;
+	if (!table)
+	{
+		fprintf(stderr, "no typo table for %s\n", lang);
+		return false;
+	}
+	const CaseRules rules = case_rules_for(*language);
+
+	for (const auto& row : read_fields(list, 2))
+	{
+		std::string key(row[0].size(), '\0');
+		if (case_pattern(row[0].data(), row[0].size(), rules, &key[0]) == kCaseLower)
+			key = row[0];
+		std::string title = key;
+		std::string upper = key;
+		capitalize(title, false, rules);
+		capitalize(upper, true, rules);
+		std::string titleCorrection = row[1];
+		std::string upperCorrection = row[1];
+		capitalize(titleCorrection, false, rules);
+		capitalize(upperCorrection, true, rules);
+
+		++result.typos;
+		if (!corrects_to(table, key, rules, row[1]) || !corrects_to(table, title, rules, titleCorrection) ||
+			(upper.size() > 1 && !corrects_to(table, upper, rules, upperCorrection)))
+		{
+			fprintf(stderr, "%s: %s doesn't correct to %s\n", lang, row[0].c_str(), row[1].c_str());
+			++result.wrong;
+		}
+		typos.push_back(key);
+	}
+	if (result.typos != table->entryCount)
+	{
+		fprintf(stderr, "%s: table has %u typos, list %zu\n", lang, table->entryCount, result.typos);
+		++result.wrong;
+	}
+
+	std::string correction;
+	for (const std::string& word : make_workload(train + "\n" + test).correct)
+	{
+		++result.words;
+		if (correct_typo(table, word.data(), word.size(), rules, correction))
+		{
+			fprintf(stderr, "%s: %s is a word, but corrects to %s\n", lang, word.c_str(), correction.c_str());
+			++result.false_hits;
+		}
+	}
+
+	unsigned long seen = 0;
+	unsigned long corrected = 0;
+	for (const auto& row : read_fields(sample, 3))
+	{
+		const unsigned long count = strtoul(row[2].c_str(), nullptr, 10);
+		seen += count;
+		if (corrects_to(table, row[0], rules, row[1]))
+			corrected += count;
+	}
+	result.coverage = seen ? static_cast<double>(corrected) / seen : 0.0;
+	return true;
+}
+
+// The first suggestion for 'word', up to 'max' of them, or "" if none.
+static std::string first_suggestion(EnchantProvider* provider, EnchantDict* dict, const char* word, size_t max, size_t* count = nullptr)
+{
+	size_t n = 0;
+	char** list = enchant_windows_dict_suggest_max(dict, word, strlen(word), max, &n);
+	const std::string first = list && n ? list[0] : "";
+	if (count)
+		*count = list ? n : 0;
+	provider->free_string_list(provider, list);
+	return first;
+}
+
+static double time_suggestions(EnchantProvider* provider, EnchantDict* dict, const std::vector<std::string>& typos, size_t calls)
+{
+	const Clock::time_point start = Clock::now();
+	for (size_t i = 0; i < calls; ++i)
+	{
+		const std::string& typo = typos[i % typos.size()];
+		size_t n = 0;
+		char** list = enchant_windows_dict_suggest_max(dict, typo.data(), typo.size(), 1, &n);
+		provider->free_string_list(provider, list);
+	}
+	return static_cast<double>(elapsed_ns(start)) / calls;
+}
+
+int typos_main(int argc, char** argv)
+{
+	TyposOptions options;
+	if (!parse_typos_options(argc, argv, options))
+	{
+		typos_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+	set_environment("ENCHANT_WINDOWS_SUGGEST_MAX", "");
+	set_environment("ENCHANT_WINDOWS_CASE_REUSE", "");
+	set_environment("ENCHANT_WINDOWS_TYPO_TABLE", "");
+
+	size_t failures = 0;
+	auto fail = [&](const char* what) {
+		fprintf(stderr, "%s\n", what);
+		++failures;
+	};
+
+	printf("%-6s %8s %8s %8s %12s %10s\n", "lang", "typos", "wrong", "words", "false hits", "coverage");
+	std::vector<std::string> english;
+	for (const char* lang : kTypoLanguages)
+	{
+		LanguageResult result;
+		std::vector<std::string> typos;
+		if (!check_language(options, lang, result, typos))
+			return 2;
+		printf("%-6s %8zu %8zu %8zu %12zu %9.1f%%\n", lang, result.typos, result.wrong, result.words, result.false_hits, 100.0 * result.coverage);
+		if (result.wrong || result.false_hits)
+			fail("typo table doesn't match its list");
+		if (result.coverage < options.min_coverage)
+			fail("typo table coverage too low");
+		if (strcmp(lang, "en") == 0)
+			english = typos;
+	}
+
+	std::atomic<size_t> lists(0);
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>([&]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<CountingBackend>(lists);
+	});
+	EnchantDict* dict = provider ? provider->request_dict(provider, "en_US") : nullptr;
+	if (!dict || english.empty())
+	{
+		fprintf(stderr, "cannot create the provider\n");
+		return 2;
+	}
+
+	size_t n = 0;
+	if (first_suggestion(provider, dict, "teh", 0, &n) != "the" || n != 3)
+		fail("correction isn't first, or is repeated");
+	if (first_suggestion(provider, dict, "Teh", 0) != "The" || first_suggestion(provider, dict, "TEH", 0) != "THE")
+		fail("correction isn't capitalized as the typo is");
+	lists = 0;
+	if (first_suggestion(provider, dict, "teh", 1, &n) != "the" || n != 1 || lists != 0)
+		fail("one suggestion for a typo asked the backend");
+	if (first_suggestion(provider, dict, "sugestion", 1) != "tea" || lists != 1)
+		fail("one suggestion for anything else didn't ask the backend");
+	const double withTable = time_suggestions(provider, dict, english, options.calls);
+	provider->dispose_dict(provider, dict);
+
+	set_environment("ENCHANT_WINDOWS_TYPO_TABLE", "0");
+	dict = provider->request_dict(provider, "en_US");
+	set_environment("ENCHANT_WINDOWS_TYPO_TABLE", "");
+	if (!dict || first_suggestion(provider, dict, "teh", 1) != "tea")
+		fail("ENCHANT_WINDOWS_TYPO_TABLE=0 not applied");
+	const double withoutTable = dict ? time_suggestions(provider, dict, english, options.calls) : 0.0;
+	if (dict)
+		provider->dispose_dict(provider, dict);
+	provider->dispose(provider);
+
+	printf("one suggestion for a typo: %.0f ns with the table, %.0f ns from the backend\n", withTable, withoutTable);
+	if (withTable >= withoutTable)
+		fail("typo table is no faster than the backend");
+	if (failures)
+		return 1;
+	printf("ok\n");
+	return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,438 @@
+// enchant_windows - hung backend call recovery check.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+// Runs the provider core in this process on a stand-in backend whose checks
+// of one word block until the check is over. A check of that word hangs the
+// worker; behind it go an asynchronous check and a check of a word that is
+// spelled correctly. Then the same with the hanging check asynchronous.
+// Fails if a hung check takes longer than twice the watchdog timeout to
+// come back, if it doesn't come back as an error, if the work queued behind
+// it is lost or wrong, or if the dictionary doesn't work afterwards on a
+// spell checker made anew. Then suggestions for that word and the list of
+// languages hang too, and fail the check if, once let go, they write to
+// where their callers, long since given up on, asked for the count. Last,
+// making the backend anew hangs as well, and fails the check unless a
+// dictionary can still be requested and disposed of meanwhile, and works
+// once the next worker has recovered.
+//
+//   enchant_windows_bench watchdog [--watchdog-ms N]
+
+#include "watchdog_check.h"
+#include "bench_harness.h"
+#include "enchant-windows.h"
+#include "provider_policies.h"
+#include "spell_backend.h"
+#include "windows_provider.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace bench {
+
+static const char kHangWord[] = "hang";
+
+// A few correct words, and one whose check never returns until released.
+class StallingBackend : public SpellBackend
+{
+public:
+	struct Shared
+	{
+		Shared() : backends(0), checkers(0), stalled(0), finished(0), hangBackends(0), hangLanguages(false), released(false) {}
+
+		// Let every stalled check return.
+		void release()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			released = true;
+			wake.notify_all();
+		}
+
+		std::atomic<int> backends;
+		std::atomic<int> checkers;
+		std::atomic<int> stalled;
+		// Lists of suggestions or languages read to the end, once let go.
+		std::atomic<int> finished;
+		// Backends still to be made that hang on the way.
+		std::atomic<int> hangBackends;
+		std::atomic<bool> hangLanguages;
+		std::mutex mutex;
+		std::condition_variable wake;
+		bool released;
+	};
+
+	explicit StallingBackend(Shared& shared) : shared(shared)
+	{
+		++shared.backends;
+		if (shared.hangBackends > 0)
+		{
+			--shared.hangBackends;
+			stall(shared);
+		}
+	}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override
+	{
+		if (!shared.hangLanguages)
+			return nullptr;
+		stall(shared);
+		return std::make_unique<Enumerator>(shared, std::vector<std::u16string>({ u"en_US" }));
+	}
+	int is_supported(const char16_t* tag) override { return std::u16string(tag) == u"en-US"; }
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t* tag) override
+	{
+		if (std::u16string(tag) != u"en-US")
+			return nullptr;
+		++shared.checkers;
+		return std::make_unique<Checker>(shared);
+	}
+
+private:
+	static void stall(Shared& shared)
+	{
+		std::unique_lock<std::mutex> lock(shared.mutex);
+		++shared.stalled;
+		shared.wake.wait(lock, [&shared]() { return shared.released; });
+	}
+
+	class Enumerator : public StringEnumerator
+	{
+	public:
+		Enumerator(Shared& shared, std::vector<std::u16string> strings) : shared(shared), strings(std::move(strings)), position(0) {}
+		~Enumerator() { ++shared.finished; }
+
+		bool next(std::u16string& out) override
+		{
+			if (position == strings.size())
+				return false;
+			out = strings[position++];
+			return true;
+		}
+
+	private:
+		Shared& shared;
+		std::vector<std::u16string> strings;
+		size_t position;
+	};
+
+	class Checker : public SpellChecker
+	{
+	public:
+		explicit Checker(Shared& shared) : shared(shared), words({ u"hello", u"world" }) {}
+
+		int check(const char16_t* word) override
+		{
+			if (std::u16string(word) == u"hang")
+			{
+				stall(shared);
+				return 0;
+			}
+			return words.count(word) ? 0 : 1;
+		}
+		std::unique_ptr<StringEnumerator> suggest(const char16_t* word) override
+		{
+			if (std::u16string(word) != u"hang")
+				return nullptr;
+			stall(shared);
+			return std::make_unique<Enumerator>(shared, std::vector<std::u16string>({ u"hand", u"hank" }));
+		}
+		bool add(const char16_t* word) override { words.insert(word); return true; }
+		bool ignore(const char16_t* word) override { words.insert(word); return true; }
+		bool auto_correct(const char16_t*, const char16_t*) override { return true; }
+
+	private:
+		Shared& shared;
+		std::set<std::u16string> words;
+	};
+
+	Shared& shared;
+};
+
+static void watchdog_usage()
+{
+	fputs(
+		"usage: enchant_windows_bench watchdog [options]\n"
+		"  --watchdog-ms N        how long a call may hang (default 200)\n",
+		stderr);
+}
+
+static bool parse_watchdog_options(int argc, char** argv, unsigned long& watchdog_ms)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h")
+			return false;
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "missing value for %s\n", arg.c_str());
+			return false;
+		}
+		const char* v = argv[++i];
+		if (arg == "--watchdog-ms") watchdog_ms = strtoul(v, nullptr, 10);
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return false;
+		}
+	}
+	return watchdog_ms > 0;
+}
+
+// Wait for the backend to have stalled 'count' checks in all.
+static bool wait_stalled(const StallingBackend::Shared& shared, int count)
+{
+	Clock::time_point start = Clock::now();
+	while (shared.stalled < count)
+	{
+		if (elapsed_ns(start) > 10000000000ull)
+			return false;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return true;
+}
+
+// Collect 'count' completions, by cookie. Returns false on timeout.
+static bool wait_completions(size_t count, std::vector<EnchantWindowsCompletion>& out)
+{
+	while (out.size() < count)
+	{
+		if (!wait_readable(enchant_windows_completion_fd(), 10000))
+			return false;
+		EnchantWindowsCompletion completions[8];
+		const size_t n = enchant_windows_poll_completions(completions, 8);
+		out.insert(out.end(), completions, completions + n);
+	}
+	return true;
+}
+
+static int completion_result(const std::vector<EnchantWindowsCompletion>& completions, void* cookie)
+{
+	for (const auto& completion : completions)
+	{
+		if (completion.cookie == cookie)
+			return completion.result;
+	}
+	return 1;
+}
+
+int watchdog_main(int argc, char** argv)
+{
+	unsigned long watchdogMs = 200;
+	if (!parse_watchdog_options(argc, argv, watchdogMs))
+	{
+		watchdog_usage();
+		return 2;
+	}
+	set_environment("ENCHANT_WINDOWS_WATCHDOG_MS", std::to_string(watchdogMs));
+	set_environment("ENCHANT_WINDOWS_JOURNAL_DIR", "");
+	set_environment("ENCHANT_WINDOWS_ASYNC_LOAD", "");
+
+	StallingBackend::Shared backend;
+	EnchantProvider* provider = windows_provider_create<DefaultProviderPolicies>([&backend]() -> std::unique_ptr<SpellBackend> {
+		return std::make_unique<StallingBackend>(backend);
+	});
+	if (!provider)
+	{
+		fprintf(stderr, "cannot create a provider\n");
+		return 2;
+	}
+	EnchantDict* dict = provider->request_dict(provider, "en_US");
+	if (!dict)
+	{
+		fprintf(stderr, "no dictionary from the stand-in backend\n");
+		provider->dispose(provider);
+		return 2;
+	}
+
+	int failures = 0;
+	const double limitMs = 2.0 * watchdogMs;
+	const std::string hello = "hello";
+	const std::string world = "world";
+	const std::string hang = kHangWord;
+
+	// A check that hangs, with more queued behind it.
+	int hungResult = 0;
+	double hungMs = 0;
+	std::thread hung([&]() {
+		Clock::time_point start = Clock::now();
+		hungResult = dict->check(dict, hang.c_str(), hang.size());
+		hungMs = elapsed_ns(start) / 1e6;
+	});
+	if (!wait_stalled(backend, 1))
+	{
+		fprintf(stderr, "the stand-in backend never stalled\n");
+		backend.release();
+		hung.join();
+		return 1;
+	}
+	std::vector<EnchantWindowsCompletion> completions;
+	enchant_windows_dict_check_async(dict, world.c_str(), world.size(), reinterpret_cast<void*>(1));
+	Clock::time_point queuedStart = Clock::now();
+	const int queuedResult = dict->check(dict, hello.c_str(), hello.size());
+	const double queuedMs = elapsed_ns(queuedStart) / 1e6;
+	hung.join();
+	if (!wait_completions(1, completions))
+		fprintf(stderr, "the asynchronous check queued behind the hung one never completed\n");
+
+	fprintf(stderr, "hung check came back with %d after %.1f ms; the check queued behind it with %d after %.1f ms\n",
+		hungResult, hungMs, queuedResult, queuedMs);
+	if (hungResult != -1)
+	{
+		fprintf(stderr, "hung check returned %d, not -1\n", hungResult);
+		++failures;
+	}
+	if (hungMs > limitMs)
+	{
+		fprintf(stderr, "hung check took %.1f ms to come back, above %.1f ms\n", hungMs, limitMs);
+		++failures;
+	}
+	if (queuedResult != 0 || completion_result(completions, reinterpret_cast<void*>(1)) != 0)
+	{
+		fprintf(stderr, "work queued behind the hung check was lost or wrong\n");
+		++failures;
+	}
+
+	// The same with the hanging check asynchronous: it completes with an error.
+	completions.clear();
+	Clock::time_point asyncStart = Clock::now();
+	enchant_windows_dict_check_async(dict, hang.c_str(), hang.size(), reinterpret_cast<void*>(2));
+	if (!wait_stalled(backend, 2) || !wait_completions(1, completions))
+	{
+		fprintf(stderr, "the hung asynchronous check never completed\n");
+		++failures;
+	}
+	const double asyncMs = elapsed_ns(asyncStart) / 1e6;
+	const int asyncResult = completion_result(completions, reinterpret_cast<void*>(2));
+	fprintf(stderr, "hung asynchronous check completed with %d after %.1f ms\n", asyncResult, asyncMs);
+	if (asyncResult != -1 || asyncMs > limitMs)
+	{
+		fprintf(stderr, "hung asynchronous check completed with %d after %.1f ms, not -1 within %.1f ms\n", asyncResult, asyncMs, limitMs);
+		++failures;
+	}
+
+	// Afterwards: fresh spell checkers, which still have what was added.
+	const std::string added = "zyzzyva";
+	dict->add_to_personal(dict, added.c_str(), added.size());
+	const int afterHello = dict->check(dict, hello.c_str(), hello.size());
+	const int afterAdded = dict->check(dict, added.c_str(), added.size());
+	fprintf(stderr, "%d backend(s) and %d spell checker(s) made; afterwards 'hello' checks %d and an added word %d\n",
+		backend.backends.load(), backend.checkers.load(), afterHello, afterAdded);
+	if (backend.checkers < 3)
+	{
+		fprintf(stderr, "the spell checker was not made anew after each hang\n");
+		++failures;
+	}
+	if (afterHello != 0 || afterAdded != 0)
+	{
+		fprintf(stderr, "the dictionary does not work after recovering\n");
+		++failures;
+	}
+
+	// Suggestions and languages that hang, asked for into counts that
+	// outlive the calls, to see whether anything lands there once the
+	// backend lets go.
+	const size_t kUntouched = 12345;
+	size_t hungSuggestions = kUntouched;
+	size_t hungLanguages = kUntouched;
+	char** suggestions = nullptr;
+	char** languages = nullptr;
+	std::thread hungSuggest([&]() {
+		suggestions = dict->suggest(dict, hang.c_str(), hang.size(), &hungSuggestions);
+	});
+	const bool suggestStalled = wait_stalled(backend, 3);
+	hungSuggest.join();
+	backend.hangLanguages = true;
+	std::thread hungList([&]() {
+		languages = provider->list_dicts(provider, &hungLanguages);
+	});
+	const bool listStalled = wait_stalled(backend, 4);
+	hungList.join();
+	if (!suggestStalled || !listStalled)
+	{
+		fprintf(stderr, "suggestions or the language list never hung\n");
+		++failures;
+	}
+	if (suggestions || languages)
+	{
+		fprintf(stderr, "a hung call for suggestions or languages came back with a list\n");
+		++failures;
+	}
+
+	// A recovery that hangs making the new backend is given up on in turn,
+	// without holding up requesting and disposing of dictionaries.
+	backend.hangBackends = 1;
+	std::thread hungAgain([&]() {
+		dict->check(dict, hang.c_str(), hang.size());
+	});
+	const bool recoveryStalled = wait_stalled(backend, 6);
+	hungAgain.join();
+	std::atomic<bool> requested(false);
+	std::thread requester([&]() {
+		EnchantDict* other = provider->request_dict(provider, "en_US");
+		if (other)
+			provider->dispose_dict(provider, other);
+		requested = true;
+	});
+	Clock::time_point requestStart = Clock::now();
+	while (!requested && elapsed_ns(requestStart) < 10ull * watchdogMs * 1000000)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	if (!requested)
+	{
+		// Stuck behind the recovery for good, so nothing can be torn down.
+		fprintf(stderr, "a hung recovery held up requesting a dictionary\n");
+		fflush(stderr);
+		_Exit(1);
+	}
+	const int afterRecovery = dict->check(dict, hello.c_str(), hello.size());
+	fprintf(stderr, "with the recovery hung, a dictionary was requested and disposed of; afterwards 'hello' checks %d\n",
+		afterRecovery);
+	if (!recoveryStalled || afterRecovery != 0)
+	{
+		fprintf(stderr, "the dictionary does not work after a hung recovery\n");
+		++failures;
+	}
+
+	// Let the abandoned workers finish before the provider goes.
+	backend.release();
+	requester.join();
+	Clock::time_point finishStart = Clock::now();
+	while (backend.finished < 2 && elapsed_ns(finishStart) < 10000000000ull)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	// What the abandoned calls do after reading the list is done by now.
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	fprintf(stderr, "after the hung calls finished, the suggestion count is %zu and the language count %zu\n",
+		hungSuggestions, hungLanguages);
+	if (hungSuggestions != kUntouched || hungLanguages != kUntouched)
+	{
+		fprintf(stderr, "a call given up on wrote to its caller's count after returning\n");
+		++failures;
+	}
+	provider->free_string_list(provider, suggestions);
+	provider->free_string_list(provider, languages);
+	provider->dispose_dict(provider, dict);
+	provider->dispose(provider);
+
+	return failures ? 1 : 0;
+}
+
+} // namespace bench
@@ -0,0 +1,319 @@
+/* enchant_windows - extensions exported by the Windows spell checking
+ *                   provider beyond the Enchant provider interface.
+ *
+ * Copyright (c) 2015 Brenda Streiff
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+ * License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+ */
+
+/* Applications reach these through the provider module, e.g. with
+ * GetProcAddress on libenchant_windows.dll; the *_fn typedefs match the
+ * exported functions. Every function taking an EnchantDict returns an error
+ * for dictionaries that did not come from this provider.
+ */
+
+#ifndef ENCHANT_WINDOWS_H
+#define ENCHANT_WINDOWS_H
+
+#include "enchant.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Memory accounting. */
+
+typedef enum
+{
+	ENCHANT_WINDOWS_MEMORY_DICT_STATE,     /* the EnchantDict and provider bookkeeping */
+	ENCHANT_WINDOWS_MEMORY_BACKEND_HANDLE, /* our side of backend objects; backend-owned memory is not visible */
+	ENCHANT_WINDOWS_MEMORY_CACHE,          /* result caches */
+	ENCHANT_WINDOWS_MEMORY_FILTER,         /* membership filters */
+	ENCHANT_WINDOWS_MEMORY_USER_WORDS,     /* in-process personal/exclude word sets */
+	ENCHANT_WINDOWS_MEMORY_STRING_ARENA,   /* string lists handed out and not yet freed */
+	ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT
+} EnchantWindowsMemoryCategory;
+
+typedef struct
+{
+	size_t current_bytes[ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT];
+	size_t peak_bytes[ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT];
+	size_t total_bytes;
+	size_t peak_total_bytes;
+} EnchantWindowsDictMemory;
+
+/* Fill 'out' with the bytes currently and at most held on behalf of 'dict'.
+ * Returns 0 on success, -1 if 'dict' is not ours. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_dict_memory_usage(EnchantDict* dict, EnchantWindowsDictMemory* out);
+typedef int (*enchant_windows_dict_memory_usage_fn)(EnchantDict* dict, EnchantWindowsDictMemory* out);
+
+/* Short lowercase name for a category, or NULL if out of range. */
+ENCHANT_MODULE_EXPORT(const char*)
+	enchant_windows_memory_category_name(int category);
+typedef const char* (*enchant_windows_memory_category_name_fn)(int category);
+
+/* Call statistics. Only plugins built with an instrumentation policy keep
+ * them (see src/provider_policies.h); the others return -1. */
+
+typedef enum
+{
+	ENCHANT_WINDOWS_STAT_CHECK,             /* check calls */
+	ENCHANT_WINDOWS_STAT_MISSPELLED,        /* checks that found the word misspelled */
+	ENCHANT_WINDOWS_STAT_CACHE_HIT,         /* checks answered without the backend */
+	ENCHANT_WINDOWS_STAT_SUGGEST,           /* suggest calls */
+	ENCHANT_WINDOWS_STAT_ADD_TO_PERSONAL,   /* add_to_personal calls */
+	ENCHANT_WINDOWS_STAT_ADD_TO_EXCLUDE,    /* add_to_exclude calls */
+	ENCHANT_WINDOWS_STAT_STORE_REPLACEMENT, /* store_replacement calls */
+	ENCHANT_WINDOWS_STAT_RELOAD,            /* spell checkers replaced by enchant_windows_dict_reload */
+	ENCHANT_WINDOWS_STAT_COUNT
+} EnchantWindowsStat;
+
+typedef struct
+{
+	unsigned long long counts[ENCHANT_WINDOWS_STAT_COUNT];
+} EnchantWindowsDictStats;
+
+/* Fill 'out' with the calls made on 'dict' so far. Returns 0 on success, -1
+ * if 'dict' is not ours or the plugin keeps no statistics. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_dict_stats(EnchantDict* dict, EnchantWindowsDictStats* out);
+typedef int (*enchant_windows_dict_stats_fn)(EnchantDict* dict, EnchantWindowsDictStats* out);
+
+/* Short lowercase name for a statistic, or NULL if out of range. */
+ENCHANT_MODULE_EXPORT(const char*)
+	enchant_windows_stat_name(int stat);
+typedef const char* (*enchant_windows_stat_name_fn)(int stat);
+
+/* Reloading. */
+
+/* Build a new spell checker for 'dict' from the language data as it is now,
+ * on a thread of its own, and switch the dictionary over to it once built.
+ * Calls on the dictionary are answered by the old spell checker until then
+ * and never wait for the build. Words added or ignored and replacements
+ * stored on the dictionary carry over. A reload still in progress is waited
+ * for first. Returns 0 once started, -1 if 'dict' is not ours. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_dict_reload(EnchantDict* dict);
+typedef int (*enchant_windows_dict_reload_fn)(EnchantDict* dict);
+
+/* Wait for the last reload of 'dict' to finish. Returns 0 if the new spell
+ * checker is in use, 1 if it could not be built and the old one still is,
+ * and -1 if 'dict' is not ours or was never reloaded. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_dict_wait_for_reload(EnchantDict* dict);
+typedef int (*enchant_windows_dict_wait_for_reload_fn)(EnchantDict* dict);
+
+/* Suggestions. */
+
+/* Like enchant_dict_suggest, but only the best 'max' suggestions: the
+ * backend's list is read no further than that, which saves its enumerating
+ * and converting the rest. 0 is the dictionary's default, which is every
+ * suggestion unless ENCHANT_WINDOWS_SUGGEST_MAX is set to a number, and
+ * which the plain suggest call uses too. Free the list with
+ * enchant_dict_free_suggestions. Returns null, with '*out_n_suggs' left
+ * alone, if there are no suggestions or 'dict' is not ours. */
+ENCHANT_MODULE_EXPORT(char**)
+	enchant_windows_dict_suggest_max(EnchantDict* dict, const char* word, size_t len, size_t max, size_t* out_n_suggs);
+typedef char** (*enchant_windows_dict_suggest_max_fn)(EnchantDict* dict, const char* word, size_t len, size_t max, size_t* out_n_suggs);
+
+/* Word completion. */
+
+/* Up to 'max' words starting with 'prefix', most common first, capitalized
+ * like the prefix when it is Title Case or ALL CAPS. The words come from a
+ * frequency list, '<tag>.freq', found in ENCHANT_WINDOWS_COMPLETION_PATH or
+ * else where word lists are looked for, read on the first call. Personal
+ * words are included, and excluded words left out. Answered on the calling
+ * thread without a backend call. Free the list with
+ * enchant_dict_free_suggestions. Returns null, with '*out_n_words' left
+ * alone, if there are no completions or 'dict' is not ours. */
+ENCHANT_MODULE_EXPORT(char**)
+	enchant_windows_dict_complete(EnchantDict* dict, const char* prefix, size_t len, size_t max, size_t* out_n_words);
+typedef char** (*enchant_windows_dict_complete_fn)(EnchantDict* dict, const char* prefix, size_t len, size_t max, size_t* out_n_words);
+
+/* Host integration. */
+
+typedef void (*EnchantWindowsJobFn)(void* job);
+typedef void (*EnchantWindowsExecutorFn)(EnchantWindowsJobFn run, void* job, void* data);
+
+/* Run backend calls on the application's threads instead of a worker thread
+ * of the provider's own. The provider hands 'executor' jobs, each of which
+ * must be run once as run(job), on any thread and without waiting on the
+ * caller; the provider keeps its work in order itself. A provider call made
+ * from inside one of the provider's jobs (by a backend, say) runs there and
+ * then. One that returns a result, made from another job of the executor's,
+ * waits for the provider's jobs to run, so the executor must have a thread
+ * free for them: with a single thread it waits forever. On Windows jobs must
+ * run on threads in the multithreaded COM apartment. Applies to providers created afterwards; NULL goes back to the
+ * worker thread. Returns 0, or -1 while any provider exists. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_set_executor(EnchantWindowsExecutorFn executor, void* data);
+typedef int (*enchant_windows_set_executor_fn)(EnchantWindowsExecutorFn executor, void* data);
+
+/* Asynchronous checks. */
+
+typedef struct
+{
+	EnchantDict* dict;
+	void* cookie;
+	int result; /* as enchant_dict_check would have returned */
+} EnchantWindowsCompletion;
+
+/* Check 'word' without waiting for the answer, which is queued as a
+ * completion carrying 'cookie'. Checks and other calls on 'dict' still take
+ * effect in the order they are made, and disposing of it waits for checks
+ * already queued. Returns 0 once queued, -1 if 'dict' is not ours. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_dict_check_async(EnchantDict* dict, const char* word, size_t len, void* cookie);
+typedef int (*enchant_windows_dict_check_async_fn)(EnchantDict* dict, const char* word, size_t len, void* cookie);
+
+/* Something to add to the application's event loop that is ready while
+ * completions are waiting: on Linux an eventfd and on other POSIX systems
+ * the read end of a pipe, both readable, and on Windows an event HANDLE,
+ * signalled. Only enchant_windows_poll_completions clears it. Returns -1 if
+ * it could not be created. */
+ENCHANT_MODULE_EXPORT(intptr_t)
+	enchant_windows_completion_fd(void);
+typedef intptr_t (*enchant_windows_completion_fd_fn)(void);
+
+/* Move up to 'max' waiting completions, oldest first, into 'out' and return
+ * how many there were. Leaves the fd ready if any are left over. */
+ENCHANT_MODULE_EXPORT(size_t)
+	enchant_windows_poll_completions(EnchantWindowsCompletion* out, size_t max);
+typedef size_t (*enchant_windows_poll_completions_fn)(EnchantWindowsCompletion* out, size_t max);
+
+/* Asynchronous loading. */
+
+struct str_enchant_provider;
+
+typedef enum
+{
+	ENCHANT_WINDOWS_DICT_READY,
+	ENCHANT_WINDOWS_DICT_LOADING,
+	ENCHANT_WINDOWS_DICT_FAILED
+} EnchantWindowsDictLoadState;
+
+/* What checks on a dictionary that is still loading return, other than for
+ * words added or ignored on it meanwhile, which are correct. Asynchronous
+ * checks are held back until it has loaded instead. */
+#define ENCHANT_WINDOWS_CHECK_PENDING (-2)
+
+/* Request a dictionary without waiting for its language data to load. The
+ * dictionary is returned at once and loaded on a thread of its own, so
+ * several requested together load in parallel. Words added or ignored and
+ * replacements stored before it has loaded are applied once it has.
+ * Suggestions are empty until then. When loading finishes a completion with
+ * 'cookie' is posted: 0 if it loaded, -1 if not, after which checks return
+ * -1. enchant_windows_dict_wait_for_reload waits for it. Returns null if the
+ * provider is not ours or does not have 'tag'. Dispose of the dictionary
+ * through the provider's dispose_dict, which waits for the load.
+ *
+ * Setting ENCHANT_WINDOWS_ASYNC_LOAD to 1 has the provider's own
+ * request_dict load this way, without a completion. */
+ENCHANT_MODULE_EXPORT(EnchantDict*)
+	enchant_windows_request_dict_async(struct str_enchant_provider* provider, const char* tag, void* cookie);
+typedef EnchantDict* (*enchant_windows_request_dict_async_fn)(struct str_enchant_provider* provider, const char* tag, void* cookie);
+
+/* One of EnchantWindowsDictLoadState, or -1 if 'dict' is not ours. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_dict_load_state(EnchantDict* dict);
+typedef int (*enchant_windows_dict_load_state_fn)(EnchantDict* dict);
+
+/* Slow-call log. */
+
+typedef enum
+{
+	ENCHANT_WINDOWS_OP_CHECK,
+	ENCHANT_WINDOWS_OP_SUGGEST,
+	ENCHANT_WINDOWS_OP_ADD_TO_PERSONAL,
+	ENCHANT_WINDOWS_OP_ADD_TO_EXCLUDE,
+	ENCHANT_WINDOWS_OP_STORE_REPLACEMENT,
+	ENCHANT_WINDOWS_OP_REQUEST_DICT,
+	ENCHANT_WINDOWS_OP_DICTIONARY_EXISTS,
+	ENCHANT_WINDOWS_OP_LIST_DICTS,
+	ENCHANT_WINDOWS_OP_CHECK_ASYNC,        /* queueing the check, not the check itself */
+	ENCHANT_WINDOWS_OP_COMPLETE,
+	ENCHANT_WINDOWS_OP_RELOAD,             /* building the new spell checker, on its thread */
+	ENCHANT_WINDOWS_OP_REQUEST_DICT_ASYNC, /* up to when the load starts */
+	ENCHANT_WINDOWS_OP_COUNT
+} EnchantWindowsOp;
+
+/* How much of a slow call's input the log keeps. */
+typedef enum
+{
+	ENCHANT_WINDOWS_CAPTURE_NONE, /* only its length */
+	ENCHANT_WINDOWS_CAPTURE_HASH, /* a 64-bit FNV-1a hash of it, the same in every process */
+	ENCHANT_WINDOWS_CAPTURE_WORD  /* the word itself, and the hash */
+} EnchantWindowsCapture;
+
+/* A threshold that turns the log off. */
+#define ENCHANT_WINDOWS_SLOW_CALL_OFF (~0ull)
+
+#define ENCHANT_WINDOWS_SLOW_CALL_TAG_BYTES 32
+#define ENCHANT_WINDOWS_SLOW_CALL_WORD_BYTES 64
+
+typedef struct
+{
+	unsigned long long sequence;      /* 1 for the first slow call logged, and so on */
+	int op;                           /* an EnchantWindowsOp */
+	int capture;                      /* the EnchantWindowsCapture this entry got */
+	char tag[ENCHANT_WINDOWS_SLOW_CALL_TAG_BYTES];   /* language, truncated, NUL-terminated */
+	size_t word_length;               /* bytes of input (the misspelling, for replacements) */
+	unsigned long long total_ns;      /* the whole call, as the caller saw it */
+	unsigned long long queue_wait_ns; /* waiting for earlier backend calls to finish */
+	unsigned long long backend_ns;    /* running where backend calls run */
+	unsigned long long word_hash;
+	char word[ENCHANT_WINDOWS_SLOW_CALL_WORD_BYTES]; /* truncated, NUL-terminated */
+} EnchantWindowsSlowCall;
+
+/* Log provider calls taking 'threshold_us' microseconds or more (0 for every
+ * call; ENCHANT_WINDOWS_SLOW_CALL_OFF to stop) into a ring of the most recent few hundred. Every 'sample_every'th entry
+ * logged gets 'capture' (an EnchantWindowsCapture); the others just the
+ * length. Also set at startup from ENCHANT_WINDOWS_SLOW_CALL_US,
+ * ENCHANT_WINDOWS_SLOW_CALL_CAPTURE ("none", "hash" or "word"; default
+ * "hash") and ENCHANT_WINDOWS_SLOW_CALL_SAMPLE (default 1). Returns 0, or -1
+ * if 'capture' or 'sample_every' is out of range. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_set_slow_call_log(unsigned long long threshold_us, int capture, unsigned sample_every);
+typedef int (*enchant_windows_set_slow_call_log_fn)(unsigned long long threshold_us, int capture, unsigned sample_every);
+
+/* Copy the up to 'max' most recent entries, oldest first, into 'out' and
+ * return how many there were. Gaps in 'sequence' are entries the ring has
+ * since overwritten. */
+ENCHANT_MODULE_EXPORT(size_t)
+	enchant_windows_slow_calls(EnchantWindowsSlowCall* out, size_t max);
+typedef size_t (*enchant_windows_slow_calls_fn)(EnchantWindowsSlowCall* out, size_t max);
+
+/* Append the entries to the file 'path' ("-" for stderr), a line each.
+ * Setting ENCHANT_WINDOWS_SLOW_CALL_LOG to a file name does this whenever a
+ * provider is disposed. Returns the number of entries written, or -1 if the
+ * file cannot be opened. */
+ENCHANT_MODULE_EXPORT(int)
+	enchant_windows_dump_slow_calls(const char* path);
+typedef int (*enchant_windows_dump_slow_calls_fn)(const char* path);
+
+/* A short name for an EnchantWindowsOp, or null. */
+ENCHANT_MODULE_EXPORT(const char*)
+	enchant_windows_op_name(int op);
+typedef const char* (*enchant_windows_op_name_fn)(int op);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENCHANT_WINDOWS_H */
@@ -0,0 +1,275 @@
+// enchant_windows - C++ API for applications that embed the provider.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#ifndef ENCHANT_WINDOWS_HPP
+#define ENCHANT_WINDOWS_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// For applications that only ever use this provider: link
+// enchant_windows_core and talk to it directly, rather than through
+// Enchant's broker and the EnchantDict function table. The spell checker is
+// the same one the plugin uses, and calls go to the same worker thread, but
+// words are passed as string_views, results land in caller-owned objects
+// that keep their storage between calls, and a batch of words costs one
+// trip to the worker instead of one per word.
+//
+//   auto provider = enchant_windows::Provider::create();
+//   auto dict = provider->request_dict("en_US");
+//   enchant_windows::Suggestions suggestions;
+//   if (dict->check(word) > 0 && dict->suggest(word, suggestions))
+//       for (std::string_view s : suggestions) ...
+//
+// All strings are UTF-8. Objects may be used from any thread.
+
+namespace enchant_windows {
+
+// A view of contiguous elements, like C++20's std::span.
+template<typename T>
+class Span
+{
+public:
+	Span() : ptr(nullptr), count(0) {}
+	Span(T* data, size_t size) : ptr(data), count(size) {}
+	template<typename Container>
+	Span(Container& c) : ptr(c.data()), count(c.size()) {}
+
+	T* data() const { return ptr; }
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+	T& operator[](size_t i) const { return ptr[i]; }
+	T* begin() const { return ptr; }
+	T* end() const { return ptr + count; }
+
+private:
+	T* ptr;
+	size_t count;
+};
+
+// Suggestions for one word. Reuse one across calls to avoid allocating.
+class Suggestions
+{
+public:
+	class const_iterator
+	{
+	public:
+		const_iterator(const Suggestions* owner, size_t index) : owner(owner), index(index) {}
+		std::string_view operator*() const { return (*owner)[index]; }
+		const_iterator& operator++() { ++index; return *this; }
+		bool operator!=(const const_iterator& other) const { return index != other.index; }
+		bool operator==(const const_iterator& other) const { return index == other.index; }
+
+	private:
+		const Suggestions* owner;
+		size_t index;
+	};
+
+	size_t size() const { return ends.size(); }
+	bool empty() const { return ends.empty(); }
+	std::string_view operator[](size_t i) const
+	{
+		size_t start = i ? ends[i - 1] : 0;
+		return std::string_view(text.data() + start, ends[i] - start);
+	}
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, size()); }
+
+	void clear() { text.clear(); ends.clear(); }
+	void push_back(std::string_view s) { text.append(s.data(), s.size()); ends.push_back(text.size()); }
+
+private:
+	// All suggestions back to back, and where each one ends.
+	std::string text;
+	std::vector<size_t> ends;
+};
+
+class Dictionary
+{
+public:
+	~Dictionary();
+
+	Dictionary(const Dictionary&) = delete;
+	Dictionary& operator=(const Dictionary&) = delete;
+
+	// The tag this was requested with.
+	const std::string& tag() const;
+
+	// 0 if 'word' is spelled correctly, 1 if not, -1 on error.
+	int check(std::string_view word);
+
+	// check() for each of 'words' into the same place in 'results', which
+	// must be at least as long.
+	void check(Span<const std::string_view> words, Span<int> results);
+
+	// Fill 'out' with suggestions for 'word'. Returns false, with 'out'
+	// empty, if the word is spelled correctly or on error.
+	bool suggest(std::string_view word, Suggestions& out);
+
+	// The same, but only the best 'max' suggestions, 0 for the default (see
+	// enchant_windows_dict_suggest_max), without reading the rest.
+	bool suggest(std::string_view word, Suggestions& out, size_t max);
+
+	// Fill 'out' with up to 'max' words starting with 'prefix', most common
+	// first (see enchant_windows_dict_complete). Returns false, with 'out'
+	// empty, if there are none. Doesn't go to the worker.
+	bool complete(std::string_view prefix, Suggestions& out, size_t max);
+
+	// Add to the user's dictionary, ignore for this dictionary's lifetime,
+	// and store an autocorrection, as the EnchantDict functions do.
+	void add(std::string_view word);
+	void ignore(std::string_view word);
+	void store_replacement(std::string_view misspelled, std::string_view correct);
+
+	struct Impl;
+
+private:
+	friend class Provider;
+	explicit Dictionary(std::unique_ptr<Impl> impl);
+	std::unique_ptr<Impl> impl;
+};
+
+class Provider
+{
+public:
+	// The backend the plugin would use on this platform. Null on failure.
+	static std::unique_ptr<Provider> create();
+
+	~Provider();
+
+	Provider(const Provider&) = delete;
+	Provider& operator=(const Provider&) = delete;
+
+	// A dictionary for 'tag' ("en_US"), or null if there isn't one. It may
+	// outlive the provider.
+	std::unique_ptr<Dictionary> request_dict(std::string_view tag);
+
+	bool dictionary_exists(std::string_view tag);
+	std::vector<std::string> list_dicts();
+
+	struct Impl;
+
+private:
+	explicit Provider(std::shared_ptr<Impl> impl);
+	std::shared_ptr<Impl> impl;
+};
+
+// Spell checks text that mixes languages. Each sentence is identified as
+// the language of one of the router's dictionaries and its words checked
+// against that dictionary, with all the words for a dictionary sent as one
+// batch. Sentences too short to identify take the language of the sentence
+// before them, or else the first dictionary's. A word in a script the
+// sentence's language isn't written in goes to the first dictionary whose
+// language is (Cyrillic to a Russian one in an English sentence), and is
+// skipped if there is none (emoji, or Han with no Chinese dictionary).
+//
+//   enchant_windows::LanguageRouter router({ en.get(), de.get() });
+//   std::vector<enchant_windows::LanguageRouter::Word> words;
+//   router.check(text, words);
+//
+// The identifier knows en, de, fr, es, it, nl, pt and sv; a dictionary for
+// any other language is only used as the fallback. A router keeps buffers
+// between calls, so use one per thread.
+class LanguageRouter
+{
+public:
+	struct Word
+	{
+		size_t offset;           // bytes into the text
+		size_t length;
+		Dictionary* dictionary;  // the one it was checked against, null if skipped
+		int result;              // as Dictionary::check, 0 if skipped
+	};
+
+	// The dictionaries must outlive the router.
+	explicit LanguageRouter(std::vector<Dictionary*> dictionaries);
+	~LanguageRouter();
+
+	LanguageRouter(const LanguageRouter&) = delete;
+	LanguageRouter& operator=(const LanguageRouter&) = delete;
+
+	// The dictionary for 'sentence', or null if it is too short to tell.
+	Dictionary* identify(std::string_view sentence) const;
+
+	// Split 'text' into sentences and words and check every word, in order,
+	// into 'out'.
+	void check(std::string_view text, std::vector<Word>& out);
+
+	struct Impl;
+
+private:
+	std::unique_ptr<Impl> impl;
+};
+
+// Finds real-word errors, which no spell checker can: words spelled
+// correctly that are probably not the word meant ("their" for "there",
+// "loose" for "lose"). Each word of a confusion set is scored against the
+// others in its set by a language model of the two words either side, and
+// flagged when one of them makes the sentence clearly likelier. Run it over
+// what a LanguageRouter found; it looks at the words one dictionary passed,
+// and takes the rest as context.
+//
+//   auto context = enchant_windows::ContextChecker::create(*en);
+//   std::vector<enchant_windows::ContextChecker::Error> errors;
+//   router.check(text, words);
+//   if (context)
+//       context->check(text, words, errors);
+//
+// The model is '<tag>.ngram' (see src/ngram_model.h), mapped into memory.
+// Scoring doesn't go to the worker, and is cheap enough to run as the user
+// types. A checker keeps buffers between calls, so use one per thread.
+class ContextChecker
+{
+public:
+	struct Error
+	{
+		size_t word;             // index into the words checked
+		std::string correction;  // the likelier word, capitalized like the one written
+	};
+
+	// A checker for the words 'dictionary' checked, with the model for its
+	// language, found as ENCHANT_WINDOWS_NGRAM_PATH or the word list search
+	// path says. Null if there is none.
+	static std::unique_ptr<ContextChecker> create(const Dictionary& dictionary);
+
+	// The same with the model in 'path'.
+	static std::unique_ptr<ContextChecker> create(const Dictionary& dictionary, const std::string& path);
+
+	~ContextChecker();
+
+	ContextChecker(const ContextChecker&) = delete;
+	ContextChecker& operator=(const ContextChecker&) = delete;
+
+	// Set 'out' to the words of 'text', as LanguageRouter::check split it
+	// into 'words', that are probably real-word errors, in order.
+	void check(std::string_view text, Span<const LanguageRouter::Word> words, std::vector<Error>& out);
+
+	struct Impl;
+
+private:
+	explicit ContextChecker(std::unique_ptr<Impl> impl);
+	std::unique_ptr<Impl> impl;
+};
+
+} // namespace enchant_windows
+
+#endif
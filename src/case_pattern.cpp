@@ -0,0 +1,224 @@
+// enchant_windows - case patterns of words.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "case_pattern.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENCHANT_WINDOWS_CASE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+CaseRules case_rules_for(const LanguageTag& language)
+{
+	CaseRules rules = { true, false };
+	const char* reuse = getenv("ENCHANT_WINDOWS_CASE_REUSE");
+	if (reuse && strcmp(reuse, "0") == 0)
+		rules.fold = false;
+
+	const std::string& tag = language.bcp47;
+	const std::string_view primary = std::string_view(tag).substr(0, tag.find('-'));
+	rules.dotted_i = primary == "tr" || primary == "az" || primary == "crh";
+	return rules;
+}
+
+// What was seen of a word: whether its first character is a capital, and
+// whether there are capitals after it or lowercase letters anywhere.
+static CasePattern classify(bool first_upper, bool upper_after, bool any_lower)
+{
+	if (!first_upper && !upper_after)
+		return kCaseLower;
+	if (!upper_after)
+		return kCaseTitle;
+	if (!any_lower)
+		return kCaseUpper;
+	return kCaseMixed;
+}
+
+CasePattern case_pattern_scalar(const char* word, size_t len, const CaseRules& rules, char* lower)
+{
+	if (!rules.fold)
+		return kCaseMixed;
+
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(word);
+	bool first_upper = false;
+	bool upper_after = false;
+	bool any_lower = false;
+	for (size_t i = 0; i < len; ++i)
+	{
+		const size_t start = i;
+		bool upper = false;
+		const unsigned char c = bytes[i];
+		if (c < 0x80)
+		{
+			upper = c >= 'A' && c <= 'Z';
+			any_lower |= c >= 'a' && c <= 'z';
+			if (c == 'I' && rules.dotted_i)
+				return kCaseMixed;
+			lower[i] = static_cast<char>(upper ? c | 0x20 : c);
+		}
+		else if (c == 0xC3 && i + 1 < len && bytes[i + 1] >= 0x80 && bytes[i + 1] <= 0xBF)
+		{
+			// U+00C0 to U+00DE are capitals, U+00DF to U+00FF lowercase,
+			// but for the multiplication and division signs.
+			const unsigned char trail = bytes[++i];
+			upper = trail <= 0x9E && trail != 0x97;
+			any_lower |= trail >= 0x9F && trail != 0xB7;
+			lower[start] = static_cast<char>(c);
+			lower[i] = static_cast<char>(upper ? trail + 0x20 : trail);
+		}
+		else
+		{
+			// Some other letter, or not one; either way its case isn't known.
+			return kCaseMixed;
+		}
+
+		if (upper)
+		{
+			if (start == 0)
+				first_upper = true;
+			else
+				upper_after = true;
+		}
+	}
+	return classify(first_upper, upper_after, any_lower);
+}
+
+#ifdef ENCHANT_WINDOWS_CASE_SSE2
+// What a block of up to sixteen bytes holds: masks of its capitals,
+// lowercase letters and Is, and the block with 0x20 set on the capitals.
+struct Block
+{
+	int upper;
+	int lower;
+	int capital_i;
+	__m128i folded;
+};
+
+static Block scan(__m128i c)
+{
+	// ASCII is positive as signed bytes, so signed compares will do.
+	const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('Z' + 1)));
+	const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('z' + 1)));
+	Block block;
+	block.upper = _mm_movemask_epi8(upper);
+	block.lower = _mm_movemask_epi8(lower);
+	block.capital_i = _mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8('I')));
+	block.folded = _mm_or_si128(c, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+	return block;
+}
+
+// A word of at least eight bytes, a block at a time. Rather than copy a
+// short last block anywhere, it is loaded overlapping the one before, and a
+// word shorter than a block is loaded as two overlapping halves; the masks
+// are only ORed together, so seeing a byte twice does no harm. Words
+// shorter than eight bytes, or with anything not ASCII, go to the scalar
+// path.
+static CasePattern case_pattern_sse2(const char* word, size_t len, const CaseRules& rules, char* lower)
+{
+	if (!rules.fold || len < 8)
+		return case_pattern_scalar(word, len, rules, lower);
+
+	int first_upper = 0;
+	int upper_after = 0;
+	int any_lower = 0;
+	int any_i = 0;
+	if (len < 16)
+	{
+		const __m128i head = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(word));
+		const __m128i tail = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(word + len - 8));
+		const __m128i c = _mm_unpacklo_epi64(head, tail);
+		if (_mm_movemask_epi8(c) != 0)
+			return case_pattern_scalar(word, len, rules, lower);
+
+		const Block block = scan(c);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(lower), block.folded);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(lower + len - 8), _mm_srli_si128(block.folded, 8));
+		first_upper = block.upper & 1;
+		// For eight bytes the second half is the first over again.
+		upper_after = block.upper & (len == 8 ? 0xFEFE : 0xFFFE);
+		any_lower = block.lower;
+		any_i = block.capital_i;
+	}
+	else
+	{
+		for (size_t i = 0; i < len; i += 16)
+		{
+			const size_t at = i + 16 <= len ? i : len - 16;
+			const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(word + at));
+			if (_mm_movemask_epi8(c) != 0)
+				return case_pattern_scalar(word, len, rules, lower);
+
+			const Block block = scan(c);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lower + at), block.folded);
+			if (at == 0)
+			{
+				first_upper = block.upper & 1;
+				upper_after |= block.upper & ~1;
+			}
+			else
+			{
+				upper_after |= block.upper;
+			}
+			any_lower |= block.lower;
+			any_i |= block.capital_i;
+		}
+	}
+
+	if (any_i && rules.dotted_i)
+		return kCaseMixed;
+	return classify(first_upper != 0, upper_after != 0, any_lower != 0);
+}
+#endif
+
+CasePattern case_pattern(const char* word, size_t len, const CaseRules& rules, char* lower)
+{
+#ifdef ENCHANT_WINDOWS_CASE_SSE2
+	return case_pattern_sse2(word, len, rules, lower);
+#else
+	return case_pattern_scalar(word, len, rules, lower);
+#endif
+}
+
+void capitalize(std::string& word, bool all, const CaseRules& rules)
+{
+	for (size_t i = 0; i < word.size(); ++i)
+	{
+		const unsigned char c = static_cast<unsigned char>(word[i]);
+		if (c >= 'a' && c <= 'z')
+		{
+			if (c != 'i' || !rules.dotted_i)
+				word[i] = static_cast<char>(c - 0x20);
+		}
+		else if (c == 0xC3 && i + 1 < word.size())
+		{
+			const unsigned char trail = static_cast<unsigned char>(word[++i]);
+			if (trail >= 0xA0 && trail <= 0xBE && trail != 0xB7)
+				word[i] = static_cast<char>(trail - 0x20);
+		}
+		else if (c >= 0x80 && !all)
+		{
+			return;
+		}
+		if (!all)
+			return;
+	}
+}
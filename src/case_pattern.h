@@ -0,0 +1,69 @@
+// enchant_windows - case patterns of words.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_CASE_PATTERN_H
+#define ENCHANT_WINDOWS_CASE_PATTERN_H
+
+#include "language_tags.h"
+
+#include <cstddef>
+#include <string>
+
+// How a word is capitalized, so that a verdict for its lowercase form can
+// stand for its Title Case and ALL CAPS forms: a word that is spelled
+// correctly still is at the start of a sentence or when shouted. Only ASCII
+// and the Latin-1 letters (U+00C0 to U+00FF) are folded, in 16-byte blocks
+// with SSE2 where available; a word with any other letter is taken as mixed,
+// and nothing is reused for it.
+
+enum CasePattern
+{
+	kCaseLower,  // no capitals, or no letters
+	kCaseTitle,  // a capital, then no more
+	kCaseUpper,  // capitals and no lowercase letters
+	kCaseMixed,  // anything else
+};
+
+// Language rules that change how words fold.
+struct CaseRules
+{
+	// False to fold nothing, and so reuse nothing.
+	bool fold;
+	// Turkish and Azerbaijani: I is the capital of dotless ı, so words with
+	// an I are taken as mixed.
+	bool dotted_i;
+};
+
+// The rules for a dictionary's language, by the primary subtag of its
+// canonical form ("tr-TR"). ENCHANT_WINDOWS_CASE_REUSE=0 turns folding off
+// for dictionaries made afterwards.
+CaseRules case_rules_for(const LanguageTag& language);
+
+// Classify 'word'. For Title Case and ALL CAPS, its lowercase form, which
+// is the same length, is written to 'lower'.
+CasePattern case_pattern(const char* word, size_t len, const CaseRules& rules, char* lower);
+
+// The same without SIMD, for comparison.
+CasePattern case_pattern_scalar(const char* word, size_t len, const CaseRules& rules, char* lower);
+
+// The reverse for a word case_pattern gave kCaseTitle or kCaseUpper:
+// capitalize the first letter of 'word', or all of them if 'all', as far as
+// case_pattern folds them.
+void capitalize(std::string& word, bool all, const CaseRules& rules);
+
+#endif
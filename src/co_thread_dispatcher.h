@@ -0,0 +1,532 @@
+// enchant_windows - worker thread that owns all backend calls.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_CO_THREAD_DISPATCHER_H
+#define ENCHANT_WINDOWS_CO_THREAD_DISPATCHER_H
+
+#include "compat.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <objbase.h>
+#endif
+
+#ifdef _WIN32
+// RAII class to wrap CoIninitalizeEx.
+struct CoInitializer
+{
+	CoInitializer() :
+		hr(CoInitializeEx(nullptr, COINIT_MULTITHREADED))
+	{}
+	~CoInitializer() _NOEXCEPT
+	{
+		if (SUCCEEDED(hr))
+			CoUninitialize();
+	}
+	HRESULT hr;
+};
+#else
+// Nothing to initialize for backends outside Windows.
+struct CoInitializer
+{
+	CoInitializer() {}
+};
+#endif
+
+// What a dispatched call hands back if the watchdog gives up on it: -1 (an
+// error, for the backend calls that return int), null for pointers, and a
+// value-initialized R otherwise.
+template<typename R>
+struct AbandonedResult
+{
+	static R get() { return R(); }
+};
+
+template<>
+struct AbandonedResult<int>
+{
+	static int get() { return -1; }
+};
+
+// How long the last call this thread dispatched waited behind others and
+// then ran. Only measured while timing is enabled, for the slow-call log.
+struct DispatchTiming
+{
+	DispatchTiming() : queued(0), ran(0) {}
+
+	std::chrono::nanoseconds queued;
+	std::chrono::nanoseconds ran;
+
+	static std::atomic<bool>& enabled()
+	{
+		static std::atomic<bool> on(false);
+		return on;
+	}
+	static DispatchTiming& last()
+	{
+		static thread_local DispatchTiming timing;
+		return timing;
+	}
+};
+
+// COM thread dispatcher. We're a DLL, and thus we're not allowed to call
+// CoInitialize* on the application's thread. Larry Osterman has an article:
+// http://blogs.msdn.com/b/larryosterman/archive/2004/05/12/130541.aspx
+// So, punt all COM stuff to a worker thread under our control. This class
+// provides a FIFO queue for serializing methods on a worker thread, so
+// callers on several application threads each get their work run in turn.
+//
+// A call that never returns would take the worker, and with it every call
+// queued behind, down with it. So the worker can be watched: once a call has
+// run longer than the watchdog allows, that thread is given up on and left
+// to finish (or not) by itself, the caller gets AbandonedResult, and a new
+// thread, in a new apartment, takes over the queue. Before anything else it
+// runs the recovery function, which is to replace whatever backend objects
+// the old thread may still be inside of. Nothing queued is lost.
+//
+// Alternatively the application can lend us its own threads through an
+// executor (enchant_windows_set_executor). The queue then runs in order, one
+// item at a time, inside jobs handed to the executor, and no thread of ours
+// is started. Those threads are the application's to watch.
+//
+// Either way, a synchronous dispatch from something the queue is running
+// runs at once on the same thread, since queued it would wait on itself.
+class CoThreadDispatcher
+{
+public:
+	// Runs 'run(work)' once, on any thread, some time after it's called.
+	typedef void (*Executor)(void (*run)(void* work), void* work, void* data);
+
+	// 'watchdog' of zero leaves the worker unwatched.
+	CoThreadDispatcher(std::chrono::milliseconds watchdog = std::chrono::milliseconds(0), std::function<void(void)> recover = nullptr) :
+		shared(std::make_shared<Shared>()),
+		executor(nullptr),
+		executor_data(nullptr),
+		draining(false),
+		watchdog_timeout(watchdog),
+		recover(std::move(recover)),
+		watchdog_stop(false)
+	{
+		shared->watched = watchdog.count() > 0;
+		dispatch_thread = std::thread(&CoThreadDispatcher::threadProc, shared, shared->generation);
+		if (shared->watched)
+			watchdog_thread = std::thread(&CoThreadDispatcher::watch, this);
+	}
+	CoThreadDispatcher(Executor executor, void* executor_data) :
+		shared(std::make_shared<Shared>()),
+		executor(executor),
+		executor_data(executor_data),
+		draining(false),
+		watchdog_timeout(0),
+		watchdog_stop(false)
+	{ }
+	~CoThreadDispatcher()
+	{
+		std::unique_lock<std::mutex> lock(shared->mutex);
+		if (!executor)
+		{
+			// Let the worker finish the queue, with the watchdog still
+			// there in case something in it hangs.
+			shared->stopping = true;
+			shared->dispatch_begin.notify_all();
+			shared->worker_stopped.wait(lock, [this]() { return shared->stopped; });
+			watchdog_stop = true;
+			lock.unlock();
+			watchdog_wake.notify_all();
+			if (watchdog_thread.joinable())
+				watchdog_thread.join();
+			dispatch_thread.join();
+			return;
+		}
+
+		// Wait for the executor to be done with us.
+		drained.wait(lock, [this]() { return !draining; });
+	}
+
+	// Dispatch callable object 'f' on the COM worker thread. Blocks until
+	// f returns, or the watchdog gives up on it. From something this
+	// dispatcher is running, which the queue would otherwise have to get
+	// past before reaching f, f is run there and then instead.
+	template<typename F>
+	typename std::result_of<F()>::type dispatch(F&& f)
+	{
+		typedef typename std::result_of<F()>::type ResultType;
+
+		if (current_queue() == shared.get() && !replaced())
+			return f();
+
+		// On the heap, since a thread the watchdog gave up on may still
+		// be running f after we have returned.
+		auto call = std::make_shared<Call<ResultType, typename std::decay<F>::type>>(std::forward<F>(f));
+		auto result = call->promise.get_future();
+		if (DispatchTiming::enabled().load(std::memory_order_relaxed))
+		{
+			call->timed = true;
+			call->queued = std::chrono::steady_clock::now();
+		}
+
+		queue({
+			[call]() { call->run(); },
+			[call]() { call->abandon(); }
+		});
+
+		// Wait for the future to have a result.
+		result.wait();
+		if (call->timed)
+			call->report_timing();
+
+		return result.get();
+	}
+
+	// Queue 'f' behind everything dispatched so far, and return without
+	// waiting for it. If the watchdog gives up on f, 'abandoned' is run
+	// instead of f making its result known, as long as f calls claim()
+	// first.
+	void post(std::function<void(void)> f, std::function<void(void)> abandoned = nullptr)
+	{
+		queue({ std::move(f), std::move(abandoned) });
+	}
+
+	// For something run by the dispatcher: whether it is still the one to
+	// make its result known. False once the watchdog has given up on it;
+	// after a true, it won't.
+	static bool claim()
+	{
+		std::atomic<int>* current = current_claim();
+		if (!current)
+			return true;
+		int expected = kRunning;
+		return current->compare_exchange_strong(expected, kClaimed) || expected == kClaimed;
+	}
+
+	// For something run by a watched worker: whether the watchdog has since
+	// given up on that worker and started another.
+	static bool replaced()
+	{
+		const Worker& worker = current_worker();
+		if (!worker.shared)
+			return false;
+		std::lock_guard<std::mutex> lock(worker.shared->mutex);
+		return worker.shared->generation != worker.generation;
+	}
+
+private:
+	struct Work
+	{
+		std::function<void(void)> run;
+		std::function<void(void)> abandoned;
+	};
+
+	// Where a call stands: still running, its result delivered, or given
+	// up on by the watchdog.
+	enum { kRunning, kClaimed, kAbandoned };
+
+	template<typename R, typename F>
+	struct Call
+	{
+		explicit Call(F&& f) : f(std::forward<F>(f)), timed(false), abandoned(false) {}
+		explicit Call(const F& f) : f(f), timed(false), abandoned(false) {}
+
+		void run()
+		{
+			if (timed)
+				started = std::chrono::steady_clock::now();
+			try
+			{
+				deliver(std::is_void<R>());
+			}
+			catch (...)
+			{
+				if (claim())
+				{
+					finish_timing();
+					promise.set_exception(std::current_exception());
+				}
+			}
+		}
+		void deliver(std::true_type)
+		{
+			f();
+			if (claim())
+			{
+				finish_timing();
+				promise.set_value();
+			}
+		}
+		void deliver(std::false_type)
+		{
+			R r = f();
+			if (claim())
+			{
+				finish_timing();
+				promise.set_value(std::move(r));
+			}
+		}
+		void abandon()
+		{
+			abandoned = true;
+			set_abandoned(std::is_void<R>());
+		}
+		void set_abandoned(std::true_type) { promise.set_value(); }
+		void set_abandoned(std::false_type) { promise.set_value(AbandonedResult<R>::get()); }
+
+		void finish_timing()
+		{
+			if (timed)
+				finished = std::chrono::steady_clock::now();
+		}
+
+		// Called by the caller once there is a result. The worker's
+		// times for an abandoned call can't be relied on, so it counts
+		// as having run the whole time.
+		void report_timing()
+		{
+			DispatchTiming& timing = DispatchTiming::last();
+			if (abandoned)
+			{
+				timing.queued = std::chrono::nanoseconds(0);
+				timing.ran = std::chrono::steady_clock::now() - queued;
+				return;
+			}
+			timing.queued = started - queued;
+			timing.ran = finished - started;
+		}
+
+		F f;
+		std::promise<R> promise;
+		bool timed;
+		bool abandoned;
+		std::chrono::steady_clock::time_point queued;
+		std::chrono::steady_clock::time_point started;
+		std::chrono::steady_clock::time_point finished;
+	};
+
+	// What the workers share with the dispatcher. A worker the watchdog
+	// gave up on keeps it alive for as long as it's still running.
+	struct Shared
+	{
+		Shared() : generation(0), watched(false), stopping(false), stopped(false), busy(false), busy_claim(nullptr), busy_abandoned(nullptr) {}
+
+		std::mutex mutex;
+		std::condition_variable dispatch_begin;
+		std::condition_variable worker_stopped;
+		std::deque<Work> dispatch_queue;
+		// Bumped for each new worker; the others stop once they notice.
+		unsigned generation;
+		bool watched;
+		bool stopping;
+		bool stopped;
+		// What the current worker is running, if watched.
+		bool busy;
+		std::chrono::steady_clock::time_point started;
+		std::atomic<int>* busy_claim;
+		const std::function<void(void)>* busy_abandoned;
+	};
+
+	// The claim of whatever this thread is running for a watched worker.
+	static std::atomic<int>*& current_claim()
+	{
+		static thread_local std::atomic<int>* current = nullptr;
+		return current;
+	}
+
+	struct Shared;
+
+	// The queue this thread is running things from, if any: a worker's, or
+	// an executor job's.
+	static Shared*& current_queue()
+	{
+		static thread_local Shared* current = nullptr;
+		return current;
+	}
+
+	// The watched worker this thread is, if any.
+	struct Worker
+	{
+		Shared* shared;
+		unsigned generation;
+	};
+	static Worker& current_worker()
+	{
+		static thread_local Worker current = { nullptr, 0 };
+		return current;
+	}
+
+	void queue(Work work)
+	{
+		bool startDrain = false;
+		{
+			// Acquire the lock so we can queue the work.
+			std::unique_lock<std::mutex> lock(shared->mutex);
+			shared->dispatch_queue.push_back(std::move(work));
+
+			// Tell the thread to go, or get the executor to run the queue
+			// if nothing is running it already.
+			if (!executor)
+				shared->dispatch_begin.notify_one();
+			else if (!draining)
+				draining = startDrain = true;
+		}
+		if (startDrain)
+			executor(&CoThreadDispatcher::drain, this, executor_data);
+	}
+
+	// An executor job: run the queue until it's empty.
+	static void drain(void* self)
+	{
+		CoThreadDispatcher* dispatcher = static_cast<CoThreadDispatcher*>(self);
+		// The executor may run this inside a job of another dispatcher's.
+		Shared* const outer = current_queue();
+		current_queue() = dispatcher->shared.get();
+		std::unique_lock<std::mutex> lock(dispatcher->shared->mutex);
+		while (!dispatcher->shared->dispatch_queue.empty())
+		{
+			std::function<void(void)> dispatched_function = std::move(dispatcher->shared->dispatch_queue.front().run);
+			dispatcher->shared->dispatch_queue.pop_front();
+			lock.unlock();
+			dispatched_function();
+			lock.lock();
+		}
+		current_queue() = outer;
+		dispatcher->draining = false;
+		dispatcher->drained.notify_all();
+	}
+
+	// A worker. Only touches 'shared', which outlives the dispatcher if
+	// this worker has been given up on.
+	static void threadProc(std::shared_ptr<Shared> shared, unsigned generation)
+	{
+		// Initialize COM in this thread.
+		CoInitializer comInit;
+		std::atomic<int> claim(kRunning);
+		current_queue() = shared.get();
+		if (shared->watched)
+		{
+			current_claim() = &claim;
+			current_worker() = { shared.get(), generation };
+		}
+
+		std::unique_lock<std::mutex> lock(shared->mutex);
+		while (shared->generation == generation)
+		{
+			// Wait for work. Work queued before we got here is still
+			// picked up, since we only sleep on an empty queue.
+			shared->dispatch_begin.wait(lock, [&]() {
+				return !shared->dispatch_queue.empty() || shared->stopping || shared->generation != generation;
+			});
+			if (shared->generation != generation)
+				break;
+			if (shared->dispatch_queue.empty())
+			{
+				shared->stopped = true;
+				break;
+			}
+			Work work = std::move(shared->dispatch_queue.front());
+			shared->dispatch_queue.pop_front();
+			if (shared->watched)
+			{
+				claim = kRunning;
+				shared->busy = true;
+				shared->started = std::chrono::steady_clock::now();
+				shared->busy_claim = &claim;
+				shared->busy_abandoned = &work.abandoned;
+			}
+
+			// Do the work without holding the lock, so other callers can
+			// queue more behind it.
+			lock.unlock();
+			work.run();
+			lock.lock();
+
+			if (shared->watched && shared->generation == generation)
+			{
+				shared->busy = false;
+				shared->busy_claim = nullptr;
+				shared->busy_abandoned = nullptr;
+			}
+		}
+		current_queue() = nullptr;
+		current_claim() = nullptr;
+		current_worker() = { nullptr, 0 };
+		shared->worker_stopped.notify_all();
+	}
+
+	// The watchdog: look in on the worker a few times per timeout, and
+	// replace it if it has been running the same thing for too long.
+	void watch()
+	{
+		const std::chrono::milliseconds period = std::max(watchdog_timeout / 4, std::chrono::milliseconds(1));
+		std::unique_lock<std::mutex> lock(shared->mutex);
+		while (!watchdog_stop)
+		{
+			watchdog_wake.wait_for(lock, period);
+			if (watchdog_stop || !shared->busy ||
+				std::chrono::steady_clock::now() - shared->started < watchdog_timeout)
+				continue;
+
+			// Whatever the worker was running gets its abandoned result,
+			// unless it has just delivered its own.
+			int expected = kRunning;
+			bool abandon = shared->busy_claim->compare_exchange_strong(expected, kAbandoned);
+			std::function<void(void)> abandoned = *shared->busy_abandoned;
+			shared->busy = false;
+			shared->busy_claim = nullptr;
+			shared->busy_abandoned = nullptr;
+
+			// The new worker recovers before it runs anything queued.
+			++shared->generation;
+			if (recover)
+				shared->dispatch_queue.push_front({ recover, nullptr });
+			dispatch_thread.detach();
+			dispatch_thread = std::thread(&CoThreadDispatcher::threadProc, shared, shared->generation);
+
+			lock.unlock();
+			if (abandon && abandoned)
+				abandoned();
+			abandoned = nullptr;
+			lock.lock();
+		}
+	}
+
+	std::shared_ptr<Shared> shared;
+	Executor executor;
+	void* executor_data;
+	// Whether an executor job is running the queue, or about to.
+	bool draining;
+	// Signalled when an executor job is done with the queue.
+	std::condition_variable drained;
+	std::chrono::milliseconds watchdog_timeout;
+	std::function<void(void)> recover;
+	bool watchdog_stop;
+	std::condition_variable watchdog_wake;
+	std::thread dispatch_thread;
+	std::thread watchdog_thread;
+};
+
+#endif
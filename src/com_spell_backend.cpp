@@ -0,0 +1,179 @@
+// enchant_windows - SpellBackend over the Windows 8 spell checking API.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#include "com_spell_backend.h"
+
+#include <comdef.h>
+#include <spellcheck.h>
+#include <wtypes.h>
+#include <wrl.h>
+
+// ATL has a wider array of COM smart pointer classes, but isn't available
+// in the Visual Studio Express editions. The WRL ComPtr works for us though.
+using Microsoft::WRL::ComPtr;
+
+static_assert(sizeof(wchar_t) == sizeof(char16_t), "wchar_t must be UTF-16");
+
+static inline const wchar_t* as_wide(const char16_t* str)
+{
+	return reinterpret_cast<const wchar_t*>(str);
+}
+
+class ComStringEnumerator : public StringEnumerator
+{
+public:
+	explicit ComStringEnumerator(const ComPtr<IEnumString>& enumerator) :
+		enumerator(enumerator)
+	{}
+
+	bool next(std::u16string& out) override
+	{
+		LPOLESTR nameRaw = nullptr;
+		HRESULT hr = enumerator->Next(1, &nameRaw, nullptr);
+		if (hr != S_OK)
+			return false;
+
+		auto OleStringDeleter = [](LPOLESTR s) { CoTaskMemFree(s); };
+		std::unique_ptr<OLECHAR, decltype(OleStringDeleter)> name(nameRaw, OleStringDeleter);
+		out.assign(reinterpret_cast<const char16_t*>(name.get()));
+		return true;
+	}
+
+private:
+	ComPtr<IEnumString> enumerator;
+};
+
+class ComSpellChecker : public SpellChecker
+{
+public:
+	explicit ComSpellChecker(const ComPtr<ISpellChecker>& spellChecker) :
+		spellChecker(spellChecker)
+	{}
+
+	int check(const char16_t* word) override
+	{
+		ComPtr<IEnumSpellingError> errors;
+		HRESULT hr = spellChecker->Check(as_wide(word), errors.GetAddressOf());
+		if (FAILED(hr))
+			return -1;
+
+		// A correct 'test' returns an empty (not a null) enumeration.
+		ComPtr<ISpellingError> error;
+		hr = errors->Next(error.GetAddressOf());
+		if (hr == S_OK)
+		{
+			// At least one error.
+			return 1;
+		}
+		else
+		{
+			// No errors.
+			return 0;
+		}
+	}
+
+	std::unique_ptr<StringEnumerator> suggest(const char16_t* word) override
+	{
+		ComPtr<IEnumString> suggestionEnumerator;
+		HRESULT hr = spellChecker->Suggest(as_wide(word), suggestionEnumerator.GetAddressOf());
+
+		if (FAILED(hr))
+			return nullptr;
+
+		// If we returned S_FALSE, the word was spelled correctly and there are no suggestions.
+		if (hr == S_FALSE)
+			return nullptr;
+
+		return std::make_unique<ComStringEnumerator>(suggestionEnumerator);
+	}
+
+	bool add(const char16_t* word) override
+	{
+		return SUCCEEDED(spellChecker->Add(as_wide(word)));
+	}
+
+	bool ignore(const char16_t* word) override
+	{
+		return SUCCEEDED(spellChecker->Ignore(as_wide(word)));
+	}
+
+	bool auto_correct(const char16_t* from, const char16_t* to) override
+	{
+		return SUCCEEDED(spellChecker->AutoCorrect(as_wide(from), as_wide(to)));
+	}
+
+private:
+	ComPtr<ISpellChecker> spellChecker;
+};
+
+class ComSpellBackend : public SpellBackend
+{
+public:
+	explicit ComSpellBackend(const ComPtr<ISpellCheckerFactory>& spellCheckerFactory) :
+		spellCheckerFactory(spellCheckerFactory)
+	{}
+
+	std::unique_ptr<StringEnumerator> supported_languages() override
+	{
+		ComPtr<IEnumString> langEnumerator;
+		HRESULT hr = spellCheckerFactory->get_SupportedLanguages(langEnumerator.GetAddressOf());
+		if (FAILED(hr))
+			return nullptr;
+
+		return std::make_unique<ComStringEnumerator>(langEnumerator);
+	}
+
+	int is_supported(const char16_t* tag) override
+	{
+		BOOL isSupported = FALSE;
+		HRESULT hr = spellCheckerFactory->IsSupported(as_wide(tag), &isSupported);
+		if (FAILED(hr))
+			return -1;
+
+		return (isSupported != FALSE);
+	}
+
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t* tag) override
+	{
+		ComPtr<ISpellChecker> spellChecker;
+		HRESULT hr = spellCheckerFactory->CreateSpellChecker(as_wide(tag), spellChecker.GetAddressOf());
+		if (FAILED(hr))
+			return nullptr;
+
+		return std::make_unique<ComSpellChecker>(spellChecker);
+	}
+
+private:
+	ComPtr<ISpellCheckerFactory> spellCheckerFactory;
+};
+
+std::unique_ptr<SpellBackend> create_com_spell_backend()
+{
+	ComPtr<ISpellCheckerFactory> spellCheckerFactory;
+	HRESULT hr = CoCreateInstance(
+		__uuidof(SpellCheckerFactory),
+		nullptr,
+		CLSCTX_INPROC_SERVER,
+		__uuidof(ISpellCheckerFactory),
+		reinterpret_cast<PVOID*>(spellCheckerFactory.GetAddressOf()));
+	if (FAILED(hr))
+		return nullptr;
+
+	return std::make_unique<ComSpellBackend>(spellCheckerFactory);
+}
@@ -0,0 +1,498 @@
+// enchant_windows - prefix completion from a word frequency list.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "completion_index.h"
+
+#include "normalize.h"
+#include "wordlist_spell_backend.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdlib.h>
+
+// Longer than any word worth completing to.
+static const size_t kMaxCompletionBytes = 255;
+static const uint32_t kNoWord = UINT32_MAX;
+static const uint32_t kNoCache = UINT32_MAX;
+// The root is never anyone's child or sibling, so its index marks the end.
+static const uint32_t kNoNode = 0;
+
+struct CompletionIndex::Trie
+{
+	// Only nodes with more than kCachedCompletions words under them have a
+	// cache; there are few enough under the rest to look at them all.
+	struct Node
+	{
+		uint32_t first_child;
+		uint32_t next_sibling;
+		uint32_t word;
+		uint32_t cache;
+		uint8_t byte;
+		uint8_t cached;
+	};
+
+	struct Word
+	{
+		uint32_t offset;
+		uint32_t length;
+		uint32_t frequency;
+		bool excluded;
+	};
+
+	Trie() : nodes(1, Node{ kNoNode, kNoNode, kNoWord, kNoCache, 0, 0 }), best_frequency(1) {}
+
+	// Whether word 'a' ranks ahead of word 'b': more common, or as common
+	// and earlier in the list.
+	bool ahead(uint32_t a, uint32_t b) const
+	{
+		if (words[a].frequency != words[b].frequency)
+			return words[a].frequency > words[b].frequency;
+		return a < b;
+	}
+
+	// The node for 'key', with the nodes from the root to it in 'path'.
+	// kNoNode if there isn't one and 'create' is false.
+	uint32_t find(const std::string& key, bool create, std::vector<uint32_t>* path)
+	{
+		uint32_t node = 0;
+		if (path)
+			path->assign(1, node);
+		for (char c : key)
+		{
+			const uint8_t byte = static_cast<uint8_t>(c);
+			uint32_t child = nodes[node].first_child;
+			while (child != kNoNode && nodes[child].byte != byte)
+				child = nodes[child].next_sibling;
+			if (child == kNoNode)
+			{
+				if (!create)
+					return kNoNode;
+				child = static_cast<uint32_t>(nodes.size());
+				nodes.push_back({ kNoNode, nodes[node].first_child, kNoWord, kNoCache, byte, 0 });
+				nodes[node].first_child = child;
+			}
+			node = child;
+			if (path)
+				path->push_back(node);
+		}
+		return node;
+	}
+
+	uint32_t* cache(uint32_t node)
+	{
+		return &top[nodes[node].cache];
+	}
+
+	// Give 'node' a cache, if it hasn't one and now needs one.
+	void cache_if_needed(uint32_t node)
+	{
+		if (nodes[node].cache != kNoCache || !more_than_cached(node))
+			return;
+		nodes[node].cache = static_cast<uint32_t>(top.size());
+		top.resize(top.size() + kCachedCompletions);
+	}
+
+	// Whether there are more than kCachedCompletions words under 'node',
+	// excluded ones included.
+	bool more_than_cached(uint32_t node)
+	{
+		size_t count = 0;
+		stack.assign(1, node);
+		while (!stack.empty())
+		{
+			const uint32_t next = stack.back();
+			stack.pop_back();
+			if (nodes[next].word != kNoWord && ++count > kCachedCompletions)
+				return true;
+			if (nodes[next].cache != kNoCache && next != node)
+				return true;
+			for (uint32_t child = nodes[next].first_child; child != kNoNode; child = nodes[child].next_sibling)
+				stack.push_back(child);
+		}
+		return false;
+	}
+
+	// Work out a node's cache again from its own word and what is under its
+	// children, which must be right.
+	void refresh(uint32_t node)
+	{
+		candidates.clear();
+		const uint32_t own = nodes[node].word;
+		if (own != kNoWord && !words[own].excluded)
+			candidates.push_back(own);
+		for (uint32_t child = nodes[node].first_child; child != kNoNode; child = nodes[child].next_sibling)
+		{
+			if (nodes[child].cache != kNoCache)
+				candidates.insert(candidates.end(), cache(child), cache(child) + nodes[child].cached);
+			else
+				collect(child, candidates);
+		}
+
+		const size_t n = std::min(candidates.size(), kCachedCompletions);
+		std::partial_sort(candidates.begin(), candidates.begin() + n, candidates.end(),
+			[this](uint32_t a, uint32_t b) { return ahead(a, b); });
+		std::copy(candidates.begin(), candidates.begin() + n, cache(node));
+		nodes[node].cached = static_cast<uint8_t>(n);
+	}
+
+	// Every word under 'node' that isn't excluded, added to 'out'.
+	void collect(uint32_t node, std::vector<uint32_t>& out)
+	{
+		stack.assign(1, node);
+		while (!stack.empty())
+		{
+			const uint32_t next = stack.back();
+			stack.pop_back();
+			const uint32_t word = nodes[next].word;
+			if (word != kNoWord && !words[word].excluded)
+				out.push_back(word);
+			for (uint32_t child = nodes[next].first_child; child != kNoNode; child = nodes[child].next_sibling)
+				stack.push_back(child);
+		}
+	}
+
+	size_t bytes() const
+	{
+		return nodes.capacity() * sizeof(Node) + top.capacity() * sizeof(uint32_t) +
+			words.capacity() * sizeof(Word) + text.capacity() + sizeof(Trie);
+	}
+
+	std::vector<Node> nodes;
+	// kCachedCompletions word IDs per cache, best first; the node's 'cached'
+	// says how many are in use.
+	std::vector<uint32_t> top;
+	std::vector<Word> words;
+	// The words' spellings, back to back.
+	std::string text;
+	// What personal words count as.
+	uint32_t best_frequency;
+
+	// Scratch for refresh() and collect().
+	std::vector<uint32_t> candidates;
+	std::vector<uint32_t> stack;
+	std::vector<uint32_t> path;
+};
+
+// Trie keys are lowercase where case_pattern can fold the word.
+static void fold(const std::string& word, const CaseRules& rules, std::string& key)
+{
+	key.resize(word.size());
+	const CasePattern pattern = case_pattern(word.data(), word.size(), rules, &key[0]);
+	if (pattern != kCaseTitle && pattern != kCaseUpper)
+		key = word;
+}
+
+static void canonical_word(const char* word, size_t len, std::string& out)
+{
+	if (is_canonical(word, len))
+		out.assign(word, len);
+	else
+		canonicalize(word, len, out);
+}
+
+CompletionIndex::CompletionIndex() :
+	rules(),
+	charged(0),
+	loaded(false)
+{
+}
+
+CompletionIndex::~CompletionIndex()
+{
+	if (loader.joinable())
+		loader.join();
+	if (account)
+		account->discharge(ENCHANT_WINDOWS_MEMORY_CACHE, charged);
+}
+
+void CompletionIndex::configure(const LanguageTagRef& language, const CaseRules& rules, const std::shared_ptr<MemoryAccount>& account)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	this->language = language;
+	this->rules = rules;
+	this->account = account;
+}
+
+void CompletionIndex::start_loading()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (loaded || loader.joinable())
+		return;
+
+	std::string path;
+	if (language)
+	{
+		const std::vector<const LanguageTag*> candidates = language_tag_candidates(*language);
+		const std::vector<std::string> directories = search_path_or_wordlists("ENCHANT_WINDOWS_COMPLETION_PATH");
+		for (size_t i = 0; i < candidates.size() && path.empty(); ++i)
+		{
+			for (const auto& directory : directories)
+			{
+				const std::string candidate = directory + "/" + candidates[i]->enchant + ".freq";
+				if (std::ifstream(candidate))
+				{
+					path = candidate;
+					break;
+				}
+			}
+		}
+	}
+
+	// Nothing to read: just the personal words.
+	if (path.empty())
+	{
+		install(std::make_unique<Trie>());
+		return;
+	}
+
+	const CaseRules listRules = rules;
+	loader = std::thread([this, path, listRules]() {
+		std::unique_ptr<Trie> built = read_list(path, listRules);
+		std::lock_guard<std::mutex> lock(mutex);
+		// load() may have put another list in meanwhile.
+		if (!loaded)
+			install(std::move(built));
+	});
+}
+
+bool CompletionIndex::load(const std::string& path)
+{
+	if (!std::ifstream(path))
+		return false;
+
+	std::unique_ptr<Trie> built = read_list(path, rules);
+	std::lock_guard<std::mutex> lock(mutex);
+	install(std::move(built));
+	return true;
+}
+
+// Make 'built' the index, with the changes made while it was being read.
+void CompletionIndex::install(std::unique_ptr<Trie> built)
+{
+	trie = std::move(built);
+	loaded = true;
+	for (const auto& change : pending)
+		update(change.first, change.second);
+	pending.clear();
+	account_for();
+}
+
+// Read a frequency list into a new trie.
+std::unique_ptr<CompletionIndex::Trie> CompletionIndex::read_list(const std::string& path, const CaseRules& rules)
+{
+	struct Entry
+	{
+		std::string word;
+		unsigned long count;
+	};
+
+	std::vector<Entry> entries;
+	std::ifstream in(path, std::ios::binary);
+	std::string line;
+	bool counted = false;
+	while (std::getline(in, line))
+	{
+		while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t'))
+			line.pop_back();
+		unsigned long count = 0;
+		const size_t space = line.find_last_of(" \t");
+		if (space != std::string::npos && line.find_first_not_of("0123456789", space + 1) == std::string::npos)
+		{
+			count = strtoul(line.c_str() + space + 1, nullptr, 10);
+			line.erase(line.find_last_not_of(" \t", space) + 1);
+			counted = true;
+		}
+		if (!line.empty() && line.size() <= kMaxCompletionBytes)
+			entries.push_back({ line, count });
+	}
+
+	// Without counts, most common first.
+	if (!counted)
+	{
+		for (size_t i = 0; i < entries.size(); ++i)
+			entries[i].count = static_cast<unsigned long>(entries.size() - i);
+	}
+	std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.count > b.count; });
+
+	auto trie = std::make_unique<Trie>();
+	std::string canonical;
+	std::string key;
+	for (const auto& entry : entries)
+	{
+		canonical_word(entry.word.data(), entry.word.size(), canonical);
+		fold(canonical, rules, key);
+		const uint32_t node = trie->find(key, true, nullptr);
+		// A less common word with the same key ("Polish" after "polish").
+		if (trie->nodes[node].word != kNoWord)
+			continue;
+
+		trie->nodes[node].word = static_cast<uint32_t>(trie->words.size());
+		trie->words.push_back({ static_cast<uint32_t>(trie->text.size()), static_cast<uint32_t>(canonical.size()),
+			static_cast<uint32_t>(std::min<unsigned long>(entry.count, UINT32_MAX)), false });
+		trie->text += canonical;
+	}
+
+	// Children come after their parents, so going backwards every node's
+	// children are counted, and cached, before it is.
+	std::vector<uint32_t> under(trie->nodes.size(), 0);
+	for (size_t node = trie->nodes.size(); node-- > 0; )
+	{
+		const Trie::Node& n = trie->nodes[node];
+		under[node] += n.word != kNoWord;
+		for (uint32_t child = n.first_child; child != kNoNode; child = trie->nodes[child].next_sibling)
+			under[node] += under[child];
+		if (under[node] > kCachedCompletions)
+		{
+			trie->nodes[node].cache = static_cast<uint32_t>(trie->top.size());
+			trie->top.resize(trie->top.size() + kCachedCompletions);
+			trie->refresh(static_cast<uint32_t>(node));
+		}
+	}
+	if (!trie->words.empty())
+		trie->best_frequency = std::max(trie->best_frequency, trie->words[0].frequency);
+	trie->nodes.shrink_to_fit();
+	trie->top.shrink_to_fit();
+	trie->words.shrink_to_fit();
+	trie->text.shrink_to_fit();
+	return trie;
+}
+
+// Add 'word' (canonical) as a personal word, or exclude it, and redo the
+// caches above it.
+void CompletionIndex::update(const std::string& word, bool add)
+{
+	fold(word, rules, key);
+	const uint32_t node = trie->find(key, add, &trie->path);
+	if (node == kNoNode && !add)
+		return;
+
+	uint32_t& id = trie->nodes[node].word;
+	if (id == kNoWord)
+	{
+		if (!add)
+			return;
+		id = static_cast<uint32_t>(trie->words.size());
+		trie->words.push_back({ static_cast<uint32_t>(trie->text.size()), static_cast<uint32_t>(word.size()), 0, false });
+		trie->text += word;
+	}
+
+	Trie::Word& entry = trie->words[id];
+	entry.excluded = !add;
+	if (add)
+	{
+		// Personal words rank with the most common.
+		entry.frequency = std::max(entry.frequency, trie->best_frequency);
+	}
+	for (size_t i = trie->path.size(); i-- > 0; )
+	{
+		trie->cache_if_needed(trie->path[i]);
+		if (trie->nodes[trie->path[i]].cache != kNoCache)
+			trie->refresh(trie->path[i]);
+	}
+}
+
+void CompletionIndex::account_for()
+{
+	const size_t bytes = trie ? trie->bytes() : 0;
+	if (account)
+	{
+		if (bytes > charged)
+			account->charge(ENCHANT_WINDOWS_MEMORY_CACHE, bytes - charged);
+		else
+			account->discharge(ENCHANT_WINDOWS_MEMORY_CACHE, charged - bytes);
+	}
+	charged = bytes;
+}
+
+size_t CompletionIndex::complete(const char* prefix, size_t len, size_t max, std::vector<std::string>& out)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	// Nothing to offer while the list is still being read.
+	if (!loaded)
+	{
+		out.clear();
+		return 0;
+	}
+
+	canonical_word(prefix, len, canonical);
+	key.resize(canonical.size());
+	const CasePattern pattern = case_pattern(canonical.data(), canonical.size(), rules, &key[0]);
+	if (pattern != kCaseTitle && pattern != kCaseUpper)
+		key = canonical;
+
+	found.clear();
+	const uint32_t node = trie->find(key, false, nullptr);
+	if (node != kNoNode || key.empty())
+	{
+		const size_t cached = trie->nodes[node].cached;
+		if (trie->nodes[node].cache != kNoCache && (max <= cached || cached < kCachedCompletions))
+		{
+			found.assign(trie->cache(node), trie->cache(node) + std::min(max, cached));
+		}
+		else
+		{
+			trie->collect(node, found);
+			const size_t n = std::min(max, found.size());
+			std::partial_sort(found.begin(), found.begin() + n, found.end(),
+				[this](uint32_t a, uint32_t b) { return trie->ahead(a, b); });
+			found.resize(n);
+		}
+	}
+
+	out.resize(found.size());
+	for (size_t i = 0; i < found.size(); ++i)
+	{
+		const Trie::Word& word = trie->words[found[i]];
+		out[i].assign(trie->text, word.offset, word.length);
+		if (pattern == kCaseTitle || pattern == kCaseUpper)
+			capitalize(out[i], pattern == kCaseUpper, rules);
+	}
+	return out.size();
+}
+
+void CompletionIndex::add(const char* word, size_t len)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::string canonicalWord;
+	canonical_word(word, len, canonicalWord);
+	if (canonicalWord.empty() || canonicalWord.size() > kMaxCompletionBytes)
+		return;
+	if (!loaded)
+	{
+		pending.emplace_back(canonicalWord, true);
+		return;
+	}
+	update(canonicalWord, true);
+	account_for();
+}
+
+void CompletionIndex::exclude(const char* word, size_t len)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::string canonicalWord;
+	canonical_word(word, len, canonicalWord);
+	if (canonicalWord.empty() || canonicalWord.size() > kMaxCompletionBytes)
+		return;
+	if (!loaded)
+	{
+		pending.emplace_back(canonicalWord, false);
+		return;
+	}
+	update(canonicalWord, false);
+	account_for();
+}
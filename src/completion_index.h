@@ -0,0 +1,105 @@
+// enchant_windows - prefix completion from a word frequency list.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_COMPLETION_INDEX_H
+#define ENCHANT_WINDOWS_COMPLETION_INDEX_H
+
+#include "case_pattern.h"
+#include "language_tags.h"
+#include "memory_accounting.h"
+
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Completions for what has been typed of a word: the most common words
+// starting with it. Neither backend can list its words, let alone say how
+// common they are, so the words come from a frequency list, '<tag>.freq'
+// ("en_US.freq") in one of the directories in ENCHANT_WINDOWS_COMPLETION_PATH,
+// or else the word list search path (wordlist_spell_backend.h). The tag's
+// fallbacks are tried too (language_tags.h). Each line is a word and,
+// optionally, how often it occurs; without counts, lines are taken as most
+// common first. Words added to the personal dictionary rank with the most
+// common words, and excluded words are never offered.
+//
+// Words are held in a trie over their lowercase UTF-8 (case_pattern.h), with
+// the best kCachedCompletions words under each node kept at the node, so
+// asking for that many costs a walk down the prefix. The list is read on a
+// thread of its own once start_loading() is called, and until it has been
+// read there are no completions. All calls may come from any thread.
+class CompletionIndex
+{
+public:
+	// Completions kept at each node. Asking for more searches every word
+	// under the prefix.
+	static constexpr size_t kCachedCompletions = 8;
+
+	CompletionIndex();
+	~CompletionIndex();
+
+	CompletionIndex(const CompletionIndex&) = delete;
+	CompletionIndex& operator=(const CompletionIndex&) = delete;
+
+	// Where the words come from and how they fold. 'account', if any, is
+	// charged for the index once it is read.
+	void configure(const LanguageTagRef& language, const CaseRules& rules, const std::shared_ptr<MemoryAccount>& account);
+
+	// Start reading the list configure() finds, off the caller's thread.
+	void start_loading();
+
+	// Read 'path' now, in place of the list configure() would find. False if
+	// it can't be read.
+	bool load(const std::string& path);
+
+	// Set 'out' to up to 'max' words starting with 'prefix' (UTF-8), most
+	// common first. A Title Case or ALL CAPS prefix gets its completions
+	// capitalized to match. Returns how many there are.
+	size_t complete(const char* prefix, size_t len, size_t max, std::vector<std::string>& out);
+
+	// A word added to the personal dictionary, or excluded.
+	void add(const char* word, size_t len);
+	void exclude(const char* word, size_t len);
+
+private:
+	struct Trie;
+
+	static std::unique_ptr<Trie> read_list(const std::string& path, const CaseRules& rules);
+	void install(std::unique_ptr<Trie> built);
+	void update(const std::string& word, bool add);
+	void account_for();
+
+	std::mutex mutex;
+	LanguageTagRef language;
+	CaseRules rules;
+	std::shared_ptr<MemoryAccount> account;
+	size_t charged;
+	bool loaded;
+	// Changes made before the list was read, applied once it is.
+	std::vector<std::pair<std::string, bool>> pending;
+	std::unique_ptr<Trie> trie;
+	std::thread loader;
+	// Reused by complete().
+	std::vector<uint32_t> found;
+	std::string canonical;
+	std::string key;
+};
+
+#endif
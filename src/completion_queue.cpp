@@ -0,0 +1,152 @@
+// enchant_windows - completions of asynchronous calls.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "completion_queue.h"
+
+#include <deque>
+#include <mutex>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// The signal is set whenever the queue goes from empty to not, and cleared
+// by a poll that empties it, both under the queue's lock; so it is set
+// exactly when completions are waiting, and one wakeup never hides another.
+namespace {
+
+class CompletionSignal
+{
+public:
+#if defined(_WIN32)
+	CompletionSignal() : event(CreateEventW(nullptr, TRUE, FALSE, nullptr)) {}
+	intptr_t handle() const { return event ? reinterpret_cast<intptr_t>(event) : -1; }
+	void set() { if (event) SetEvent(event); }
+	void clear() { if (event) ResetEvent(event); }
+private:
+	HANDLE event;
+#elif defined(__linux__)
+	CompletionSignal() : fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+	intptr_t handle() const { return fd; }
+	void set()
+	{
+		uint64_t one = 1;
+		if (fd >= 0 && write(fd, &one, sizeof(one)) < 0)
+			return;
+	}
+	void clear()
+	{
+		uint64_t count;
+		if (fd >= 0 && read(fd, &count, sizeof(count)) < 0)
+			return;
+	}
+private:
+	int fd;
+#else
+	CompletionSignal()
+	{
+		if (pipe(fds) != 0)
+		{
+			fds[0] = fds[1] = -1;
+			return;
+		}
+		for (int fd : fds)
+		{
+			fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+			fcntl(fd, F_SETFD, FD_CLOEXEC);
+		}
+	}
+	intptr_t handle() const { return fds[0]; }
+	void set()
+	{
+		char byte = 0;
+		if (fds[1] >= 0 && write(fds[1], &byte, 1) < 0)
+			return;
+	}
+	void clear()
+	{
+		char bytes[64];
+		while (fds[0] >= 0 && read(fds[0], bytes, sizeof(bytes)) > 0)
+			;
+	}
+private:
+	int fds[2];
+#endif
+};
+
+// Lives as long as the module: the application may hold on to the fd.
+struct CompletionQueue
+{
+	std::mutex mutex;
+	std::deque<EnchantWindowsCompletion> entries;
+	CompletionSignal signal;
+};
+
+CompletionQueue& completion_queue()
+{
+	static CompletionQueue* queue = new CompletionQueue();
+	return *queue;
+}
+
+} // namespace
+
+void post_completion(const EnchantWindowsCompletion& completion)
+{
+	CompletionQueue& queue = completion_queue();
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	queue.entries.push_back(completion);
+	if (queue.entries.size() == 1)
+		queue.signal.set();
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ENCHANT_MODULE_EXPORT(intptr_t) enchant_windows_completion_fd(void)
+{
+	return completion_queue().signal.handle();
+}
+
+ENCHANT_MODULE_EXPORT(size_t) enchant_windows_poll_completions(EnchantWindowsCompletion* out, size_t max)
+{
+	if (!out)
+		return 0;
+
+	CompletionQueue& queue = completion_queue();
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	size_t count = 0;
+	while (count < max && !queue.entries.empty())
+	{
+		out[count++] = queue.entries.front();
+		queue.entries.pop_front();
+	}
+	if (count > 0 && queue.entries.empty())
+		queue.signal.clear();
+	return count;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,31 @@
+// enchant_windows - completions of asynchronous calls.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_COMPLETION_QUEUE_H
+#define ENCHANT_WINDOWS_COMPLETION_QUEUE_H
+
+#include "enchant-windows.h"
+
+// Results of asynchronous calls wait in one queue for the whole module until
+// the application takes them with enchant_windows_poll_completions, and make
+// enchant_windows_completion_fd ready while they do.
+
+// Append 'completion' to the queue. Called from wherever backend calls run.
+void post_completion(const EnchantWindowsCompletion& completion);
+
+#endif
@@ -0,0 +1,305 @@
+// enchant_windows - real-word error detection over checked text.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "enchant-windows.hpp"
+
+#include "case_pattern.h"
+#include "language_tags.h"
+#include "ngram_model.h"
+
+#include <algorithm>
+
+namespace enchant_windows {
+
+// A word of a confusion set, in place of the one written, changes the three
+// trigrams it is part of. Each is looked up with the bigram and unigram it
+// backs off to, so a word costs nine lookups; scoring must match
+// tools/build_ngram_model.py.
+static const size_t kTerms = 3;
+static const size_t kKeysPerTerm = 3;
+static const size_t kKeysPerWord = kTerms * kKeysPerTerm;
+// Candidates scored together; their keys and values come to about 10 KB.
+static const size_t kBatch = 32;
+// A key for an n-gram a term doesn't need.
+static const uint64_t kNoKey = 0;
+// What a lookup that found nothing leaves, as no log probability is.
+static const float kMissing = 1.0f;
+
+static bool is_sentence_break(std::string_view gap)
+{
+	return gap.find_first_of(".!?\n") != std::string_view::npos;
+}
+
+struct ContextChecker::Impl
+{
+	// A word of a confusion set the dictionary passed.
+	struct Candidate
+	{
+		size_t word;
+		size_t position;  // in 'tokens'
+		int set;
+		size_t keys;      // its set's words' keys start here
+	};
+
+	// Null without a model.
+	static std::unique_ptr<Impl> make(const Dictionary& dictionary, std::unique_ptr<NgramModel> model)
+	{
+		if (!model)
+			return nullptr;
+		auto impl = std::make_unique<Impl>();
+		impl->dictionary = &dictionary;
+		impl->model = std::move(model);
+		const LanguageTagRef language = resolve_language_tag(dictionary.tag());
+		impl->rules = language ? case_rules_for(*language) : CaseRules{ true, false };
+		return impl;
+	}
+
+	const Dictionary* dictionary;
+	std::unique_ptr<NgramModel> model;
+	CaseRules rules;
+
+	// Reused between checks: every word's hash, with sentence markers
+	// around each sentence, and the n-grams the candidates need.
+	std::vector<uint64_t> tokens;
+	std::vector<Candidate> candidates;
+	std::vector<uint64_t> keys;
+	std::vector<float> values;
+	std::string lower;
+
+	// The n-grams for 'word' at 'p' in 'tokens': for each term, the trigram
+	// and the bigram and unigram it backs off to, predicting its last word.
+	void add_keys(size_t p, uint64_t word)
+	{
+		const uint64_t before = tokens[p - 1];
+		const uint64_t after = tokens[p + 1];
+		uint64_t gram[3];
+
+		// The word after the two before it, or the one at a sentence start.
+		gram[0] = p >= 2 ? tokens[p - 2] : kNoKey;
+		gram[1] = before;
+		gram[2] = word;
+		const bool first = before == NgramModel::kSentenceStart;
+		keys.push_back(first ? kNoKey : NgramModel::ngram_key(gram, 3));
+		keys.push_back(NgramModel::ngram_key(gram + 1, 2));
+		keys.push_back(NgramModel::ngram_key(gram + 2, 1));
+
+		// The next word after it.
+		gram[0] = before;
+		gram[1] = word;
+		gram[2] = after;
+		keys.push_back(NgramModel::ngram_key(gram, 3));
+		keys.push_back(NgramModel::ngram_key(gram + 1, 2));
+		keys.push_back(NgramModel::ngram_key(gram + 2, 1));
+
+		// The one after that, if the sentence goes on.
+		if (after == NgramModel::kSentenceEnd)
+		{
+			keys.insert(keys.end(), kKeysPerTerm, kNoKey);
+			return;
+		}
+		gram[0] = word;
+		gram[1] = after;
+		gram[2] = tokens[p + 2];
+		keys.push_back(NgramModel::ngram_key(gram, 3));
+		keys.push_back(NgramModel::ngram_key(gram + 1, 2));
+		keys.push_back(NgramModel::ngram_key(gram + 2, 1));
+	}
+
+	// log10 of a term, with stupid backoff, from its three lookups; and
+	// whether what was found includes the word scored, at 'lowest' order or
+	// above.
+	float term(const float* v, bool hasTrigram, size_t lowest, bool& evidence) const
+	{
+		if (hasTrigram && v[0] != kMissing)
+		{
+			evidence = true;
+			return v[0];
+		}
+		const float drop = hasTrigram ? model->backoff() : 0.0f;
+		if (v[1] != kMissing)
+		{
+			evidence = lowest <= 2;
+			return drop + v[1];
+		}
+		evidence = false;
+		return drop + model->backoff() + (v[2] != kMissing ? v[2] : model->unknown());
+	}
+
+	// The sentence's log10 probability, as far as the word at 'keys'
+	// changes it, and whether any n-gram including the word was seen.
+	float score(size_t at, bool& evidence) const
+	{
+		const uint64_t* k = keys.data() + at;
+		const float* v = values.data() + at;
+		bool seen;
+		float total = term(v, k[0] != kNoKey, 2, seen);
+		evidence = seen;
+		total += term(v + kKeysPerTerm, true, 2, seen);
+		evidence = evidence || seen;
+		if (k[2 * kKeysPerTerm + 2] != kNoKey)
+		{
+			total += term(v + 2 * kKeysPerTerm, true, 3, seen);
+			evidence = evidence || seen;
+		}
+		return total;
+	}
+
+	// The word of its set to offer instead of the candidate's: one that,
+	// backed by an n-gram of its own, makes the sentence likelier by the
+	// model's margin, the likeliest if several do. -1 for none.
+	int best_alternative(const Candidate& candidate) const
+	{
+		const std::vector<uint64_t>& hashes = model->set_hashes(candidate.set);
+		const uint64_t written = tokens[candidate.position];
+		bool evidence;
+		size_t mine = 0;
+		while (hashes[mine] != written)
+			++mine;
+		const float myScore = score(candidate.keys + mine * kKeysPerWord, evidence);
+		int best = -1;
+		float bestScore = 0.0f;
+		for (size_t a = 0; a < hashes.size(); ++a)
+		{
+			if (a == mine)
+				continue;
+			const float theirs = score(candidate.keys + a * kKeysPerWord, evidence);
+			if (evidence && theirs - myScore >= model->margin() && (best < 0 || theirs > bestScore))
+			{
+				best = static_cast<int>(a);
+				bestScore = theirs;
+			}
+		}
+		return best;
+	}
+
+	void add_error(std::string_view text, const LanguageRouter::Word& word, size_t index, const std::string& correction, std::vector<Error>& out)
+	{
+		Error error = { index, correction };
+		const char* written = text.data() + word.offset;
+		lower.resize(word.length);
+		const CasePattern pattern = case_pattern(written, word.length, rules, &lower[0]);
+		if (pattern == kCaseTitle || pattern == kCaseUpper)
+			capitalize(error.correction, pattern == kCaseUpper, rules);
+
+		// Keep a typographic apostrophe if one was typed.
+		if (text.substr(word.offset, word.length).find("\xE2\x80\x99") != std::string_view::npos)
+		{
+			size_t quote = error.correction.find('\'');
+			if (quote != std::string::npos)
+				error.correction.replace(quote, 1, "\xE2\x80\x99");
+		}
+		out.push_back(std::move(error));
+	}
+};
+
+std::unique_ptr<ContextChecker> ContextChecker::create(const Dictionary& dictionary)
+{
+	auto impl = Impl::make(dictionary, NgramModel::open_for(resolve_language_tag(dictionary.tag())));
+	return impl ? std::unique_ptr<ContextChecker>(new ContextChecker(std::move(impl))) : nullptr;
+}
+
+std::unique_ptr<ContextChecker> ContextChecker::create(const Dictionary& dictionary, const std::string& path)
+{
+	auto impl = Impl::make(dictionary, NgramModel::open(path));
+	return impl ? std::unique_ptr<ContextChecker>(new ContextChecker(std::move(impl))) : nullptr;
+}
+
+ContextChecker::ContextChecker(std::unique_ptr<Impl> impl) :
+	impl(std::move(impl))
+{
+}
+
+ContextChecker::~ContextChecker()
+{
+}
+
+void ContextChecker::check(std::string_view text, Span<const LanguageRouter::Word> words, std::vector<Error>& out)
+{
+	Impl* d = impl.get();
+	const NgramModel& model = *d->model;
+	out.clear();
+	d->tokens.clear();
+	d->candidates.clear();
+	d->keys.clear();
+
+	// Hash every word, as context, and note the ones to score.
+	size_t end = 0;
+	for (size_t i = 0; i < words.size(); ++i)
+	{
+		const LanguageRouter::Word& word = words[i];
+		if (i == 0)
+		{
+			d->tokens.push_back(NgramModel::kSentenceStart);
+		}
+		else if (word.offset < end || is_sentence_break(text.substr(end, word.offset - end)))
+		{
+			d->tokens.push_back(NgramModel::kSentenceEnd);
+			d->tokens.push_back(NgramModel::kSentenceStart);
+		}
+		end = word.offset + word.length;
+
+		const uint64_t hash = NgramModel::word_hash(text.data() + word.offset, word.length);
+		if (word.dictionary == d->dictionary && word.result == 0)
+		{
+			const int set = model.confusion_set(hash);
+			if (set >= 0)
+				d->candidates.push_back({ i, d->tokens.size(), set, 0 });
+		}
+		d->tokens.push_back(hash);
+	}
+	if (d->candidates.empty())
+		return;
+	d->tokens.push_back(NgramModel::kSentenceEnd);
+
+	// A batch of candidates at a time: every n-gram they need, fetched
+	// ahead of the lookups so that misses on a large model overlap rather
+	// than queue, in buffers small enough to stay in cache.
+	for (size_t first = 0; first < d->candidates.size(); first += kBatch)
+	{
+		const size_t last = std::min(first + kBatch, d->candidates.size());
+		d->keys.clear();
+		for (size_t c = first; c < last; ++c)
+		{
+			Impl::Candidate& candidate = d->candidates[c];
+			candidate.keys = d->keys.size();
+			for (uint64_t alternative : model.set_hashes(candidate.set))
+				d->add_keys(candidate.position, alternative);
+		}
+		for (uint64_t key : d->keys)
+		{
+			if (key != kNoKey)
+				model.prefetch(key);
+		}
+		d->values.resize(d->keys.size());
+		for (size_t k = 0; k < d->keys.size(); ++k)
+		{
+			float logp;
+			d->values[k] = d->keys[k] != kNoKey && model.lookup(d->keys[k], logp) ? logp : kMissing;
+		}
+
+		for (size_t c = first; c < last; ++c)
+		{
+			const Impl::Candidate& candidate = d->candidates[c];
+			const int best = d->best_alternative(candidate);
+			if (best >= 0)
+				d->add_error(text, words[candidate.word], candidate.word, model.set_words(candidate.set)[best], out);
+		}
+	}
+}
+
+} // namespace enchant_windows
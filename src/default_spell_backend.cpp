@@ -0,0 +1,41 @@
+// enchant_windows - choice of spell checking backend.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#include "spell_backend.h"
+#include "wordlist_spell_backend.h"
+
+#ifdef _WIN32
+#include "com_spell_backend.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+// The profile-guided optimization training run sets
+// ENCHANT_WINDOWS_BACKEND=wordlist so it exercises the shipped DLL without
+// depending on the languages installed on the build machine.
+std::unique_ptr<SpellBackend> create_default_spell_backend()
+{
+#ifdef _WIN32
+	const char* backend = getenv("ENCHANT_WINDOWS_BACKEND");
+	if (!backend || strcmp(backend, "wordlist") != 0)
+		return create_com_spell_backend();
+#endif
+	return create_wordlist_spell_backend();
+}
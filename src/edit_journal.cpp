@@ -0,0 +1,384 @@
+// enchant_windows - journal of personal dictionary changes.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "edit_journal.h"
+
+#include <ctype.h>
+#include <map>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <direct.h>
+#include <io.h>
+#include <process.h>
+#else
+#include <dirent.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Emptying the journal costs more than a batch of entries usually does, so
+// it waits until there is this much to throw away. Making an entry again
+// does no harm if it is recovered after all.
+static const size_t kCompactBytes = 64 * 1024;
+
+// Each entry is its kind, then the word and the replacement, each as a
+// 32-bit little-endian length and that many bytes. An entry cut short by a
+// crash is ignored.
+
+static void make_directory(const std::string& path)
+{
+#ifdef _WIN32
+	_mkdir(path.c_str());
+#else
+	mkdir(path.c_str(), 0700);
+#endif
+}
+
+// 'path' and the directories it is in, those that don't exist yet.
+static void make_directories(const std::string& path)
+{
+	for (size_t i = 1; i < path.size(); ++i)
+	{
+		if (path[i] == '/' || path[i] == '\\')
+			make_directory(path.substr(0, i));
+	}
+	make_directory(path);
+}
+
+static FILE* open_file(const std::string& path, const char* mode)
+{
+#ifdef _MSC_VER
+	FILE* file = nullptr;
+	if (fopen_s(&file, path.c_str(), mode) != 0)
+		return nullptr;
+	return file;
+#else
+	return fopen(path.c_str(), mode);
+#endif
+}
+
+// Take the exclusive lock on 'file' without waiting. Held until it is closed.
+static bool lock_file(FILE* file)
+{
+#ifdef _WIN32
+	HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file)));
+	OVERLAPPED overlapped = {};
+	return LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+#else
+	return flock(fileno(file), LOCK_EX | LOCK_NB) == 0;
+#endif
+}
+
+static bool truncate_file(FILE* file)
+{
+	if (fflush(file) != 0)
+		return false;
+#ifdef _WIN32
+	const bool truncated = _chsize_s(_fileno(file), 0) == 0;
+#else
+	const bool truncated = ftruncate(fileno(file), 0) == 0;
+#endif
+	rewind(file);
+	return truncated;
+}
+
+// Close and remove a file this process has locked. Where an open file can't
+// be removed, another process may take the lock in between and recover the
+// entries again, which does no harm.
+static void remove_file(FILE* file, const std::string& path)
+{
+#ifdef _WIN32
+	fclose(file);
+	remove(path.c_str());
+#else
+	remove(path.c_str());
+	fclose(file);
+#endif
+}
+
+static unsigned long process_id()
+{
+#ifdef _WIN32
+	return static_cast<unsigned long>(_getpid());
+#else
+	return static_cast<unsigned long>(getpid());
+#endif
+}
+
+// Where journals go, or empty if they are off. Nothing is created here.
+static std::string journal_directory()
+{
+	const char* dir = getenv("ENCHANT_WINDOWS_JOURNAL_DIR");
+	if (dir)
+		return dir;
+
+	std::string base;
+#ifdef _WIN32
+	const char* localAppData = getenv("LOCALAPPDATA");
+	if (!localAppData || !*localAppData)
+		return std::string();
+	base = localAppData;
+#else
+	const char* state = getenv("XDG_STATE_HOME");
+	const char* home = getenv("HOME");
+	if (state && *state)
+		base = state;
+	else if (home && *home)
+		base = std::string(home) + "/.local/state";
+	else
+		return std::string();
+#endif
+	return base + "/enchant_windows";
+}
+
+// Whether 'name' is a journal for 'tag': '<tag>.<pid>.journal', or
+// '<tag>.journal' as earlier versions named them.
+static bool is_journal_for(const std::string& name, const std::string& tag)
+{
+	static const std::string kSuffix = ".journal";
+	if (name.size() < tag.size() + kSuffix.size() || name.compare(0, tag.size(), tag) != 0 ||
+		name.compare(name.size() - kSuffix.size(), kSuffix.size(), kSuffix) != 0)
+		return false;
+
+	const std::string middle = name.substr(tag.size(), name.size() - tag.size() - kSuffix.size());
+	if (middle.empty())
+		return true;
+	if (middle.size() < 2 || middle[0] != '.')
+		return false;
+	for (size_t i = 1; i < middle.size(); ++i)
+	{
+		if (!isdigit(static_cast<unsigned char>(middle[i])))
+			return false;
+	}
+	return true;
+}
+
+static std::vector<std::string> journal_files(const std::string& dir, const std::string& tag)
+{
+	std::vector<std::string> names;
+#ifdef _WIN32
+	WIN32_FIND_DATAA data;
+	HANDLE find = FindFirstFileA((dir + "\\" + tag + "*.journal").c_str(), &data);
+	if (find == INVALID_HANDLE_VALUE)
+		return names;
+	do
+	{
+		if (is_journal_for(data.cFileName, tag))
+			names.push_back(data.cFileName);
+	} while (FindNextFileA(find, &data));
+	FindClose(find);
+#else
+	DIR* directory = opendir(dir.c_str());
+	if (!directory)
+		return names;
+	while (dirent* entry = readdir(directory))
+	{
+		if (is_journal_for(entry->d_name, tag))
+			names.push_back(entry->d_name);
+	}
+	closedir(directory);
+#endif
+	return names;
+}
+
+static bool read_field(FILE* file, std::string& out)
+{
+	unsigned char length[4];
+	if (fread(length, 1, sizeof(length), file) != sizeof(length))
+		return false;
+	const uint32_t len = length[0] | (length[1] << 8) | (length[2] << 16) | (static_cast<uint32_t>(length[3]) << 24);
+	// Nothing longer than a word is ever written.
+	if (len > 4096)
+		return false;
+	out.resize(len);
+	return len == 0 || fread(&out[0], 1, len, file) == len;
+}
+
+static void write_field(std::string& out, const char* data, size_t len)
+{
+	const uint32_t n = static_cast<uint32_t>(len);
+	const char length[4] = { static_cast<char>(n), static_cast<char>(n >> 8), static_cast<char>(n >> 16), static_cast<char>(n >> 24) };
+	out.append(length, sizeof(length));
+	out.append(data, len);
+}
+
+static void read_entries(FILE* file, std::vector<EditJournal::Entry>& entries)
+{
+	int kind;
+	while ((kind = fgetc(file)) == EditJournal::Add || kind == EditJournal::AutoCorrect)
+	{
+		EditJournal::Entry entry;
+		entry.kind = static_cast<EditJournal::Kind>(kind);
+		if (!read_field(file, entry.word) || !read_field(file, entry.replacement))
+			break;
+		entries.push_back(std::move(entry));
+	}
+}
+
+static std::mutex journals_mutex;
+static std::map<std::string, std::weak_ptr<EditJournal>> journals;
+
+// Tags name the files, so anything that could step outside the directory
+// is refused.
+static bool is_file_name(const std::string& tag)
+{
+	if (tag.empty())
+		return false;
+	for (char c : tag)
+	{
+		if (!isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '-' && c != '@')
+			return false;
+	}
+	return true;
+}
+
+std::shared_ptr<EditJournal> EditJournal::open(const std::string& tag)
+{
+	if (!is_file_name(tag))
+		return nullptr;
+
+	const std::string dir = journal_directory();
+	if (dir.empty())
+		return nullptr;
+
+	const std::string path = dir + "/" + tag + "." + std::to_string(process_id()) + ".journal";
+	std::lock_guard<std::mutex> lock(journals_mutex);
+	auto& slot = journals[path];
+	if (auto journal = slot.lock())
+		return journal;
+	std::shared_ptr<EditJournal> journal(new EditJournal(dir, path));
+
+	// Journals whose process is gone, locked until their entries are in
+	// this one. One that has this process's name is from an earlier process
+	// with the same ID, and is about to be rewritten anyway.
+	struct Orphan
+	{
+		FILE* file;
+		std::string path;
+	};
+	std::vector<Orphan> orphans;
+	std::vector<Entry> recovered;
+	for (const std::string& name : journal_files(dir, tag))
+	{
+		const std::string orphanPath = dir + "/" + name;
+		FILE* file = open_file(orphanPath, "rb");
+		if (!file)
+			continue;
+		if (!lock_file(file))
+		{
+			fclose(file);
+			continue;
+		}
+		read_entries(file, recovered);
+		if (orphanPath == path)
+			fclose(file);
+		else
+			orphans.push_back({ file, orphanPath });
+	}
+
+	bool kept = true;
+	for (const auto& entry : recovered)
+		kept = journal->append(entry.kind, entry.word.data(), entry.word.size(), entry.replacement.data(), entry.replacement.size()) && kept;
+	for (const auto& orphan : orphans)
+	{
+		if (kept)
+			remove_file(orphan.file, orphan.path);
+		else
+			fclose(orphan.file);
+	}
+	journal->recovered = std::move(recovered);
+	slot = journal;
+	return journal;
+}
+
+EditJournal::EditJournal(const std::string& dir, const std::string& path) :
+	dir(dir),
+	path(path),
+	file(nullptr),
+	appended(0),
+	done(0),
+	bytes(0)
+{
+}
+
+EditJournal::~EditJournal()
+{
+	if (file && done == appended)
+		remove_file(file, path);
+	else if (file)
+		fclose(file);
+
+	// Unless the file has been opened again already.
+	std::lock_guard<std::mutex> lock(journals_mutex);
+	auto slot = journals.find(path);
+	if (slot != journals.end() && slot->second.expired())
+		journals.erase(slot);
+}
+
+bool EditJournal::create()
+{
+	make_directories(dir);
+	file = open_file(path, "wb");
+	if (file && !lock_file(file))
+	{
+		fclose(file);
+		file = nullptr;
+	}
+	return file != nullptr;
+}
+
+bool EditJournal::append(Kind kind, const char* word, size_t len, const char* replacement, size_t replacement_len)
+{
+	std::string entry(1, static_cast<char>(kind));
+	write_field(entry, word, len);
+	write_field(entry, replacement, replacement_len);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	++appended;
+	bytes += entry.size();
+	if (!file && !create())
+		return false;
+	return fwrite(entry.data(), 1, entry.size(), file) == entry.size() && fflush(file) == 0;
+}
+
+std::vector<EditJournal::Entry> EditJournal::take_recovered()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::vector<Entry> entries;
+	entries.swap(recovered);
+	return entries;
+}
+
+void EditJournal::applied(size_t count)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	done += count;
+	if (done < appended || bytes < kCompactBytes)
+		return;
+
+	// Emptied in place, so the lock is never let go of.
+	if (file && !truncate_file(file))
+		return;
+	appended = done = 0;
+	bytes = 0;
+}
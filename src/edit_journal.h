@@ -0,0 +1,98 @@
+// enchant_windows - journal of personal dictionary changes.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_EDIT_JOURNAL_H
+#define ENCHANT_WINDOWS_EDIT_JOURNAL_H
+
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// Changes to the user's dictionary are acknowledged before the backend has
+// made them, so each is first written to a journal file, which is emptied
+// when the backend has caught up. Each process has a journal of its own for
+// each language, '<tag>.<pid>.journal', held under an exclusive lock for as
+// long as the process has it open. A journal whose lock can be taken is what
+// a process that exited early left behind; its entries are handed to the
+// first dictionary for the language to make, and the file is removed once
+// they are in that process's journal. So processes using a language at once
+// never read or rewrite each other's journals.
+//
+// Each entry is written through to the operating system before append
+// returns, which is enough to survive the process crashing. It is not
+// synced to disk, which would make every change wait on the disk, so a
+// crash of the machine or a power loss can lose entries. Nothing is
+// created, not even the directory, until there is an entry to write.
+//
+// The journals live in ENCHANT_WINDOWS_JOURNAL_DIR, if set (to nothing to
+// turn them off), or else an enchant_windows directory under
+// %LOCALAPPDATA% on Windows and $XDG_STATE_HOME or ~/.local/state elsewhere.
+// Dictionaries for one language in a process share its journal.
+class EditJournal
+{
+public:
+	enum Kind { Add = 'a', AutoCorrect = 'r' };
+
+	struct Entry
+	{
+		Kind kind;
+		std::string word;
+		std::string replacement;
+	};
+
+	~EditJournal();
+
+	EditJournal(const EditJournal&) = delete;
+	EditJournal& operator=(const EditJournal&) = delete;
+
+	// The journal for 'tag', the language's interned Enchant spelling
+	// ("en_US"), or null if journals are off or it can't be opened.
+	static std::shared_ptr<EditJournal> open(const std::string& tag);
+
+	// Record a change (UTF-8). False if it couldn't be written.
+	bool append(Kind kind, const char* word, size_t len, const char* replacement = nullptr, size_t replacement_len = 0);
+
+	// Entries left by an earlier process, once; the caller must report
+	// them through applied like its own.
+	std::vector<Entry> take_recovered();
+
+	// 'count' entries have reached the backend. Empties the journal, from
+	// time to time, once all of them have; and deletes it on the way out.
+	void applied(size_t count);
+
+private:
+	EditJournal(const std::string& dir, const std::string& path);
+
+	// Create and lock the file, and the directory if need be.
+	bool create();
+
+	std::mutex mutex;
+	std::string dir;
+	std::string path;
+	// Null until the first entry.
+	FILE* file;
+	std::vector<Entry> recovered;
+	// Entries in the file, how many of them the backend has, and the size.
+	size_t appended;
+	size_t done;
+	size_t bytes;
+};
+
+#endif
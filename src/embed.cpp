@@ -0,0 +1,380 @@
+// enchant_windows - C++ API for applications that embed the provider.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#include "enchant-windows.hpp"
+
+#include "windows_provider.h"
+
+#include <algorithm>
+
+namespace enchant_windows {
+
+// The embedding API runs with the plugin's default configuration.
+typedef DefaultProviderPolicies::Dispatch Dispatch;
+typedef DefaultProviderPolicies::Conversion Conversion;
+
+// UTF-8 from the caller into 'out', reusing its storage. False if it's too
+// long to be a word.
+static bool to_utf16(std::string_view word, std::u16string& out)
+{
+	if (word.size() > kMaxUTF8WordLengthInBytes)
+		return false;
+
+	out.resize(Conversion::to_utf16(word.data(), word.size(), nullptr));
+	Conversion::to_utf16(word.data(), word.size(), &out[0]);
+	return true;
+}
+
+static void to_utf8(const std::u16string& str, std::string& out)
+{
+	out.resize(Conversion::to_utf8(str.data(), str.size(), nullptr));
+	Conversion::to_utf8(str.data(), str.size(), &out[0]);
+}
+
+struct Provider::Impl
+{
+	Impl() :
+		data()
+	{
+		Dispatch::addref();
+	}
+
+	~Impl()
+	{
+		untrack_backend_user(&data);
+
+		// The backend goes where it was created, and is only touched there,
+		// where a recovery may still be replacing it.
+		Dispatch::dispatch([this]() { data.backend.reset(); });
+		Dispatch::release();
+	}
+
+	// The backend, and how to make another if a call hangs in it.
+	ProviderUserData data;
+};
+
+// Calls go through the same worker as the plugin's, so one that hangs can be
+// given up on the same way. Everything a call reads or writes is its own
+// until it has claimed its result, since a call given up on may still
+// return: words are converted before they are queued, and results come back
+// as return values. Anything changed on the spell checker is kept, so a
+// replacement made after a hang (recover) has it too.
+struct Dictionary::Impl : BackendUser
+{
+	struct Edit
+	{
+		enum Kind { Add, Ignore, AutoCorrect } kind;
+		std::u16string word;
+		std::u16string replacement;
+	};
+
+	~Impl()
+	{
+		untrack_backend_user(this);
+		Dispatch::dispatch([this]() { spellChecker.reset(); });
+	}
+
+	// As the plugin's dictionaries do, the old spell checker is leaked, since
+	// the hung call may still be using it. Runs after the provider has a new
+	// backend.
+	void recover() override
+	{
+		spellChecker.release();
+		if (provider->data.backend)
+			spellChecker = create_spell_checker_for(*provider->data.backend, *language);
+		if (!spellChecker)
+			return;
+		for (const auto& edit : session)
+			apply(edit);
+	}
+
+	// Only called on the worker.
+	void apply(const Edit& edit)
+	{
+		switch (edit.kind)
+		{
+		case Edit::Add: spellChecker->add(edit.word.c_str()); break;
+		case Edit::Ignore: spellChecker->ignore(edit.word.c_str()); break;
+		case Edit::AutoCorrect: spellChecker->auto_correct(edit.word.c_str(), edit.replacement.c_str()); break;
+		}
+	}
+
+	// Whether 'word' is written only in scripts the language isn't, which
+	// the backend has nothing to judge by; as in the plugin, it is correct
+	// without asking.
+	bool outside_language(std::string_view word) const
+	{
+		return scripts != kAllScripts && outside_scripts(word_scripts(word.data(), word.size()), scripts);
+	}
+
+	// Record 'edit' and make it. Recorded first, so an edit whose call hangs
+	// is made again by the replacement, and nothing is touched afterwards.
+	// The backend is given this call's own copy, since a hung backend may
+	// still be reading it after 'session' has grown.
+	void make_edit(Edit edit)
+	{
+		session.push_back(edit);
+		if (spellChecker)
+			apply(edit);
+	}
+
+	// Keeps the worker thread (and the backend) around for as long as the
+	// dictionary is.
+	std::shared_ptr<Provider::Impl> provider;
+	std::unique_ptr<SpellChecker> spellChecker;
+	std::string tag;
+	LanguageTagRef language;
+	// What the language is written in.
+	ScriptSet scripts;
+	// Suggestions returned when not asked for some number.
+	size_t suggestMax;
+	CompletionIndex completion;
+	// Words added and ignored and replacements stored, only touched on the
+	// worker.
+	std::vector<Edit> session;
+};
+
+Dictionary::Dictionary(std::unique_ptr<Impl> impl) :
+	impl(std::move(impl))
+{
+}
+
+Dictionary::~Dictionary()
+{
+}
+
+const std::string& Dictionary::tag() const
+{
+	return impl->tag;
+}
+
+int Dictionary::check(std::string_view word)
+{
+	Impl* d = impl.get();
+	std::u16string utf16Word;
+	if (!to_utf16(word, utf16Word))
+		return -1;
+	if (d->outside_language(word))
+		return 0;
+
+	return Dispatch::dispatch([d, utf16Word = std::move(utf16Word)]() -> int {
+		return d->spellChecker ? d->spellChecker->check(utf16Word.c_str()) : -1;
+	});
+}
+
+void Dictionary::check(Span<const std::string_view> words, Span<int> results)
+{
+	Impl* d = impl.get();
+	const size_t count = std::min(words.size(), results.size());
+	std::vector<std::u16string> utf16Words(count);
+	std::vector<bool> valid(count);
+	std::vector<bool> outside(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		valid[i] = to_utf16(words[i], utf16Words[i]);
+		outside[i] = valid[i] && d->outside_language(words[i]);
+		valid[i] = valid[i] && !outside[i];
+	}
+
+	std::vector<int> checked = Dispatch::dispatch([d, utf16Words = std::move(utf16Words), valid = std::move(valid)]() -> std::vector<int> {
+		std::vector<int> checked(utf16Words.size(), -1);
+		for (size_t i = 0; i < utf16Words.size(); ++i)
+		{
+			if (valid[i] && d->spellChecker)
+				checked[i] = d->spellChecker->check(utf16Words[i].c_str());
+		}
+		return checked;
+	});
+
+	// A batch given up on comes back empty, all errors.
+	for (size_t i = 0; i < count; ++i)
+		results[i] = outside[i] ? 0 : i < checked.size() ? checked[i] : -1;
+}
+
+bool Dictionary::suggest(std::string_view word, Suggestions& out)
+{
+	return suggest(word, out, 0);
+}
+
+bool Dictionary::suggest(std::string_view word, Suggestions& out, size_t max)
+{
+	Impl* d = impl.get();
+	const size_t limit = max ? max : d->suggestMax;
+	out.clear();
+	std::u16string utf16Word;
+	if (!to_utf16(word, utf16Word) || d->outside_language(word))
+		return false;
+
+	// Null if the word was spelled correctly and there are no suggestions.
+	std::unique_ptr<Suggestions> found = Dispatch::dispatch([d, limit, utf16Word = std::move(utf16Word)]() -> std::unique_ptr<Suggestions> {
+		if (!d->spellChecker)
+			return nullptr;
+		auto suggestionEnumerator = d->spellChecker->suggest(utf16Word.c_str());
+		if (!suggestionEnumerator)
+			return nullptr;
+
+		auto suggestions = std::make_unique<Suggestions>();
+		std::u16string entry;
+		std::string entryUtf8;
+		for (size_t n = 0; n < limit && suggestionEnumerator->next(entry); )
+		{
+			if (entry.size() > kMaxWordLength)
+				continue;
+			to_utf8(entry, entryUtf8);
+			suggestions->push_back(entryUtf8);
+			++n;
+		}
+		return suggestions;
+	});
+	if (!found)
+		return false;
+
+	for (std::string_view suggestion : *found)
+		out.push_back(suggestion);
+	return true;
+}
+
+void Dictionary::add(std::string_view word)
+{
+	Impl* d = impl.get();
+	d->completion.add(word.data(), word.size());
+	std::u16string utf16Word;
+	if (!to_utf16(word, utf16Word))
+		return;
+
+	Dispatch::dispatch([d, edit = Impl::Edit{ Impl::Edit::Add, std::move(utf16Word), std::u16string() }]() mutable -> void {
+		d->make_edit(std::move(edit));
+	});
+}
+
+void Dictionary::ignore(std::string_view word)
+{
+	Impl* d = impl.get();
+	d->completion.exclude(word.data(), word.size());
+	std::u16string utf16Word;
+	if (!to_utf16(word, utf16Word))
+		return;
+
+	Dispatch::dispatch([d, edit = Impl::Edit{ Impl::Edit::Ignore, std::move(utf16Word), std::u16string() }]() mutable -> void {
+		d->make_edit(std::move(edit));
+	});
+}
+
+bool Dictionary::complete(std::string_view prefix, Suggestions& out, size_t max)
+{
+	Impl* d = impl.get();
+	out.clear();
+	thread_local std::vector<std::string> words;
+	d->completion.complete(prefix.data(), prefix.size(), max, words);
+	for (const std::string& word : words)
+		out.push_back(word);
+	return !words.empty();
+}
+
+void Dictionary::store_replacement(std::string_view misspelled, std::string_view correct)
+{
+	Impl* d = impl.get();
+	std::u16string from;
+	std::u16string to;
+	if (!to_utf16(misspelled, from) || !to_utf16(correct, to))
+		return;
+
+	Dispatch::dispatch([d, edit = Impl::Edit{ Impl::Edit::AutoCorrect, std::move(from), std::move(to) }]() mutable -> void {
+		d->make_edit(std::move(edit));
+	});
+}
+
+std::unique_ptr<Provider> Provider::create()
+{
+	auto impl = std::make_shared<Impl>();
+	impl->data.backend = Dispatch::dispatch([]() { return create_default_spell_backend(); });
+	if (!impl->data.backend)
+		return nullptr;
+	impl->data.create_backend = create_default_spell_backend;
+	track_backend_user(&impl->data);
+	return std::unique_ptr<Provider>(new Provider(impl));
+}
+
+Provider::Provider(std::shared_ptr<Impl> impl) :
+	impl(std::move(impl))
+{
+}
+
+Provider::~Provider()
+{
+}
+
+std::unique_ptr<Dictionary> Provider::request_dict(std::string_view tag)
+{
+	const LanguageTagRef language = resolve_language_tag(tag);
+	if (!language)
+		return nullptr;
+
+	auto dictdata = std::make_unique<Dictionary::Impl>();
+	dictdata->provider = impl;
+	dictdata->tag = std::string(tag);
+	dictdata->language = language;
+	dictdata->scripts = dictionary_scripts(language->bcp47);
+	dictdata->suggestMax = default_suggest_max();
+	dictdata->completion.configure(language, case_rules_for(*language), nullptr);
+	dictdata->completion.start_loading();
+	ProviderUserData* provider = &impl->data;
+	dictdata->spellChecker = Dispatch::dispatch([provider, language]() -> std::unique_ptr<SpellChecker> {
+		return provider->backend ? create_spell_checker_for(*provider->backend, *language) : nullptr;
+	});
+	if (!dictdata->spellChecker)
+		return nullptr;
+
+	track_backend_user(dictdata.get());
+	return std::unique_ptr<Dictionary>(new Dictionary(std::move(dictdata)));
+}
+
+bool Provider::dictionary_exists(std::string_view tag)
+{
+	const LanguageTagRef language = resolve_language_tag(tag);
+	if (!language)
+		return false;
+
+	ProviderUserData* provider = &impl->data;
+	return Dispatch::dispatch([provider, language]() -> bool {
+		return provider->backend && has_spell_checker_for(*provider->backend, *language);
+	});
+}
+
+std::vector<std::string> Provider::list_dicts()
+{
+	ProviderUserData* provider = &impl->data;
+	return Dispatch::dispatch([provider]() -> std::vector<std::string> {
+		std::vector<std::string> tags;
+		auto langEnumerator = provider->backend ? provider->backend->supported_languages() : nullptr;
+		if (!langEnumerator)
+			return tags;
+
+		std::u16string entry;
+		std::string tag;
+		while (langEnumerator->next(entry))
+		{
+			to_utf8(entry, tag);
+			tags.push_back(tag);
+		}
+		return tags;
+	});
+}
+
+} // namespace enchant_windows
@@ -0,0 +1,176 @@
+// enchant_windows - epoch-based reclamation.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "epoch.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+// Each thread that has ever pinned owns a record in a list that only grows.
+// A record's epoch is 0 while its thread is not pinned. Records are handed
+// on to new threads when theirs exit.
+struct EpochRecord
+{
+	EpochRecord() : epoch(0), in_use(true), next(nullptr) {}
+
+	std::atomic<uint64_t> epoch;
+	std::atomic<bool> in_use;
+	EpochRecord* next;
+};
+
+struct Retired
+{
+	uint64_t epoch;
+	void* p;
+	void (*destroy)(void*);
+};
+
+// Starts at 1 so that 0 can mean unpinned.
+static std::atomic<uint64_t> global_epoch(1);
+static std::atomic<EpochRecord*> records(nullptr);
+
+static std::mutex retired_mutex;
+static std::vector<Retired> retired;
+
+static EpochRecord* acquire_record()
+{
+	for (EpochRecord* r = records.load(std::memory_order_acquire); r; r = r->next)
+	{
+		bool expected = false;
+		if (!r->in_use.load(std::memory_order_relaxed) && r->in_use.compare_exchange_strong(expected, true))
+			return r;
+	}
+
+	EpochRecord* r = new EpochRecord;
+	EpochRecord* head = records.load(std::memory_order_relaxed);
+	do
+	{
+		r->next = head;
+	} while (!records.compare_exchange_weak(head, r, std::memory_order_release, std::memory_order_relaxed));
+	return r;
+}
+
+// The calling thread's record and how deeply it is pinned.
+struct ThreadEpoch
+{
+	ThreadEpoch() : record(acquire_record()), depth(0) {}
+	~ThreadEpoch()
+	{
+		record->epoch.store(0, std::memory_order_release);
+		record->in_use.store(false, std::memory_order_release);
+	}
+
+	EpochRecord* record;
+	unsigned depth;
+};
+
+static ThreadEpoch& thread_epoch()
+{
+	static thread_local ThreadEpoch te;
+	return te;
+}
+
+EpochGuard::EpochGuard()
+{
+	ThreadEpoch& te = thread_epoch();
+	if (te.depth++)
+		return;
+
+	// Publish the epoch we saw, and make sure it was still current once
+	// the publication was visible; otherwise an advance could have missed
+	// us and freed what we are about to read.
+	uint64_t epoch = global_epoch.load();
+	for (;;)
+	{
+		te.record->epoch.store(epoch);
+		uint64_t now = global_epoch.load();
+		if (now == epoch)
+			break;
+		epoch = now;
+	}
+}
+
+EpochGuard::~EpochGuard()
+{
+	ThreadEpoch& te = thread_epoch();
+	if (--te.depth == 0)
+		te.record->epoch.store(0, std::memory_order_release);
+}
+
+// Move the global epoch on if every pinned thread has seen the current one.
+static void try_advance()
+{
+	uint64_t epoch = global_epoch.load();
+	for (EpochRecord* r = records.load(std::memory_order_acquire); r; r = r->next)
+	{
+		uint64_t pinned = r->epoch.load();
+		if (pinned != 0 && pinned != epoch)
+			return;
+	}
+	global_epoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+// Free what was retired at least two epochs ago. Returns how many are left.
+static size_t collect()
+{
+	std::vector<Retired> ready;
+	size_t left;
+	{
+		std::lock_guard<std::mutex> lock(retired_mutex);
+		try_advance();
+		const uint64_t epoch = global_epoch.load();
+		auto keep = retired.begin();
+		for (auto it = retired.begin(); it != retired.end(); ++it)
+		{
+			if (it->epoch + 2 <= epoch)
+				ready.push_back(*it);
+			else
+				*keep++ = *it;
+		}
+		retired.erase(keep, retired.end());
+		left = retired.size();
+	}
+
+	// Outside the lock, so destructors may retire more.
+	for (const auto& r : ready)
+		r.destroy(r.p);
+	return left;
+}
+
+void epoch_retire(void* p, void (*destroy)(void*))
+{
+	{
+		std::lock_guard<std::mutex> lock(retired_mutex);
+		retired.push_back(Retired{ global_epoch.load(), p, destroy });
+	}
+	collect();
+}
+
+void epoch_collect()
+{
+	collect();
+}
+
+void epoch_barrier()
+{
+	while (collect())
+		std::this_thread::yield();
+}
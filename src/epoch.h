@@ -0,0 +1,59 @@
+// enchant_windows - epoch-based reclamation.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_EPOCH_H
+#define ENCHANT_WINDOWS_EPOCH_H
+
+// Lets threads read shared objects without locks while other threads retire
+// them. A reader pins the current epoch with an EpochGuard for as long as it
+// may use such objects; a retired object is freed only once every thread
+// that was pinned when it was retired has unpinned, which takes the global
+// epoch moving on twice.
+//
+// Readers pay two atomic stores per guard. Retiring and collecting take a
+// lock, and are meant for rare events such as disposing a dictionary.
+
+// Pins the calling thread for its lifetime. Guards nest.
+class EpochGuard
+{
+public:
+	EpochGuard();
+	~EpochGuard();
+
+	EpochGuard(const EpochGuard&) = delete;
+	EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+// Free 'p' with 'destroy' once no reader can still be using it, then try to
+// free what earlier calls retired. Must not be called while pinned.
+void epoch_retire(void* p, void (*destroy)(void*));
+
+template<typename T>
+void epoch_retire_delete(T* p)
+{
+	epoch_retire(p, [](void* q) { delete static_cast<T*>(q); });
+}
+
+// Free everything retired that no reader can still be using.
+void epoch_collect();
+
+// Wait for all readers pinned now to unpin and free everything retired so
+// far. Must not be called while pinned.
+void epoch_barrier();
+
+#endif
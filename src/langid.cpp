@@ -0,0 +1,209 @@
+// enchant_windows - character n-gram language identification.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "langid.h"
+#include "langid_model.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENCHANT_WINDOWS_LANGID_SSE2 1
+#include <emmintrin.h>
+#endif
+
+static_assert(langid_model::kLanguageCount == kLangidLanguageCount, "model does not match langid.h");
+
+static const uint32_t kBucketMask = (1u << langid_model::kBucketBits) - 1;
+
+// n-grams are hashed and scored a chunk at a time. With at most 127 per
+// n-gram, a chunk's sum fits the 16-bit SSE2 accumulators.
+static const size_t kChunk = 256;
+
+const char* langid_language(size_t index)
+{
+	return index < kLangidLanguageCount ? langid_model::kLanguages[index] : nullptr;
+}
+
+int langid_language_index(std::string_view tag)
+{
+	size_t primary = tag.find_first_of("_-");
+	if (primary == std::string_view::npos)
+		primary = tag.size();
+	for (size_t i = 0; i < kLangidLanguageCount; ++i)
+	{
+		const char* language = langid_model::kLanguages[i];
+		if (strlen(language) != primary)
+			continue;
+		size_t k = 0;
+		while (k < primary && (tag[k] | 0x20) == language[k])
+			++k;
+		if (k == primary)
+			return static_cast<int>(i);
+	}
+	return -1;
+}
+
+// Must match normalize() in tools/gen_langid_model.py: ASCII letters
+// lowercased, Latin-1 capitals (C3 80..C3 9E but not C3 97) folded, ASCII
+// other than letters and apostrophes a separator (space).
+static inline unsigned char normalize(unsigned char b, unsigned char prev)
+{
+	if (b >= 'A' && b <= 'Z')
+		return b + 0x20;
+	if (prev == 0xC3 && b >= 0x80 && b <= 0x9E && b != 0x97)
+		return b + 0x20;
+	if (b < 0x80 && !(b >= 'a' && b <= 'z') && b != '\'')
+		return ' ';
+	return b;
+}
+
+static inline uint32_t fnv_step(uint32_t h, unsigned char b)
+{
+	return (h ^ b) * 16777619u;
+}
+
+static inline uint32_t fnv_seed(uint32_t n)
+{
+	return 2166136261u ^ n;
+}
+
+static inline uint16_t bucket(uint32_t h)
+{
+	return static_cast<uint16_t>((h ^ (h >> 16)) & kBucketMask);
+}
+
+static void add_scalar(const uint16_t* buckets, size_t count, int32_t* scores)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		const int8_t* row = &langid_model::kWeights[buckets[i] * kLangidLanguageCount];
+		for (size_t l = 0; l < kLangidLanguageCount; ++l)
+			scores[l] += row[l];
+	}
+}
+
+#ifdef ENCHANT_WINDOWS_LANGID_SSE2
+// A row is eight int8 weights, one per language: widen it to eight int16
+// lanes and add, then widen the chunk's total to int32 once at the end.
+static void add_sse2(const uint16_t* buckets, size_t count, int32_t* scores)
+{
+	static_assert(kLangidLanguageCount == 8, "add_sse2 assumes one 64-bit row per bucket");
+
+	__m128i sum = _mm_setzero_si128();
+	for (size_t i = 0; i < count; ++i)
+	{
+		__m128i row = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&langid_model::kWeights[buckets[i] * kLangidLanguageCount]));
+		sum = _mm_add_epi16(sum, _mm_srai_epi16(_mm_unpacklo_epi8(row, row), 8));
+	}
+
+	__m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(sum, sum), 16);
+	__m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(sum, sum), 16);
+	__m128i* out = reinterpret_cast<__m128i*>(scores);
+	_mm_storeu_si128(out, _mm_add_epi32(_mm_loadu_si128(out), lo));
+	_mm_storeu_si128(out + 1, _mm_add_epi32(_mm_loadu_si128(out + 1), hi));
+}
+#endif
+
+typedef void (*AddFn)(const uint16_t* buckets, size_t count, int32_t* scores);
+
+// Hash the n-grams of each word, padded with a space either side, and hand
+// them to 'add' a chunk at a time. Every n-gram ending at a byte is taken
+// as that byte arrives, which covers the same ones the training script
+// takes by start position.
+static void score_with(std::string_view text, LangidScores& out, AddFn add)
+{
+	memset(&out, 0, sizeof(out));
+
+	uint16_t buckets[kChunk];
+	size_t count = 0;
+	unsigned char prev1 = 0;
+	unsigned char prev2 = 0;
+	size_t pos = 0;  // bytes of the padded word so far; 0 between words
+
+	auto push = [&](unsigned char c) {
+		if (count + 3 > kChunk)
+		{
+			add(buckets, count, out.score);
+			out.features += count;
+			count = 0;
+		}
+		if (c != ' ')
+			buckets[count++] = bucket(fnv_step(fnv_seed(1), c));
+		if (pos >= 1)
+			buckets[count++] = bucket(fnv_step(fnv_step(fnv_seed(2), prev1), c));
+		if (pos >= 2)
+			buckets[count++] = bucket(fnv_step(fnv_step(fnv_step(fnv_seed(3), prev2), prev1), c));
+		prev2 = prev1;
+		prev1 = c;
+		++pos;
+	};
+
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text.data());
+	unsigned char raw = 0;
+	for (size_t i = 0; i < text.size(); ++i)
+	{
+		unsigned char c = normalize(bytes[i], raw);
+		raw = bytes[i];
+		if (c == ' ')
+		{
+			if (pos)
+			{
+				push(' ');
+				pos = 0;
+			}
+		}
+		else
+		{
+			if (!pos)
+				push(' ');
+			push(c);
+		}
+	}
+	if (pos)
+		push(' ');
+
+	add(buckets, count, out.score);
+	out.features += count;
+}
+
+void langid_score(std::string_view text, LangidScores& out)
+{
+#ifdef ENCHANT_WINDOWS_LANGID_SSE2
+	score_with(text, out, add_sse2);
+#else
+	score_with(text, out, add_scalar);
+#endif
+}
+
+void langid_score_scalar(std::string_view text, LangidScores& out)
+{
+	score_with(text, out, add_scalar);
+}
+
+int langid_best(const LangidScores& scores, uint32_t candidates, size_t min_features)
+{
+	if (scores.features < min_features)
+		return -1;
+	int best = -1;
+	for (size_t l = 0; l < kLangidLanguageCount; ++l)
+	{
+		if ((candidates & (1u << l)) && (best < 0 || scores.score[l] > scores.score[best]))
+			best = static_cast<int>(l);
+	}
+	return best;
+}
@@ -0,0 +1,58 @@
+// enchant_windows - character n-gram language identification.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_LANGID_H
+#define ENCHANT_WINDOWS_LANGID_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <string_view>
+
+// Tells which of a fixed set of languages a piece of UTF-8 text is written
+// in, from hashed byte 1-, 2- and 3-grams of its words weighted by a naive
+// Bayes model quantized to int8 (src/langid_model.h, generated by
+// tools/gen_langid_model.py). Scoring is a table lookup and an add per
+// n-gram, done for all languages at once with SSE2 where available. It
+// needs a sentence or so to be reliable; single words are often wrong.
+
+const size_t kLangidLanguageCount = 8;
+
+// Primary language subtag ("en") of the language at 'index'.
+const char* langid_language(size_t index);
+
+// Index of the model's language for a dictionary tag ("en_US", "pt-BR"), or
+// -1 if the model does not know it.
+int langid_language_index(std::string_view tag);
+
+struct LangidScores
+{
+	int32_t score[kLangidLanguageCount];
+	size_t features;
+};
+
+// Sum the weights of every n-gram in 'text' for each language.
+void langid_score(std::string_view text, LangidScores& out);
+
+// The same without SIMD, for comparison.
+void langid_score_scalar(std::string_view text, LangidScores& out);
+
+// The best scoring language whose bit is set in 'candidates', or -1 if there
+// is none or the text had fewer than 'min_features' n-grams.
+int langid_best(const LangidScores& scores, uint32_t candidates, size_t min_features);
+
+#endif
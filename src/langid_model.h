@@ -0,0 +1,4124 @@
+// enchant_windows - language identification model.
+//
+// Generated by tools/gen_langid_model.py from data/langid/train. Do not edit.
+
+#ifndef ENCHANT_WINDOWS_LANGID_MODEL_H
+#define ENCHANT_WINDOWS_LANGID_MODEL_H
+
+#include <stdint.h>
+
+namespace langid_model {
+
+const unsigned kBucketBits = 12;
+const unsigned kLanguageCount = 8;
+
+// One scaled log-probability unit, in nats.
+const double kScale = 0.020629;
+
+const char* const kLanguages[kLanguageCount] = {
+	"en", "de", "fr", "es", "it", "nl", "pt", "sv"
+};
+
+// Weight of each bucket for each language, a row per bucket.
+alignas(16) const int8_t kWeights[4096 * kLanguageCount] = {
+	27, 6, -72, 9, 9, 48, -15, -13,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	-26, 85, -31, -28, -28, -27, 80, -25,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, 30, -23, -20, -20, 34, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-53, 48, -58, -2, 40, 24, -1, 1,
+	-74, -1, 53, 67, 2, -75, -22, 51,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-38, 35, -42, 67, 39, 14, -39, -37,
+	31, 25, 98, -66, -65, 51, -65, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-41, 7, 7, 63, -43, -42, 11, 38,
+	5, 0, 1, 28, 4, 4, -49, 6,
+	0, -3, -11, 10, -8, 1, 13, -2,
+	-34, -39, 39, -36, 18, 43, 43, -33,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-3, 9, 11, 6, -11, -15, 16, -13,
+	61, -39, -38, 59, -35, -35, 60, -32,
+	-31, -36, 18, -33, 21, -32, 46, 48,
+	-56, 45, -7, 20, 20, -57, -4, 39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	11, 69, 6, -44, -44, -44, 10, 37,
+	-33, 56, 16, -35, -35, 19, -34, 46,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-46, -104, 20, -23, 30, 47, 43, 33,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, 48, 10, 13, 78, -65, -11, -62,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-18, -23, 30, 33, -20, -19, 34, -17,
+	-15, 58, -19, -17, 37, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	-18, -23, -22, 58, -19, -19, 59, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	61, -38, -38, 43, -35, 19, -34, 21,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-18, 30, -23, -20, 34, -19, -19, 36,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	127, -11, 14, -62, -8, 17, -61, -58,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, 23, -29, -27, -26, -26, -26, 127,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-33, -38, 57, 43, -35, -34, 19, 21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	40, -43, 36, 14, -39, -39, 15, 17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, -40, -40, 57, 70, -36, 58, -34,
+	-12, 37, -16, -13, 40, -13, -12, -10,
+	-25, -5, 34, 14, 45, -79, 15, 1,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-18, -23, -23, 33, 87, -19, -19, -17,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-39, 9, 2, -41, -12, 45, -2, 40,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	82, 23, -29, -27, -26, 27, -26, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-24, -127, 35, 88, 78, -127, 87, 53,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-3, -61, 87, -5, 20, -4, -57, 23,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-49, 41, 71, -51, 56, -50, 28, -47,
+	-12, -17, -16, -13, -13, -13, 94, -10,
+	-16, 7, -99, 35, -96, 42, 64, 63,
+	-27, -32, 75, -29, 96, -28, -28, -26,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-69, 42, -20, -17, -17, 24, 8, 49,
+	-15, -20, -19, -17, -16, 37, -16, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-62, -14, -13, 30, 15, -10, 61, -8,
+	-15, -20, -19, -17, -16, 37, -16, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	37, -22, 73, -19, -18, -18, -18, -16,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	15, 10, 11, 13, -40, 14, 14, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-28, -33, 21, 23, 49, -29, 24, -27,
+	-21, -26, 52, 30, -23, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, 30, -20, 34, -19, -19, -17,
+	36, -63, 54, 18, 35, -59, 36, -57,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	39, 46, -12, -72, -31, 27, -47, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, -30, -29, 52, 27, -26, 53, -23,
+	22, -8, -7, -5, 20, -57, 37, -2,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-23, 13, -3, 0, 29, 29, -24, -22,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, 123, 25, -26, -25, -25, -25, -23,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-17, -22, 32, -19, 76, -18, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -64, 31, 34, 34, -7, 35, -58,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, 5, -19, -16, 62, -15, -15, 12,
+	-23, 66, -28, -25, -25, -25, -24, 84,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, -11, -11, 85,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-83, 37, 19, -7, -6, 10, -6, 35,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	9, 4, 4, -46, -46, 8, 33, 35,
+	66, 20, -33, -30, -30, -30, -29, 67,
+	29, -4, -29, 15, -79, 74, -78, 72,
+	-36, 111, -40, -38, 16, 57, -37, -35,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	50, -33, 21, -30, 24, -29, 24, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, -17, -16, 62, 38, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, 48, -29, -26, -26, 52, 28, -23,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	37, -22, -21, -19, -18, -18, -18, 79,
+	-3, -8, -60, -4, -4, 21, -3, 62,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-43, 5, 6, 33, 34, -44, -44, 53,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 59, -17, -16, -16, 38, -14,
+	-31, 5, -36, 38, 8, -33, 39, 11,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-43, -48, 31, 33, 9, -44, 51, 12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -33, 21, -30, 49, -29, 78, -27,
+	57, -73, 120, -69, 25, -69, 74, -66,
+	-22, -27, 27, -24, 114, -23, -23, -21,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-12, -17, -16, 40, -13, 41, -12, -10,
+	-12, -17, -16, 93, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-9, -14, -5, -11, 38, -21, -2, 24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	34, 4, -49, -46, 61, 8, 33, -43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, 82, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	16, 3, 30, -32, 7, 22, -56, 9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-56, -8, 77, 90, -58, -57, 67, -55,
+	54, -11, 6, -32, 9, -7, -31, 12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	61, -38, 40, 18, -35, -34, 19, -32,
+	27, 43, 44, 3, -90, -90, 34, 28,
+	25, -34, -33, 64, -30, -30, 65, -27,
+	-21, 27, -26, 55, -23, -22, 31, -20,
+	-15, -20, -19, 37, 62, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-29, -34, -33, 107, 76, -30, -30, -28,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	31, -53, 26, 4, -49, 58, 30, -46,
+	-29, -34, -34, 93, -31, -31, 94, -28,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-47, -52, -51, 5, 46, -48, 69, 79,
+	82, -39, -39, -36, -35, 81, -35, 20,
+	-14, 105, -18, -16, -15, -15, -15, -13,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, -22, 58, 59, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, -25, -24, 73, -21, -21, 57, -19,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	116, -41, -40, 16, -37, -37, 58, -35,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, -17, -16, 37, 62, -14,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, 52, -26, -23, -23, 31, -22, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, 27, -26, -23, -23, 56, -22, 33,
+	-10, -15, -15, 82, -12, -11, -11, -9,
+	-12, -17, 37, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	50, 20, -33, 23, -29, -29, -29, 26,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-27, 71, -6, -4, -3, 50, -81, -1,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	63, -20, 34, -17, -16, -16, -16, -14,
+	-15, -20, -19, 37, -16, -16, 62, -14,
+	-38, 10, 36, -40, 39, 14, 15, -37,
+	3, -2, -1, -52, 2, 2, 43, 4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-2, -113, 51, 46, 38, -15, 7, -13,
+	-25, -30, -29, 26, 27, -26, 27, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -33, -33, 77, 24, -29, 49, -27,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	63, -20, 34, -17, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-29, -34, 44, -31, 86, -30, -30, 25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, 76, -29, -27, -26, 80, -26, -24,
+	52, -85, -21, -18, -18, 36, 49, 6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-48, 0, 1, 28, 57, 4, -49, 6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, -19, -18, -16, -15, -15, 110, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-45, 4, 4, -46, 70, -46, -45, 104,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-23, -28, -28, -25, 28, 29, -24, 72,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-36, -41, 54, 72, 16, -90, 58, -34,
+	-8, -13, -13, -10, 44, 16, -9, -7,
+	-29, -34, 44, -31, -31, 23, 86, -28,
+	82, 59, -47, -45, -44, 81, -44, -41,
+	-9, 32, 33, 27, -10, 6, 6, -86,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	10, 76, 5, -45, -45, 33, 9, -42,
+	11, -48, -47, 34, -44, 10, 10, 75,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	25, -33, -33, 23, 49, -29, 24, -27,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	-12, 37, -16, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 30, -20, 34, -19, -19, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 33, -19, -17, -16, -16, -16, 65,
+	-12, -17, 90, -13, -13, -13, -12, -10,
+	12, -18, 23, 26, -15, -68, 27, 13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-33, 15, 16, 59, -35, -34, 44, -32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, 76, -48, -45, -45, 34, -44, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	17, -13, 13, -9, -9, -9, -8, 18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-12, -17, 37, -13, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, -11, -11, 85,
+	54, -15, 2, 4, 27, -89, 27, -9,
+	-88, -93, 67, 90, 70, -89, 5, 37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	117, -20, -19, -17, -16, -16, -16, -14,
+	25, -33, 21, 48, -29, -29, -29, 26,
+	-33, -38, 40, -35, 60, -34, 19, 21,
+	-20, 99, -25, -22, 31, -22, -21, -19,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	-38, -43, -42, 14, 39, 39, 15, 17,
+	79, -33, 21, 48, -29, -29, -29, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-15, 33, -19, -17, -16, -16, 62, -14,
+	104, -26, -25, -22, -22, -22, -21, 34,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	43, -40, 14, 17, -36, 17, -36, 20,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 40, -13, -12, 43,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-31, -36, -36, 20, 84, -32, 62, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	12, -46, 7, 35, 64, -42, -42, 13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	96, 64, -52, -49, -48, 83, -48, -46,
+	-39, 80, -43, -41, -40, -40, -40, 127,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	12, 60, -70, 39, 27, -67, -14, 13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -14, 25, -11, 1, 2, 21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-13, 63, -43, -93, 63, -15, 50, -12,
+	-49, 24, -53, 56, 74, -50, 45, -47,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, -26, 27, -23, -23, -22, 56, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-72, 47, -23, 21, 33, 5, -19, 7,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-30, 18, -35, -32, 22, 63, -31, 24,
+	-21, -26, 27, 55, -23, -22, 31, -20,
+	2, -57, -3, 0, 0, -53, 54, 56,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, 33, -20, -19, 34, -17,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, 31, -21, -19, -18, -18, -18, 79,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	7, -52, 2, 30, 5, 6, -47, 49,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	78, -22, -21, -19, -18, -18, -18, 38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	30, -28, -28, -25, 70, -25, -24, 31,
+	-53, 37, -57, 23, -1, 24, 0, 27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, 53, -24, -22, -21, 73, -21, -19,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, -20, -20, -19, 87, -17,
+	9, -34, 13, 29, 16, -30, 8, -11,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, -19, 35, -18, 77, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	9, 9, -44, 51, -19, -19, 52, -38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -33, 21, 23, 49, -29, 24, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-18, -23, -23, 86, -20, -19, -19, 36,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	6, -77, 40, 33, 5, -20, 5, 7,
+	-12, -17, -16, -13, -13, -13, -12, 96,
+	-12, -17, 90, -13, -13, -13, -12, -10,
+	39, -20, -19, -17, 62, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, -25, -24, 73, -21, -21, 57, -19,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-60, -2, -64, 54, 28, 2, 2, 40,
+	-31, 42, -36, 45, -33, 21, -32, 23,
+	37, -22, -21, -19, -18, -18, 77, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	75, 53, -24, -22, -21, -21, -21, -19,
+	-12, -17, -16, -13, -13, 94, -12, -10,
+	55, 3, -74, -18, -71, 114, -17, 9,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	54, 48, -29, -26, -26, 28, -25, -23,
+	35, -23, 30, -20, 34, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-60, -66, -65, 97, 75, -62, 33, 47,
+	44, -39, 15, -36, 42, 43, -35, -33,
+	-38, 10, -43, -40, -40, 55, 39, 57,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	50, -9, 99, -59, -58, 37, -58, -2,
+	-18, -23, 56, -20, 59, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 59, 37, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 58, -19, -17, 37, -16, -16, -14,
+	21, 64, -78, 3, -75, 57, 4, 6,
+	103, -18, -17, -15, -14, -14, -14, -12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	117, -31, -30, -28, -27, -27, -27, 53,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-12, -17, -16, 40, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	80, -31, 86, -28, -28, -27, -27, -25,
+	37, -40, -92, 58, -36, -11, 28, 56,
+	30, 66, 25, -25, -25, -25, -24, -22,
+	-14, -19, -18, -16, -15, -15, -15, 112,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	69, -73, 59, -17, -16, 9, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	57, -26, -26, -23, -23, -22, -22, 86,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	58, -85, 32, 50, 43, -81, 62, -79,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	5, 24, -53, -26, -9, 40, 4, 16,
+	-18, -23, 84, -20, -20, -19, -19, 36,
+	-31, 42, -36, -33, 21, 46, -32, 23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-32, 41, -37, 44, -34, 83, -33, -31,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-12, -17, -16, 93, -13, -13, -12, -10,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-30, -35, -35, 92, 22, -31, 47, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-25, 23, -29, 26, 27, -26, 27, -24,
+	-10, 2, 14, 27, 5, -36, 6, -8,
+	39, -20, -19, -17, 62, -16, -16, -14,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	-13, -18, -17, -15, 102, -14, -14, -12,
+	-15, -32, 17, 14, 52, -28, 34, -42,
+	35, -23, 30, -20, -20, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	-12, 37, 37, -13, -13, -13, -12, -10,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-12, 37, -16, 40, -13, -13, -12, -10,
+	-24, 24, 49, -26, -26, -26, 53, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, -17, -16, 37, -16, 65,
+	31, -27, -27, -24, -24, -23, -23, 116,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	25, -33, 21, 23, -29, -29, 49, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	82, -30, -29, -27, 27, 27, -26, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, 27, 57, -64, -64, -10, 31, -8,
+	39, 45, 59, 12, 0, -94, 31, -91,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, 30, -23, -20, -20, 34, -19, -17,
+	27, -1, 53, 38, -127, 9, 43, -39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-23, -28, -28, 81, -25, -25, 70, -22,
+	35, -23, -23, -20, 34, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	30, -16, 48, -66, -66, 13, 13, 44,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	43, -40, -40, -37, -37, 127, 17, -34,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, -30, -29, 52, 52, -26, 28, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, -16, -13, -13, -13, -12, 43,
+	35, -23, 30, -20, -20, 34, -19, -17,
+	2, -3, -2, 25, 1, 1, 26, -50,
+	18, 41, 14, -9, 63, -61, -8, -59,
+	-10, -15, -15, -12, 83, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	-26, 22, 47, -28, -28, -28, 67, -25,
+	-18, -23, -22, 58, -19, -19, 59, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-43, 6, -47, -44, 72, 34, 10, 12,
+	25, -33, -33, 23, 24, -29, 49, -27,
+	25, 20, -33, -30, -29, 24, -29, 51,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	28, -30, 24, 26, -26, -26, -26, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	31, 25, 1, -49, -49, 58, -48, 32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-65, 8, -16, 11, -13, 50, 12, 14,
+	42, -17, -16, 40, -13, -13, -12, -10,
+	41, 48, 49, 23, -55, -1, -54, -52,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-6, -12, 30, -8, 17, -8, -7, -5,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, 76, -18, -18, 36, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -33, 21, 48, 24, -29, 24, -27,
+	4, 29, 0, 3, -13, -13, 25, -35,
+	-12, -17, -16, -13, -13, -13, 41, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	4, -107, 41, -10, 108, -103, 13, 55,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-31, 116, -35, -32, -32, 75, -31, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	23, 77, -59, -57, 22, 50, -56, 0,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, 35, 76, -18, -18, -16,
+	-12, -17, -16, 40, -13, -13, -12, 43,
+	-12, -17, -16, 40, 40, -13, -12, -10,
+	-46, -51, 81, -48, 31, -47, 31, 50,
+	7, 48, 31, -73, 52, -19, -72, 25,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, 20, -33, 23, 49, 24, -29, -27,
+	-23, -28, -28, -25, -25, 29, 70, 31,
+	-15, -20, -19, 37, 62, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, 83, -11, -9,
+	15, 10, 11, -40, 14, 14, -39, 16,
+	32, -26, -26, 30, 55, -22, -22, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	19, -39, -38, 18, -35, 18, -35, 92,
+	-90, 36, 12, 14, 46, 15, -38, 5,
+	78, -22, -21, -19, -18, -18, 36, -16,
+	7, -52, 2, 30, 46, 6, 6, -45,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, 13, -7, -2, -15, 17, -3, 7,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-18, -23, -22, 58, 59, -19, -19, -17,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	11, 1, 19, -5, 9, 8, -6, -36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	21, -22, -10, -19, -2, 39, 7, -16,
+	23, -35, 60, -32, -31, -31, 22, 24,
+	42, -17, 37, -13, -13, -13, -12, -10,
+	67, -32, 106, -29, -29, -28, -28, -26,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	-12, -17, -16, -13, 40, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, 37, -16, -13, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 59, -17, 37, -16, -16, -14,
+	-12, -17, -16, -13, 40, 41, -12, -10,
+	-22, 2, -51, 5, 23, -6, 16, 33,
+	40, 10, -43, -40, 13, -40, -39, 100,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	71, -28, -28, -25, -25, 29, -24, 31,
+	-13, 98, -17, -15, -14, -14, -14, -12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	37, 40, -30, -81, -27, 72, 14, -25,
+	-21, -26, -26, 30, 55, -22, 31, -20,
+	-37, -42, 83, -39, 68, -38, 40, -36,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	-15, -20, -19, -17, -16, 115, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-43, -48, 59, 49, 8, -44, 62, -42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-47, 42, -52, -49, 46, 76, -48, 32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-32, -37, 41, 44, -34, -33, 83, -31,
+	53, -30, -30, -27, -27, 111, -26, -24,
+	35, 30, -23, -20, -20, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -40, 14, -37, 17, 17, 42, -33,
+	19, 49, 5, -21, -21, -21, -20, 10,
+	72, -27, 68, -24, -23, -23, -23, -21,
+	14, 5, 1, -20, 23, -90, 13, 53,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	-18, 30, -23, -20, 34, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	71, 25, -28, -25, -25, 29, -24, -22,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	27, -31, 23, -28, -28, -27, -27, 91,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, 38, -40, -37, -37, 58, -36, 90,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	10, 21, 75, -17, 37, -69, -69, 11,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 61, -16, -16, 38, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-37, -42, 36, 39, -39, 40, -38, 42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-3, -8, -32, 13, -5, -11, 29, 18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-18, -23, -23, 33, 34, -19, 34, -17,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-23, -28, -28, 81, -25, -25, 70, -22,
+	26, -26, -50, -6, 24, -22, -46, 99,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, -38, -21, 3, 25, -18, 20, -3,
+	-12, -17, -16, 93, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, -41, -40, -37, 16, 17, 17, 103,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	-1, -15, 2, -3, 7, 10, 1, 0,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, 39, 0, 64, 1, -52, -50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, 27, 28, -48, -47, 31, -47, 8,
+	77, -35, 109, -31, -31, -31, -30, -28,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, -30, -29, 52, 52, -26, 28, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	50, -33, -33, -30, -29, 24, 24, 26,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	2, 27, -3, -16, 13, 31, -40, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, -26, 27, -23, 55, 31, -22, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, -23, -20, 34, 34, -19, -17,
+	52, -113, 57, 72, 79, -109, 69, -107,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 30, 33, -20, 34, -19, -17,
+	25, 45, 21, -30, -29, 24, -29, -27,
+	-17, -22, 32, 76, -18, -18, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, -26, -26, 30, 55, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	97, 56, -50, -48, -47, 84, -47, -45,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, 31, 73, -19, -18, -18, -18, -16,
+	-33, 40, 16, 18, -35, 60, -34, -32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 34, -17, -16, 62, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	18, 24, 76, 40, -115, -37, 28, -34,
+	43, 13, 14, -37, 17, -36, -36, 20,
+	-5, -1, 5, 0, 0, -8, 1, 8,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-66, 53, 45, -15, -68, 27, 11, 13,
+	63, -20, -19, -17, -16, 37, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 40, 41, -12, -10,
+	29, 48, -29, -26, -26, 52, -25, -23,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-44, 4, 29, 7, 32, 8, -45, 10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	38, -8, -61, -5, -4, 21, -4, 23,
+	22, -61, -7, 20, 37, -57, 49, -2,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-11, -30, 52, 32, 32, -21, -31, -23,
+	-15, -20, 34, -17, -16, -16, 62, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, 52, 27, -23, -23, -22, -22, -20,
+	-15, -20, -19, -17, -16, -16, 116, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-29, -34, 73, 107, -30, -30, -30, -28,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	15, 51, -43, -40, -40, 55, -39, 41,
+	-22, -27, 68, 71, -23, -23, -23, -21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-15, -20, -19, 37, -16, -16, 62, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, 72, -21, -19, -18, 35, -18, -16,
+	-46, 44, 3, 6, -47, -47, 7, 80,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, 24, -38, -8, 7, 1, -3, 16,
+	39, -20, -19, -17, -16, 62, -16, -14,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-27, 92, -32, -29, 25, -28, -28, 27,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-76, 14, -27, 74, 1, 1, 87, -74,
+	-16, -21, -45, 56, 42, 11, 12, -39,
+	-20, -25, 12, -22, 45, 4, 36, -31,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	61, -38, 40, -35, 19, -34, -34, 21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	127, 112, -76, -73, -73, 118, -72, -70,
+	-28, 73, -33, -30, -29, 24, -29, 51,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	0, -15, -27, 24, -12, -1, 30, 1,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -33, -33, 77, 24, -29, 49, -27,
+	-31, -36, 18, 20, -33, 46, -32, 48,
+	28, 39, -55, -52, -52, 43, 2, 45,
+	41, -88, 97, -32, 47, -6, -31, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-25, -30, 24, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 34, -17, -16, -16, 62, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	95, -17, -16, -13, -13, -13, -12, -10,
+	1, -57, -4, 52, 41, -53, 71, -51,
+	-12, -17, 37, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	84, 1, -52, -49, -49, 5, 30, 32,
+	9, 28, -49, -46, -46, 32, 61, 10,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-14, -19, 39, 78, -16, -56, 43, -54,
+	27, 12, -31, -38, 36, 4, -27, 18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, 48, -29, 52, -26, -26, 28, -23,
+	8, -28, -3, 59, 32, 7, -77, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	53, -46, 7, 10, -43, -42, -42, 103,
+	-14, -19, -18, -16, -15, -15, -15, 112,
+	-18, 30, -23, -20, -20, 34, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-43, -48, -47, 8, 34, -44, 88, 53,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	0, -5, 12, 15, -1, 28, -25, -23,
+	47, -17, 5, -13, 8, -35, 14, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	25, 10, -12, -15, 8, -28, -9, 21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 33, -19, -17, 62, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 19, 23, 22, -21, -25, 34, -39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, 43, -34, -31, -31, 64, -30, -28,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-32, 17, 17, 20, 20, -33, 21, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	30, 25, -28, 69, -25, -25, -24, -22,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	42, 102, -40, -38, -37, 41, -37, -34,
+	-36, 12, 54, -38, -38, -37, -37, 121,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-4, -62, -9, 65, 36, -59, 36, -3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 83, -23, -20, -20, -19, -19, 36,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-48, 25, 1, 3, 57, -49, 4, 6,
+	12, 7, 7, 35, -43, 11, 11, -40,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-43, -48, -48, 49, 50, -44, 72, 11,
+	-15, 33, -19, -17, -16, -16, -16, 65,
+	-26, 63, 22, -28, 50, -28, -27, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, 27, -26, 30, 55, -22, -22, -20,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-10, -15, -15, -12, -12, 83, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	-15, 33, -19, -17, -16, 62, -16, -14,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	17, 24, -29, 15, 52, -1, -79, 1,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	22, -37, 17, 20, -33, 21, 21, -30,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-15, 33, -19, -17, -16, 62, -16, -14,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	53, 58, -58, -55, -55, 70, -54, 42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, -40, -39, 70, -36, 17, 42, 20,
+	-12, -17, -16, 40, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -2, 0, 26, 1, 26, -50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 30, 33, 34, -19, -19, -17,
+	40, -18, 42, 23, -14, -39, -39, 5,
+	-19, -25, -24, 95, -21, -21, 33, -18,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	10, -48, 5, 8, 62, -44, -44, 52,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, -19, -18, -16, -15, -15, -15, 112,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	42, -17, -16, -13, -13, -13, 41, -10,
+	-15, -2, -19, 1, -16, 25, 21, 4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-9, -14, -13, 31, 31, -63, 44, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	77, 71, -52, -50, -49, 99, -49, -47,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	-19, 29, -24, -21, -21, -21, -20, 98,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	33, -26, -25, 102, -22, -22, -21, -19,
+	-15, -20, 59, -17, -16, -16, 38, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -40, 14, 70, -36, 42, -36, -33,
+	22, 42, 42, -33, -33, -32, -32, 23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-33, -38, 41, 36, -34, -9, 44, -7,
+	9, 4, 4, -46, -46, 32, 33, 10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, 2, 27, -48, -48, 6, 6, 8,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-12, -17, -16, 40, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	22, 33, -61, -5, -58, -4, 21, 51,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-55, -60, 65, -3, 87, 22, -56, 0,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-48, 41, 53, 44, 3, -50, 4, -47,
+	65, 38, -3, -53, 54, -52, -52, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-28, 20, -33, 48, 24, -29, 24, -27,
+	5, 28, -31, -28, 9, 28, -47, 36,
+	-19, 29, -24, -21, -21, -21, -20, 98,
+	-32, -38, 94, -34, 109, -34, -33, -31,
+	-27, 38, -2, 2, -29, 40, -26, 5,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	9, -37, 41, 19, -9, -9, -8, -6,
+	102, -46, 33, 74, -42, -42, -41, -39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	43, -40, -118, 93, 123, -114, 124, -112,
+	-12, -17, -16, -13, -13, -13, -12, 96,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	3, -27, 14, -24, -23, 30, 48, -21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 112, -17, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-43, -48, 31, 103, -44, -44, 9, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	79, 92, -32, -29, -29, -28, -28, -26,
+	40, 35, 11, -40, -39, 68, -39, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-55, 11, 18, 32, -4, -15, 15, -1,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-15, -20, -19, -17, 62, -16, 38, -14,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, -19, -18, 76, -18, 38,
+	-18, 55, -22, 58, -19, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	22, -24, 18, -74, 33, 21, 21, -18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, -13, -13, 41, 43,
+	77, 18, -35, -32, -31, -31, -31, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-16, 20, 20, 7, 23, -71, 8, 10,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, 100, -31, -28, -28, 67, -27, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, 41, -12, -10,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	15, 27, 49, 14, -64, -10, -63, 33,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	78, -22, -21, -19, 35, -18, -18, -16,
+	22, 17, 17, -33, -33, 21, -32, 23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	35, 30, -23, -20, -20, 34, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	60, -23, -22, -20, 59, -19, -19, -17,
+	51, -48, 5, 8, 8, 9, 9, -42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, -26, -26, 30, 30, -22, 56, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, -20, -20, 34, -19, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 59, -17, 37, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 90, -13, -13, -13, -12, -10,
+	5, -41, 1, 3, 34, -12, 4, 6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-49, 83, -54, 96, -51, -51, 74, -48,
+	80, 37, -40, 15, -37, 16, -37, -35,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	75, -46, -46, 51, -42, 11, -42, 38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	13, -3, -23, -20, 33, 20, -29, 9,
+	-30, 63, 18, -86, -7, 31, 40, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	25, -33, 21, -30, 49, -29, 24, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	14, 21, 9, -29, -82, 111, -81, 37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, -26, 52, -23, -23, 31, -22, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	10, 5, -48, 8, 8, 9, 50, -42,
+	44, -39, -39, -36, 42, -35, 43, 20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, 28, -24, 32, -75, 32, 4, 22,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	70, 36, -41, -39, -38, 86, -38, -36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-89, 20, 59, 55, 1, -127, 42, 80,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	106, 72, -65, -9, -62, 76, -61, -59,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	97, 29, -24, -21, -21, -21, -20, -18,
+	51, -48, 59, 33, 34, -44, -44, -42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-33, 15, 79, -35, 19, 19, -34, -32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 33, -19, -17, -16, -16, 62, -14,
+	-12, -17, -16, -13, 40, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-100, 93, 48, 46, 30, 82, -101, -98,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 61, 37, -16, -16, -14,
+	-12, -17, -16, 40, -13, 41, -12, -10,
+	-15, -20, 34, -17, -16, -16, -16, 65,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-39, 71, -22, -19, 31, 13, -18, -16,
+	2, 50, 67, -25, 59, 0, -77, -75,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	17, 33, -82, -2, 45, 37, 28, -77,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-14, -19, -18, -16, -15, -15, 110, -13,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-30, 18, -35, 62, -31, 22, 22, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	66, -33, 110, -30, -29, -29, -29, -27,
+	-17, -22, 32, -19, -18, 76, -18, -16,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	70, -42, 12, -39, -38, 56, -38, 18,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, -40, -40, 127, -36, -36, 80, -34,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	59, -40, 55, -37, -37, -36, -36, 73,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	39, -20, 59, -17, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	22, 63, 17, 20, -58, -58, -4, -2,
+	25, 13, 78, -14, -54, 9, -29, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 83, -23, -20, -20, 34, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-47, 1, 26, 29, -49, 58, 30, -46,
+	26, -32, -32, -29, -29, 96, -28, 27,
+	58, -25, -24, -22, 73, -21, -21, -19,
+	-12, -17, -16, -13, 93, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	40, 57, -59, -56, 22, 51, -55, 0,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-12, -17, -16, -13, -13, -13, 94, -10,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, 27, 27, -23, -23, 56, -22, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-44, -49, -49, 102, -45, -45, 79, 51,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	-17, -22, -21, -19, 35, 76, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, -19, 106, -16, -15, -15, -15, -13,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -65, -64, 55, 33, -7, 18, -5,
+	-35, 13, 14, 41, 17, 17, -36, -33,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, -13, -13, -12, 43,
+	39, -20, -19, 61, -16, -16, -16, -14,
+	79, 90, -101, -98, -97, 111, -97, 113,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	57, -26, 27, -23, -23, -22, -22, 33,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	23, 59, -35, -32, -31, 22, 22, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-40, -45, 34, -42, -41, 83, 12, 39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	0, 14, 2, -4, -10, 21, -7, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	5, -117, 36, 11, 43, -18, 35, 6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-30, -35, 19, 21, 22, -31, 63, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	49, -50, -49, -47, 32, 48, 7, 10,
+	-12, -17, 37, -13, -13, -13, -12, 43,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	43, -87, -8, 23, 11, 12, 34, -27,
+	-12, -17, 37, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, -11, -11, 85,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-22, 67, -26, 71, -23, -23, -23, -21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-4, 32, -62, 19, 57, -59, 20, -3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-30, 71, -35, -32, 22, 63, -31, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	24, 19, 20, -2, 23, -55, 23, -53,
+	-25, -30, 24, -27, -26, -26, 27, 83,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, -19, -18, -16, 109, -15, -15, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 55, -22, -20, -19, 59, -19, -17,
+	4, 15, -1, 2, 2, -22, -22, 21,
+	-33, 15, 57, -35, 19, 44, -34, -32,
+	39, -20, -19, 61, -16, -16, -16, -14,
+	-43, -48, 31, 33, 9, -44, 51, 12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-24, -30, 24, -26, 52, -26, 53, -23,
+	-15, -20, 59, 37, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	127, -58, -4, -2, -54, -1, 0, -52,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-56, 37, 10, -17, 13, -33, 6, 39,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	63, 33, -19, -17, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-43, 33, 17, 14, 25, -28, 9, -26,
+	-6, 26, -14, -12, 12, 26, -23, -11,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-36, 66, 38, -38, -37, -37, -37, 82,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, -23, 33, 34, -19, 34, -17,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	-10, -15, -15, -12, -12, -11, 83, -9,
+	-12, -17, 37, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 30, 33, 34, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	47, 42, 18, -33, -33, 21, -32, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	35, -87, 57, 33, 48, -29, 24, -80,
+	7, 2, -7, 13, 5, -4, 14, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-40, -45, -44, 36, 65, 12, 54, -39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	23, 11, 34, -4, -4, -15, 63, -107,
+	-14, -19, -18, -16, 109, -15, -15, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -33, -33, 48, 24, 24, 24, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-56, 105, 17, -58, 37, 67, -57, -55,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	63, -20, 34, -17, -16, -16, -16, -14,
+	29, 48, -29, -26, -26, -26, -25, 55,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-13, -18, -17, -15, -14, -14, 103, -12,
+	66, -34, -33, -30, -30, 24, 65, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, 40, -13, -13, -12, -10,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	32, -26, -26, -23, 55, 31, -22, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -57, 38, 0, 0, 25, 42, -50,
+	28, -30, -29, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-12, -17, -16, -13, 40, 41, -12, -10,
+	-26, -31, -6, -3, 26, -27, 14, 53,
+	-42, 7, -46, 35, -43, 95, 36, -40,
+	-15, -20, -19, -17, 62, -16, 38, -14,
+	-10, -15, -15, -12, -12, -11, 83, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	50, 20, 21, -30, -29, 24, -29, -27,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-21, -26, -26, 30, 30, -22, 56, -20,
+	70, -42, 83, -39, -38, 40, -38, -36,
+	59, -83, -29, 45, 105, -79, 59, -77,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, 46, 22, -28, -28, -28, -27, 69,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -34, -33, 64, 23, -30, 65, -27,
+	58, 11, -41, 68, 15, -38, -38, -36,
+	50, 17, -7, -58, 37, -4, -57, 23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, -26, 27, -23, 55, -22, -22, 33,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	52, -32, -31, -28, 25, -28, 67, -25,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	-23, -28, 25, 69, 28, -25, -24, -22,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	55, 33, -37, 22, 7, -63, -16, -1,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-23, 66, 25, -25, -25, -25, -24, 31,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-41, 7, -46, 10, 64, 11, -42, 38,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	-27, 66, -7, -29, -82, 56, 25, -1,
+	-41, 7, -45, 35, 11, -42, 36, 38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-23, 66, -28, -25, 28, 29, -24, -22,
+	-20, -25, -24, -22, 73, 57, -21, -19,
+	-23, -28, -28, 81, -25, -25, 70, -22,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, -20, 34, 34, -19, -17,
+	21, -16, 13, 11, -10, -37, 30, -13,
+	-18, -23, 56, 58, -19, -19, -19, -17,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	7, -66, 28, 15, 30, -21, 23, -16,
+	16, -43, -42, 38, 39, -39, 68, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	39, -20, -19, -17, -16, -16, -16, 65,
+	-58, 15, 32, 56, -59, -59, 36, 38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, 26, -51, -49, 89, 30, -48, -46,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-21, 0, 5, -2, -23, 13, 17, 11,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	46, -44, 35, 38, 54, -93, 55, -91,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-12, 37, 37, -13, -13, -13, -12, -10,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	-12, -17, -16, 40, 40, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 84, -20, -20, -19, -19, 36,
+	-17, 72, -21, -19, -18, 35, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-46, -51, -51, 68, 83, -48, 90, -45,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	95, -17, -16, -13, -13, -13, -12, -10,
+	42, -17, -16, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	39, -20, 59, -17, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	44, -39, -39, 42, -36, 18, -35, 45,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	52, -47, 7, -44, -43, 35, -43, 83,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-85, 26, -11, 7, -8, 38, -8, 41,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	35, -23, -23, 33, -20, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-48, 0, 1, 3, 4, 29, 4, 6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-34, -39, -39, 42, 18, -35, 43, 45,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-34, 40, -22, -11, -24, 33, 9, 8,
+	-29, -34, -34, 93, -31, -31, 94, -28,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 30, 33, -20, 34, -19, -17,
+	-62, -14, -67, 60, 31, -10, 68, -8,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-28, 45, -33, 23, 24, -29, -29, 26,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-21, -26, 52, 30, -23, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-46, 27, -51, 5, 31, 31, 47, -45,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	7, 96, 27, -48, 5, -48, -47, 8,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, 30, -23, -20, -20, 34, -19, -17,
+	-12, -17, 37, -13, -13, -13, 41, -10,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	35, -23, 30, -20, -20, 34, -19, -17,
+	-12, -17, -16, -13, -13, 94, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 112, -17, -16, -16, -16, -14,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, 30, -23, -20, 34, -19, -19, -17,
+	42, 37, -16, -13, -13, -13, -12, -10,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	27, 22, -15, 25, -11, 1, 1, -50,
+	-21, -26, -26, 55, -23, -22, 84, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-17, -22, -21, 76, 35, -18, -18, -16,
+	-18, 30, -23, 33, -20, -19, 34, -17,
+	-40, -45, 9, 65, 53, -41, 37, -39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 34, -17, -16, -16, -16, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -33, 21, -30, 49, 24, -29, 26,
+	-25, -30, 24, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	10, 46, -47, 33, -44, 34, 9, -42,
+	-26, 22, -5, 26, 36, -27, -27, 0,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	81, -85, 10, 10, -35, 1, 8, 10,
+	48, -73, 6, 55, -16, -69, 38, 11,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-38, -43, 11, 66, 14, -39, 67, -37,
+	-10, -15, -15, -12, 83, -11, -11, -9,
+	-35, -40, 14, 17, 42, -36, 18, 20,
+	-25, -30, 24, 26, 27, -26, 27, -24,
+	-21, 40, 16, 34, 23, -22, -50, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, -31, 94, -28, -27, -27, 68, -24,
+	-23, 25, 66, -25, -25, -25, 29, -22,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-33, 56, -38, -35, 19, -34, 19, 46,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, -26, 99, -22, -22, -22, 32, -19,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, -17, 62, -16, 38, -14,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-33, -92, 84, 84, 43, -88, 88, -85,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-72, -14, 13, 33, -48, 56, -1, 32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-29, 55, -9, -31, -6, -31, -30, 82,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, 18, 3, -19, 44, -19, 6, -16,
+	29, 26, 0, -26, 3, 10, -13, -30,
+	-21, -26, -26, -23, -23, 56, -22, 86,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	63, -20, -19, -17, -16, -16, -16, 40,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-58, -10, 16, -6, 47, -6, -5, 21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-1, -6, 84, -3, -3, 39, -55, -53,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, 30, -23, -20, -20, -19, -19, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	65, 47, -46, -44, -43, 10, -43, 54,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-31, -36, -36, 83, -33, -32, 62, 23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, 37, -13, -13, -13, -12, -10,
+	-7, 35, -11, 45, -8, 9, -32, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, -19, 35, -18, -18, 79,
+	-65, 47, 25, -13, -13, -66, -12, 96,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	9, -50, 29, 7, 7, -46, 33, 10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-46, 43, -51, -48, 5, 6, -47, 127,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	54, 48, -29, -26, -26, -26, -25, 30,
+	36, -125, -18, 45, 73, -68, 43, 13,
+	54, 48, -29, -26, -26, -26, -25, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-51, 22, 22, 0, 1, 1, 1, 3,
+	-45, 67, 4, -46, 7, 49, 8, -43,
+	-50, 108, -55, 1, 1, 43, -51, 4,
+	26, -73, 59, 37, 9, -69, 25, -14,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 58, -19, 37, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	20, -38, 16, 43, 60, -34, -34, -32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-53, -5, 37, -2, -1, -1, -1, 26,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, -30, 24, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	43, 21, 3, -24, -24, 6, -40, 16,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, -30, 24, 26, -26, 27, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 55, -22, -20, -19, 59, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, 28, -25, -22, -22, -22, -21, 105,
+	-30, 18, 19, -32, -31, 22, -31, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, -40, 67, -37, 17, 17, 42, -33,
+	-43, -48, 6, 9, 80, -44, 81, -41,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, 48, -29, -26, -26, 28, -25, 55,
+	-20, 69, -24, -22, -21, -21, -21, 59,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, -23, -20, 87, -19, 34, -17,
+	-38, 10, -43, 13, 67, 14, 14, -37,
+	-33, -38, 69, -35, -34, 82, -34, 22,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, 38, 14, 17, -36, -36, 18, -33,
+	62, -60, -59, -57, -56, 60, 39, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	9, -68, 4, 20, 20, -1, 53, -37,
+	10, -8, 12, -15, -27, -4, -3, 36,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	66, 84, 15, -60, -60, -60, -59, 74,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-70, 77, -74, 23, 53, 23, 36, -69,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-21, -26, -26, 30, -23, 31, -22, 58,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, -23, -20, -20, 34, -19, 36,
+	66, -3, -81, 0, 0, 54, -77, 41,
+	-21, 27, -26, -23, 55, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	7, -13, 20, 11, 15, -10, -35, 4,
+	63, -20, -19, 37, -16, -16, -16, -14,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 34, -17, -16, -16, 62, -14,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-23, 66, -28, -25, -25, 29, 29, -22,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-20, 53, -24, -22, 73, -21, -21, -19,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, -11, -11, 85,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-26, -32, 47, -28, 25, -28, 67, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-38, 35, 64, -40, 14, -39, 39, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, 45, -33, -30, 24, -29, 24, 26,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	37, -22, 73, -19, -18, -18, -18, -16,
+	3, -56, -55, 42, 104, -52, 65, -50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	111, -19, -18, -16, -15, -15, -15, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	31, -48, 38, 73, 33, 9, -122, -13,
+	58, -42, 12, 15, 15, -38, 16, -36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	94, -28, -27, -24, -24, -24, 55, -21,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-39, -45, 72, -41, 66, -41, 66, -38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	54, -30, 24, -26, 52, -26, -25, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	15, -50, 4, 13, 18, -8, 14, -5,
+	-35, -40, -40, 127, -36, -36, 80, -34,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	25, 45, 21, -30, 24, -29, -29, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	115, 64, -42, -39, -39, 15, -38, -36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	5, -53, 1, 3, 4, 4, 29, 6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 58, 34, -17, -16, -16, -16, -14,
+	14, -3, 4, -7, -24, 12, 1, 3,
+	54, 48, -29, -26, -26, -26, -25, 30,
+	-25, 23, -29, 26, 27, 27, -26, -24,
+	28, -30, 24, -27, 27, -26, 27, -24,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	29, 48, -29, -26, 52, -26, -25, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-31, -36, 81, -33, 111, -32, -32, -29,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	16, -42, 36, 50, 45, -92, 75, -89,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	39, -20, -19, -17, -16, -16, -16, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	89, -32, -32, -29, -29, -28, -28, 90,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	28, -30, -29, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	14, -70, 25, 28, 12, -12, -12, 15,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-3, 40, 45, -21, -5, 8, -45, -18,
+	35, 14, 14, -8, -7, 18, -60, -5,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	13, 28, -1, -46, 2, 12, -23, 14,
+	-17, -30, 39, 26, -5, -11, 33, -34,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-44, 4, -49, 7, 61, 32, -45, 35,
+	-32, 123, -36, -33, -33, 21, -32, 23,
+	24, -59, 20, 22, -2, 23, 23, -53,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, -19, -18, -16, -15, -15, 110, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	5, 27, -10, -2, 8, -27, 9, -10,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	36, 52, 39, -82, 42, -82, -3, -1,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	22, -37, 17, 20, 20, -33, 21, -30,
+	-12, 90, -16, -13, -13, -13, -12, -10,
+	-13, 28, -1, -39, 14, -14, 60, -36,
+	-7, -2, -10, -1, 4, -10, 25, 3,
+	15, 10, 49, -11, 73, -64, -64, -8,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	20, 18, 54, -32, -4, 4, -31, -29,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-28, 20, -33, 48, 24, -29, 24, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, -17, 37, -16, 62, -14,
+	-20, -25, -24, -22, -21, 73, -21, 59,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -95, 0, 64, 46, 25, 61, -89,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-29, -34, -33, -31, 76, -30, 108, -28,
+	-12, 37, -16, -13, -13, -13, 41, -10,
+	15, 26, 10, -65, -11, -64, 73, 16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, -30, -29, 27, 52, -26, 53, -23,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	27, -56, -56, 25, 1, 1, 1, 57,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-9, 9, -7, -1, 24, -29, -14, 28,
+	-28, 61, -33, 23, -30, -30, -29, 67,
+	-26, 22, -31, -28, 50, -28, -27, 69,
+	-12, -17, 37, -13, -13, -13, 41, -10,
+	-52, 50, 22, 41, 0, 42, -52, -50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, 43, -19, -16, 25, -16, 10, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-10, -15, -15, -12, -12, -11, 83, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	30, -28, 66, -25, -25, -25, -24, 31,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-43, 58, -48, -45, 8, 50, -44, 64,
+	-15, -20, 34, -17, -16, 62, -16, -14,
+	-30, -35, -34, 47, 47, -31, 64, -28,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, 30, -20, 34, -19, -19, -17,
+	-15, -20, -19, 61, -16, -16, -16, 40,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-55, -6, -6, -3, -3, 51, -2, 25,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-17, -22, 32, -19, 76, -18, -18, -16,
+	54, -30, 49, -26, -26, -26, 28, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-93, 33, 59, 0, 12, -94, 23, 60,
+	8, 100, -50, 22, -125, 102, -124, 67,
+	-28, -33, 45, 23, 24, -29, 24, -27,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, -19, -18, -18, -18, 127,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	16, 10, -42, 38, -39, 14, -39, 41,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	8, 3, 4, 6, -46, 7, 8, 10,
+	27, 22, -56, 0, 1, 1, 1, 3,
+	-59, -64, 31, 34, 18, -60, 19, 80,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	15, 10, 11, -40, 14, -39, 14, 16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-30, -35, -35, 21, 93, -31, 47, -29,
+	33, -25, -8, 25, -46, 7, 57, -43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-41, 7, 7, 35, -43, 11, 11, 13,
+	57, -26, 27, -23, -23, 31, -22, -20,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	-5, -31, 13, 19, 19, -37, 20, 2,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	-12, -17, -16, 40, -13, -13, -12, 43,
+	-25, 76, -29, -27, -26, 27, -26, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	35, -23, 30, -20, -20, -19, -19, 36,
+	-46, 43, -51, -48, 5, -48, 6, 127,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	30, -28, -81, 85, 59, -78, 89, -75,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	5, -85, 41, 31, 47, -53, 39, -26,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -56, 47, 31, 18, 1, 19, -50,
+	-31, -36, 71, 45, -33, -32, 46, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	44, -55, 23, 42, -52, -51, 43, 4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	95, -17, -16, -13, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 19, 3, -6, -5, 14, -23, 1,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	13, -45, 34, 65, -41, -41, 54, -39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 61, 37, -16, -16, -14,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	7, 100, 15, -89, -35, 43, 43, -86,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	-56, -61, 18, 37, 59, 37, 21, -55,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	4, -26, -25, 31, 68, -75, 42, -19,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, 24, -29, -26, -26, 52, -25, 55,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	36, 31, 53, -82, 35, 35, -81, -26,
+	-25, 23, 24, 26, 27, -26, -26, -24,
+	-12, -17, -16, -13, -13, -13, 41, 43,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-53, 20, -4, -1, -54, 24, 24, 43,
+	-12, -17, -16, 40, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-22, -48, 18, 31, 26, -54, 41, 8,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	42, -17, 37, -13, -13, -13, -12, -10,
+	23, -35, -35, 62, 22, -31, 22, -29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	13, -34, -8, -6, 33, 33, -5, -27,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, -26, -26, -23, 55, -22, -22, 33,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	58, 75, -41, -38, -38, 57, -37, -35,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, -13, -13, 41, -10,
+	-28, 20, -33, 48, -29, 24, -29, 26,
+	4, 6, -30, -27, -5, 59, -5, -2,
+	55, -28, -27, -24, -24, -24, -23, 95,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-36, 12, 38, 15, -37, 79, -37, -35,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 61, -16, -16, 38, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	45, 24, 24, -51, 27, -50, -50, 30,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	55, 33, -44, -42, -41, 66, 13, -39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, 45, 46, -29, 49, -29, -28, -26,
+	47, -36, 18, -33, -33, 46, 21, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	10, -48, 5, 8, 8, 50, 9, -42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-27, -85, 79, 74, 43, -81, 75, -79,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	22, -37, 17, -33, 20, 21, -32, 23,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-18, -23, -23, -20, -20, -19, 87, 36,
+	10, 76, -48, -45, -45, 9, 34, 11,
+	86, 12, -66, -63, -10, 32, -9, 18,
+	-12, -17, 37, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 56, -20, -19, -19, -19, 61,
+	-19, -25, 29, -21, -21, -21, 96, -18,
+	23, -23, 2, 43, 22, -19, 22, -70,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, 22, -31, 50, -28, -28, 67, -25,
+	36, 31, -63, -7, 72, 47, -59, -57,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	26, -32, -32, 24, 96, -28, -28, -26,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	34, 97, -33, -31, -84, 33, -30, 13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-34, -39, 86, -36, 71, -35, 19, -33,
+	-25, 23, -29, -27, 27, 27, -26, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, 33, -20, -19, -19, 36,
+	-15, 33, -19, -17, -16, -16, -16, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	28, -30, 24, 26, -26, 27, -26, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-23, -28, -27, -24, 54, 93, -23, -21,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 58, -73, -17, -70, 68, -16, 64,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-12, 37, -16, -13, -13, -13, 41, -10,
+	-23, -28, 66, -25, 28, 29, -24, -22,
+	-10, -15, -15, 82, -12, -11, -11, -9,
+	31, 1, 1, 29, 29, -49, -48, 7,
+	-15, -20, -19, 37, -16, 62, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, 22, 47, -28, -28, 67, -27, -25,
+	-18, -23, -22, 58, -19, -19, 59, -17,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-54, 47, -6, 38, -56, 23, -55, 63,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	7, 26, -51, 5, -48, 6, 6, 49,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 40, -13, 41, -10,
+	-66, 35, 24, -15, 11, -14, 11, 13,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-14, 105, -18, -16, -15, -15, -15, -13,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 37, -16, -16, 62, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-22, 67, -26, -24, -23, -23, -23, 74,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	60, -39, 39, -36, -36, 81, -35, -33,
+	12, 7, -46, -43, -43, 11, 36, 66,
+	61, 14, -14, -36, 36, 6, -35, -33,
+	-21, 27, 52, -23, -23, 31, -22, -20,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	1, 21, 6, 17, 0, 18, -12, -51,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	78, -22, -21, 35, -18, -18, -18, -16,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	-15, -20, -19, -17, 62, 37, -16, -14,
+	-17, 31, -21, -19, -18, -18, 77, -16,
+	-40, -46, -45, 11, 82, -42, 65, 14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-36, 90, -41, -38, -38, -37, 41, 59,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-7, 54, -40, -9, 32, 28, 2, -59,
+	-18, 83, -23, -20, -20, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	88, -102, 91, -21, -20, 26, -20, -42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 61, 37, -16, -16, -14,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	33, -26, 99, -22, -22, -22, -21, -19,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, -23, -20, -20, 34, -19, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-34, 2, -39, 62, 35, -11, 71, -86,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 30, 33, -20, -19, 34, -17,
+	-31, -36, -36, 45, 45, -32, 21, 23,
+	64, -35, -35, 21, 22, -31, -31, 24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 93, -13, -12, -10,
+	-113, 45, -24, 22, 1, 28, 28, 12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-19, -25, -24, 32, 95, -21, -20, -18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-38, -43, 11, 38, 39, 14, 15, -37,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-17, 72, -21, -19, -18, 35, -18, -16,
+	39, -20, -19, -17, -16, -16, -16, 65,
+	-18, 55, -22, -20, -19, -19, -19, 61,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	61, 71, -7, -57, -57, 22, -56, 24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	52, 22, -31, -28, -28, -28, 67, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-37, -42, -41, 15, 15, 56, 16, 18,
+	57, -26, -26, -23, 30, 31, -22, -20,
+	-21, -26, 27, 55, -23, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -52, -16, 11, 25, -18, 9, 22,
+	9, 42, -20, -17, 8, -17, -16, 11,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-72, 19, 7, 6, -28, 40, 0, 28,
+	-22, 51, -51, 23, 36, -23, 6, -21,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	60, -23, -22, -20, -19, 59, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, -19, -18, 35, -18, 79,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-44, 4, 4, 32, 7, 8, 33, -43,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	28, -30, -29, 26, 27, -26, -26, 30,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	94, 43, -35, -32, -32, 22, -31, -29,
+	-34, -39, 15, -36, 18, 89, -35, 21,
+	-12, -17, -16, 40, -13, 41, -12, -10,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-10, -15, -15, -12, -12, 83, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-37, 82, -42, -39, -39, 56, -38, 58,
+	-17, 31, 73, -19, -18, -18, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 55, 56, -20, -19, -19, -19, -17,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 33, -19, -17, -16, 62, -16, -14,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 40, -13, 41, -10,
+	65, 43, -34, -31, -31, 47, -30, -28,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	22, -36, 42, -33, -33, 21, 46, -30,
+	48, 38, -41, -32, -12, 19, -17, -2,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-28, 20, -33, 48, -29, -29, 24, 26,
+	-21, -26, -26, 30, 55, -22, -22, 33,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	23, -47, 39, -5, 35, -14, -43, 13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	-25, 65, -29, -26, -26, -26, -25, 93,
+	-25, -30, -30, 26, -27, -26, 127, -24,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	75, -67, 50, -64, -63, 61, 68, -61,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	10, 5, 63, -33, -33, 9, -32, 11,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-23, -28, -28, 81, -25, -25, 70, -22,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	15, 10, 11, -40, -40, 14, 14, 16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-55, 18, -7, -9, -14, 56, -13, 24,
+	22, 17, 17, 20, -33, -33, 21, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-45, 28, 4, -47, 48, 7, -46, 51,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	78, -58, -58, -2, 70, -1, -54, 26,
+	22, -36, 42, 20, -33, 46, -32, -30,
+	-21, -26, -1, 2, -23, 49, 41, -20,
+	15, -43, 11, 13, 14, 14, 14, -37,
+	-12, -17, -16, -13, -13, 94, -12, -10,
+	28, -30, -29, 26, 27, 27, -26, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-30, -35, 7, -32, -7, -6, 47, 55,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	37, 72, -21, -19, -18, -18, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, -19, -18, -18, 77, 38,
+	-33, -38, 16, 18, 43, -34, 60, -32,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	15, 10, 64, 13, -40, 14, -39, -37,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	85, -68, -14, -11, -11, -11, 14, 16,
+	20, -3, 66, 10, 61, -105, 1, -50,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	39, -20, -19, -17, -16, -16, -16, 65,
+	39, -20, -19, -17, 62, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, -16, -13, -13, -13, -12, 43,
+	127, -14, -13, -11, 79, -63, -63, -61,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	21, 28, -25, -22, -22, 20, -21, 22,
+	20, 40, -38, -35, -35, 60, -34, 21,
+	-28, 73, 21, -30, -29, 49, -29, -27,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-36, 75, -40, 15, -37, 41, -37, 19,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	-17, -22, -21, -19, 35, 76, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	15, -31, -84, 50, 35, 14, 26, -25,
+	22, 42, -36, -33, -33, 46, -32, 23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	9, -49, 30, 7, 57, -45, 33, -43,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, 40, -13, -12, -10,
+	37, -22, -21, -19, 76, -18, -18, -16,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, -20, 34, -19, -19, 36,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	-10, -15, -15, -12, 83, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-75, -2, 27, 39, -77, 2, 18, 69,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	-12, 37, -16, -13, -13, -13, 41, -10,
+	39, 58, -19, -17, -16, -16, -16, -14,
+	-38, -43, 35, 13, 55, 55, -39, -37,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	-15, -20, -19, 37, -16, 62, -16, -14,
+	28, 23, -29, 26, 27, -26, -26, -24,
+	6, -52, 2, 4, 5, 5, 76, -46,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-21, 27, -26, 55, -23, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 83, -23, -20, -20, 34, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-79, 10, 11, 50, 36, -80, 51, 0,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, 13, 39, -37, 17, -36, 18, -33,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 58, -19, -17, 37, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, -19, -18, -18, 36, 79,
+	10, 5, 74, -38, 16, 1, -8, -60,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 58, -19, -17, 37, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-32, 58, -36, -34, -33, 62, -32, 48,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-3, 8, 9, -11, 25, -3, -1, -24,
+	76, -23, 2, -20, -20, 34, -72, 24,
+	108, 84, -93, -12, -37, 74, -36, -87,
+	2, 31, -31, 9, -20, 3, -10, 16,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-41, -47, 32, 45, 31, -4, 49, -65,
+	-21, 4, -3, -23, 21, 31, -38, 29,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-28, 20, 45, -30, -29, 77, -29, -27,
+	-36, -41, -40, -38, 16, 16, 41, 82,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, -30, -29, 26, 27, -26, 27, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, -17, -16, 37, -16, 65,
+	111, -19, -18, -16, -15, -15, -15, -13,
+	25, -33, -33, -30, 24, 49, 24, -27,
+	12, -46, -46, 10, -43, 11, 11, 91,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-56, 82, -60, -4, 21, -57, 50, 24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 112, -17, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, 39, -67, -11, 14, 67, -10, -62,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-27, -32, -32, 24, 96, -28, 25, -26,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	-14, 5, 22, 9, 25, -69, 10, 12,
+	-13, -18, 99, -15, -14, -14, -14, -12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, -26, -26, -23, -23, 31, -22, 58,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, 38, 54, -37, -37, 88, -36, -34,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-17, 72, -21, -19, -18, -18, -18, 38,
+	9, -50, 29, 32, 7, 8, 8, -43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, 127, -30, -28, -27, 26, -27, -25,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-12, -17, -16, 40, 40, -13, -12, -10,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	77, 9, 9, 12, -41, 13, -40, -38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-30, -35, 90, 46, 22, -31, -31, -29,
+	-15, 33, -19, 61, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, -23, -20, 34, 34, 34, -17,
+	32, 17, -89, 8, 38, 8, -8, -6,
+	22, 30, -28, 3, -50, 4, 13, 6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-31, 17, 42, 45, -33, -32, 21, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	47, -21, 21, 7, -17, 46, -16, -68,
+	20, -38, -38, 43, 19, -34, 60, -32,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	32, 37, -26, 71, 2, -75, 31, -73,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, 33, -20, -19, -19, 36,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -2, 11, -7, 20, 15, -16, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, -26, -26, 55, -23, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-53, 20, -4, 23, 24, 41, 0, -51,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	16, -43, 36, -40, 14, 39, 15, -37,
+	-1, -84, 54, 25, -3, 36, 51, -78,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	28, -30, 24, 26, -26, -26, 27, -24,
+	51, 45, -32, -29, -29, 49, -28, -26,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-60, 42, -64, 16, 33, -8, 46, -5,
+	-76, -28, -27, 97, 39, 1, 17, -22,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, 37, -16, -13, -13, -13, -12, -10,
+	-12, -17, 37, -13, -13, -13, -12, 43,
+	33, -26, -25, -22, -22, -22, -21, 105,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	57, -26, -26, 83, -23, -22, -22, -20,
+	-28, 20, 21, 23, -29, -29, 49, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	42, -17, -16, -13, -13, -13, -12, 43,
+	-32, 17, -36, 20, -33, -33, -32, 127,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 8, 1, 28, 31, -37, 13, -39,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-73, -25, -78, 62, 73, -21, 82, -19,
+	10, -48, -47, 50, 34, 9, 34, -42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, -26, -26, 55, 30, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-22, -27, -26, 71, -23, -23, 72, -21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	12, -46, 33, 11, 36, -42, 36, -40,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-50, 40, -1, -51, 27, 27, 3, 5,
+	-38, -43, -42, 14, 39, -39, 15, 95,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, 82, -12, -11, -11, -9,
+	-34, -39, 78, 17, -35, -35, 81, -33,
+	-21, -26, 27, -23, -23, -22, -22, 111,
+	64, 18, -35, -32, -31, 22, -31, 24,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 30, 33, -20, -19, 34, -17,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	95, -17, -16, -13, -13, -13, -12, -10,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-12, 37, -16, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, -13, -13, 41, -10,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	15, 56, -15, -12, 42, -11, -11, -62,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 61, -16, -16, 38, -14,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-38, -43, 11, 13, 14, 14, 14, 16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, 23, -29, -27, -26, 27, 27, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 34, -17, 62, -16, -16, -14,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	80, -41, 13, 15, -37, -37, 41, -35,
+	-20, -9, 14, 37, 17, -21, 25, -44,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-20, 40, 49, -47, -21, 25, 17, -44,
+	-41, 7, 33, 35, 36, -42, 12, -40,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	25, -33, 21, -30, 49, 24, -29, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-76, -3, 56, 28, 29, -24, 66, -75,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	35, 30, -23, 33, -20, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	8, -51, -50, 31, 31, -47, 70, 9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, -25, -24, 56, -21, -21, 74, -19,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	28, -55, 70, -52, 43, -51, 65, -49,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-18, 30, -23, -20, -20, 34, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	50, -33, -33, 23, 24, -29, 24, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, 30, -20, 34, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	15, -18, 11, 14, -14, -14, 2, 4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	47, -36, 18, 45, -33, -32, -32, 23,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-55, -6, -6, 21, 50, -3, -2, 0,
+	-65, 24, -16, 57, 11, -66, 12, 43,
+	-18, -23, 30, 86, -20, -19, -19, -17,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	4, -30, 30, -51, 71, -50, 49, -23,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-18, 30, -23, 33, -20, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, 37, -13, -13, -13, -12, -10,
+	-12, -17, 37, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-49, 62, 53, 27, -51, 3, 3, -48,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, 20, -57, -1, -54, 24, 0, 27,
+	26, -73, -19, 8, 9, 25, 38, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, -20, 34, 34, -19, -17,
+	-24, 24, -29, -26, -26, 52, -25, 55,
+	35, -23, 30, -20, -20, 34, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, -40, 14, -37, 58, 58, 17, -34,
+	-18, -23, -23, -20, 87, -19, 34, -17,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	37, -22, -21, 76, -18, -18, -18, -16,
+	42, -17, -16, -13, -13, -13, 41, -10,
+	39, -20, -19, -17, -16, 62, -16, -14,
+	28, -30, 24, -27, 27, -26, 27, -24,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	68, 80, 73, -127, -127, 95, -127, 85,
+	-37, 65, -41, -39, -38, 40, -38, 89,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-31, 95, -36, -33, -33, 99, -32, -30,
+	19, 27, 38, -72, 35, -9, 7, -45,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	-8, -38, 3, 18, 6, -10, 7, 21,
+	42, 37, -16, -13, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 83, -23, -20, -20, -19, -19, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, 99, -25, -22, -22, -22, -21, 34,
+	-17, -22, -21, -19, -18, -18, -18, 127,
+	-15, -20, -19, 61, -16, -16, -16, 40,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, 40, -13, -13, -12, -10,
+	25, 20, -33, 48, -29, -29, -29, 26,
+	-25, -30, 24, 26, -26, -26, 27, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-51, 22, 23, 26, 1, -52, 27, 4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	35, -23, -23, 33, 34, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	40, 35, 11, -40, -39, 14, -39, 17,
+	-18, 30, -23, -20, -20, -19, 34, 36,
+	103, -18, -17, -15, -14, -14, -14, -12,
+	-56, -61, -61, 49, 67, -57, 50, 70,
+	-7, -90, 17, 20, 30, 62, 52, -84,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	78, -22, -21, 35, -18, -18, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-13, -18, -17, -15, -14, 102, -14, -12,
+	-18, 30, -23, 33, -20, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, -11, 83, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, 22, -19, -16, -69, 62, -15, 50,
+	-33, 15, -38, 59, 43, 19, -34, -32,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	25, -33, -33, 48, -29, -29, 78, -27,
+	-35, -40, 14, 41, 17, -36, 71, -33,
+	34, 4, 29, 7, -46, -46, 8, 10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	18, -65, -64, 33, -8, 46, 46, -5,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 21, -20, 24, -17, -16, 37, -14,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-48, 0, -52, 45, 4, -49, 94, 7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-36, 75, -40, -38, 41, 16, -37, 19,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-36, 115, -40, -38, -37, -37, -37, 108,
+	-25, -30, 24, 26, 80, -26, -26, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	32, 27, -26, -23, 55, -22, -22, -20,
+	-18, -23, 30, 33, 34, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	-12, 37, -16, -13, -13, -13, 41, -10,
+	-19, 127, -23, -21, -20, -20, -20, -17,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	57, 27, 27, -23, -23, -22, -22, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-34, 14, 24, 17, -11, -35, 6, 20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-16, 42, 21, -71, -17, -17, 8, 49,
+	-24, -30, -29, 27, -26, -26, 53, 55,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-96, -7, 36, 79, -45, 9, 40, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, 20, 45, -30, -29, 24, -29, 26,
+	-18, -23, -23, 33, 34, -19, 34, -17,
+	13, 8, -44, -42, 53, 12, -41, 39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	71, 0, -19, -37, -10, 43, -36, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, 22, -31, 66, -28, -28, 51, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, -13, 94, -12, -10,
+	-50, -2, -18, 40, 6, 29, 7, -12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-18, 30, 30, -20, -20, 34, -19, -17,
+	-51, -3, 61, 25, -52, 42, -52, 28,
+	-12, -17, -16, -13, -13, 41, 41, -10,
+	-25, -30, 24, -27, 27, 80, -26, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, -26, 27, 30, -23, -22, -22, 58,
+	-5, 15, -63, 18, -6, 78, 19, -57,
+	-33, 15, -38, 18, -35, -34, 44, 62,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-15, -20, -19, -17, -16, 37, -16, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	-120, 59, 18, -16, 16, 45, 10, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-74, 32, 15, -3, 1, 24, 9, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, -13, -13, -12, 96,
+	27, 56, 39, -40, 30, -11, -117, 16,
+	18, 2, -2, -21, -2, 8, -15, 12,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -56, 0, -53, 1, 42, 66,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	37, 72, -21, -19, -18, -18, -18, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -40, 39, 17, 17, -36, -36, 20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, -15, -15, 9, 29, -26, 17, 26,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	4, -55, -1, 27, 43, -51, 28, 5,
+	-12, -17, -16, 40, 40, -13, -12, -10,
+	8, -50, 57, 60, -46, 7, 8, -44,
+	-17, 31, -21, -19, -18, -18, -18, 79,
+	31, 25, -37, 72, -87, 20, 8, -31,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-42, -47, 31, 72, 35, -43, 35, -41,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 40, 41, -12, -10,
+	-19, 92, -24, 32, -21, -21, -20, -18,
+	-12, -17, -16, -13, 40, -13, -12, 43,
+	11, 6, 37, -85, -85, 98, -84, 102,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	110, -26, -26, 30, -23, -22, -22, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-13, -72, 45, 56, 38, -68, 80, -66,
+	-20, -26, 0, 2, 81, -22, -21, 6,
+	-21, 27, -26, 55, 30, -22, -22, -20,
+	7, 2, 92, 30, -47, -47, -47, 9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, -1, -54, 12, 27, -9, 21, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -40, -39, 41, 17, 71, -36, -33,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-72, 1, -24, 50, 33, -73, 79, 7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, -16, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-67, 6, 23, -69, 63, 124, -68, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, -23, -20, -20, 87, -19, -17,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 40, -13, 41, -10,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, 23, -29, -27, -26, 80, -26, 30,
+	-25, 23, 24, -27, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	28, 76, -29, -27, -26, 27, -26, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-32, -37, 111, -34, 91, -33, -33, -31,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-38, -96, 11, 50, 55, -92, 64, 47,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, 22, 47, 66, -28, -28, -27, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	105, 11, -42, -39, -39, -38, -38, 80,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	28, -30, 24, -27, -26, 27, -26, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	26, 74, -73, -70, -70, 90, -69, 92,
+	16, -67, 11, 14, 30, -10, 15, -8,
+	-40, -46, 62, 64, 82, -42, -41, -39,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	-39, -44, 34, 37, 37, -40, 54, -38,
+	-36, 12, 37, 56, 40, -37, -37, -35,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -64, 14, -8, 17, -7, -7, 36,
+	-41, 2, -4, 43, -24, 11, 34, -22,
+	1, 34, 0, -16, -5, 14, -21, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, -11, -11, 85,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 61, -16, -16, -16, 40,
+	42, -17, 37, -13, -13, -13, -12, -10,
+	-10, -15, -15, -12, -12, 83, -11, -9,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	20, -38, -38, 59, 19, -34, 44, -32,
+	68, 46, 22, -28, -28, -28, -27, -25,
+	-19, -25, 92, -21, -21, -21, -20, 35,
+	15, -43, 11, 13, 14, 14, 14, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-25, -30, 24, 26, 27, 27, -26, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 59, -17, 37, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	39, -20, 59, -17, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	16, 11, -41, -39, -38, 40, 87, -36,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, -25, 54, -22, -21, -21, -21, 76,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	-11, 17, 31, 14, 0, -15, 3, -39,
+	-31, -36, 18, 20, -33, 46, 46, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-50, -55, 70, 1, -52, 27, 2, 57,
+	-25, 23, -29, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, 61, 37, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -28, 14, 17, -77, 18, 18, 20,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-4, 44, 16, -6, -6, 19, -5, -57,
+	11, 77, -47, -44, -43, 35, -43, 53,
+	-24, -29, -28, 27, -25, 127, -25, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	15, -43, 11, 13, 14, 14, 14, -37,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -24, -102, 48, -21, 26, 26, 28,
+	7, 15, -28, 58, -66, 13, 64, -63,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	39, 58, -19, -17, -16, -16, -16, -14,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-15, 58, -19, -17, -16, 37, -16, -14,
+	66, -34, 61, 23, -30, -30, -29, -27,
+	39, -20, -19, -17, -16, 62, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, -26, -26, 30, -23, 31, -22, 58,
+	71, -28, -28, -25, -25, 82, -24, -22,
+	88, -23, -23, -20, -20, 34, -19, -17,
+	-21, 52, 27, -23, 30, -22, -22, -20,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-36, -41, 12, 40, -38, -37, 57, 43,
+	-12, -17, 37, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	24, 72, -59, -3, 22, -2, -55, 0,
+	13, 49, -45, -42, -42, -42, 12, 98,
+	8, 3, 4, -47, 7, 7, 8, 10,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-22, -27, -26, -24, -23, 71, -23, 74,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, 38, 14, -37, -36, 17, 18, 20,
+	51, 56, 78, -57, -57, 38, -56, -54,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	-24, 48, -29, -26, -26, 52, -25, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-4, 15, -9, -6, -6, 19, -5, -3,
+	-40, -45, 34, 12, 53, -41, 13, 15,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, -11, 83, -9,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-34, -39, 39, 42, 18, -35, 43, -33,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -74, 21, -8, 58, -7, 24, -15,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, 48, -29, -26, 27, 52, -25, -23,
+	28, -30, 24, -27, -26, 27, -26, 30,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-12, -17, -16, 40, 40, -13, -12, -10,
+	-39, 9, 104, -41, 84, -40, -40, -38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-26, -31, -31, 25, -28, -27, 26, 91,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-4, -14, -4, -1, 3, 11, 11, -3,
+	-15, -20, -19, 37, -16, 62, -16, -14,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	91, 56, 16, -18, -112, 51, -112, 28,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	43, -57, 50, 41, -53, -53, 1, 28,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-38, -43, 105, 54, -40, -39, 39, -37,
+	57, -26, -26, 30, 30, -22, -22, -20,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-10, 24, 2, 17, 17, -35, -35, 20,
+	-24, -29, 96, -25, -25, -25, -24, 56,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-5, -64, 31, 18, 64, -60, 19, -4,
+	18, -5, 5, -14, 23, -14, -13, 1,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	92, -50, 4, 6, -47, -46, 7, 34,
+	57, -26, 27, 30, -23, -22, -22, -20,
+	37, -22, -21, -19, -18, 76, -18, -16,
+	-18, 55, -22, -20, -19, 59, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-19, 16, 1, 20, -21, -21, 43, -18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	46, -22, 20, -18, 7, -71, -17, 56,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-22, -22, 2, -7, 4, 28, 9, 8,
+	30, 0, 1, -50, 4, 4, 4, 6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, -11, 83, -9,
+	-18, -23, -22, -20, -19, 59, -19, 61,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, 83, -11, -11, -9,
+	-25, -30, 24, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-13, 28, -1, -39, -14, 24, -38, 53,
+	35, 30, -23, -20, -20, -19, -19, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-19, 127, -23, -21, -20, -20, -20, -17,
+	-10, 79, -15, -12, -12, -11, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-32, 73, 58, 7, -33, -33, -8, -31,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, 27, -26, -23, -23, 31, -22, 58,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	-21, -26, 52, 30, -23, -22, 31, -20,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	70, 101, -51, -48, -48, -47, -47, 71,
+	40, -43, 36, 14, 14, -39, 15, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-36, -41, 12, -38, -38, 127, -37, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-67, -19, -18, 9, -15, 26, 10, 72,
+	57, -26, 27, 30, -23, -22, -22, -20,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	39, -20, -19, -17, -16, -16, 62, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	14, -45, -44, 12, 12, 76, 13, -38,
+	-17, 72, -21, -19, -18, -18, 36, -16,
+	58, -25, 70, -22, -21, -21, -21, -19,
+	-18, -23, 56, 58, -19, -19, -19, -17,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	-15, -20, -19, -17, -16, 115, -16, -14,
+	97, -25, -24, -21, -21, 33, -20, -18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-12, -17, -16, -13, 40, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, -16, -13, -13, -13, -12, 43,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	-20, -26, -25, 102, -22, -22, 32, -19,
+	-23, -28, -28, 69, -25, -25, 82, -22,
+	67, 80, 41, -73, -72, 44, -72, -16,
+	38, -39, 25, 6, 54, 36, -34, -86,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	82, -75, 20, 53, -71, -71, 36, 26,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	9, 12, -56, -3, -7, 48, -27, 24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-55, 34, 47, -57, 38, -3, -3, -1,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	34, -50, 4, -46, 32, 61, -45, 10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-43, 30, 77, -44, -44, -44, -43, 111,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-20, -50, 4, 37, -46, 17, 8, 51,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	119, -32, 21, 74, -82, -82, -81, 63,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-21, 52, -26, -23, -23, 84, -22, -20,
+	22, 17, -36, -33, -33, 21, -32, 76,
+	-15, -20, -19, -17, 115, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	21, -37, -36, 104, -33, -33, -33, 47,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	38, -45, 34, -42, 12, -41, -41, 86,
+	27, -32, -31, -28, 66, 50, -27, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-24, 24, -29, -26, -26, 52, -25, 55,
+	-66, 92, 23, -15, -68, 89, -67, 13,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-11, -17, -16, 11, 12, -66, 72, 15,
+	-15, 33, -19, -17, -16, 62, -16, -14,
+	27, -31, 86, -28, 26, -27, -27, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, 45, -12, -9, -2, 37, -55, 21,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -34, -33, -30, 64, 24, 65, -27,
+	25, -33, -33, 23, 49, 24, -29, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	7, -52, 43, -48, 5, 30, 6, 8,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	23, -35, -35, -32, 22, 22, -31, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-30, -35, 97, -32, 93, -31, -31, -29,
+	-62, -67, 76, 61, 53, -63, 62, -61,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-23, -46, 18, 47, 27, -5, -32, 14,
+	-21, -26, -26, -23, -23, -22, 56, 86,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-23, -28, 51, 92, -24, -24, -23, -21,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	6, 1, 1, 16, 34, -37, -12, -9,
+	-10, -15, -15, -12, -12, 83, -11, -9,
+	-18, -23, 84, -20, -20, -19, -19, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, 37, -13, -13, -13, -12, -10,
+	-24, 24, 49, 52, -26, -26, -25, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-15, 33, -19, -17, -16, -16, -16, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	55, -28, -27, -24, -24, -24, -23, 95,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	42, -17, -16, -13, -13, 41, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	66, -56, 23, 54, -52, -52, 65, -49,
+	-49, -54, 127, 66, -50, -50, 28, -48,
+	-30, 18, 60, -32, -31, -31, 22, 24,
+	1, -57, 15, 9, 31, -12, 10, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-12, 37, -16, -13, -13, -13, 41, -10,
+	-12, 37, 37, -13, -13, -13, -12, -10,
+	-28, 20, 45, 23, -29, -29, 24, -27,
+	-30, 18, 19, -32, 22, 63, -31, -29,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, 83, -11, -9,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-43, 115, 31, -45, -44, 72, -44, -42,
+	-63, -15, 39, 13, 42, 30, 14, -62,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-44, -50, 29, 32, 7, -46, 8, 63,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, -23, 33, 34, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, 73, -19, -18, -18, -18, 38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-34, -39, -39, 42, -36, 81, -35, 61,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	45, 47, -84, -28, -27, 57, -27, 16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-17, -22, 73, 35, -18, -18, -18, -16,
+	-30, 18, -35, -4, 22, 57, -15, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	52, -32, -31, 25, 66, -28, -27, -25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 56, -20, -19, -19, -19, 61,
+	51, 5, 69, -45, -44, -44, -44, 52,
+	-12, 90, -16, -13, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -44, 10, 22, 1, 1, 44, -38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -111, 5, 35, 17, -1, 36, 32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, 20, -33, 64, -30, -30, -29, 67,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	63, -20, 34, -17, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, 60, -31, -106, -52, 26, 61, 40,
+	-17, 31, -21, -19, -18, -18, -18, 79,
+	-62, 57, -67, -64, -63, -10, 68, 127,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-15, -20, -19, -17, -16, -16, 116, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 58, -19, 37, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -16, -15, -12, 26, 27, 35, -34,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	28, 23, 77, -27, -26, -26, -26, -24,
+	40, 88, -42, -40, -39, 68, -39, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-47, -52, -51, 68, 30, -48, 69, 32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-19, 92, -24, -21, -21, -21, -20, 35,
+	-12, -17, 37, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, -23, -20, -20, 34, -19, 36,
+	-36, -41, 38, -38, 41, 106, -37, -34,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 55, -22, -20, -19, 59, -19, -17,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-12, -17, 37, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	16, 35, 36, -40, -39, 14, -39, 17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-42, 44, 28, 26, 21, -68, 31, -41,
+	-40, -46, 79, -42, 65, 12, 12, -39,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-41, -46, 33, -43, 11, 36, 36, 14,
+	-5, -2, 26, -123, 1, 70, -44, 77,
+	12, -46, -46, 35, 64, -42, 11, 13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-36, 37, -40, -38, 79, 16, -37, 19,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-10, -15, -15, -12, -12, 83, -11, -9,
+	42, -17, -16, 40, -13, -13, -12, -10,
+	-12, -17, -16, 40, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-35, -40, 55, 69, -37, -36, 58, -34,
+	49, 3, -49, 6, -46, 48, 32, -44,
+	-28, -33, 21, 23, -29, -29, 24, 51,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	4, -6, 18, 6, 27, -19, 3, -32,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, 40, -13, -13, -12, -10,
+	-8, -13, 65, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	-15, -20, 59, 37, -16, -16, -16, -14,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-10, -15, -15, -12, -12, -11, 83, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-127, 27, 36, 27, -10, 42, 5, 19,
+	-47, 73, 27, -49, 5, 83, -48, -45,
+	36, 53, -9, -60, -6, 47, -59, -3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, -13, -13, 41, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-45, 81, -49, -47, -46, 32, -46, 120,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	23, -32, 32, -8, 22, -1, -20, -17,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-9, -2, 35, -27, 19, 20, -26, -8,
+	42, -17, -16, 40, -13, -13, -12, -10,
+	10, 5, 46, -45, 8, 9, 9, -42,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	18, 54, 55, -37, 17, -36, -36, -34,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, -23, 33, -20, -19, 34, -17,
+	-21, -26, 52, 30, -23, -22, -22, 33,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, 33, -19, -17, -16, -16, -16, 65,
+	4, -13, -13, 12, -9, 21, -25, 23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	37, -46, 33, -43, 11, 36, -42, 14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, 40, -13, -13, 41, -10,
+	7, -52, 56, -48, 30, 6, -47, 49,
+	54, -58, 59, -1, -1, -54, -54, 55,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-2, -86, 31, 34, 34, -28, 43, -26,
+	84, -15, -15, -12, -12, -11, -11, -9,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	40, -60, -6, 21, 22, -3, 39, -53,
+	28, -30, -29, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-53, -59, 58, 76, 61, -55, 24, -52,
+	-23, -28, -27, -24, -24, -24, -23, 127,
+	127, 10, -43, -40, -40, 14, -39, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-10, -15, -15, -12, -12, 83, -11, -9,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-51, 22, 51, 0, -53, -52, 1, 81,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-50, -55, 52, 42, 86, -51, 27, -49,
+	-38, 10, -43, 38, -40, 55, 55, -37,
+	-34, 14, -38, -36, 102, 59, -35, -33,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, -13, 41, -10,
+	6, -11, -11, -8, -8, 14, -7, 25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	30, -28, -28, -25, -25, 70, -24, 31,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	70, 28, -66, -63, -63, 80, -62, 77,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-10, -15, 80, -12, -12, -11, -11, -9,
+	-28, 20, 21, 23, 49, -29, -29, -27,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	35, 30, -23, -20, -20, -19, 34, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, -21, -19, 35, -18, 77, -16,
+	39, -44, -44, -41, -40, 76, 13, 40,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	1, -20, -3, 12, 12, 0, 13, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-24, 48, -29, 27, 52, -26, -25, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, -13, -13, 41, 43,
+	-26, 85, -31, -28, 79, -27, -27, -25,
+	29, 7, 28, -43, -26, 17, 28, -40,
+	-15, -20, -19, 61, -16, -16, 38, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, 30, -23, 33, 34, -19, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	17, -42, 53, 15, 15, -38, 16, -36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, -13, -13, 41, -10,
+	5, -53, 54, 3, 57, -49, 29, -47,
+	9, -50, 29, 32, 7, -46, 8, 10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-18, -23, 30, 33, -20, -19, 34, -17,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	-62, -38, 22, 28, -47, 57, 15, 25,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	29, -30, 49, -26, -26, -26, -25, 55,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-33, 40, -38, 59, -35, 19, -34, 21,
+	-47, 73, 27, 29, -48, 59, -48, -45,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, -13, 41, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-19, 92, -24, -21, -21, 33, -20, -18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	10, 29, 46, -46, 92, -45, -45, -42,
+	14, -16, 38, 12, -13, -12, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-31, 17, 42, -33, 21, -32, -32, 48,
+	21, -38, 16, 19, -34, -34, -34, 85,
+	-51, 22, 39, 79, -52, -52, -52, 67,
+	-8, -13, -13, -10, 69, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, 41, -12, -10,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, 89, -35, -32, -32, 22, -31, -29,
+	-24, -30, -29, 52, 27, -26, 53, -23,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 40, 41, -12, -10,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	31, 1, -52, 29, -49, 5, 30, 7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	22, -36, 18, 45, 45, -32, -32, -30,
+	20, 31, -62, 35, 19, -59, -5, 21,
+	35, -23, -23, -20, 34, 34, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-17, -22, 73, -19, -18, -18, 36, -16,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, 40, -13, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	40, 10, 11, -40, 14, -39, -39, 41,
+	-23, 78, -28, -25, -25, 70, -24, -22,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-56, 55, 46, -4, 21, -57, -3, -1,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	19, -55, -6, 11, 27, -5, 28, -20,
+	42, -57, -4, 70, 0, 0, 0, -51,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, 69, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-28, -33, 21, 23, 24, -29, 49, -27,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-14, 59, -19, -28, -6, 53, -68, 23,
+	63, -20, -19, 37, -16, -16, -16, -14,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, 59, -17, -16, -16, 38, -14,
+	-39, 13, -14, 17, -11, 3, 32, -1,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	30, 2, 34, -3, 51, -40, -118, 44,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-51, -56, -56, 63, 42, 1, 54, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	29, -55, 121, -51, 105, -51, -50, -48,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, 23, -29, 26, 27, -26, 27, -24,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-38, -43, -42, 116, -39, -39, 121, -37,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-18, 30, -23, -20, -20, -19, -19, 89,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	49, -50, -49, 6, 48, -46, 7, 34,
+	-40, 86, -44, 53, -41, 12, 13, -39,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-48, -53, 1, 45, 67, -49, 5, 32,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	-47, 1, 1, 29, 29, -49, 30, 7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-15, -21, 117, -17, -17, -17, -16, -14,
+	-12, 37, 37, -13, -13, -13, -12, -10,
+	-16, -21, -21, -18, -18, -17, -17, 127,
+	-20, -25, -24, 73, -21, -21, 57, -19,
+	16, 28, -66, -64, 61, 32, -63, 56,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-27, -85, 82, 74, 43, -81, 75, -79,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, -23, -20, 34, -19, -19, 36,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	22, 42, -36, 45, -33, 21, -32, -30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	1, 47, -9, 0, -35, 54, -84, 25,
+	-18, 30, -23, -20, -20, 34, -19, 36,
+	-10, -15, 27, -12, -11, -64, 30, 54,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	48, 43, -34, -31, -31, 64, -30, -28,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, 43, -9, -7, -6, -6, -6, -4,
+	-41, -99, 76, 76, 42, -42, 80, -93,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	49, -34, -8, -30, 69, -83, 24, 14,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	82, 77, -39, -36, -35, -35, -35, 20,
+	-19, 17, 30, -74, -74, 79, 5, 36,
+	-21, 27, -26, -23, -23, 31, -22, 58,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	7, -10, -51, 36, -23, -6, 37, 8,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, 47, -6, -4,
+	-1, 23, -5, -11, -39, 2, -3, 34,
+	-23, -28, -28, 28, 28, 70, -24, -22,
+	-17, 72, -21, -19, -18, -18, -18, 38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-56, -7, 83, -4, -57, -3, 22, 24,
+	-29, 97, -34, -31, -31, -30, 86, -28,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-49, -54, 127, 66, -50, -50, 28, -48,
+	62, 57, 4, -47, -46, 7, -46, 10,
+	19, -40, 14, 17, 42, -36, -36, 20,
+	16, -43, -42, 38, 14, 14, 39, -37,
+	0, 24, 12, 27, -1, 15, -1, -77,
+	9, 47, -12, -34, 38, -8, -33, -6,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	13, -46, -45, 11, 65, -42, -41, 85,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	75, 61, -28, -79, -78, 46, 0, 2,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	115, -27, -27, -24, -24, 30, -23, -21,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	23, 18, -35, 21, -31, 63, -31, -29,
+	-44, -49, 58, 79, 33, 9, -44, -42,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -20, -5, 21, 10, -13, 21, -2,
+	48, -10, -9, -7, -6, -6, -6, -4,
+	70, -13, -13, -10, -9, -9, -9, -7,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, 44, -7, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, 37, -16, -13, -13, -13, -12, 43,
+	-5, -10, -9, -7, 47, -6, -6, -4,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-16, 4, 21, 7, 8, 8, -17, -15,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, 37, -13, -13, -13, 41, -10,
+	10, 30, -47, 50, -44, 34, -44, 12,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-25, 23, 24, -27, 27, -26, -26, 30,
+	-15, -20, -19, -17, -16, 37, -16, 65,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-38, 10, -42, 14, -39, 14, 39, 41,
+	15, 63, -43, -40, 14, 14, -39, 16,
+	11, 6, -88, -32, 22, 32, -6, 55,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	30, 60, -99, 35, 51, -18, -96, 38,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, 68, -9, -9, -9, -7,
+	-12, -17, 6, 8, 9, -13, 30, -11,
+	-19, 29, -24, -21, 95, -21, -20, -18,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, 30, -23, -20, -20, -19, 34, -17,
+	-12, -17, 37, -13, 40, -13, -12, -10,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, -9, 71,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	63, -20, 34, -17, -16, -16, -16, -14,
+	-28, -33, -33, 23, 49, -29, 24, 26,
+	-18, 30, -23, -20, 34, -19, 34, -17,
+	-14, -19, -18, 109, -15, -15, -15, -13,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-56, -61, -60, 37, 74, 21, 21, 23,
+	57, -26, -26, -23, -23, -22, 31, 33,
+	-15, -20, -19, 61, -16, -16, -16, 40,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, 65, -13, -10, -9, -9, -9, -7,
+	-25, 65, -29, -26, -26, -26, 91, -23,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	35, -23, 30, -20, -20, 34, -19, -17,
+	-12, -17, -16, -13, -13, 41, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-8, -13, -13, -10, -9, -9, 69, -7,
+	-25, 23, -29, 26, -26, -26, 27, 30,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, 46, -6, -6, -6, -4,
+	-5, -10, -9, -7, -6, -6, 47, -4,
+	-18, 30, -23, -20, -20, 87, -19, -17,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-5, -10, -9, -7, -6, -6, -6, 50,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-15, -20, -19, -17, 62, 37, -16, -14,
+	-15, -20, 34, -17, -16, -16, 62, -14,
+	-12, -17, -16, -13, 40, -13, -12, 43,
+	2, -3, -3, 0, 0, 1, 1, 3,
+	-12, -17, -16, -13, 40, -13, -12, 43,
+};
+
+} // namespace langid_model
+
+#endif
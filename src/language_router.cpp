@@ -0,0 +1,230 @@
+// enchant_windows - routing mixed-language text to dictionaries.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "enchant-windows.hpp"
+
+#include "langid.h"
+#include "language_tags.h"
+#include "unicode_script.h"
+
+#include <algorithm>
+
+namespace enchant_windows {
+
+// n-grams a sentence needs before its language is trusted; about three
+// short words.
+static const size_t kMinFeatures = 16;
+
+// Bytes in the UTF-8 sequence led by 'b', or 1 for a stray continuation.
+static size_t char_length(unsigned char b)
+{
+	return b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : b >= 0xC0 ? 2 : 1;
+}
+
+// Whether the character at 'p' belongs in a word: letters, apostrophes
+// (ASCII or U+2019) and anything non-ASCII other than Latin-1 punctuation
+// (U+0080..U+00BF) and general punctuation (U+2000..U+206F).
+static bool is_word_char(const unsigned char* p, size_t length)
+{
+	unsigned char b = p[0];
+	if (b < 0x80)
+		return ((b | 0x20) >= 'a' && (b | 0x20) <= 'z') || b == '\'';
+	if (b == 0xC2)
+		return false;
+	if (b == 0xE2 && length == 3 && (p[1] == 0x80 || p[1] == 0x81))
+		return p[1] == 0x80 && p[2] == 0x99;
+	return true;
+}
+
+static bool is_curly_apostrophe(std::string_view s, size_t at)
+{
+	return s.compare(at, 3, "\xE2\x80\x99") == 0;
+}
+
+struct LanguageRouter::Impl
+{
+	std::vector<Dictionary*> dictionaries;
+
+	// The dictionary for each of the identifier's languages, or -1, and a
+	// bit for each language that has one.
+	int language_dictionary[kLangidLanguageCount];
+	uint32_t candidates;
+	// What each dictionary's language is written in.
+	std::vector<ScriptSet> scripts;
+
+	// Words bound for each dictionary, and where their results go in 'out'.
+	std::vector<std::vector<std::string_view>> batch_words;
+	std::vector<std::vector<size_t>> batch_slots;
+	std::vector<int> results;
+
+	// The dictionary for a word with 'wordScripts' in a sentence for
+	// 'dictionary': that one if its language is written in any of them, else
+	// the first that is, else -1 for none.
+	int dictionary_for(ScriptSet wordScripts, int dictionary) const
+	{
+		if (dictionary < 0 || !outside_scripts(wordScripts, scripts[dictionary]))
+			return dictionary;
+		for (size_t d = 0; d < scripts.size(); ++d)
+		{
+			if (!outside_scripts(wordScripts, scripts[d]))
+				return static_cast<int>(d);
+		}
+		return -1;
+	}
+
+	int identify(std::string_view sentence) const
+	{
+		LangidScores scores;
+		langid_score(sentence, scores);
+		int language = langid_best(scores, candidates, kMinFeatures);
+		return language < 0 ? -1 : language_dictionary[language];
+	}
+
+	void add_words(std::string_view text, size_t start, size_t end, int dictionary, std::vector<Word>& out)
+	{
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text.data());
+		size_t i = start;
+		while (i < end)
+		{
+			size_t length = std::min(char_length(bytes[i]), end - i);
+			if (!is_word_char(bytes + i, length))
+			{
+				i += length;
+				continue;
+			}
+
+			size_t wordStart = i;
+			do
+			{
+				i += length;
+				length = i < end ? std::min(char_length(bytes[i]), end - i) : 0;
+			} while (length && is_word_char(bytes + i, length));
+			size_t wordEnd = i;
+
+			// Quotes around a word are not part of it.
+			for (;;)
+			{
+				if (wordStart < wordEnd && text[wordStart] == '\'')
+					wordStart += 1;
+				else if (wordEnd - wordStart >= 3 && is_curly_apostrophe(text, wordStart))
+					wordStart += 3;
+				else
+					break;
+			}
+			for (;;)
+			{
+				if (wordStart < wordEnd && text[wordEnd - 1] == '\'')
+					wordEnd -= 1;
+				else if (wordEnd - wordStart >= 3 && is_curly_apostrophe(text, wordEnd - 3))
+					wordEnd -= 3;
+				else
+					break;
+			}
+			if (wordStart == wordEnd)
+				continue;
+
+			Word word = { wordStart, wordEnd - wordStart, nullptr, -1 };
+			int target = dictionary;
+			if (target >= 0 && scripts[target] != kAllScripts)
+			{
+				target = dictionary_for(word_scripts(text.data() + wordStart, wordEnd - wordStart), dictionary);
+				if (target < 0)
+					word.result = 0;
+			}
+			if (target >= 0)
+			{
+				word.dictionary = dictionaries[target];
+				batch_words[target].push_back(text.substr(wordStart, wordEnd - wordStart));
+				batch_slots[target].push_back(out.size());
+			}
+			out.push_back(word);
+		}
+	}
+};
+
+LanguageRouter::LanguageRouter(std::vector<Dictionary*> dictionaries) :
+	impl(new Impl)
+{
+	impl->dictionaries = std::move(dictionaries);
+	impl->candidates = 0;
+	for (size_t l = 0; l < kLangidLanguageCount; ++l)
+		impl->language_dictionary[l] = -1;
+	for (size_t d = 0; d < impl->dictionaries.size(); ++d)
+	{
+		int language = langid_language_index(impl->dictionaries[d]->tag());
+		if (language >= 0 && impl->language_dictionary[language] < 0)
+		{
+			impl->language_dictionary[language] = static_cast<int>(d);
+			impl->candidates |= 1u << language;
+		}
+	}
+	for (Dictionary* dictionary : impl->dictionaries)
+	{
+		const LanguageTagRef language = resolve_language_tag(dictionary->tag());
+		impl->scripts.push_back(language ? dictionary_scripts(language->bcp47) : kAllScripts);
+	}
+	impl->batch_words.resize(impl->dictionaries.size());
+	impl->batch_slots.resize(impl->dictionaries.size());
+}
+
+LanguageRouter::~LanguageRouter()
+{
+}
+
+Dictionary* LanguageRouter::identify(std::string_view sentence) const
+{
+	int dictionary = impl->identify(sentence);
+	return dictionary < 0 ? nullptr : impl->dictionaries[dictionary];
+}
+
+void LanguageRouter::check(std::string_view text, std::vector<Word>& out)
+{
+	out.clear();
+	for (size_t d = 0; d < impl->dictionaries.size(); ++d)
+	{
+		impl->batch_words[d].clear();
+		impl->batch_slots[d].clear();
+	}
+
+	int current = impl->dictionaries.empty() ? -1 : 0;
+	size_t start = 0;
+	while (start < text.size())
+	{
+		size_t end = text.find_first_of(".!?\n", start);
+		end = (end == std::string_view::npos) ? text.size() : end + 1;
+
+		int dictionary = impl->identify(text.substr(start, end - start));
+		if (dictionary >= 0)
+			current = dictionary;
+		impl->add_words(text, start, end, current, out);
+		start = end;
+	}
+
+	for (size_t d = 0; d < impl->dictionaries.size(); ++d)
+	{
+		const auto& words = impl->batch_words[d];
+		if (words.empty())
+			continue;
+		impl->results.resize(words.size());
+		impl->dictionaries[d]->check(words, impl->results);
+		for (size_t i = 0; i < words.size(); ++i)
+			out[impl->batch_slots[d][i]].result = impl->results[i];
+	}
+}
+
+} // namespace enchant_windows
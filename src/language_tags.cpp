@@ -0,0 +1,331 @@
+// enchant_windows - interned language tags.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "language_tags.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string.h>
+
+// Longer than any real tag, which is at most a language, script, region and
+// a variant or two.
+static const size_t kMaxTagBytes = 64;
+// Open addressing over the IDs, at most half full.
+static const size_t kSlots = 2 * kMaxLanguageTags;
+
+struct RegionalParent
+{
+	const char* language;
+	const char* region;
+	const char* parent;
+};
+
+// Regions that spell like another region of the same language more than
+// like the language's main region.
+static const RegionalParent kRegionalParents[] = {
+	{ "en", "AU", "GB" }, { "en", "HK", "GB" }, { "en", "IE", "GB" }, { "en", "IN", "GB" },
+	{ "en", "MT", "GB" }, { "en", "NZ", "GB" }, { "en", "SG", "GB" }, { "en", "ZA", "GB" },
+	{ "es", "419", "MX" }, { "es", "AR", "MX" }, { "es", "BO", "MX" }, { "es", "CL", "MX" },
+	{ "es", "CO", "MX" }, { "es", "CR", "MX" }, { "es", "CU", "MX" }, { "es", "DO", "MX" },
+	{ "es", "EC", "MX" }, { "es", "GT", "MX" }, { "es", "HN", "MX" }, { "es", "NI", "MX" },
+	{ "es", "PA", "MX" }, { "es", "PE", "MX" }, { "es", "PR", "MX" }, { "es", "PY", "MX" },
+	{ "es", "SV", "MX" }, { "es", "US", "MX" }, { "es", "UY", "MX" }, { "es", "VE", "MX" },
+	{ "pt", "AO", "PT" }, { "pt", "CV", "PT" }, { "pt", "GW", "PT" }, { "pt", "MO", "PT" },
+	{ "pt", "MZ", "PT" }, { "pt", "ST", "PT" }, { "pt", "TL", "PT" },
+};
+
+struct MainRegion
+{
+	const char* language;
+	const char* region;
+};
+
+// Where a language's dictionary is most likely to be, when its region has
+// none.
+static const MainRegion kMainRegions[] = {
+	{ "ar", "SA" }, { "bg", "BG" }, { "ca", "ES" }, { "cs", "CZ" }, { "da", "DK" },
+	{ "de", "DE" }, { "el", "GR" }, { "en", "US" }, { "es", "ES" }, { "et", "EE" },
+	{ "eu", "ES" }, { "fi", "FI" }, { "fr", "FR" }, { "gl", "ES" }, { "he", "IL" },
+	{ "hi", "IN" }, { "hr", "HR" }, { "hu", "HU" }, { "id", "ID" }, { "it", "IT" },
+	{ "ja", "JP" }, { "ko", "KR" }, { "lt", "LT" }, { "lv", "LV" }, { "nb", "NO" },
+	{ "nl", "NL" }, { "nn", "NO" }, { "pl", "PL" }, { "pt", "BR" }, { "ro", "RO" },
+	{ "ru", "RU" }, { "sk", "SK" }, { "sl", "SI" }, { "sv", "SE" }, { "th", "TH" },
+	{ "tr", "TR" }, { "uk", "UA" }, { "vi", "VN" },
+};
+
+static std::mutex intern_mutex;
+// Published with a release store once complete, so readers need no lock.
+static std::atomic<const LanguageTag*> tags[kMaxLanguageTags];
+static std::atomic<LanguageTagId> slots[kSlots];
+// Under intern_mutex.
+static LanguageTagId tag_count(0);
+
+static char ascii_lower(char c)
+{
+	return c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c;
+}
+
+static char ascii_upper(char c)
+{
+	return c >= 'a' && c <= 'z' ? static_cast<char>(c & ~0x20) : c;
+}
+
+// Write the canonical BCP 47 form of 'tag' to 'out', which has room for
+// kMaxTagBytes. Returns its length, or 0 if 'tag' isn't well-formed: subtags
+// of one to eight letters and digits, separated by '-' or '_', the first of
+// at least two letters. A locale's ".charset" or "@modifier" is dropped.
+static size_t canonical_form(std::string_view tag, char* out)
+{
+	// One pass: each subtag is copied lowercase, then checked and recased
+	// in place once its end is found.
+	size_t len = 0;
+	size_t index = 0;
+	size_t subtagStart = 0;
+	bool alpha = true;
+	bool digit = true;
+	bool sawScript = false;
+	bool sawRegion = false;
+	for (size_t i = 0; ; ++i)
+	{
+		const char c = i < tag.size() ? tag[i] : '\0';
+		const bool end = i == tag.size() || c == '.' || c == '@';
+		if (end || c == '-' || c == '_')
+		{
+			const size_t size = len - subtagStart;
+			if (size == 0 || size > 8)
+				return 0;
+
+			// Language, then an optional script and region; anything after
+			// is a variant or extension, lowercase.
+			if (index == 0)
+			{
+				if (!alpha || size < 2)
+					return 0;
+			}
+			else if (index == 1 && alpha && size == 4)
+			{
+				sawScript = true;
+				out[subtagStart] = ascii_upper(out[subtagStart]);
+			}
+			else if (!sawRegion && index == (sawScript ? 2u : 1u) &&
+				((alpha && size == 2) || (digit && size == 3)))
+			{
+				sawRegion = true;
+				for (size_t k = subtagStart; k < len; ++k)
+					out[k] = ascii_upper(out[k]);
+			}
+			if (end)
+				return len;
+
+			out[len++] = '-';
+			subtagStart = len;
+			alpha = digit = true;
+			++index;
+			continue;
+		}
+
+		const char lower = ascii_lower(c);
+		const bool isAlpha = lower >= 'a' && lower <= 'z';
+		const bool isDigit = c >= '0' && c <= '9';
+		if ((!isAlpha && !isDigit) || len + 1 >= kMaxTagBytes)
+			return 0;
+		alpha &= isAlpha;
+		digit &= isDigit;
+		out[len++] = lower;
+	}
+}
+
+// FNV-1a.
+static size_t slot_of(const char* key, size_t len)
+{
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < len; ++i)
+		hash = (hash ^ static_cast<unsigned char>(key[i])) * 16777619u;
+	return hash & (kSlots - 1);
+}
+
+// The slot holding 'key', or the empty one where it would go.
+static size_t probe(const char* key, size_t len, LanguageTagId& id)
+{
+	for (size_t slot = slot_of(key, len); ; slot = (slot + 1) & (kSlots - 1))
+	{
+		id = slots[slot].load(std::memory_order_acquire);
+		if (id == kNoLanguageTag)
+			return slot;
+		const std::string& bcp47 = tags[id].load(std::memory_order_acquire)->bcp47;
+		if (bcp47.size() == len && memcmp(bcp47.data(), key, len) == 0)
+			return slot;
+	}
+}
+
+// The next tag to try after 'tag' (canonical), or an empty string if there
+// is none.
+static std::string parent_of(const std::string& tag)
+{
+	std::vector<std::string> subtags;
+	size_t start = 0;
+	while (start <= tag.size())
+	{
+		size_t stop = tag.find('-', start);
+		if (stop == std::string::npos)
+			stop = tag.size();
+		subtags.push_back(tag.substr(start, stop - start));
+		start = stop + 1;
+	}
+
+	if (subtags.size() == 1)
+		return std::string();
+	// Variants, and scripts, are dropped first, one subtag at a time.
+	if (subtags.size() > 2 || subtags[1].size() == 4)
+		return tag.substr(0, tag.rfind('-'));
+
+	const std::string& language = subtags[0];
+	const std::string& region = subtags[1];
+	for (const RegionalParent& parent : kRegionalParents)
+	{
+		if (language == parent.language && region == parent.region)
+			return language + "-" + parent.parent;
+	}
+	for (const MainRegion& main : kMainRegions)
+	{
+		if (language == main.language && region != main.region)
+			return language + "-" + main.region;
+	}
+	return language;
+}
+
+// Fill in the forms of the canonical tag 'key'.
+static void set_forms(LanguageTag& tag, const char* key, size_t len)
+{
+	tag.bcp47.assign(key, len);
+	tag.enchant = tag.bcp47;
+	for (char& c : tag.enchant)
+	{
+		if (c == '-')
+			c = '_';
+	}
+	tag.windows.assign(tag.bcp47.begin(), tag.bcp47.end());
+}
+
+// Called with intern_mutex held. Each fallback is interned too, with its
+// own fallbacks, which are the rest of this tag's.
+static LanguageTagId intern_locked(const char* key, size_t len)
+{
+	LanguageTagId id;
+	probe(key, len, id);
+	if (id != kNoLanguageTag)
+		return id;
+	if (tag_count + 1 >= kMaxLanguageTags)
+		return kNoLanguageTag;
+
+	auto tag = std::make_unique<LanguageTag>();
+	set_forms(*tag, key, len);
+
+	const std::string parent = parent_of(tag->bcp47);
+	if (!parent.empty())
+	{
+		const LanguageTagId parentId = intern_locked(parent.data(), parent.size());
+		if (parentId != kNoLanguageTag)
+		{
+			const LanguageTag& parentTag = language_tag(parentId);
+			tag->fallbacks.push_back(parentId);
+			tag->fallbacks.insert(tag->fallbacks.end(), parentTag.fallbacks.begin(), parentTag.fallbacks.end());
+		}
+	}
+
+	// Found again, since interning the fallbacks may have taken the slot
+	// it would have had.
+	const size_t slot = probe(key, len, id);
+	id = ++tag_count;
+	tags[id].store(tag.release(), std::memory_order_release);
+	slots[slot].store(id, std::memory_order_release);
+	return id;
+}
+
+LanguageTagId intern_language_tag(std::string_view tag)
+{
+	char key[kMaxTagBytes];
+	const size_t len = canonical_form(tag, key);
+	if (len == 0)
+		return kNoLanguageTag;
+
+	LanguageTagId id;
+	probe(key, len, id);
+	if (id != kNoLanguageTag)
+		return id;
+
+	std::lock_guard<std::mutex> lock(intern_mutex);
+	return intern_locked(key, len);
+}
+
+LanguageTagRef resolve_language_tag(std::string_view tag)
+{
+	char key[kMaxTagBytes];
+	const size_t len = canonical_form(tag, key);
+	if (len == 0)
+		return nullptr;
+
+	LanguageTagId id;
+	probe(key, len, id);
+	if (id == kNoLanguageTag)
+	{
+		std::lock_guard<std::mutex> lock(intern_mutex);
+		id = intern_locked(key, len);
+	}
+	if (id != kNoLanguageTag)
+		return LanguageTagRef(LanguageTagRef(), &language_tag(id));
+
+	// The registry is full. Each parent is looked for in turn, since one
+	// that isn't interned may still have one that is.
+	auto converted = std::make_shared<LanguageTag>();
+	set_forms(*converted, key, len);
+	for (std::string parent = parent_of(converted->bcp47); !parent.empty(); parent = parent_of(parent))
+	{
+		LanguageTagId parentId;
+		probe(parent.data(), parent.size(), parentId);
+		if (parentId != kNoLanguageTag)
+			converted->fallbacks.push_back(parentId);
+	}
+	return converted;
+}
+
+LanguageTagId find_language_tag(std::string_view tag)
+{
+	char key[kMaxTagBytes];
+	const size_t len = canonical_form(tag, key);
+	if (len == 0)
+		return kNoLanguageTag;
+
+	LanguageTagId id;
+	probe(key, len, id);
+	return id;
+}
+
+const LanguageTag& language_tag(LanguageTagId id)
+{
+	return *tags[id].load(std::memory_order_acquire);
+}
+
+std::vector<const LanguageTag*> language_tag_candidates(const LanguageTag& tag)
+{
+	std::vector<const LanguageTag*> candidates(1, &tag);
+	for (LanguageTagId fallback : tag.fallbacks)
+		candidates.push_back(&language_tag(fallback));
+	return candidates;
+}
@@ -0,0 +1,75 @@
+// enchant_windows - interned language tags.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_LANGUAGE_TAGS_H
+#define ENCHANT_WINDOWS_LANGUAGE_TAGS_H
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Language tags arrive as Enchant spells them ("en_US", maybe with a locale's
+// ".UTF-8" left on) and go to the backend as Windows does ("en-US"). Each
+// distinct tag is canonicalized once, as BCP 47 casing has it (language
+// lowercase, script Title Case, region uppercase), and interned: after that
+// it is a small integer, and its forms and fallbacks are looked up without
+// allocating. Tags are never freed; there is room for kMaxLanguageTags, and
+// once that is used up new tags are converted every time they are asked
+// for instead.
+
+typedef uint32_t LanguageTagId;
+const LanguageTagId kNoLanguageTag = 0;
+const size_t kMaxLanguageTags = 1024;
+
+struct LanguageTag
+{
+	std::string bcp47;       // "de-CH"
+	std::string enchant;     // "de_CH"
+	std::u16string windows;  // u"de-CH", NUL-terminated for the backend
+	// What to use, best first, when there is no dictionary for the tag:
+	// less specific tags, a neighbouring region's spelling (en-AU: en-GB)
+	// and the language's main region (de-CH: de-DE), then the language
+	// alone. Doesn't include the tag itself.
+	std::vector<LanguageTagId> fallbacks;
+};
+
+// A tag, interned or not. An interned one is shared without being owned.
+typedef std::shared_ptr<const LanguageTag> LanguageTagRef;
+
+// The ID of 'tag', interning it if it is new. kNoLanguageTag if it isn't a
+// well-formed tag, or the registry is full.
+LanguageTagId intern_language_tag(std::string_view tag);
+
+// 'tag', interned if it is or there is room; if the registry is full,
+// converted for the caller alone, with the fallbacks that are interned.
+// Null if it isn't a well-formed tag.
+LanguageTagRef resolve_language_tag(std::string_view tag);
+
+// The ID of 'tag' if it has been interned, otherwise kNoLanguageTag.
+// Doesn't allocate or take a lock.
+LanguageTagId find_language_tag(std::string_view tag);
+
+// An interned tag, by ID. Doesn't take a lock.
+const LanguageTag& language_tag(LanguageTagId id);
+
+// 'tag' and then its fallbacks, best first.
+std::vector<const LanguageTag*> language_tag_candidates(const LanguageTag& tag);
+
+#endif
@@ -0,0 +1,134 @@
+// enchant_windows - per-dictionary memory accounting.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_MEMORY_ACCOUNTING_H
+#define ENCHANT_WINDOWS_MEMORY_ACCOUNTING_H
+
+#include "enchant-windows.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+typedef EnchantWindowsMemoryCategory MemoryCategory;
+
+// Running byte counts for one dictionary, by category. Charges come from
+// whichever thread allocates, so the counters are atomic; peaks are kept
+// per category and for the total.
+class MemoryAccount
+{
+public:
+	MemoryAccount()
+	{
+		for (int i = 0; i < ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT; ++i)
+		{
+			current[i] = 0;
+			peak[i] = 0;
+		}
+		total = 0;
+		peak_total = 0;
+	}
+
+	void charge(MemoryCategory category, size_t bytes)
+	{
+		raise_peak(peak[category], current[category].fetch_add(bytes, std::memory_order_relaxed) + bytes);
+		raise_peak(peak_total, total.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+	}
+
+	void discharge(MemoryCategory category, size_t bytes)
+	{
+		current[category].fetch_sub(bytes, std::memory_order_relaxed);
+		total.fetch_sub(bytes, std::memory_order_relaxed);
+	}
+
+	void snapshot(EnchantWindowsDictMemory& out) const
+	{
+		for (int i = 0; i < ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT; ++i)
+		{
+			out.current_bytes[i] = current[i].load(std::memory_order_relaxed);
+			out.peak_bytes[i] = peak[i].load(std::memory_order_relaxed);
+		}
+		out.total_bytes = total.load(std::memory_order_relaxed);
+		out.peak_total_bytes = peak_total.load(std::memory_order_relaxed);
+	}
+
+private:
+	static void raise_peak(std::atomic<size_t>& peakValue, size_t value)
+	{
+		size_t seen = peakValue.load(std::memory_order_relaxed);
+		while (value > seen && !peakValue.compare_exchange_weak(seen, value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	std::atomic<size_t> current[ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT];
+	std::atomic<size_t> peak[ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT];
+	std::atomic<size_t> total;
+	std::atomic<size_t> peak_total;
+};
+
+// Standard allocator that charges every allocation to a MemoryAccount, so
+// containers owned by a dictionary (caches, word sets, ...) are counted to
+// the byte without walking them. The account must outlive the container.
+template<typename T>
+class AccountedAllocator
+{
+public:
+	typedef T value_type;
+
+	AccountedAllocator(MemoryAccount* account, MemoryCategory category) :
+		account(account),
+		category(category)
+	{}
+
+	template<typename U>
+	AccountedAllocator(const AccountedAllocator<U>& other) :
+		account(other.account),
+		category(other.category)
+	{}
+
+	T* allocate(size_t n)
+	{
+		T* p = std::allocator<T>().allocate(n);
+		account->charge(category, n * sizeof(T));
+		return p;
+	}
+
+	void deallocate(T* p, size_t n)
+	{
+		account->discharge(category, n * sizeof(T));
+		std::allocator<T>().deallocate(p, n);
+	}
+
+	template<typename U>
+	bool operator==(const AccountedAllocator<U>& other) const
+	{
+		return account == other.account && category == other.category;
+	}
+
+	template<typename U>
+	bool operator!=(const AccountedAllocator<U>& other) const
+	{
+		return !(*this == other);
+	}
+
+	MemoryAccount* account;
+	MemoryCategory category;
+};
+
+#endif
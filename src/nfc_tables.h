@@ -0,0 +1,3981 @@
+// enchant_windows - Unicode tables for NFC.
+//
+// Generated by tools/gen_nfc_tables.py from Unicode 14.0.0. Do not edit.
+
+#ifndef ENCHANT_WINDOWS_NFC_TABLES_H
+#define ENCHANT_WINDOWS_NFC_TABLES_H
+
+#include <stdint.h>
+
+namespace nfc_tables {
+
+// Below this, every code point has combining class 0 and is NFC_QC=Yes.
+const uint32_t kFirstInteresting = 0x300;
+
+enum QuickCheck { kYes, kMaybe, kNo };
+
+struct Property
+{
+	uint32_t first;
+	uint32_t last;
+	uint8_t ccc;
+	uint8_t quick_check;
+};
+
+// Ranges, in order, of code points whose class isn't 0 or that aren't
+// NFC_QC=Yes.
+const Property kProperties[] = {
+	{ 0x300, 0x304, 230, 1 },
+	{ 0x305, 0x305, 230, 0 },
+	{ 0x306, 0x30C, 230, 1 },
+	{ 0x30D, 0x30E, 230, 0 },
+	{ 0x30F, 0x30F, 230, 1 },
+	{ 0x310, 0x310, 230, 0 },
+	{ 0x311, 0x311, 230, 1 },
+	{ 0x312, 0x312, 230, 0 },
+	{ 0x313, 0x314, 230, 1 },
+	{ 0x315, 0x315, 232, 0 },
+	{ 0x316, 0x319, 220, 0 },
+	{ 0x31A, 0x31A, 232, 0 },
+	{ 0x31B, 0x31B, 216, 1 },
+	{ 0x31C, 0x320, 220, 0 },
+	{ 0x321, 0x322, 202, 0 },
+	{ 0x323, 0x326, 220, 1 },
+	{ 0x327, 0x328, 202, 1 },
+	{ 0x329, 0x32C, 220, 0 },
+	{ 0x32D, 0x32E, 220, 1 },
+	{ 0x32F, 0x32F, 220, 0 },
+	{ 0x330, 0x331, 220, 1 },
+	{ 0x332, 0x333, 220, 0 },
+	{ 0x334, 0x337, 1, 0 },
+	{ 0x338, 0x338, 1, 1 },
+	{ 0x339, 0x33C, 220, 0 },
+	{ 0x33D, 0x33F, 230, 0 },
+	{ 0x340, 0x341, 230, 2 },
+	{ 0x342, 0x342, 230, 1 },
+	{ 0x343, 0x344, 230, 2 },
+	{ 0x345, 0x345, 240, 1 },
+	{ 0x346, 0x346, 230, 0 },
+	{ 0x347, 0x349, 220, 0 },
+	{ 0x34A, 0x34C, 230, 0 },
+	{ 0x34D, 0x34E, 220, 0 },
+	{ 0x350, 0x352, 230, 0 },
+	{ 0x353, 0x356, 220, 0 },
+	{ 0x357, 0x357, 230, 0 },
+	{ 0x358, 0x358, 232, 0 },
+	{ 0x359, 0x35A, 220, 0 },
+	{ 0x35B, 0x35B, 230, 0 },
+	{ 0x35C, 0x35C, 233, 0 },
+	{ 0x35D, 0x35E, 234, 0 },
+	{ 0x35F, 0x35F, 233, 0 },
+	{ 0x360, 0x361, 234, 0 },
+	{ 0x362, 0x362, 233, 0 },
+	{ 0x363, 0x36F, 230, 0 },
+	{ 0x374, 0x374, 0, 2 },
+	{ 0x37E, 0x37E, 0, 2 },
+	{ 0x387, 0x387, 0, 2 },
+	{ 0x483, 0x487, 230, 0 },
+	{ 0x591, 0x591, 220, 0 },
+	{ 0x592, 0x595, 230, 0 },
+	{ 0x596, 0x596, 220, 0 },
+	{ 0x597, 0x599, 230, 0 },
+	{ 0x59A, 0x59A, 222, 0 },
+	{ 0x59B, 0x59B, 220, 0 },
+	{ 0x59C, 0x5A1, 230, 0 },
+	{ 0x5A2, 0x5A7, 220, 0 },
+	{ 0x5A8, 0x5A9, 230, 0 },
+	{ 0x5AA, 0x5AA, 220, 0 },
+	{ 0x5AB, 0x5AC, 230, 0 },
+	{ 0x5AD, 0x5AD, 222, 0 },
+	{ 0x5AE, 0x5AE, 228, 0 },
+	{ 0x5AF, 0x5AF, 230, 0 },
+	{ 0x5B0, 0x5B0, 10, 0 },
+	{ 0x5B1, 0x5B1, 11, 0 },
+	{ 0x5B2, 0x5B2, 12, 0 },
+	{ 0x5B3, 0x5B3, 13, 0 },
+	{ 0x5B4, 0x5B4, 14, 0 },
+	{ 0x5B5, 0x5B5, 15, 0 },
+	{ 0x5B6, 0x5B6, 16, 0 },
+	{ 0x5B7, 0x5B7, 17, 0 },
+	{ 0x5B8, 0x5B8, 18, 0 },
+	{ 0x5B9, 0x5BA, 19, 0 },
+	{ 0x5BB, 0x5BB, 20, 0 },
+	{ 0x5BC, 0x5BC, 21, 0 },
+	{ 0x5BD, 0x5BD, 22, 0 },
+	{ 0x5BF, 0x5BF, 23, 0 },
+	{ 0x5C1, 0x5C1, 24, 0 },
+	{ 0x5C2, 0x5C2, 25, 0 },
+	{ 0x5C4, 0x5C4, 230, 0 },
+	{ 0x5C5, 0x5C5, 220, 0 },
+	{ 0x5C7, 0x5C7, 18, 0 },
+	{ 0x610, 0x617, 230, 0 },
+	{ 0x618, 0x618, 30, 0 },
+	{ 0x619, 0x619, 31, 0 },
+	{ 0x61A, 0x61A, 32, 0 },
+	{ 0x64B, 0x64B, 27, 0 },
+	{ 0x64C, 0x64C, 28, 0 },
+	{ 0x64D, 0x64D, 29, 0 },
+	{ 0x64E, 0x64E, 30, 0 },
+	{ 0x64F, 0x64F, 31, 0 },
+	{ 0x650, 0x650, 32, 0 },
+	{ 0x651, 0x651, 33, 0 },
+	{ 0x652, 0x652, 34, 0 },
+	{ 0x653, 0x654, 230, 1 },
+	{ 0x655, 0x655, 220, 1 },
+	{ 0x656, 0x656, 220, 0 },
+	{ 0x657, 0x65B, 230, 0 },
+	{ 0x65C, 0x65C, 220, 0 },
+	{ 0x65D, 0x65E, 230, 0 },
+	{ 0x65F, 0x65F, 220, 0 },
+	{ 0x670, 0x670, 35, 0 },
+	{ 0x6D6, 0x6DC, 230, 0 },
+	{ 0x6DF, 0x6E2, 230, 0 },
+	{ 0x6E3, 0x6E3, 220, 0 },
+	{ 0x6E4, 0x6E4, 230, 0 },
+	{ 0x6E7, 0x6E8, 230, 0 },
+	{ 0x6EA, 0x6EA, 220, 0 },
+	{ 0x6EB, 0x6EC, 230, 0 },
+	{ 0x6ED, 0x6ED, 220, 0 },
+	{ 0x711, 0x711, 36, 0 },
+	{ 0x730, 0x730, 230, 0 },
+	{ 0x731, 0x731, 220, 0 },
+	{ 0x732, 0x733, 230, 0 },
+	{ 0x734, 0x734, 220, 0 },
+	{ 0x735, 0x736, 230, 0 },
+	{ 0x737, 0x739, 220, 0 },
+	{ 0x73A, 0x73A, 230, 0 },
+	{ 0x73B, 0x73C, 220, 0 },
+	{ 0x73D, 0x73D, 230, 0 },
+	{ 0x73E, 0x73E, 220, 0 },
+	{ 0x73F, 0x741, 230, 0 },
+	{ 0x742, 0x742, 220, 0 },
+	{ 0x743, 0x743, 230, 0 },
+	{ 0x744, 0x744, 220, 0 },
+	{ 0x745, 0x745, 230, 0 },
+	{ 0x746, 0x746, 220, 0 },
+	{ 0x747, 0x747, 230, 0 },
+	{ 0x748, 0x748, 220, 0 },
+	{ 0x749, 0x74A, 230, 0 },
+	{ 0x7EB, 0x7F1, 230, 0 },
+	{ 0x7F2, 0x7F2, 220, 0 },
+	{ 0x7F3, 0x7F3, 230, 0 },
+	{ 0x7FD, 0x7FD, 220, 0 },
+	{ 0x816, 0x819, 230, 0 },
+	{ 0x81B, 0x823, 230, 0 },
+	{ 0x825, 0x827, 230, 0 },
+	{ 0x829, 0x82D, 230, 0 },
+	{ 0x859, 0x85B, 220, 0 },
+	{ 0x898, 0x898, 230, 0 },
+	{ 0x899, 0x89B, 220, 0 },
+	{ 0x89C, 0x89F, 230, 0 },
+	{ 0x8CA, 0x8CE, 230, 0 },
+	{ 0x8CF, 0x8D3, 220, 0 },
+	{ 0x8D4, 0x8E1, 230, 0 },
+	{ 0x8E3, 0x8E3, 220, 0 },
+	{ 0x8E4, 0x8E5, 230, 0 },
+	{ 0x8E6, 0x8E6, 220, 0 },
+	{ 0x8E7, 0x8E8, 230, 0 },
+	{ 0x8E9, 0x8E9, 220, 0 },
+	{ 0x8EA, 0x8EC, 230, 0 },
+	{ 0x8ED, 0x8EF, 220, 0 },
+	{ 0x8F0, 0x8F0, 27, 0 },
+	{ 0x8F1, 0x8F1, 28, 0 },
+	{ 0x8F2, 0x8F2, 29, 0 },
+	{ 0x8F3, 0x8F5, 230, 0 },
+	{ 0x8F6, 0x8F6, 220, 0 },
+	{ 0x8F7, 0x8F8, 230, 0 },
+	{ 0x8F9, 0x8FA, 220, 0 },
+	{ 0x8FB, 0x8FF, 230, 0 },
+	{ 0x93C, 0x93C, 7, 1 },
+	{ 0x94D, 0x94D, 9, 0 },
+	{ 0x951, 0x951, 230, 0 },
+	{ 0x952, 0x952, 220, 0 },
+	{ 0x953, 0x954, 230, 0 },
+	{ 0x958, 0x95F, 0, 2 },
+	{ 0x9BC, 0x9BC, 7, 0 },
+	{ 0x9BE, 0x9BE, 0, 1 },
+	{ 0x9CD, 0x9CD, 9, 0 },
+	{ 0x9D7, 0x9D7, 0, 1 },
+	{ 0x9DC, 0x9DD, 0, 2 },
+	{ 0x9DF, 0x9DF, 0, 2 },
+	{ 0x9FE, 0x9FE, 230, 0 },
+	{ 0xA33, 0xA33, 0, 2 },
+	{ 0xA36, 0xA36, 0, 2 },
+	{ 0xA3C, 0xA3C, 7, 0 },
+	{ 0xA4D, 0xA4D, 9, 0 },
+	{ 0xA59, 0xA5B, 0, 2 },
+	{ 0xA5E, 0xA5E, 0, 2 },
+	{ 0xABC, 0xABC, 7, 0 },
+	{ 0xACD, 0xACD, 9, 0 },
+	{ 0xB3C, 0xB3C, 7, 0 },
+	{ 0xB3E, 0xB3E, 0, 1 },
+	{ 0xB4D, 0xB4D, 9, 0 },
+	{ 0xB56, 0xB57, 0, 1 },
+	{ 0xB5C, 0xB5D, 0, 2 },
+	{ 0xBBE, 0xBBE, 0, 1 },
+	{ 0xBCD, 0xBCD, 9, 0 },
+	{ 0xBD7, 0xBD7, 0, 1 },
+	{ 0xC3C, 0xC3C, 7, 0 },
+	{ 0xC4D, 0xC4D, 9, 0 },
+	{ 0xC55, 0xC55, 84, 0 },
+	{ 0xC56, 0xC56, 91, 1 },
+	{ 0xCBC, 0xCBC, 7, 0 },
+	{ 0xCC2, 0xCC2, 0, 1 },
+	{ 0xCCD, 0xCCD, 9, 0 },
+	{ 0xCD5, 0xCD6, 0, 1 },
+	{ 0xD3B, 0xD3C, 9, 0 },
+	{ 0xD3E, 0xD3E, 0, 1 },
+	{ 0xD4D, 0xD4D, 9, 0 },
+	{ 0xD57, 0xD57, 0, 1 },
+	{ 0xDCA, 0xDCA, 9, 1 },
+	{ 0xDCF, 0xDCF, 0, 1 },
+	{ 0xDDF, 0xDDF, 0, 1 },
+	{ 0xE38, 0xE39, 103, 0 },
+	{ 0xE3A, 0xE3A, 9, 0 },
+	{ 0xE48, 0xE4B, 107, 0 },
+	{ 0xEB8, 0xEB9, 118, 0 },
+	{ 0xEBA, 0xEBA, 9, 0 },
+	{ 0xEC8, 0xECB, 122, 0 },
+	{ 0xF18, 0xF19, 220, 0 },
+	{ 0xF35, 0xF35, 220, 0 },
+	{ 0xF37, 0xF37, 220, 0 },
+	{ 0xF39, 0xF39, 216, 0 },
+	{ 0xF43, 0xF43, 0, 2 },
+	{ 0xF4D, 0xF4D, 0, 2 },
+	{ 0xF52, 0xF52, 0, 2 },
+	{ 0xF57, 0xF57, 0, 2 },
+	{ 0xF5C, 0xF5C, 0, 2 },
+	{ 0xF69, 0xF69, 0, 2 },
+	{ 0xF71, 0xF71, 129, 0 },
+	{ 0xF72, 0xF72, 130, 0 },
+	{ 0xF73, 0xF73, 0, 2 },
+	{ 0xF74, 0xF74, 132, 0 },
+	{ 0xF75, 0xF76, 0, 2 },
+	{ 0xF78, 0xF78, 0, 2 },
+	{ 0xF7A, 0xF7D, 130, 0 },
+	{ 0xF80, 0xF80, 130, 0 },
+	{ 0xF81, 0xF81, 0, 2 },
+	{ 0xF82, 0xF83, 230, 0 },
+	{ 0xF84, 0xF84, 9, 0 },
+	{ 0xF86, 0xF87, 230, 0 },
+	{ 0xF93, 0xF93, 0, 2 },
+	{ 0xF9D, 0xF9D, 0, 2 },
+	{ 0xFA2, 0xFA2, 0, 2 },
+	{ 0xFA7, 0xFA7, 0, 2 },
+	{ 0xFAC, 0xFAC, 0, 2 },
+	{ 0xFB9, 0xFB9, 0, 2 },
+	{ 0xFC6, 0xFC6, 220, 0 },
+	{ 0x102E, 0x102E, 0, 1 },
+	{ 0x1037, 0x1037, 7, 0 },
+	{ 0x1039, 0x103A, 9, 0 },
+	{ 0x108D, 0x108D, 220, 0 },
+	{ 0x1161, 0x1175, 0, 1 },
+	{ 0x11A8, 0x11C2, 0, 1 },
+	{ 0x135D, 0x135F, 230, 0 },
+	{ 0x1714, 0x1715, 9, 0 },
+	{ 0x1734, 0x1734, 9, 0 },
+	{ 0x17D2, 0x17D2, 9, 0 },
+	{ 0x17DD, 0x17DD, 230, 0 },
+	{ 0x18A9, 0x18A9, 228, 0 },
+	{ 0x1939, 0x1939, 222, 0 },
+	{ 0x193A, 0x193A, 230, 0 },
+	{ 0x193B, 0x193B, 220, 0 },
+	{ 0x1A17, 0x1A17, 230, 0 },
+	{ 0x1A18, 0x1A18, 220, 0 },
+	{ 0x1A60, 0x1A60, 9, 0 },
+	{ 0x1A75, 0x1A7C, 230, 0 },
+	{ 0x1A7F, 0x1A7F, 220, 0 },
+	{ 0x1AB0, 0x1AB4, 230, 0 },
+	{ 0x1AB5, 0x1ABA, 220, 0 },
+	{ 0x1ABB, 0x1ABC, 230, 0 },
+	{ 0x1ABD, 0x1ABD, 220, 0 },
+	{ 0x1ABF, 0x1AC0, 220, 0 },
+	{ 0x1AC1, 0x1AC2, 230, 0 },
+	{ 0x1AC3, 0x1AC4, 220, 0 },
+	{ 0x1AC5, 0x1AC9, 230, 0 },
+	{ 0x1ACA, 0x1ACA, 220, 0 },
+	{ 0x1ACB, 0x1ACE, 230, 0 },
+	{ 0x1B34, 0x1B34, 7, 0 },
+	{ 0x1B35, 0x1B35, 0, 1 },
+	{ 0x1B44, 0x1B44, 9, 0 },
+	{ 0x1B6B, 0x1B6B, 230, 0 },
+	{ 0x1B6C, 0x1B6C, 220, 0 },
+	{ 0x1B6D, 0x1B73, 230, 0 },
+	{ 0x1BAA, 0x1BAB, 9, 0 },
+	{ 0x1BE6, 0x1BE6, 7, 0 },
+	{ 0x1BF2, 0x1BF3, 9, 0 },
+	{ 0x1C37, 0x1C37, 7, 0 },
+	{ 0x1CD0, 0x1CD2, 230, 0 },
+	{ 0x1CD4, 0x1CD4, 1, 0 },
+	{ 0x1CD5, 0x1CD9, 220, 0 },
+	{ 0x1CDA, 0x1CDB, 230, 0 },
+	{ 0x1CDC, 0x1CDF, 220, 0 },
+	{ 0x1CE0, 0x1CE0, 230, 0 },
+	{ 0x1CE2, 0x1CE8, 1, 0 },
+	{ 0x1CED, 0x1CED, 220, 0 },
+	{ 0x1CF4, 0x1CF4, 230, 0 },
+	{ 0x1CF8, 0x1CF9, 230, 0 },
+	{ 0x1DC0, 0x1DC1, 230, 0 },
+	{ 0x1DC2, 0x1DC2, 220, 0 },
+	{ 0x1DC3, 0x1DC9, 230, 0 },
+	{ 0x1DCA, 0x1DCA, 220, 0 },
+	{ 0x1DCB, 0x1DCC, 230, 0 },
+	{ 0x1DCD, 0x1DCD, 234, 0 },
+	{ 0x1DCE, 0x1DCE, 214, 0 },
+	{ 0x1DCF, 0x1DCF, 220, 0 },
+	{ 0x1DD0, 0x1DD0, 202, 0 },
+	{ 0x1DD1, 0x1DF5, 230, 0 },
+	{ 0x1DF6, 0x1DF6, 232, 0 },
+	{ 0x1DF7, 0x1DF8, 228, 0 },
+	{ 0x1DF9, 0x1DF9, 220, 0 },
+	{ 0x1DFA, 0x1DFA, 218, 0 },
+	{ 0x1DFB, 0x1DFB, 230, 0 },
+	{ 0x1DFC, 0x1DFC, 233, 0 },
+	{ 0x1DFD, 0x1DFD, 220, 0 },
+	{ 0x1DFE, 0x1DFE, 230, 0 },
+	{ 0x1DFF, 0x1DFF, 220, 0 },
+	{ 0x1F71, 0x1F71, 0, 2 },
+	{ 0x1F73, 0x1F73, 0, 2 },
+	{ 0x1F75, 0x1F75, 0, 2 },
+	{ 0x1F77, 0x1F77, 0, 2 },
+	{ 0x1F79, 0x1F79, 0, 2 },
+	{ 0x1F7B, 0x1F7B, 0, 2 },
+	{ 0x1F7D, 0x1F7D, 0, 2 },
+	{ 0x1FBB, 0x1FBB, 0, 2 },
+	{ 0x1FBE, 0x1FBE, 0, 2 },
+	{ 0x1FC9, 0x1FC9, 0, 2 },
+	{ 0x1FCB, 0x1FCB, 0, 2 },
+	{ 0x1FD3, 0x1FD3, 0, 2 },
+	{ 0x1FDB, 0x1FDB, 0, 2 },
+	{ 0x1FE3, 0x1FE3, 0, 2 },
+	{ 0x1FEB, 0x1FEB, 0, 2 },
+	{ 0x1FEE, 0x1FEF, 0, 2 },
+	{ 0x1FF9, 0x1FF9, 0, 2 },
+	{ 0x1FFB, 0x1FFB, 0, 2 },
+	{ 0x1FFD, 0x1FFD, 0, 2 },
+	{ 0x2000, 0x2001, 0, 2 },
+	{ 0x20D0, 0x20D1, 230, 0 },
+	{ 0x20D2, 0x20D3, 1, 0 },
+	{ 0x20D4, 0x20D7, 230, 0 },
+	{ 0x20D8, 0x20DA, 1, 0 },
+	{ 0x20DB, 0x20DC, 230, 0 },
+	{ 0x20E1, 0x20E1, 230, 0 },
+	{ 0x20E5, 0x20E6, 1, 0 },
+	{ 0x20E7, 0x20E7, 230, 0 },
+	{ 0x20E8, 0x20E8, 220, 0 },
+	{ 0x20E9, 0x20E9, 230, 0 },
+	{ 0x20EA, 0x20EB, 1, 0 },
+	{ 0x20EC, 0x20EF, 220, 0 },
+	{ 0x20F0, 0x20F0, 230, 0 },
+	{ 0x2126, 0x2126, 0, 2 },
+	{ 0x212A, 0x212B, 0, 2 },
+	{ 0x2329, 0x232A, 0, 2 },
+	{ 0x2ADC, 0x2ADC, 0, 2 },
+	{ 0x2CEF, 0x2CF1, 230, 0 },
+	{ 0x2D7F, 0x2D7F, 9, 0 },
+	{ 0x2DE0, 0x2DFF, 230, 0 },
+	{ 0x302A, 0x302A, 218, 0 },
+	{ 0x302B, 0x302B, 228, 0 },
+	{ 0x302C, 0x302C, 232, 0 },
+	{ 0x302D, 0x302D, 222, 0 },
+	{ 0x302E, 0x302F, 224, 0 },
+	{ 0x3099, 0x309A, 8, 1 },
+	{ 0xA66F, 0xA66F, 230, 0 },
+	{ 0xA674, 0xA67D, 230, 0 },
+	{ 0xA69E, 0xA69F, 230, 0 },
+	{ 0xA6F0, 0xA6F1, 230, 0 },
+	{ 0xA806, 0xA806, 9, 0 },
+	{ 0xA82C, 0xA82C, 9, 0 },
+	{ 0xA8C4, 0xA8C4, 9, 0 },
+	{ 0xA8E0, 0xA8F1, 230, 0 },
+	{ 0xA92B, 0xA92D, 220, 0 },
+	{ 0xA953, 0xA953, 9, 0 },
+	{ 0xA9B3, 0xA9B3, 7, 0 },
+	{ 0xA9C0, 0xA9C0, 9, 0 },
+	{ 0xAAB0, 0xAAB0, 230, 0 },
+	{ 0xAAB2, 0xAAB3, 230, 0 },
+	{ 0xAAB4, 0xAAB4, 220, 0 },
+	{ 0xAAB7, 0xAAB8, 230, 0 },
+	{ 0xAABE, 0xAABF, 230, 0 },
+	{ 0xAAC1, 0xAAC1, 230, 0 },
+	{ 0xAAF6, 0xAAF6, 9, 0 },
+	{ 0xABED, 0xABED, 9, 0 },
+	{ 0xF900, 0xFA0D, 0, 2 },
+	{ 0xFA10, 0xFA10, 0, 2 },
+	{ 0xFA12, 0xFA12, 0, 2 },
+	{ 0xFA15, 0xFA1E, 0, 2 },
+	{ 0xFA20, 0xFA20, 0, 2 },
+	{ 0xFA22, 0xFA22, 0, 2 },
+	{ 0xFA25, 0xFA26, 0, 2 },
+	{ 0xFA2A, 0xFA6D, 0, 2 },
+	{ 0xFA70, 0xFAD9, 0, 2 },
+	{ 0xFB1D, 0xFB1D, 0, 2 },
+	{ 0xFB1E, 0xFB1E, 26, 0 },
+	{ 0xFB1F, 0xFB1F, 0, 2 },
+	{ 0xFB2A, 0xFB36, 0, 2 },
+	{ 0xFB38, 0xFB3C, 0, 2 },
+	{ 0xFB3E, 0xFB3E, 0, 2 },
+	{ 0xFB40, 0xFB41, 0, 2 },
+	{ 0xFB43, 0xFB44, 0, 2 },
+	{ 0xFB46, 0xFB4E, 0, 2 },
+	{ 0xFE20, 0xFE26, 230, 0 },
+	{ 0xFE27, 0xFE2D, 220, 0 },
+	{ 0xFE2E, 0xFE2F, 230, 0 },
+	{ 0x101FD, 0x101FD, 220, 0 },
+	{ 0x102E0, 0x102E0, 220, 0 },
+	{ 0x10376, 0x1037A, 230, 0 },
+	{ 0x10A0D, 0x10A0D, 220, 0 },
+	{ 0x10A0F, 0x10A0F, 230, 0 },
+	{ 0x10A38, 0x10A38, 230, 0 },
+	{ 0x10A39, 0x10A39, 1, 0 },
+	{ 0x10A3A, 0x10A3A, 220, 0 },
+	{ 0x10A3F, 0x10A3F, 9, 0 },
+	{ 0x10AE5, 0x10AE5, 230, 0 },
+	{ 0x10AE6, 0x10AE6, 220, 0 },
+	{ 0x10D24, 0x10D27, 230, 0 },
+	{ 0x10EAB, 0x10EAC, 230, 0 },
+	{ 0x10F46, 0x10F47, 220, 0 },
+	{ 0x10F48, 0x10F4A, 230, 0 },
+	{ 0x10F4B, 0x10F4B, 220, 0 },
+	{ 0x10F4C, 0x10F4C, 230, 0 },
+	{ 0x10F4D, 0x10F50, 220, 0 },
+	{ 0x10F82, 0x10F82, 230, 0 },
+	{ 0x10F83, 0x10F83, 220, 0 },
+	{ 0x10F84, 0x10F84, 230, 0 },
+	{ 0x10F85, 0x10F85, 220, 0 },
+	{ 0x11046, 0x11046, 9, 0 },
+	{ 0x11070, 0x11070, 9, 0 },
+	{ 0x1107F, 0x1107F, 9, 0 },
+	{ 0x110B9, 0x110B9, 9, 0 },
+	{ 0x110BA, 0x110BA, 7, 1 },
+	{ 0x11100, 0x11102, 230, 0 },
+	{ 0x11127, 0x11127, 0, 1 },
+	{ 0x11133, 0x11134, 9, 0 },
+	{ 0x11173, 0x11173, 7, 0 },
+	{ 0x111C0, 0x111C0, 9, 0 },
+	{ 0x111CA, 0x111CA, 7, 0 },
+	{ 0x11235, 0x11235, 9, 0 },
+	{ 0x11236, 0x11236, 7, 0 },
+	{ 0x112E9, 0x112E9, 7, 0 },
+	{ 0x112EA, 0x112EA, 9, 0 },
+	{ 0x1133B, 0x1133C, 7, 0 },
+	{ 0x1133E, 0x1133E, 0, 1 },
+	{ 0x1134D, 0x1134D, 9, 0 },
+	{ 0x11357, 0x11357, 0, 1 },
+	{ 0x11366, 0x1136C, 230, 0 },
+	{ 0x11370, 0x11374, 230, 0 },
+	{ 0x11442, 0x11442, 9, 0 },
+	{ 0x11446, 0x11446, 7, 0 },
+	{ 0x1145E, 0x1145E, 230, 0 },
+	{ 0x114B0, 0x114B0, 0, 1 },
+	{ 0x114BA, 0x114BA, 0, 1 },
+	{ 0x114BD, 0x114BD, 0, 1 },
+	{ 0x114C2, 0x114C2, 9, 0 },
+	{ 0x114C3, 0x114C3, 7, 0 },
+	{ 0x115AF, 0x115AF, 0, 1 },
+	{ 0x115BF, 0x115BF, 9, 0 },
+	{ 0x115C0, 0x115C0, 7, 0 },
+	{ 0x1163F, 0x1163F, 9, 0 },
+	{ 0x116B6, 0x116B6, 9, 0 },
+	{ 0x116B7, 0x116B7, 7, 0 },
+	{ 0x1172B, 0x1172B, 9, 0 },
+	{ 0x11839, 0x11839, 9, 0 },
+	{ 0x1183A, 0x1183A, 7, 0 },
+	{ 0x11930, 0x11930, 0, 1 },
+	{ 0x1193D, 0x1193E, 9, 0 },
+	{ 0x11943, 0x11943, 7, 0 },
+	{ 0x119E0, 0x119E0, 9, 0 },
+	{ 0x11A34, 0x11A34, 9, 0 },
+	{ 0x11A47, 0x11A47, 9, 0 },
+	{ 0x11A99, 0x11A99, 9, 0 },
+	{ 0x11C3F, 0x11C3F, 9, 0 },
+	{ 0x11D42, 0x11D42, 7, 0 },
+	{ 0x11D44, 0x11D45, 9, 0 },
+	{ 0x11D97, 0x11D97, 9, 0 },
+	{ 0x16AF0, 0x16AF4, 1, 0 },
+	{ 0x16B30, 0x16B36, 230, 0 },
+	{ 0x16FF0, 0x16FF1, 6, 0 },
+	{ 0x1BC9E, 0x1BC9E, 1, 0 },
+	{ 0x1D15E, 0x1D164, 0, 2 },
+	{ 0x1D165, 0x1D166, 216, 0 },
+	{ 0x1D167, 0x1D169, 1, 0 },
+	{ 0x1D16D, 0x1D16D, 226, 0 },
+	{ 0x1D16E, 0x1D172, 216, 0 },
+	{ 0x1D17B, 0x1D182, 220, 0 },
+	{ 0x1D185, 0x1D189, 230, 0 },
+	{ 0x1D18A, 0x1D18B, 220, 0 },
+	{ 0x1D1AA, 0x1D1AD, 230, 0 },
+	{ 0x1D1BB, 0x1D1C0, 0, 2 },
+	{ 0x1D242, 0x1D244, 230, 0 },
+	{ 0x1E000, 0x1E006, 230, 0 },
+	{ 0x1E008, 0x1E018, 230, 0 },
+	{ 0x1E01B, 0x1E021, 230, 0 },
+	{ 0x1E023, 0x1E024, 230, 0 },
+	{ 0x1E026, 0x1E02A, 230, 0 },
+	{ 0x1E130, 0x1E136, 230, 0 },
+	{ 0x1E2AE, 0x1E2AE, 230, 0 },
+	{ 0x1E2EC, 0x1E2EF, 230, 0 },
+	{ 0x1E8D0, 0x1E8D6, 220, 0 },
+	{ 0x1E944, 0x1E949, 230, 0 },
+	{ 0x1E94A, 0x1E94A, 7, 0 },
+	{ 0x2F800, 0x2FA1D, 0, 2 },
+};
+
+struct Decomposition
+{
+	uint32_t code_point;
+	uint16_t offset;
+	uint16_t length;
+};
+
+// Full canonical decompositions, in order of code point, other than
+// Hangul syllables. Each is 'length' code points at 'offset' in kDecomposed.
+const Decomposition kDecompositions[] = {
+	{ 0xC0, 0, 2 },
+	{ 0xC1, 2, 2 },
+	{ 0xC2, 4, 2 },
+	{ 0xC3, 6, 2 },
+	{ 0xC4, 8, 2 },
+	{ 0xC5, 10, 2 },
+	{ 0xC7, 12, 2 },
+	{ 0xC8, 14, 2 },
+	{ 0xC9, 16, 2 },
+	{ 0xCA, 18, 2 },
+	{ 0xCB, 20, 2 },
+	{ 0xCC, 22, 2 },
+	{ 0xCD, 24, 2 },
+	{ 0xCE, 26, 2 },
+	{ 0xCF, 28, 2 },
+	{ 0xD1, 30, 2 },
+	{ 0xD2, 32, 2 },
+	{ 0xD3, 34, 2 },
+	{ 0xD4, 36, 2 },
+	{ 0xD5, 38, 2 },
+	{ 0xD6, 40, 2 },
+	{ 0xD9, 42, 2 },
+	{ 0xDA, 44, 2 },
+	{ 0xDB, 46, 2 },
+	{ 0xDC, 48, 2 },
+	{ 0xDD, 50, 2 },
+	{ 0xE0, 52, 2 },
+	{ 0xE1, 54, 2 },
+	{ 0xE2, 56, 2 },
+	{ 0xE3, 58, 2 },
+	{ 0xE4, 60, 2 },
+	{ 0xE5, 62, 2 },
+	{ 0xE7, 64, 2 },
+	{ 0xE8, 66, 2 },
+	{ 0xE9, 68, 2 },
+	{ 0xEA, 70, 2 },
+	{ 0xEB, 72, 2 },
+	{ 0xEC, 74, 2 },
+	{ 0xED, 76, 2 },
+	{ 0xEE, 78, 2 },
+	{ 0xEF, 80, 2 },
+	{ 0xF1, 82, 2 },
+	{ 0xF2, 84, 2 },
+	{ 0xF3, 86, 2 },
+	{ 0xF4, 88, 2 },
+	{ 0xF5, 90, 2 },
+	{ 0xF6, 92, 2 },
+	{ 0xF9, 94, 2 },
+	{ 0xFA, 96, 2 },
+	{ 0xFB, 98, 2 },
+	{ 0xFC, 100, 2 },
+	{ 0xFD, 102, 2 },
+	{ 0xFF, 104, 2 },
+	{ 0x100, 106, 2 },
+	{ 0x101, 108, 2 },
+	{ 0x102, 110, 2 },
+	{ 0x103, 112, 2 },
+	{ 0x104, 114, 2 },
+	{ 0x105, 116, 2 },
+	{ 0x106, 118, 2 },
+	{ 0x107, 120, 2 },
+	{ 0x108, 122, 2 },
+	{ 0x109, 124, 2 },
+	{ 0x10A, 126, 2 },
+	{ 0x10B, 128, 2 },
+	{ 0x10C, 130, 2 },
+	{ 0x10D, 132, 2 },
+	{ 0x10E, 134, 2 },
+	{ 0x10F, 136, 2 },
+	{ 0x112, 138, 2 },
+	{ 0x113, 140, 2 },
+	{ 0x114, 142, 2 },
+	{ 0x115, 144, 2 },
+	{ 0x116, 146, 2 },
+	{ 0x117, 148, 2 },
+	{ 0x118, 150, 2 },
+	{ 0x119, 152, 2 },
+	{ 0x11A, 154, 2 },
+	{ 0x11B, 156, 2 },
+	{ 0x11C, 158, 2 },
+	{ 0x11D, 160, 2 },
+	{ 0x11E, 162, 2 },
+	{ 0x11F, 164, 2 },
+	{ 0x120, 166, 2 },
+	{ 0x121, 168, 2 },
+	{ 0x122, 170, 2 },
+	{ 0x123, 172, 2 },
+	{ 0x124, 174, 2 },
+	{ 0x125, 176, 2 },
+	{ 0x128, 178, 2 },
+	{ 0x129, 180, 2 },
+	{ 0x12A, 182, 2 },
+	{ 0x12B, 184, 2 },
+	{ 0x12C, 186, 2 },
+	{ 0x12D, 188, 2 },
+	{ 0x12E, 190, 2 },
+	{ 0x12F, 192, 2 },
+	{ 0x130, 194, 2 },
+	{ 0x134, 196, 2 },
+	{ 0x135, 198, 2 },
+	{ 0x136, 200, 2 },
+	{ 0x137, 202, 2 },
+	{ 0x139, 204, 2 },
+	{ 0x13A, 206, 2 },
+	{ 0x13B, 208, 2 },
+	{ 0x13C, 210, 2 },
+	{ 0x13D, 212, 2 },
+	{ 0x13E, 214, 2 },
+	{ 0x143, 216, 2 },
+	{ 0x144, 218, 2 },
+	{ 0x145, 220, 2 },
+	{ 0x146, 222, 2 },
+	{ 0x147, 224, 2 },
+	{ 0x148, 226, 2 },
+	{ 0x14C, 228, 2 },
+	{ 0x14D, 230, 2 },
+	{ 0x14E, 232, 2 },
+	{ 0x14F, 234, 2 },
+	{ 0x150, 236, 2 },
+	{ 0x151, 238, 2 },
+	{ 0x154, 240, 2 },
+	{ 0x155, 242, 2 },
+	{ 0x156, 244, 2 },
+	{ 0x157, 246, 2 },
+	{ 0x158, 248, 2 },
+	{ 0x159, 250, 2 },
+	{ 0x15A, 252, 2 },
+	{ 0x15B, 254, 2 },
+	{ 0x15C, 256, 2 },
+	{ 0x15D, 258, 2 },
+	{ 0x15E, 260, 2 },
+	{ 0x15F, 262, 2 },
+	{ 0x160, 264, 2 },
+	{ 0x161, 266, 2 },
+	{ 0x162, 268, 2 },
+	{ 0x163, 270, 2 },
+	{ 0x164, 272, 2 },
+	{ 0x165, 274, 2 },
+	{ 0x168, 276, 2 },
+	{ 0x169, 278, 2 },
+	{ 0x16A, 280, 2 },
+	{ 0x16B, 282, 2 },
+	{ 0x16C, 284, 2 },
+	{ 0x16D, 286, 2 },
+	{ 0x16E, 288, 2 },
+	{ 0x16F, 290, 2 },
+	{ 0x170, 292, 2 },
+	{ 0x171, 294, 2 },
+	{ 0x172, 296, 2 },
+	{ 0x173, 298, 2 },
+	{ 0x174, 300, 2 },
+	{ 0x175, 302, 2 },
+	{ 0x176, 304, 2 },
+	{ 0x177, 306, 2 },
+	{ 0x178, 308, 2 },
+	{ 0x179, 310, 2 },
+	{ 0x17A, 312, 2 },
+	{ 0x17B, 314, 2 },
+	{ 0x17C, 316, 2 },
+	{ 0x17D, 318, 2 },
+	{ 0x17E, 320, 2 },
+	{ 0x1A0, 322, 2 },
+	{ 0x1A1, 324, 2 },
+	{ 0x1AF, 326, 2 },
+	{ 0x1B0, 328, 2 },
+	{ 0x1CD, 330, 2 },
+	{ 0x1CE, 332, 2 },
+	{ 0x1CF, 334, 2 },
+	{ 0x1D0, 336, 2 },
+	{ 0x1D1, 338, 2 },
+	{ 0x1D2, 340, 2 },
+	{ 0x1D3, 342, 2 },
+	{ 0x1D4, 344, 2 },
+	{ 0x1D5, 346, 3 },
+	{ 0x1D6, 349, 3 },
+	{ 0x1D7, 352, 3 },
+	{ 0x1D8, 355, 3 },
+	{ 0x1D9, 358, 3 },
+	{ 0x1DA, 361, 3 },
+	{ 0x1DB, 364, 3 },
+	{ 0x1DC, 367, 3 },
+	{ 0x1DE, 370, 3 },
+	{ 0x1DF, 373, 3 },
+	{ 0x1E0, 376, 3 },
+	{ 0x1E1, 379, 3 },
+	{ 0x1E2, 382, 2 },
+	{ 0x1E3, 384, 2 },
+	{ 0x1E6, 386, 2 },
+	{ 0x1E7, 388, 2 },
+	{ 0x1E8, 390, 2 },
+	{ 0x1E9, 392, 2 },
+	{ 0x1EA, 394, 2 },
+	{ 0x1EB, 396, 2 },
+	{ 0x1EC, 398, 3 },
+	{ 0x1ED, 401, 3 },
+	{ 0x1EE, 404, 2 },
+	{ 0x1EF, 406, 2 },
+	{ 0x1F0, 408, 2 },
+	{ 0x1F4, 410, 2 },
+	{ 0x1F5, 412, 2 },
+	{ 0x1F8, 414, 2 },
+	{ 0x1F9, 416, 2 },
+	{ 0x1FA, 418, 3 },
+	{ 0x1FB, 421, 3 },
+	{ 0x1FC, 424, 2 },
+	{ 0x1FD, 426, 2 },
+	{ 0x1FE, 428, 2 },
+	{ 0x1FF, 430, 2 },
+	{ 0x200, 432, 2 },
+	{ 0x201, 434, 2 },
+	{ 0x202, 436, 2 },
+	{ 0x203, 438, 2 },
+	{ 0x204, 440, 2 },
+	{ 0x205, 442, 2 },
+	{ 0x206, 444, 2 },
+	{ 0x207, 446, 2 },
+	{ 0x208, 448, 2 },
+	{ 0x209, 450, 2 },
+	{ 0x20A, 452, 2 },
+	{ 0x20B, 454, 2 },
+	{ 0x20C, 456, 2 },
+	{ 0x20D, 458, 2 },
+	{ 0x20E, 460, 2 },
+	{ 0x20F, 462, 2 },
+	{ 0x210, 464, 2 },
+	{ 0x211, 466, 2 },
+	{ 0x212, 468, 2 },
+	{ 0x213, 470, 2 },
+	{ 0x214, 472, 2 },
+	{ 0x215, 474, 2 },
+	{ 0x216, 476, 2 },
+	{ 0x217, 478, 2 },
+	{ 0x218, 480, 2 },
+	{ 0x219, 482, 2 },
+	{ 0x21A, 484, 2 },
+	{ 0x21B, 486, 2 },
+	{ 0x21E, 488, 2 },
+	{ 0x21F, 490, 2 },
+	{ 0x226, 492, 2 },
+	{ 0x227, 494, 2 },
+	{ 0x228, 496, 2 },
+	{ 0x229, 498, 2 },
+	{ 0x22A, 500, 3 },
+	{ 0x22B, 503, 3 },
+	{ 0x22C, 506, 3 },
+	{ 0x22D, 509, 3 },
+	{ 0x22E, 512, 2 },
+	{ 0x22F, 514, 2 },
+	{ 0x230, 516, 3 },
+	{ 0x231, 519, 3 },
+	{ 0x232, 522, 2 },
+	{ 0x233, 524, 2 },
+	{ 0x340, 526, 1 },
+	{ 0x341, 527, 1 },
+	{ 0x343, 528, 1 },
+	{ 0x344, 529, 2 },
+	{ 0x374, 531, 1 },
+	{ 0x37E, 532, 1 },
+	{ 0x385, 533, 2 },
+	{ 0x386, 535, 2 },
+	{ 0x387, 537, 1 },
+	{ 0x388, 538, 2 },
+	{ 0x389, 540, 2 },
+	{ 0x38A, 542, 2 },
+	{ 0x38C, 544, 2 },
+	{ 0x38E, 546, 2 },
+	{ 0x38F, 548, 2 },
+	{ 0x390, 550, 3 },
+	{ 0x3AA, 553, 2 },
+	{ 0x3AB, 555, 2 },
+	{ 0x3AC, 557, 2 },
+	{ 0x3AD, 559, 2 },
+	{ 0x3AE, 561, 2 },
+	{ 0x3AF, 563, 2 },
+	{ 0x3B0, 565, 3 },
+	{ 0x3CA, 568, 2 },
+	{ 0x3CB, 570, 2 },
+	{ 0x3CC, 572, 2 },
+	{ 0x3CD, 574, 2 },
+	{ 0x3CE, 576, 2 },
+	{ 0x3D3, 578, 2 },
+	{ 0x3D4, 580, 2 },
+	{ 0x400, 582, 2 },
+	{ 0x401, 584, 2 },
+	{ 0x403, 586, 2 },
+	{ 0x407, 588, 2 },
+	{ 0x40C, 590, 2 },
+	{ 0x40D, 592, 2 },
+	{ 0x40E, 594, 2 },
+	{ 0x419, 596, 2 },
+	{ 0x439, 598, 2 },
+	{ 0x450, 600, 2 },
+	{ 0x451, 602, 2 },
+	{ 0x453, 604, 2 },
+	{ 0x457, 606, 2 },
+	{ 0x45C, 608, 2 },
+	{ 0x45D, 610, 2 },
+	{ 0x45E, 612, 2 },
+	{ 0x476, 614, 2 },
+	{ 0x477, 616, 2 },
+	{ 0x4C1, 618, 2 },
+	{ 0x4C2, 620, 2 },
+	{ 0x4D0, 622, 2 },
+	{ 0x4D1, 624, 2 },
+	{ 0x4D2, 626, 2 },
+	{ 0x4D3, 628, 2 },
+	{ 0x4D6, 630, 2 },
+	{ 0x4D7, 632, 2 },
+	{ 0x4DA, 634, 2 },
+	{ 0x4DB, 636, 2 },
+	{ 0x4DC, 638, 2 },
+	{ 0x4DD, 640, 2 },
+	{ 0x4DE, 642, 2 },
+	{ 0x4DF, 644, 2 },
+	{ 0x4E2, 646, 2 },
+	{ 0x4E3, 648, 2 },
+	{ 0x4E4, 650, 2 },
+	{ 0x4E5, 652, 2 },
+	{ 0x4E6, 654, 2 },
+	{ 0x4E7, 656, 2 },
+	{ 0x4EA, 658, 2 },
+	{ 0x4EB, 660, 2 },
+	{ 0x4EC, 662, 2 },
+	{ 0x4ED, 664, 2 },
+	{ 0x4EE, 666, 2 },
+	{ 0x4EF, 668, 2 },
+	{ 0x4F0, 670, 2 },
+	{ 0x4F1, 672, 2 },
+	{ 0x4F2, 674, 2 },
+	{ 0x4F3, 676, 2 },
+	{ 0x4F4, 678, 2 },
+	{ 0x4F5, 680, 2 },
+	{ 0x4F8, 682, 2 },
+	{ 0x4F9, 684, 2 },
+	{ 0x622, 686, 2 },
+	{ 0x623, 688, 2 },
+	{ 0x624, 690, 2 },
+	{ 0x625, 692, 2 },
+	{ 0x626, 694, 2 },
+	{ 0x6C0, 696, 2 },
+	{ 0x6C2, 698, 2 },
+	{ 0x6D3, 700, 2 },
+	{ 0x929, 702, 2 },
+	{ 0x931, 704, 2 },
+	{ 0x934, 706, 2 },
+	{ 0x958, 708, 2 },
+	{ 0x959, 710, 2 },
+	{ 0x95A, 712, 2 },
+	{ 0x95B, 714, 2 },
+	{ 0x95C, 716, 2 },
+	{ 0x95D, 718, 2 },
+	{ 0x95E, 720, 2 },
+	{ 0x95F, 722, 2 },
+	{ 0x9CB, 724, 2 },
+	{ 0x9CC, 726, 2 },
+	{ 0x9DC, 728, 2 },
+	{ 0x9DD, 730, 2 },
+	{ 0x9DF, 732, 2 },
+	{ 0xA33, 734, 2 },
+	{ 0xA36, 736, 2 },
+	{ 0xA59, 738, 2 },
+	{ 0xA5A, 740, 2 },
+	{ 0xA5B, 742, 2 },
+	{ 0xA5E, 744, 2 },
+	{ 0xB48, 746, 2 },
+	{ 0xB4B, 748, 2 },
+	{ 0xB4C, 750, 2 },
+	{ 0xB5C, 752, 2 },
+	{ 0xB5D, 754, 2 },
+	{ 0xB94, 756, 2 },
+	{ 0xBCA, 758, 2 },
+	{ 0xBCB, 760, 2 },
+	{ 0xBCC, 762, 2 },
+	{ 0xC48, 764, 2 },
+	{ 0xCC0, 766, 2 },
+	{ 0xCC7, 768, 2 },
+	{ 0xCC8, 770, 2 },
+	{ 0xCCA, 772, 2 },
+	{ 0xCCB, 774, 3 },
+	{ 0xD4A, 777, 2 },
+	{ 0xD4B, 779, 2 },
+	{ 0xD4C, 781, 2 },
+	{ 0xDDA, 783, 2 },
+	{ 0xDDC, 785, 2 },
+	{ 0xDDD, 787, 3 },
+	{ 0xDDE, 790, 2 },
+	{ 0xF43, 792, 2 },
+	{ 0xF4D, 794, 2 },
+	{ 0xF52, 796, 2 },
+	{ 0xF57, 798, 2 },
+	{ 0xF5C, 800, 2 },
+	{ 0xF69, 802, 2 },
+	{ 0xF73, 804, 2 },
+	{ 0xF75, 806, 2 },
+	{ 0xF76, 808, 2 },
+	{ 0xF78, 810, 2 },
+	{ 0xF81, 812, 2 },
+	{ 0xF93, 814, 2 },
+	{ 0xF9D, 816, 2 },
+	{ 0xFA2, 818, 2 },
+	{ 0xFA7, 820, 2 },
+	{ 0xFAC, 822, 2 },
+	{ 0xFB9, 824, 2 },
+	{ 0x1026, 826, 2 },
+	{ 0x1B06, 828, 2 },
+	{ 0x1B08, 830, 2 },
+	{ 0x1B0A, 832, 2 },
+	{ 0x1B0C, 834, 2 },
+	{ 0x1B0E, 836, 2 },
+	{ 0x1B12, 838, 2 },
+	{ 0x1B3B, 840, 2 },
+	{ 0x1B3D, 842, 2 },
+	{ 0x1B40, 844, 2 },
+	{ 0x1B41, 846, 2 },
+	{ 0x1B43, 848, 2 },
+	{ 0x1E00, 850, 2 },
+	{ 0x1E01, 852, 2 },
+	{ 0x1E02, 854, 2 },
+	{ 0x1E03, 856, 2 },
+	{ 0x1E04, 858, 2 },
+	{ 0x1E05, 860, 2 },
+	{ 0x1E06, 862, 2 },
+	{ 0x1E07, 864, 2 },
+	{ 0x1E08, 866, 3 },
+	{ 0x1E09, 869, 3 },
+	{ 0x1E0A, 872, 2 },
+	{ 0x1E0B, 874, 2 },
+	{ 0x1E0C, 876, 2 },
+	{ 0x1E0D, 878, 2 },
+	{ 0x1E0E, 880, 2 },
+	{ 0x1E0F, 882, 2 },
+	{ 0x1E10, 884, 2 },
+	{ 0x1E11, 886, 2 },
+	{ 0x1E12, 888, 2 },
+	{ 0x1E13, 890, 2 },
+	{ 0x1E14, 892, 3 },
+	{ 0x1E15, 895, 3 },
+	{ 0x1E16, 898, 3 },
+	{ 0x1E17, 901, 3 },
+	{ 0x1E18, 904, 2 },
+	{ 0x1E19, 906, 2 },
+	{ 0x1E1A, 908, 2 },
+	{ 0x1E1B, 910, 2 },
+	{ 0x1E1C, 912, 3 },
+	{ 0x1E1D, 915, 3 },
+	{ 0x1E1E, 918, 2 },
+	{ 0x1E1F, 920, 2 },
+	{ 0x1E20, 922, 2 },
+	{ 0x1E21, 924, 2 },
+	{ 0x1E22, 926, 2 },
+	{ 0x1E23, 928, 2 },
+	{ 0x1E24, 930, 2 },
+	{ 0x1E25, 932, 2 },
+	{ 0x1E26, 934, 2 },
+	{ 0x1E27, 936, 2 },
+	{ 0x1E28, 938, 2 },
+	{ 0x1E29, 940, 2 },
+	{ 0x1E2A, 942, 2 },
+	{ 0x1E2B, 944, 2 },
+	{ 0x1E2C, 946, 2 },
+	{ 0x1E2D, 948, 2 },
+	{ 0x1E2E, 950, 3 },
+	{ 0x1E2F, 953, 3 },
+	{ 0x1E30, 956, 2 },
+	{ 0x1E31, 958, 2 },
+	{ 0x1E32, 960, 2 },
+	{ 0x1E33, 962, 2 },
+	{ 0x1E34, 964, 2 },
+	{ 0x1E35, 966, 2 },
+	{ 0x1E36, 968, 2 },
+	{ 0x1E37, 970, 2 },
+	{ 0x1E38, 972, 3 },
+	{ 0x1E39, 975, 3 },
+	{ 0x1E3A, 978, 2 },
+	{ 0x1E3B, 980, 2 },
+	{ 0x1E3C, 982, 2 },
+	{ 0x1E3D, 984, 2 },
+	{ 0x1E3E, 986, 2 },
+	{ 0x1E3F, 988, 2 },
+	{ 0x1E40, 990, 2 },
+	{ 0x1E41, 992, 2 },
+	{ 0x1E42, 994, 2 },
+	{ 0x1E43, 996, 2 },
+	{ 0x1E44, 998, 2 },
+	{ 0x1E45, 1000, 2 },
+	{ 0x1E46, 1002, 2 },
+	{ 0x1E47, 1004, 2 },
+	{ 0x1E48, 1006, 2 },
+	{ 0x1E49, 1008, 2 },
+	{ 0x1E4A, 1010, 2 },
+	{ 0x1E4B, 1012, 2 },
+	{ 0x1E4C, 1014, 3 },
+	{ 0x1E4D, 1017, 3 },
+	{ 0x1E4E, 1020, 3 },
+	{ 0x1E4F, 1023, 3 },
+	{ 0x1E50, 1026, 3 },
+	{ 0x1E51, 1029, 3 },
+	{ 0x1E52, 1032, 3 },
+	{ 0x1E53, 1035, 3 },
+	{ 0x1E54, 1038, 2 },
+	{ 0x1E55, 1040, 2 },
+	{ 0x1E56, 1042, 2 },
+	{ 0x1E57, 1044, 2 },
+	{ 0x1E58, 1046, 2 },
+	{ 0x1E59, 1048, 2 },
+	{ 0x1E5A, 1050, 2 },
+	{ 0x1E5B, 1052, 2 },
+	{ 0x1E5C, 1054, 3 },
+	{ 0x1E5D, 1057, 3 },
+	{ 0x1E5E, 1060, 2 },
+	{ 0x1E5F, 1062, 2 },
+	{ 0x1E60, 1064, 2 },
+	{ 0x1E61, 1066, 2 },
+	{ 0x1E62, 1068, 2 },
+	{ 0x1E63, 1070, 2 },
+	{ 0x1E64, 1072, 3 },
+	{ 0x1E65, 1075, 3 },
+	{ 0x1E66, 1078, 3 },
+	{ 0x1E67, 1081, 3 },
+	{ 0x1E68, 1084, 3 },
+	{ 0x1E69, 1087, 3 },
+	{ 0x1E6A, 1090, 2 },
+	{ 0x1E6B, 1092, 2 },
+	{ 0x1E6C, 1094, 2 },
+	{ 0x1E6D, 1096, 2 },
+	{ 0x1E6E, 1098, 2 },
+	{ 0x1E6F, 1100, 2 },
+	{ 0x1E70, 1102, 2 },
+	{ 0x1E71, 1104, 2 },
+	{ 0x1E72, 1106, 2 },
+	{ 0x1E73, 1108, 2 },
+	{ 0x1E74, 1110, 2 },
+	{ 0x1E75, 1112, 2 },
+	{ 0x1E76, 1114, 2 },
+	{ 0x1E77, 1116, 2 },
+	{ 0x1E78, 1118, 3 },
+	{ 0x1E79, 1121, 3 },
+	{ 0x1E7A, 1124, 3 },
+	{ 0x1E7B, 1127, 3 },
+	{ 0x1E7C, 1130, 2 },
+	{ 0x1E7D, 1132, 2 },
+	{ 0x1E7E, 1134, 2 },
+	{ 0x1E7F, 1136, 2 },
+	{ 0x1E80, 1138, 2 },
+	{ 0x1E81, 1140, 2 },
+	{ 0x1E82, 1142, 2 },
+	{ 0x1E83, 1144, 2 },
+	{ 0x1E84, 1146, 2 },
+	{ 0x1E85, 1148, 2 },
+	{ 0x1E86, 1150, 2 },
+	{ 0x1E87, 1152, 2 },
+	{ 0x1E88, 1154, 2 },
+	{ 0x1E89, 1156, 2 },
+	{ 0x1E8A, 1158, 2 },
+	{ 0x1E8B, 1160, 2 },
+	{ 0x1E8C, 1162, 2 },
+	{ 0x1E8D, 1164, 2 },
+	{ 0x1E8E, 1166, 2 },
+	{ 0x1E8F, 1168, 2 },
+	{ 0x1E90, 1170, 2 },
+	{ 0x1E91, 1172, 2 },
+	{ 0x1E92, 1174, 2 },
+	{ 0x1E93, 1176, 2 },
+	{ 0x1E94, 1178, 2 },
+	{ 0x1E95, 1180, 2 },
+	{ 0x1E96, 1182, 2 },
+	{ 0x1E97, 1184, 2 },
+	{ 0x1E98, 1186, 2 },
+	{ 0x1E99, 1188, 2 },
+	{ 0x1E9B, 1190, 2 },
+	{ 0x1EA0, 1192, 2 },
+	{ 0x1EA1, 1194, 2 },
+	{ 0x1EA2, 1196, 2 },
+	{ 0x1EA3, 1198, 2 },
+	{ 0x1EA4, 1200, 3 },
+	{ 0x1EA5, 1203, 3 },
+	{ 0x1EA6, 1206, 3 },
+	{ 0x1EA7, 1209, 3 },
+	{ 0x1EA8, 1212, 3 },
+	{ 0x1EA9, 1215, 3 },
+	{ 0x1EAA, 1218, 3 },
+	{ 0x1EAB, 1221, 3 },
+	{ 0x1EAC, 1224, 3 },
+	{ 0x1EAD, 1227, 3 },
+	{ 0x1EAE, 1230, 3 },
+	{ 0x1EAF, 1233, 3 },
+	{ 0x1EB0, 1236, 3 },
+	{ 0x1EB1, 1239, 3 },
+	{ 0x1EB2, 1242, 3 },
+	{ 0x1EB3, 1245, 3 },
+	{ 0x1EB4, 1248, 3 },
+	{ 0x1EB5, 1251, 3 },
+	{ 0x1EB6, 1254, 3 },
+	{ 0x1EB7, 1257, 3 },
+	{ 0x1EB8, 1260, 2 },
+	{ 0x1EB9, 1262, 2 },
+	{ 0x1EBA, 1264, 2 },
+	{ 0x1EBB, 1266, 2 },
+	{ 0x1EBC, 1268, 2 },
+	{ 0x1EBD, 1270, 2 },
+	{ 0x1EBE, 1272, 3 },
+	{ 0x1EBF, 1275, 3 },
+	{ 0x1EC0, 1278, 3 },
+	{ 0x1EC1, 1281, 3 },
+	{ 0x1EC2, 1284, 3 },
+	{ 0x1EC3, 1287, 3 },
+	{ 0x1EC4, 1290, 3 },
+	{ 0x1EC5, 1293, 3 },
+	{ 0x1EC6, 1296, 3 },
+	{ 0x1EC7, 1299, 3 },
+	{ 0x1EC8, 1302, 2 },
+	{ 0x1EC9, 1304, 2 },
+	{ 0x1ECA, 1306, 2 },
+	{ 0x1ECB, 1308, 2 },
+	{ 0x1ECC, 1310, 2 },
+	{ 0x1ECD, 1312, 2 },
+	{ 0x1ECE, 1314, 2 },
+	{ 0x1ECF, 1316, 2 },
+	{ 0x1ED0, 1318, 3 },
+	{ 0x1ED1, 1321, 3 },
+	{ 0x1ED2, 1324, 3 },
+	{ 0x1ED3, 1327, 3 },
+	{ 0x1ED4, 1330, 3 },
+	{ 0x1ED5, 1333, 3 },
+	{ 0x1ED6, 1336, 3 },
+	{ 0x1ED7, 1339, 3 },
+	{ 0x1ED8, 1342, 3 },
+	{ 0x1ED9, 1345, 3 },
+	{ 0x1EDA, 1348, 3 },
+	{ 0x1EDB, 1351, 3 },
+	{ 0x1EDC, 1354, 3 },
+	{ 0x1EDD, 1357, 3 },
+	{ 0x1EDE, 1360, 3 },
+	{ 0x1EDF, 1363, 3 },
+	{ 0x1EE0, 1366, 3 },
+	{ 0x1EE1, 1369, 3 },
+	{ 0x1EE2, 1372, 3 },
+	{ 0x1EE3, 1375, 3 },
+	{ 0x1EE4, 1378, 2 },
+	{ 0x1EE5, 1380, 2 },
+	{ 0x1EE6, 1382, 2 },
+	{ 0x1EE7, 1384, 2 },
+	{ 0x1EE8, 1386, 3 },
+	{ 0x1EE9, 1389, 3 },
+	{ 0x1EEA, 1392, 3 },
+	{ 0x1EEB, 1395, 3 },
+	{ 0x1EEC, 1398, 3 },
+	{ 0x1EED, 1401, 3 },
+	{ 0x1EEE, 1404, 3 },
+	{ 0x1EEF, 1407, 3 },
+	{ 0x1EF0, 1410, 3 },
+	{ 0x1EF1, 1413, 3 },
+	{ 0x1EF2, 1416, 2 },
+	{ 0x1EF3, 1418, 2 },
+	{ 0x1EF4, 1420, 2 },
+	{ 0x1EF5, 1422, 2 },
+	{ 0x1EF6, 1424, 2 },
+	{ 0x1EF7, 1426, 2 },
+	{ 0x1EF8, 1428, 2 },
+	{ 0x1EF9, 1430, 2 },
+	{ 0x1F00, 1432, 2 },
+	{ 0x1F01, 1434, 2 },
+	{ 0x1F02, 1436, 3 },
+	{ 0x1F03, 1439, 3 },
+	{ 0x1F04, 1442, 3 },
+	{ 0x1F05, 1445, 3 },
+	{ 0x1F06, 1448, 3 },
+	{ 0x1F07, 1451, 3 },
+	{ 0x1F08, 1454, 2 },
+	{ 0x1F09, 1456, 2 },
+	{ 0x1F0A, 1458, 3 },
+	{ 0x1F0B, 1461, 3 },
+	{ 0x1F0C, 1464, 3 },
+	{ 0x1F0D, 1467, 3 },
+	{ 0x1F0E, 1470, 3 },
+	{ 0x1F0F, 1473, 3 },
+	{ 0x1F10, 1476, 2 },
+	{ 0x1F11, 1478, 2 },
+	{ 0x1F12, 1480, 3 },
+	{ 0x1F13, 1483, 3 },
+	{ 0x1F14, 1486, 3 },
+	{ 0x1F15, 1489, 3 },
+	{ 0x1F18, 1492, 2 },
+	{ 0x1F19, 1494, 2 },
+	{ 0x1F1A, 1496, 3 },
+	{ 0x1F1B, 1499, 3 },
+	{ 0x1F1C, 1502, 3 },
+	{ 0x1F1D, 1505, 3 },
+	{ 0x1F20, 1508, 2 },
+	{ 0x1F21, 1510, 2 },
+	{ 0x1F22, 1512, 3 },
+	{ 0x1F23, 1515, 3 },
+	{ 0x1F24, 1518, 3 },
+	{ 0x1F25, 1521, 3 },
+	{ 0x1F26, 1524, 3 },
+	{ 0x1F27, 1527, 3 },
+	{ 0x1F28, 1530, 2 },
+	{ 0x1F29, 1532, 2 },
+	{ 0x1F2A, 1534, 3 },
+	{ 0x1F2B, 1537, 3 },
+	{ 0x1F2C, 1540, 3 },
+	{ 0x1F2D, 1543, 3 },
+	{ 0x1F2E, 1546, 3 },
+	{ 0x1F2F, 1549, 3 },
+	{ 0x1F30, 1552, 2 },
+	{ 0x1F31, 1554, 2 },
+	{ 0x1F32, 1556, 3 },
+	{ 0x1F33, 1559, 3 },
+	{ 0x1F34, 1562, 3 },
+	{ 0x1F35, 1565, 3 },
+	{ 0x1F36, 1568, 3 },
+	{ 0x1F37, 1571, 3 },
+	{ 0x1F38, 1574, 2 },
+	{ 0x1F39, 1576, 2 },
+	{ 0x1F3A, 1578, 3 },
+	{ 0x1F3B, 1581, 3 },
+	{ 0x1F3C, 1584, 3 },
+	{ 0x1F3D, 1587, 3 },
+	{ 0x1F3E, 1590, 3 },
+	{ 0x1F3F, 1593, 3 },
+	{ 0x1F40, 1596, 2 },
+	{ 0x1F41, 1598, 2 },
+	{ 0x1F42, 1600, 3 },
+	{ 0x1F43, 1603, 3 },
+	{ 0x1F44, 1606, 3 },
+	{ 0x1F45, 1609, 3 },
+	{ 0x1F48, 1612, 2 },
+	{ 0x1F49, 1614, 2 },
+	{ 0x1F4A, 1616, 3 },
+	{ 0x1F4B, 1619, 3 },
+	{ 0x1F4C, 1622, 3 },
+	{ 0x1F4D, 1625, 3 },
+	{ 0x1F50, 1628, 2 },
+	{ 0x1F51, 1630, 2 },
+	{ 0x1F52, 1632, 3 },
+	{ 0x1F53, 1635, 3 },
+	{ 0x1F54, 1638, 3 },
+	{ 0x1F55, 1641, 3 },
+	{ 0x1F56, 1644, 3 },
+	{ 0x1F57, 1647, 3 },
+	{ 0x1F59, 1650, 2 },
+	{ 0x1F5B, 1652, 3 },
+	{ 0x1F5D, 1655, 3 },
+	{ 0x1F5F, 1658, 3 },
+	{ 0x1F60, 1661, 2 },
+	{ 0x1F61, 1663, 2 },
+	{ 0x1F62, 1665, 3 },
+	{ 0x1F63, 1668, 3 },
+	{ 0x1F64, 1671, 3 },
+	{ 0x1F65, 1674, 3 },
+	{ 0x1F66, 1677, 3 },
+	{ 0x1F67, 1680, 3 },
+	{ 0x1F68, 1683, 2 },
+	{ 0x1F69, 1685, 2 },
+	{ 0x1F6A, 1687, 3 },
+	{ 0x1F6B, 1690, 3 },
+	{ 0x1F6C, 1693, 3 },
+	{ 0x1F6D, 1696, 3 },
+	{ 0x1F6E, 1699, 3 },
+	{ 0x1F6F, 1702, 3 },
+	{ 0x1F70, 1705, 2 },
+	{ 0x1F71, 1707, 2 },
+	{ 0x1F72, 1709, 2 },
+	{ 0x1F73, 1711, 2 },
+	{ 0x1F74, 1713, 2 },
+	{ 0x1F75, 1715, 2 },
+	{ 0x1F76, 1717, 2 },
+	{ 0x1F77, 1719, 2 },
+	{ 0x1F78, 1721, 2 },
+	{ 0x1F79, 1723, 2 },
+	{ 0x1F7A, 1725, 2 },
+	{ 0x1F7B, 1727, 2 },
+	{ 0x1F7C, 1729, 2 },
+	{ 0x1F7D, 1731, 2 },
+	{ 0x1F80, 1733, 3 },
+	{ 0x1F81, 1736, 3 },
+	{ 0x1F82, 1739, 4 },
+	{ 0x1F83, 1743, 4 },
+	{ 0x1F84, 1747, 4 },
+	{ 0x1F85, 1751, 4 },
+	{ 0x1F86, 1755, 4 },
+	{ 0x1F87, 1759, 4 },
+	{ 0x1F88, 1763, 3 },
+	{ 0x1F89, 1766, 3 },
+	{ 0x1F8A, 1769, 4 },
+	{ 0x1F8B, 1773, 4 },
+	{ 0x1F8C, 1777, 4 },
+	{ 0x1F8D, 1781, 4 },
+	{ 0x1F8E, 1785, 4 },
+	{ 0x1F8F, 1789, 4 },
+	{ 0x1F90, 1793, 3 },
+	{ 0x1F91, 1796, 3 },
+	{ 0x1F92, 1799, 4 },
+	{ 0x1F93, 1803, 4 },
+	{ 0x1F94, 1807, 4 },
+	{ 0x1F95, 1811, 4 },
+	{ 0x1F96, 1815, 4 },
+	{ 0x1F97, 1819, 4 },
+	{ 0x1F98, 1823, 3 },
+	{ 0x1F99, 1826, 3 },
+	{ 0x1F9A, 1829, 4 },
+	{ 0x1F9B, 1833, 4 },
+	{ 0x1F9C, 1837, 4 },
+	{ 0x1F9D, 1841, 4 },
+	{ 0x1F9E, 1845, 4 },
+	{ 0x1F9F, 1849, 4 },
+	{ 0x1FA0, 1853, 3 },
+	{ 0x1FA1, 1856, 3 },
+	{ 0x1FA2, 1859, 4 },
+	{ 0x1FA3, 1863, 4 },
+	{ 0x1FA4, 1867, 4 },
+	{ 0x1FA5, 1871, 4 },
+	{ 0x1FA6, 1875, 4 },
+	{ 0x1FA7, 1879, 4 },
+	{ 0x1FA8, 1883, 3 },
+	{ 0x1FA9, 1886, 3 },
+	{ 0x1FAA, 1889, 4 },
+	{ 0x1FAB, 1893, 4 },
+	{ 0x1FAC, 1897, 4 },
+	{ 0x1FAD, 1901, 4 },
+	{ 0x1FAE, 1905, 4 },
+	{ 0x1FAF, 1909, 4 },
+	{ 0x1FB0, 1913, 2 },
+	{ 0x1FB1, 1915, 2 },
+	{ 0x1FB2, 1917, 3 },
+	{ 0x1FB3, 1920, 2 },
+	{ 0x1FB4, 1922, 3 },
+	{ 0x1FB6, 1925, 2 },
+	{ 0x1FB7, 1927, 3 },
+	{ 0x1FB8, 1930, 2 },
+	{ 0x1FB9, 1932, 2 },
+	{ 0x1FBA, 1934, 2 },
+	{ 0x1FBB, 1936, 2 },
+	{ 0x1FBC, 1938, 2 },
+	{ 0x1FBE, 1940, 1 },
+	{ 0x1FC1, 1941, 2 },
+	{ 0x1FC2, 1943, 3 },
+	{ 0x1FC3, 1946, 2 },
+	{ 0x1FC4, 1948, 3 },
+	{ 0x1FC6, 1951, 2 },
+	{ 0x1FC7, 1953, 3 },
+	{ 0x1FC8, 1956, 2 },
+	{ 0x1FC9, 1958, 2 },
+	{ 0x1FCA, 1960, 2 },
+	{ 0x1FCB, 1962, 2 },
+	{ 0x1FCC, 1964, 2 },
+	{ 0x1FCD, 1966, 2 },
+	{ 0x1FCE, 1968, 2 },
+	{ 0x1FCF, 1970, 2 },
+	{ 0x1FD0, 1972, 2 },
+	{ 0x1FD1, 1974, 2 },
+	{ 0x1FD2, 1976, 3 },
+	{ 0x1FD3, 1979, 3 },
+	{ 0x1FD6, 1982, 2 },
+	{ 0x1FD7, 1984, 3 },
+	{ 0x1FD8, 1987, 2 },
+	{ 0x1FD9, 1989, 2 },
+	{ 0x1FDA, 1991, 2 },
+	{ 0x1FDB, 1993, 2 },
+	{ 0x1FDD, 1995, 2 },
+	{ 0x1FDE, 1997, 2 },
+	{ 0x1FDF, 1999, 2 },
+	{ 0x1FE0, 2001, 2 },
+	{ 0x1FE1, 2003, 2 },
+	{ 0x1FE2, 2005, 3 },
+	{ 0x1FE3, 2008, 3 },
+	{ 0x1FE4, 2011, 2 },
+	{ 0x1FE5, 2013, 2 },
+	{ 0x1FE6, 2015, 2 },
+	{ 0x1FE7, 2017, 3 },
+	{ 0x1FE8, 2020, 2 },
+	{ 0x1FE9, 2022, 2 },
+	{ 0x1FEA, 2024, 2 },
+	{ 0x1FEB, 2026, 2 },
+	{ 0x1FEC, 2028, 2 },
+	{ 0x1FED, 2030, 2 },
+	{ 0x1FEE, 2032, 2 },
+	{ 0x1FEF, 2034, 1 },
+	{ 0x1FF2, 2035, 3 },
+	{ 0x1FF3, 2038, 2 },
+	{ 0x1FF4, 2040, 3 },
+	{ 0x1FF6, 2043, 2 },
+	{ 0x1FF7, 2045, 3 },
+	{ 0x1FF8, 2048, 2 },
+	{ 0x1FF9, 2050, 2 },
+	{ 0x1FFA, 2052, 2 },
+	{ 0x1FFB, 2054, 2 },
+	{ 0x1FFC, 2056, 2 },
+	{ 0x1FFD, 2058, 1 },
+	{ 0x2000, 2059, 1 },
+	{ 0x2001, 2060, 1 },
+	{ 0x2126, 2061, 1 },
+	{ 0x212A, 2062, 1 },
+	{ 0x212B, 2063, 2 },
+	{ 0x219A, 2065, 2 },
+	{ 0x219B, 2067, 2 },
+	{ 0x21AE, 2069, 2 },
+	{ 0x21CD, 2071, 2 },
+	{ 0x21CE, 2073, 2 },
+	{ 0x21CF, 2075, 2 },
+	{ 0x2204, 2077, 2 },
+	{ 0x2209, 2079, 2 },
+	{ 0x220C, 2081, 2 },
+	{ 0x2224, 2083, 2 },
+	{ 0x2226, 2085, 2 },
+	{ 0x2241, 2087, 2 },
+	{ 0x2244, 2089, 2 },
+	{ 0x2247, 2091, 2 },
+	{ 0x2249, 2093, 2 },
+	{ 0x2260, 2095, 2 },
+	{ 0x2262, 2097, 2 },
+	{ 0x226D, 2099, 2 },
+	{ 0x226E, 2101, 2 },
+	{ 0x226F, 2103, 2 },
+	{ 0x2270, 2105, 2 },
+	{ 0x2271, 2107, 2 },
+	{ 0x2274, 2109, 2 },
+	{ 0x2275, 2111, 2 },
+	{ 0x2278, 2113, 2 },
+	{ 0x2279, 2115, 2 },
+	{ 0x2280, 2117, 2 },
+	{ 0x2281, 2119, 2 },
+	{ 0x2284, 2121, 2 },
+	{ 0x2285, 2123, 2 },
+	{ 0x2288, 2125, 2 },
+	{ 0x2289, 2127, 2 },
+	{ 0x22AC, 2129, 2 },
+	{ 0x22AD, 2131, 2 },
+	{ 0x22AE, 2133, 2 },
+	{ 0x22AF, 2135, 2 },
+	{ 0x22E0, 2137, 2 },
+	{ 0x22E1, 2139, 2 },
+	{ 0x22E2, 2141, 2 },
+	{ 0x22E3, 2143, 2 },
+	{ 0x22EA, 2145, 2 },
+	{ 0x22EB, 2147, 2 },
+	{ 0x22EC, 2149, 2 },
+	{ 0x22ED, 2151, 2 },
+	{ 0x2329, 2153, 1 },
+	{ 0x232A, 2154, 1 },
+	{ 0x2ADC, 2155, 2 },
+	{ 0x304C, 2157, 2 },
+	{ 0x304E, 2159, 2 },
+	{ 0x3050, 2161, 2 },
+	{ 0x3052, 2163, 2 },
+	{ 0x3054, 2165, 2 },
+	{ 0x3056, 2167, 2 },
+	{ 0x3058, 2169, 2 },
+	{ 0x305A, 2171, 2 },
+	{ 0x305C, 2173, 2 },
+	{ 0x305E, 2175, 2 },
+	{ 0x3060, 2177, 2 },
+	{ 0x3062, 2179, 2 },
+	{ 0x3065, 2181, 2 },
+	{ 0x3067, 2183, 2 },
+	{ 0x3069, 2185, 2 },
+	{ 0x3070, 2187, 2 },
+	{ 0x3071, 2189, 2 },
+	{ 0x3073, 2191, 2 },
+	{ 0x3074, 2193, 2 },
+	{ 0x3076, 2195, 2 },
+	{ 0x3077, 2197, 2 },
+	{ 0x3079, 2199, 2 },
+	{ 0x307A, 2201, 2 },
+	{ 0x307C, 2203, 2 },
+	{ 0x307D, 2205, 2 },
+	{ 0x3094, 2207, 2 },
+	{ 0x309E, 2209, 2 },
+	{ 0x30AC, 2211, 2 },
+	{ 0x30AE, 2213, 2 },
+	{ 0x30B0, 2215, 2 },
+	{ 0x30B2, 2217, 2 },
+	{ 0x30B4, 2219, 2 },
+	{ 0x30B6, 2221, 2 },
+	{ 0x30B8, 2223, 2 },
+	{ 0x30BA, 2225, 2 },
+	{ 0x30BC, 2227, 2 },
+	{ 0x30BE, 2229, 2 },
+	{ 0x30C0, 2231, 2 },
+	{ 0x30C2, 2233, 2 },
+	{ 0x30C5, 2235, 2 },
+	{ 0x30C7, 2237, 2 },
+	{ 0x30C9, 2239, 2 },
+	{ 0x30D0, 2241, 2 },
+	{ 0x30D1, 2243, 2 },
+	{ 0x30D3, 2245, 2 },
+	{ 0x30D4, 2247, 2 },
+	{ 0x30D6, 2249, 2 },
+	{ 0x30D7, 2251, 2 },
+	{ 0x30D9, 2253, 2 },
+	{ 0x30DA, 2255, 2 },
+	{ 0x30DC, 2257, 2 },
+	{ 0x30DD, 2259, 2 },
+	{ 0x30F4, 2261, 2 },
+	{ 0x30F7, 2263, 2 },
+	{ 0x30F8, 2265, 2 },
+	{ 0x30F9, 2267, 2 },
+	{ 0x30FA, 2269, 2 },
+	{ 0x30FE, 2271, 2 },
+	{ 0xF900, 2273, 1 },
+	{ 0xF901, 2274, 1 },
+	{ 0xF902, 2275, 1 },
+	{ 0xF903, 2276, 1 },
+	{ 0xF904, 2277, 1 },
+	{ 0xF905, 2278, 1 },
+	{ 0xF906, 2279, 1 },
+	{ 0xF907, 2280, 1 },
+	{ 0xF908, 2281, 1 },
+	{ 0xF909, 2282, 1 },
+	{ 0xF90A, 2283, 1 },
+	{ 0xF90B, 2284, 1 },
+	{ 0xF90C, 2285, 1 },
+	{ 0xF90D, 2286, 1 },
+	{ 0xF90E, 2287, 1 },
+	{ 0xF90F, 2288, 1 },
+	{ 0xF910, 2289, 1 },
+	{ 0xF911, 2290, 1 },
+	{ 0xF912, 2291, 1 },
+	{ 0xF913, 2292, 1 },
+	{ 0xF914, 2293, 1 },
+	{ 0xF915, 2294, 1 },
+	{ 0xF916, 2295, 1 },
+	{ 0xF917, 2296, 1 },
+	{ 0xF918, 2297, 1 },
+	{ 0xF919, 2298, 1 },
+	{ 0xF91A, 2299, 1 },
+	{ 0xF91B, 2300, 1 },
+	{ 0xF91C, 2301, 1 },
+	{ 0xF91D, 2302, 1 },
+	{ 0xF91E, 2303, 1 },
+	{ 0xF91F, 2304, 1 },
+	{ 0xF920, 2305, 1 },
+	{ 0xF921, 2306, 1 },
+	{ 0xF922, 2307, 1 },
+	{ 0xF923, 2308, 1 },
+	{ 0xF924, 2309, 1 },
+	{ 0xF925, 2310, 1 },
+	{ 0xF926, 2311, 1 },
+	{ 0xF927, 2312, 1 },
+	{ 0xF928, 2313, 1 },
+	{ 0xF929, 2314, 1 },
+	{ 0xF92A, 2315, 1 },
+	{ 0xF92B, 2316, 1 },
+	{ 0xF92C, 2317, 1 },
+	{ 0xF92D, 2318, 1 },
+	{ 0xF92E, 2319, 1 },
+	{ 0xF92F, 2320, 1 },
+	{ 0xF930, 2321, 1 },
+	{ 0xF931, 2322, 1 },
+	{ 0xF932, 2323, 1 },
+	{ 0xF933, 2324, 1 },
+	{ 0xF934, 2325, 1 },
+	{ 0xF935, 2326, 1 },
+	{ 0xF936, 2327, 1 },
+	{ 0xF937, 2328, 1 },
+	{ 0xF938, 2329, 1 },
+	{ 0xF939, 2330, 1 },
+	{ 0xF93A, 2331, 1 },
+	{ 0xF93B, 2332, 1 },
+	{ 0xF93C, 2333, 1 },
+	{ 0xF93D, 2334, 1 },
+	{ 0xF93E, 2335, 1 },
+	{ 0xF93F, 2336, 1 },
+	{ 0xF940, 2337, 1 },
+	{ 0xF941, 2338, 1 },
+	{ 0xF942, 2339, 1 },
+	{ 0xF943, 2340, 1 },
+	{ 0xF944, 2341, 1 },
+	{ 0xF945, 2342, 1 },
+	{ 0xF946, 2343, 1 },
+	{ 0xF947, 2344, 1 },
+	{ 0xF948, 2345, 1 },
+	{ 0xF949, 2346, 1 },
+	{ 0xF94A, 2347, 1 },
+	{ 0xF94B, 2348, 1 },
+	{ 0xF94C, 2349, 1 },
+	{ 0xF94D, 2350, 1 },
+	{ 0xF94E, 2351, 1 },
+	{ 0xF94F, 2352, 1 },
+	{ 0xF950, 2353, 1 },
+	{ 0xF951, 2354, 1 },
+	{ 0xF952, 2355, 1 },
+	{ 0xF953, 2356, 1 },
+	{ 0xF954, 2357, 1 },
+	{ 0xF955, 2358, 1 },
+	{ 0xF956, 2359, 1 },
+	{ 0xF957, 2360, 1 },
+	{ 0xF958, 2361, 1 },
+	{ 0xF959, 2362, 1 },
+	{ 0xF95A, 2363, 1 },
+	{ 0xF95B, 2364, 1 },
+	{ 0xF95C, 2365, 1 },
+	{ 0xF95D, 2366, 1 },
+	{ 0xF95E, 2367, 1 },
+	{ 0xF95F, 2368, 1 },
+	{ 0xF960, 2369, 1 },
+	{ 0xF961, 2370, 1 },
+	{ 0xF962, 2371, 1 },
+	{ 0xF963, 2372, 1 },
+	{ 0xF964, 2373, 1 },
+	{ 0xF965, 2374, 1 },
+	{ 0xF966, 2375, 1 },
+	{ 0xF967, 2376, 1 },
+	{ 0xF968, 2377, 1 },
+	{ 0xF969, 2378, 1 },
+	{ 0xF96A, 2379, 1 },
+	{ 0xF96B, 2380, 1 },
+	{ 0xF96C, 2381, 1 },
+	{ 0xF96D, 2382, 1 },
+	{ 0xF96E, 2383, 1 },
+	{ 0xF96F, 2384, 1 },
+	{ 0xF970, 2385, 1 },
+	{ 0xF971, 2386, 1 },
+	{ 0xF972, 2387, 1 },
+	{ 0xF973, 2388, 1 },
+	{ 0xF974, 2389, 1 },
+	{ 0xF975, 2390, 1 },
+	{ 0xF976, 2391, 1 },
+	{ 0xF977, 2392, 1 },
+	{ 0xF978, 2393, 1 },
+	{ 0xF979, 2394, 1 },
+	{ 0xF97A, 2395, 1 },
+	{ 0xF97B, 2396, 1 },
+	{ 0xF97C, 2397, 1 },
+	{ 0xF97D, 2398, 1 },
+	{ 0xF97E, 2399, 1 },
+	{ 0xF97F, 2400, 1 },
+	{ 0xF980, 2401, 1 },
+	{ 0xF981, 2402, 1 },
+	{ 0xF982, 2403, 1 },
+	{ 0xF983, 2404, 1 },
+	{ 0xF984, 2405, 1 },
+	{ 0xF985, 2406, 1 },
+	{ 0xF986, 2407, 1 },
+	{ 0xF987, 2408, 1 },
+	{ 0xF988, 2409, 1 },
+	{ 0xF989, 2410, 1 },
+	{ 0xF98A, 2411, 1 },
+	{ 0xF98B, 2412, 1 },
+	{ 0xF98C, 2413, 1 },
+	{ 0xF98D, 2414, 1 },
+	{ 0xF98E, 2415, 1 },
+	{ 0xF98F, 2416, 1 },
+	{ 0xF990, 2417, 1 },
+	{ 0xF991, 2418, 1 },
+	{ 0xF992, 2419, 1 },
+	{ 0xF993, 2420, 1 },
+	{ 0xF994, 2421, 1 },
+	{ 0xF995, 2422, 1 },
+	{ 0xF996, 2423, 1 },
+	{ 0xF997, 2424, 1 },
+	{ 0xF998, 2425, 1 },
+	{ 0xF999, 2426, 1 },
+	{ 0xF99A, 2427, 1 },
+	{ 0xF99B, 2428, 1 },
+	{ 0xF99C, 2429, 1 },
+	{ 0xF99D, 2430, 1 },
+	{ 0xF99E, 2431, 1 },
+	{ 0xF99F, 2432, 1 },
+	{ 0xF9A0, 2433, 1 },
+	{ 0xF9A1, 2434, 1 },
+	{ 0xF9A2, 2435, 1 },
+	{ 0xF9A3, 2436, 1 },
+	{ 0xF9A4, 2437, 1 },
+	{ 0xF9A5, 2438, 1 },
+	{ 0xF9A6, 2439, 1 },
+	{ 0xF9A7, 2440, 1 },
+	{ 0xF9A8, 2441, 1 },
+	{ 0xF9A9, 2442, 1 },
+	{ 0xF9AA, 2443, 1 },
+	{ 0xF9AB, 2444, 1 },
+	{ 0xF9AC, 2445, 1 },
+	{ 0xF9AD, 2446, 1 },
+	{ 0xF9AE, 2447, 1 },
+	{ 0xF9AF, 2448, 1 },
+	{ 0xF9B0, 2449, 1 },
+	{ 0xF9B1, 2450, 1 },
+	{ 0xF9B2, 2451, 1 },
+	{ 0xF9B3, 2452, 1 },
+	{ 0xF9B4, 2453, 1 },
+	{ 0xF9B5, 2454, 1 },
+	{ 0xF9B6, 2455, 1 },
+	{ 0xF9B7, 2456, 1 },
+	{ 0xF9B8, 2457, 1 },
+	{ 0xF9B9, 2458, 1 },
+	{ 0xF9BA, 2459, 1 },
+	{ 0xF9BB, 2460, 1 },
+	{ 0xF9BC, 2461, 1 },
+	{ 0xF9BD, 2462, 1 },
+	{ 0xF9BE, 2463, 1 },
+	{ 0xF9BF, 2464, 1 },
+	{ 0xF9C0, 2465, 1 },
+	{ 0xF9C1, 2466, 1 },
+	{ 0xF9C2, 2467, 1 },
+	{ 0xF9C3, 2468, 1 },
+	{ 0xF9C4, 2469, 1 },
+	{ 0xF9C5, 2470, 1 },
+	{ 0xF9C6, 2471, 1 },
+	{ 0xF9C7, 2472, 1 },
+	{ 0xF9C8, 2473, 1 },
+	{ 0xF9C9, 2474, 1 },
+	{ 0xF9CA, 2475, 1 },
+	{ 0xF9CB, 2476, 1 },
+	{ 0xF9CC, 2477, 1 },
+	{ 0xF9CD, 2478, 1 },
+	{ 0xF9CE, 2479, 1 },
+	{ 0xF9CF, 2480, 1 },
+	{ 0xF9D0, 2481, 1 },
+	{ 0xF9D1, 2482, 1 },
+	{ 0xF9D2, 2483, 1 },
+	{ 0xF9D3, 2484, 1 },
+	{ 0xF9D4, 2485, 1 },
+	{ 0xF9D5, 2486, 1 },
+	{ 0xF9D6, 2487, 1 },
+	{ 0xF9D7, 2488, 1 },
+	{ 0xF9D8, 2489, 1 },
+	{ 0xF9D9, 2490, 1 },
+	{ 0xF9DA, 2491, 1 },
+	{ 0xF9DB, 2492, 1 },
+	{ 0xF9DC, 2493, 1 },
+	{ 0xF9DD, 2494, 1 },
+	{ 0xF9DE, 2495, 1 },
+	{ 0xF9DF, 2496, 1 },
+	{ 0xF9E0, 2497, 1 },
+	{ 0xF9E1, 2498, 1 },
+	{ 0xF9E2, 2499, 1 },
+	{ 0xF9E3, 2500, 1 },
+	{ 0xF9E4, 2501, 1 },
+	{ 0xF9E5, 2502, 1 },
+	{ 0xF9E6, 2503, 1 },
+	{ 0xF9E7, 2504, 1 },
+	{ 0xF9E8, 2505, 1 },
+	{ 0xF9E9, 2506, 1 },
+	{ 0xF9EA, 2507, 1 },
+	{ 0xF9EB, 2508, 1 },
+	{ 0xF9EC, 2509, 1 },
+	{ 0xF9ED, 2510, 1 },
+	{ 0xF9EE, 2511, 1 },
+	{ 0xF9EF, 2512, 1 },
+	{ 0xF9F0, 2513, 1 },
+	{ 0xF9F1, 2514, 1 },
+	{ 0xF9F2, 2515, 1 },
+	{ 0xF9F3, 2516, 1 },
+	{ 0xF9F4, 2517, 1 },
+	{ 0xF9F5, 2518, 1 },
+	{ 0xF9F6, 2519, 1 },
+	{ 0xF9F7, 2520, 1 },
+	{ 0xF9F8, 2521, 1 },
+	{ 0xF9F9, 2522, 1 },
+	{ 0xF9FA, 2523, 1 },
+	{ 0xF9FB, 2524, 1 },
+	{ 0xF9FC, 2525, 1 },
+	{ 0xF9FD, 2526, 1 },
+	{ 0xF9FE, 2527, 1 },
+	{ 0xF9FF, 2528, 1 },
+	{ 0xFA00, 2529, 1 },
+	{ 0xFA01, 2530, 1 },
+	{ 0xFA02, 2531, 1 },
+	{ 0xFA03, 2532, 1 },
+	{ 0xFA04, 2533, 1 },
+	{ 0xFA05, 2534, 1 },
+	{ 0xFA06, 2535, 1 },
+	{ 0xFA07, 2536, 1 },
+	{ 0xFA08, 2537, 1 },
+	{ 0xFA09, 2538, 1 },
+	{ 0xFA0A, 2539, 1 },
+	{ 0xFA0B, 2540, 1 },
+	{ 0xFA0C, 2541, 1 },
+	{ 0xFA0D, 2542, 1 },
+	{ 0xFA10, 2543, 1 },
+	{ 0xFA12, 2544, 1 },
+	{ 0xFA15, 2545, 1 },
+	{ 0xFA16, 2546, 1 },
+	{ 0xFA17, 2547, 1 },
+	{ 0xFA18, 2548, 1 },
+	{ 0xFA19, 2549, 1 },
+	{ 0xFA1A, 2550, 1 },
+	{ 0xFA1B, 2551, 1 },
+	{ 0xFA1C, 2552, 1 },
+	{ 0xFA1D, 2553, 1 },
+	{ 0xFA1E, 2554, 1 },
+	{ 0xFA20, 2555, 1 },
+	{ 0xFA22, 2556, 1 },
+	{ 0xFA25, 2557, 1 },
+	{ 0xFA26, 2558, 1 },
+	{ 0xFA2A, 2559, 1 },
+	{ 0xFA2B, 2560, 1 },
+	{ 0xFA2C, 2561, 1 },
+	{ 0xFA2D, 2562, 1 },
+	{ 0xFA2E, 2563, 1 },
+	{ 0xFA2F, 2564, 1 },
+	{ 0xFA30, 2565, 1 },
+	{ 0xFA31, 2566, 1 },
+	{ 0xFA32, 2567, 1 },
+	{ 0xFA33, 2568, 1 },
+	{ 0xFA34, 2569, 1 },
+	{ 0xFA35, 2570, 1 },
+	{ 0xFA36, 2571, 1 },
+	{ 0xFA37, 2572, 1 },
+	{ 0xFA38, 2573, 1 },
+	{ 0xFA39, 2574, 1 },
+	{ 0xFA3A, 2575, 1 },
+	{ 0xFA3B, 2576, 1 },
+	{ 0xFA3C, 2577, 1 },
+	{ 0xFA3D, 2578, 1 },
+	{ 0xFA3E, 2579, 1 },
+	{ 0xFA3F, 2580, 1 },
+	{ 0xFA40, 2581, 1 },
+	{ 0xFA41, 2582, 1 },
+	{ 0xFA42, 2583, 1 },
+	{ 0xFA43, 2584, 1 },
+	{ 0xFA44, 2585, 1 },
+	{ 0xFA45, 2586, 1 },
+	{ 0xFA46, 2587, 1 },
+	{ 0xFA47, 2588, 1 },
+	{ 0xFA48, 2589, 1 },
+	{ 0xFA49, 2590, 1 },
+	{ 0xFA4A, 2591, 1 },
+	{ 0xFA4B, 2592, 1 },
+	{ 0xFA4C, 2593, 1 },
+	{ 0xFA4D, 2594, 1 },
+	{ 0xFA4E, 2595, 1 },
+	{ 0xFA4F, 2596, 1 },
+	{ 0xFA50, 2597, 1 },
+	{ 0xFA51, 2598, 1 },
+	{ 0xFA52, 2599, 1 },
+	{ 0xFA53, 2600, 1 },
+	{ 0xFA54, 2601, 1 },
+	{ 0xFA55, 2602, 1 },
+	{ 0xFA56, 2603, 1 },
+	{ 0xFA57, 2604, 1 },
+	{ 0xFA58, 2605, 1 },
+	{ 0xFA59, 2606, 1 },
+	{ 0xFA5A, 2607, 1 },
+	{ 0xFA5B, 2608, 1 },
+	{ 0xFA5C, 2609, 1 },
+	{ 0xFA5D, 2610, 1 },
+	{ 0xFA5E, 2611, 1 },
+	{ 0xFA5F, 2612, 1 },
+	{ 0xFA60, 2613, 1 },
+	{ 0xFA61, 2614, 1 },
+	{ 0xFA62, 2615, 1 },
+	{ 0xFA63, 2616, 1 },
+	{ 0xFA64, 2617, 1 },
+	{ 0xFA65, 2618, 1 },
+	{ 0xFA66, 2619, 1 },
+	{ 0xFA67, 2620, 1 },
+	{ 0xFA68, 2621, 1 },
+	{ 0xFA69, 2622, 1 },
+	{ 0xFA6A, 2623, 1 },
+	{ 0xFA6B, 2624, 1 },
+	{ 0xFA6C, 2625, 1 },
+	{ 0xFA6D, 2626, 1 },
+	{ 0xFA70, 2627, 1 },
+	{ 0xFA71, 2628, 1 },
+	{ 0xFA72, 2629, 1 },
+	{ 0xFA73, 2630, 1 },
+	{ 0xFA74, 2631, 1 },
+	{ 0xFA75, 2632, 1 },
+	{ 0xFA76, 2633, 1 },
+	{ 0xFA77, 2634, 1 },
+	{ 0xFA78, 2635, 1 },
+	{ 0xFA79, 2636, 1 },
+	{ 0xFA7A, 2637, 1 },
+	{ 0xFA7B, 2638, 1 },
+	{ 0xFA7C, 2639, 1 },
+	{ 0xFA7D, 2640, 1 },
+	{ 0xFA7E, 2641, 1 },
+	{ 0xFA7F, 2642, 1 },
+	{ 0xFA80, 2643, 1 },
+	{ 0xFA81, 2644, 1 },
+	{ 0xFA82, 2645, 1 },
+	{ 0xFA83, 2646, 1 },
+	{ 0xFA84, 2647, 1 },
+	{ 0xFA85, 2648, 1 },
+	{ 0xFA86, 2649, 1 },
+	{ 0xFA87, 2650, 1 },
+	{ 0xFA88, 2651, 1 },
+	{ 0xFA89, 2652, 1 },
+	{ 0xFA8A, 2653, 1 },
+	{ 0xFA8B, 2654, 1 },
+	{ 0xFA8C, 2655, 1 },
+	{ 0xFA8D, 2656, 1 },
+	{ 0xFA8E, 2657, 1 },
+	{ 0xFA8F, 2658, 1 },
+	{ 0xFA90, 2659, 1 },
+	{ 0xFA91, 2660, 1 },
+	{ 0xFA92, 2661, 1 },
+	{ 0xFA93, 2662, 1 },
+	{ 0xFA94, 2663, 1 },
+	{ 0xFA95, 2664, 1 },
+	{ 0xFA96, 2665, 1 },
+	{ 0xFA97, 2666, 1 },
+	{ 0xFA98, 2667, 1 },
+	{ 0xFA99, 2668, 1 },
+	{ 0xFA9A, 2669, 1 },
+	{ 0xFA9B, 2670, 1 },
+	{ 0xFA9C, 2671, 1 },
+	{ 0xFA9D, 2672, 1 },
+	{ 0xFA9E, 2673, 1 },
+	{ 0xFA9F, 2674, 1 },
+	{ 0xFAA0, 2675, 1 },
+	{ 0xFAA1, 2676, 1 },
+	{ 0xFAA2, 2677, 1 },
+	{ 0xFAA3, 2678, 1 },
+	{ 0xFAA4, 2679, 1 },
+	{ 0xFAA5, 2680, 1 },
+	{ 0xFAA6, 2681, 1 },
+	{ 0xFAA7, 2682, 1 },
+	{ 0xFAA8, 2683, 1 },
+	{ 0xFAA9, 2684, 1 },
+	{ 0xFAAA, 2685, 1 },
+	{ 0xFAAB, 2686, 1 },
+	{ 0xFAAC, 2687, 1 },
+	{ 0xFAAD, 2688, 1 },
+	{ 0xFAAE, 2689, 1 },
+	{ 0xFAAF, 2690, 1 },
+	{ 0xFAB0, 2691, 1 },
+	{ 0xFAB1, 2692, 1 },
+	{ 0xFAB2, 2693, 1 },
+	{ 0xFAB3, 2694, 1 },
+	{ 0xFAB4, 2695, 1 },
+	{ 0xFAB5, 2696, 1 },
+	{ 0xFAB6, 2697, 1 },
+	{ 0xFAB7, 2698, 1 },
+	{ 0xFAB8, 2699, 1 },
+	{ 0xFAB9, 2700, 1 },
+	{ 0xFABA, 2701, 1 },
+	{ 0xFABB, 2702, 1 },
+	{ 0xFABC, 2703, 1 },
+	{ 0xFABD, 2704, 1 },
+	{ 0xFABE, 2705, 1 },
+	{ 0xFABF, 2706, 1 },
+	{ 0xFAC0, 2707, 1 },
+	{ 0xFAC1, 2708, 1 },
+	{ 0xFAC2, 2709, 1 },
+	{ 0xFAC3, 2710, 1 },
+	{ 0xFAC4, 2711, 1 },
+	{ 0xFAC5, 2712, 1 },
+	{ 0xFAC6, 2713, 1 },
+	{ 0xFAC7, 2714, 1 },
+	{ 0xFAC8, 2715, 1 },
+	{ 0xFAC9, 2716, 1 },
+	{ 0xFACA, 2717, 1 },
+	{ 0xFACB, 2718, 1 },
+	{ 0xFACC, 2719, 1 },
+	{ 0xFACD, 2720, 1 },
+	{ 0xFACE, 2721, 1 },
+	{ 0xFACF, 2722, 1 },
+	{ 0xFAD0, 2723, 1 },
+	{ 0xFAD1, 2724, 1 },
+	{ 0xFAD2, 2725, 1 },
+	{ 0xFAD3, 2726, 1 },
+	{ 0xFAD4, 2727, 1 },
+	{ 0xFAD5, 2728, 1 },
+	{ 0xFAD6, 2729, 1 },
+	{ 0xFAD7, 2730, 1 },
+	{ 0xFAD8, 2731, 1 },
+	{ 0xFAD9, 2732, 1 },
+	{ 0xFB1D, 2733, 2 },
+	{ 0xFB1F, 2735, 2 },
+	{ 0xFB2A, 2737, 2 },
+	{ 0xFB2B, 2739, 2 },
+	{ 0xFB2C, 2741, 3 },
+	{ 0xFB2D, 2744, 3 },
+	{ 0xFB2E, 2747, 2 },
+	{ 0xFB2F, 2749, 2 },
+	{ 0xFB30, 2751, 2 },
+	{ 0xFB31, 2753, 2 },
+	{ 0xFB32, 2755, 2 },
+	{ 0xFB33, 2757, 2 },
+	{ 0xFB34, 2759, 2 },
+	{ 0xFB35, 2761, 2 },
+	{ 0xFB36, 2763, 2 },
+	{ 0xFB38, 2765, 2 },
+	{ 0xFB39, 2767, 2 },
+	{ 0xFB3A, 2769, 2 },
+	{ 0xFB3B, 2771, 2 },
+	{ 0xFB3C, 2773, 2 },
+	{ 0xFB3E, 2775, 2 },
+	{ 0xFB40, 2777, 2 },
+	{ 0xFB41, 2779, 2 },
+	{ 0xFB43, 2781, 2 },
+	{ 0xFB44, 2783, 2 },
+	{ 0xFB46, 2785, 2 },
+	{ 0xFB47, 2787, 2 },
+	{ 0xFB48, 2789, 2 },
+	{ 0xFB49, 2791, 2 },
+	{ 0xFB4A, 2793, 2 },
+	{ 0xFB4B, 2795, 2 },
+	{ 0xFB4C, 2797, 2 },
+	{ 0xFB4D, 2799, 2 },
+	{ 0xFB4E, 2801, 2 },
+	{ 0x1109A, 2803, 2 },
+	{ 0x1109C, 2805, 2 },
+	{ 0x110AB, 2807, 2 },
+	{ 0x1112E, 2809, 2 },
+	{ 0x1112F, 2811, 2 },
+	{ 0x1134B, 2813, 2 },
+	{ 0x1134C, 2815, 2 },
+	{ 0x114BB, 2817, 2 },
+	{ 0x114BC, 2819, 2 },
+	{ 0x114BE, 2821, 2 },
+	{ 0x115BA, 2823, 2 },
+	{ 0x115BB, 2825, 2 },
+	{ 0x11938, 2827, 2 },
+	{ 0x1D15E, 2829, 2 },
+	{ 0x1D15F, 2831, 2 },
+	{ 0x1D160, 2833, 3 },
+	{ 0x1D161, 2836, 3 },
+	{ 0x1D162, 2839, 3 },
+	{ 0x1D163, 2842, 3 },
+	{ 0x1D164, 2845, 3 },
+	{ 0x1D1BB, 2848, 2 },
+	{ 0x1D1BC, 2850, 2 },
+	{ 0x1D1BD, 2852, 3 },
+	{ 0x1D1BE, 2855, 3 },
+	{ 0x1D1BF, 2858, 3 },
+	{ 0x1D1C0, 2861, 3 },
+	{ 0x2F800, 2864, 1 },
+	{ 0x2F801, 2865, 1 },
+	{ 0x2F802, 2866, 1 },
+	{ 0x2F803, 2867, 1 },
+	{ 0x2F804, 2868, 1 },
+	{ 0x2F805, 2869, 1 },
+	{ 0x2F806, 2870, 1 },
+	{ 0x2F807, 2871, 1 },
+	{ 0x2F808, 2872, 1 },
+	{ 0x2F809, 2873, 1 },
+	{ 0x2F80A, 2874, 1 },
+	{ 0x2F80B, 2875, 1 },
+	{ 0x2F80C, 2876, 1 },
+	{ 0x2F80D, 2877, 1 },
+	{ 0x2F80E, 2878, 1 },
+	{ 0x2F80F, 2879, 1 },
+	{ 0x2F810, 2880, 1 },
+	{ 0x2F811, 2881, 1 },
+	{ 0x2F812, 2882, 1 },
+	{ 0x2F813, 2883, 1 },
+	{ 0x2F814, 2884, 1 },
+	{ 0x2F815, 2885, 1 },
+	{ 0x2F816, 2886, 1 },
+	{ 0x2F817, 2887, 1 },
+	{ 0x2F818, 2888, 1 },
+	{ 0x2F819, 2889, 1 },
+	{ 0x2F81A, 2890, 1 },
+	{ 0x2F81B, 2891, 1 },
+	{ 0x2F81C, 2892, 1 },
+	{ 0x2F81D, 2893, 1 },
+	{ 0x2F81E, 2894, 1 },
+	{ 0x2F81F, 2895, 1 },
+	{ 0x2F820, 2896, 1 },
+	{ 0x2F821, 2897, 1 },
+	{ 0x2F822, 2898, 1 },
+	{ 0x2F823, 2899, 1 },
+	{ 0x2F824, 2900, 1 },
+	{ 0x2F825, 2901, 1 },
+	{ 0x2F826, 2902, 1 },
+	{ 0x2F827, 2903, 1 },
+	{ 0x2F828, 2904, 1 },
+	{ 0x2F829, 2905, 1 },
+	{ 0x2F82A, 2906, 1 },
+	{ 0x2F82B, 2907, 1 },
+	{ 0x2F82C, 2908, 1 },
+	{ 0x2F82D, 2909, 1 },
+	{ 0x2F82E, 2910, 1 },
+	{ 0x2F82F, 2911, 1 },
+	{ 0x2F830, 2912, 1 },
+	{ 0x2F831, 2913, 1 },
+	{ 0x2F832, 2914, 1 },
+	{ 0x2F833, 2915, 1 },
+	{ 0x2F834, 2916, 1 },
+	{ 0x2F835, 2917, 1 },
+	{ 0x2F836, 2918, 1 },
+	{ 0x2F837, 2919, 1 },
+	{ 0x2F838, 2920, 1 },
+	{ 0x2F839, 2921, 1 },
+	{ 0x2F83A, 2922, 1 },
+	{ 0x2F83B, 2923, 1 },
+	{ 0x2F83C, 2924, 1 },
+	{ 0x2F83D, 2925, 1 },
+	{ 0x2F83E, 2926, 1 },
+	{ 0x2F83F, 2927, 1 },
+	{ 0x2F840, 2928, 1 },
+	{ 0x2F841, 2929, 1 },
+	{ 0x2F842, 2930, 1 },
+	{ 0x2F843, 2931, 1 },
+	{ 0x2F844, 2932, 1 },
+	{ 0x2F845, 2933, 1 },
+	{ 0x2F846, 2934, 1 },
+	{ 0x2F847, 2935, 1 },
+	{ 0x2F848, 2936, 1 },
+	{ 0x2F849, 2937, 1 },
+	{ 0x2F84A, 2938, 1 },
+	{ 0x2F84B, 2939, 1 },
+	{ 0x2F84C, 2940, 1 },
+	{ 0x2F84D, 2941, 1 },
+	{ 0x2F84E, 2942, 1 },
+	{ 0x2F84F, 2943, 1 },
+	{ 0x2F850, 2944, 1 },
+	{ 0x2F851, 2945, 1 },
+	{ 0x2F852, 2946, 1 },
+	{ 0x2F853, 2947, 1 },
+	{ 0x2F854, 2948, 1 },
+	{ 0x2F855, 2949, 1 },
+	{ 0x2F856, 2950, 1 },
+	{ 0x2F857, 2951, 1 },
+	{ 0x2F858, 2952, 1 },
+	{ 0x2F859, 2953, 1 },
+	{ 0x2F85A, 2954, 1 },
+	{ 0x2F85B, 2955, 1 },
+	{ 0x2F85C, 2956, 1 },
+	{ 0x2F85D, 2957, 1 },
+	{ 0x2F85E, 2958, 1 },
+	{ 0x2F85F, 2959, 1 },
+	{ 0x2F860, 2960, 1 },
+	{ 0x2F861, 2961, 1 },
+	{ 0x2F862, 2962, 1 },
+	{ 0x2F863, 2963, 1 },
+	{ 0x2F864, 2964, 1 },
+	{ 0x2F865, 2965, 1 },
+	{ 0x2F866, 2966, 1 },
+	{ 0x2F867, 2967, 1 },
+	{ 0x2F868, 2968, 1 },
+	{ 0x2F869, 2969, 1 },
+	{ 0x2F86A, 2970, 1 },
+	{ 0x2F86B, 2971, 1 },
+	{ 0x2F86C, 2972, 1 },
+	{ 0x2F86D, 2973, 1 },
+	{ 0x2F86E, 2974, 1 },
+	{ 0x2F86F, 2975, 1 },
+	{ 0x2F870, 2976, 1 },
+	{ 0x2F871, 2977, 1 },
+	{ 0x2F872, 2978, 1 },
+	{ 0x2F873, 2979, 1 },
+	{ 0x2F874, 2980, 1 },
+	{ 0x2F875, 2981, 1 },
+	{ 0x2F876, 2982, 1 },
+	{ 0x2F877, 2983, 1 },
+	{ 0x2F878, 2984, 1 },
+	{ 0x2F879, 2985, 1 },
+	{ 0x2F87A, 2986, 1 },
+	{ 0x2F87B, 2987, 1 },
+	{ 0x2F87C, 2988, 1 },
+	{ 0x2F87D, 2989, 1 },
+	{ 0x2F87E, 2990, 1 },
+	{ 0x2F87F, 2991, 1 },
+	{ 0x2F880, 2992, 1 },
+	{ 0x2F881, 2993, 1 },
+	{ 0x2F882, 2994, 1 },
+	{ 0x2F883, 2995, 1 },
+	{ 0x2F884, 2996, 1 },
+	{ 0x2F885, 2997, 1 },
+	{ 0x2F886, 2998, 1 },
+	{ 0x2F887, 2999, 1 },
+	{ 0x2F888, 3000, 1 },
+	{ 0x2F889, 3001, 1 },
+	{ 0x2F88A, 3002, 1 },
+	{ 0x2F88B, 3003, 1 },
+	{ 0x2F88C, 3004, 1 },
+	{ 0x2F88D, 3005, 1 },
+	{ 0x2F88E, 3006, 1 },
+	{ 0x2F88F, 3007, 1 },
+	{ 0x2F890, 3008, 1 },
+	{ 0x2F891, 3009, 1 },
+	{ 0x2F892, 3010, 1 },
+	{ 0x2F893, 3011, 1 },
+	{ 0x2F894, 3012, 1 },
+	{ 0x2F895, 3013, 1 },
+	{ 0x2F896, 3014, 1 },
+	{ 0x2F897, 3015, 1 },
+	{ 0x2F898, 3016, 1 },
+	{ 0x2F899, 3017, 1 },
+	{ 0x2F89A, 3018, 1 },
+	{ 0x2F89B, 3019, 1 },
+	{ 0x2F89C, 3020, 1 },
+	{ 0x2F89D, 3021, 1 },
+	{ 0x2F89E, 3022, 1 },
+	{ 0x2F89F, 3023, 1 },
+	{ 0x2F8A0, 3024, 1 },
+	{ 0x2F8A1, 3025, 1 },
+	{ 0x2F8A2, 3026, 1 },
+	{ 0x2F8A3, 3027, 1 },
+	{ 0x2F8A4, 3028, 1 },
+	{ 0x2F8A5, 3029, 1 },
+	{ 0x2F8A6, 3030, 1 },
+	{ 0x2F8A7, 3031, 1 },
+	{ 0x2F8A8, 3032, 1 },
+	{ 0x2F8A9, 3033, 1 },
+	{ 0x2F8AA, 3034, 1 },
+	{ 0x2F8AB, 3035, 1 },
+	{ 0x2F8AC, 3036, 1 },
+	{ 0x2F8AD, 3037, 1 },
+	{ 0x2F8AE, 3038, 1 },
+	{ 0x2F8AF, 3039, 1 },
+	{ 0x2F8B0, 3040, 1 },
+	{ 0x2F8B1, 3041, 1 },
+	{ 0x2F8B2, 3042, 1 },
+	{ 0x2F8B3, 3043, 1 },
+	{ 0x2F8B4, 3044, 1 },
+	{ 0x2F8B5, 3045, 1 },
+	{ 0x2F8B6, 3046, 1 },
+	{ 0x2F8B7, 3047, 1 },
+	{ 0x2F8B8, 3048, 1 },
+	{ 0x2F8B9, 3049, 1 },
+	{ 0x2F8BA, 3050, 1 },
+	{ 0x2F8BB, 3051, 1 },
+	{ 0x2F8BC, 3052, 1 },
+	{ 0x2F8BD, 3053, 1 },
+	{ 0x2F8BE, 3054, 1 },
+	{ 0x2F8BF, 3055, 1 },
+	{ 0x2F8C0, 3056, 1 },
+	{ 0x2F8C1, 3057, 1 },
+	{ 0x2F8C2, 3058, 1 },
+	{ 0x2F8C3, 3059, 1 },
+	{ 0x2F8C4, 3060, 1 },
+	{ 0x2F8C5, 3061, 1 },
+	{ 0x2F8C6, 3062, 1 },
+	{ 0x2F8C7, 3063, 1 },
+	{ 0x2F8C8, 3064, 1 },
+	{ 0x2F8C9, 3065, 1 },
+	{ 0x2F8CA, 3066, 1 },
+	{ 0x2F8CB, 3067, 1 },
+	{ 0x2F8CC, 3068, 1 },
+	{ 0x2F8CD, 3069, 1 },
+	{ 0x2F8CE, 3070, 1 },
+	{ 0x2F8CF, 3071, 1 },
+	{ 0x2F8D0, 3072, 1 },
+	{ 0x2F8D1, 3073, 1 },
+	{ 0x2F8D2, 3074, 1 },
+	{ 0x2F8D3, 3075, 1 },
+	{ 0x2F8D4, 3076, 1 },
+	{ 0x2F8D5, 3077, 1 },
+	{ 0x2F8D6, 3078, 1 },
+	{ 0x2F8D7, 3079, 1 },
+	{ 0x2F8D8, 3080, 1 },
+	{ 0x2F8D9, 3081, 1 },
+	{ 0x2F8DA, 3082, 1 },
+	{ 0x2F8DB, 3083, 1 },
+	{ 0x2F8DC, 3084, 1 },
+	{ 0x2F8DD, 3085, 1 },
+	{ 0x2F8DE, 3086, 1 },
+	{ 0x2F8DF, 3087, 1 },
+	{ 0x2F8E0, 3088, 1 },
+	{ 0x2F8E1, 3089, 1 },
+	{ 0x2F8E2, 3090, 1 },
+	{ 0x2F8E3, 3091, 1 },
+	{ 0x2F8E4, 3092, 1 },
+	{ 0x2F8E5, 3093, 1 },
+	{ 0x2F8E6, 3094, 1 },
+	{ 0x2F8E7, 3095, 1 },
+	{ 0x2F8E8, 3096, 1 },
+	{ 0x2F8E9, 3097, 1 },
+	{ 0x2F8EA, 3098, 1 },
+	{ 0x2F8EB, 3099, 1 },
+	{ 0x2F8EC, 3100, 1 },
+	{ 0x2F8ED, 3101, 1 },
+	{ 0x2F8EE, 3102, 1 },
+	{ 0x2F8EF, 3103, 1 },
+	{ 0x2F8F0, 3104, 1 },
+	{ 0x2F8F1, 3105, 1 },
+	{ 0x2F8F2, 3106, 1 },
+	{ 0x2F8F3, 3107, 1 },
+	{ 0x2F8F4, 3108, 1 },
+	{ 0x2F8F5, 3109, 1 },
+	{ 0x2F8F6, 3110, 1 },
+	{ 0x2F8F7, 3111, 1 },
+	{ 0x2F8F8, 3112, 1 },
+	{ 0x2F8F9, 3113, 1 },
+	{ 0x2F8FA, 3114, 1 },
+	{ 0x2F8FB, 3115, 1 },
+	{ 0x2F8FC, 3116, 1 },
+	{ 0x2F8FD, 3117, 1 },
+	{ 0x2F8FE, 3118, 1 },
+	{ 0x2F8FF, 3119, 1 },
+	{ 0x2F900, 3120, 1 },
+	{ 0x2F901, 3121, 1 },
+	{ 0x2F902, 3122, 1 },
+	{ 0x2F903, 3123, 1 },
+	{ 0x2F904, 3124, 1 },
+	{ 0x2F905, 3125, 1 },
+	{ 0x2F906, 3126, 1 },
+	{ 0x2F907, 3127, 1 },
+	{ 0x2F908, 3128, 1 },
+	{ 0x2F909, 3129, 1 },
+	{ 0x2F90A, 3130, 1 },
+	{ 0x2F90B, 3131, 1 },
+	{ 0x2F90C, 3132, 1 },
+	{ 0x2F90D, 3133, 1 },
+	{ 0x2F90E, 3134, 1 },
+	{ 0x2F90F, 3135, 1 },
+	{ 0x2F910, 3136, 1 },
+	{ 0x2F911, 3137, 1 },
+	{ 0x2F912, 3138, 1 },
+	{ 0x2F913, 3139, 1 },
+	{ 0x2F914, 3140, 1 },
+	{ 0x2F915, 3141, 1 },
+	{ 0x2F916, 3142, 1 },
+	{ 0x2F917, 3143, 1 },
+	{ 0x2F918, 3144, 1 },
+	{ 0x2F919, 3145, 1 },
+	{ 0x2F91A, 3146, 1 },
+	{ 0x2F91B, 3147, 1 },
+	{ 0x2F91C, 3148, 1 },
+	{ 0x2F91D, 3149, 1 },
+	{ 0x2F91E, 3150, 1 },
+	{ 0x2F91F, 3151, 1 },
+	{ 0x2F920, 3152, 1 },
+	{ 0x2F921, 3153, 1 },
+	{ 0x2F922, 3154, 1 },
+	{ 0x2F923, 3155, 1 },
+	{ 0x2F924, 3156, 1 },
+	{ 0x2F925, 3157, 1 },
+	{ 0x2F926, 3158, 1 },
+	{ 0x2F927, 3159, 1 },
+	{ 0x2F928, 3160, 1 },
+	{ 0x2F929, 3161, 1 },
+	{ 0x2F92A, 3162, 1 },
+	{ 0x2F92B, 3163, 1 },
+	{ 0x2F92C, 3164, 1 },
+	{ 0x2F92D, 3165, 1 },
+	{ 0x2F92E, 3166, 1 },
+	{ 0x2F92F, 3167, 1 },
+	{ 0x2F930, 3168, 1 },
+	{ 0x2F931, 3169, 1 },
+	{ 0x2F932, 3170, 1 },
+	{ 0x2F933, 3171, 1 },
+	{ 0x2F934, 3172, 1 },
+	{ 0x2F935, 3173, 1 },
+	{ 0x2F936, 3174, 1 },
+	{ 0x2F937, 3175, 1 },
+	{ 0x2F938, 3176, 1 },
+	{ 0x2F939, 3177, 1 },
+	{ 0x2F93A, 3178, 1 },
+	{ 0x2F93B, 3179, 1 },
+	{ 0x2F93C, 3180, 1 },
+	{ 0x2F93D, 3181, 1 },
+	{ 0x2F93E, 3182, 1 },
+	{ 0x2F93F, 3183, 1 },
+	{ 0x2F940, 3184, 1 },
+	{ 0x2F941, 3185, 1 },
+	{ 0x2F942, 3186, 1 },
+	{ 0x2F943, 3187, 1 },
+	{ 0x2F944, 3188, 1 },
+	{ 0x2F945, 3189, 1 },
+	{ 0x2F946, 3190, 1 },
+	{ 0x2F947, 3191, 1 },
+	{ 0x2F948, 3192, 1 },
+	{ 0x2F949, 3193, 1 },
+	{ 0x2F94A, 3194, 1 },
+	{ 0x2F94B, 3195, 1 },
+	{ 0x2F94C, 3196, 1 },
+	{ 0x2F94D, 3197, 1 },
+	{ 0x2F94E, 3198, 1 },
+	{ 0x2F94F, 3199, 1 },
+	{ 0x2F950, 3200, 1 },
+	{ 0x2F951, 3201, 1 },
+	{ 0x2F952, 3202, 1 },
+	{ 0x2F953, 3203, 1 },
+	{ 0x2F954, 3204, 1 },
+	{ 0x2F955, 3205, 1 },
+	{ 0x2F956, 3206, 1 },
+	{ 0x2F957, 3207, 1 },
+	{ 0x2F958, 3208, 1 },
+	{ 0x2F959, 3209, 1 },
+	{ 0x2F95A, 3210, 1 },
+	{ 0x2F95B, 3211, 1 },
+	{ 0x2F95C, 3212, 1 },
+	{ 0x2F95D, 3213, 1 },
+	{ 0x2F95E, 3214, 1 },
+	{ 0x2F95F, 3215, 1 },
+	{ 0x2F960, 3216, 1 },
+	{ 0x2F961, 3217, 1 },
+	{ 0x2F962, 3218, 1 },
+	{ 0x2F963, 3219, 1 },
+	{ 0x2F964, 3220, 1 },
+	{ 0x2F965, 3221, 1 },
+	{ 0x2F966, 3222, 1 },
+	{ 0x2F967, 3223, 1 },
+	{ 0x2F968, 3224, 1 },
+	{ 0x2F969, 3225, 1 },
+	{ 0x2F96A, 3226, 1 },
+	{ 0x2F96B, 3227, 1 },
+	{ 0x2F96C, 3228, 1 },
+	{ 0x2F96D, 3229, 1 },
+	{ 0x2F96E, 3230, 1 },
+	{ 0x2F96F, 3231, 1 },
+	{ 0x2F970, 3232, 1 },
+	{ 0x2F971, 3233, 1 },
+	{ 0x2F972, 3234, 1 },
+	{ 0x2F973, 3235, 1 },
+	{ 0x2F974, 3236, 1 },
+	{ 0x2F975, 3237, 1 },
+	{ 0x2F976, 3238, 1 },
+	{ 0x2F977, 3239, 1 },
+	{ 0x2F978, 3240, 1 },
+	{ 0x2F979, 3241, 1 },
+	{ 0x2F97A, 3242, 1 },
+	{ 0x2F97B, 3243, 1 },
+	{ 0x2F97C, 3244, 1 },
+	{ 0x2F97D, 3245, 1 },
+	{ 0x2F97E, 3246, 1 },
+	{ 0x2F97F, 3247, 1 },
+	{ 0x2F980, 3248, 1 },
+	{ 0x2F981, 3249, 1 },
+	{ 0x2F982, 3250, 1 },
+	{ 0x2F983, 3251, 1 },
+	{ 0x2F984, 3252, 1 },
+	{ 0x2F985, 3253, 1 },
+	{ 0x2F986, 3254, 1 },
+	{ 0x2F987, 3255, 1 },
+	{ 0x2F988, 3256, 1 },
+	{ 0x2F989, 3257, 1 },
+	{ 0x2F98A, 3258, 1 },
+	{ 0x2F98B, 3259, 1 },
+	{ 0x2F98C, 3260, 1 },
+	{ 0x2F98D, 3261, 1 },
+	{ 0x2F98E, 3262, 1 },
+	{ 0x2F98F, 3263, 1 },
+	{ 0x2F990, 3264, 1 },
+	{ 0x2F991, 3265, 1 },
+	{ 0x2F992, 3266, 1 },
+	{ 0x2F993, 3267, 1 },
+	{ 0x2F994, 3268, 1 },
+	{ 0x2F995, 3269, 1 },
+	{ 0x2F996, 3270, 1 },
+	{ 0x2F997, 3271, 1 },
+	{ 0x2F998, 3272, 1 },
+	{ 0x2F999, 3273, 1 },
+	{ 0x2F99A, 3274, 1 },
+	{ 0x2F99B, 3275, 1 },
+	{ 0x2F99C, 3276, 1 },
+	{ 0x2F99D, 3277, 1 },
+	{ 0x2F99E, 3278, 1 },
+	{ 0x2F99F, 3279, 1 },
+	{ 0x2F9A0, 3280, 1 },
+	{ 0x2F9A1, 3281, 1 },
+	{ 0x2F9A2, 3282, 1 },
+	{ 0x2F9A3, 3283, 1 },
+	{ 0x2F9A4, 3284, 1 },
+	{ 0x2F9A5, 3285, 1 },
+	{ 0x2F9A6, 3286, 1 },
+	{ 0x2F9A7, 3287, 1 },
+	{ 0x2F9A8, 3288, 1 },
+	{ 0x2F9A9, 3289, 1 },
+	{ 0x2F9AA, 3290, 1 },
+	{ 0x2F9AB, 3291, 1 },
+	{ 0x2F9AC, 3292, 1 },
+	{ 0x2F9AD, 3293, 1 },
+	{ 0x2F9AE, 3294, 1 },
+	{ 0x2F9AF, 3295, 1 },
+	{ 0x2F9B0, 3296, 1 },
+	{ 0x2F9B1, 3297, 1 },
+	{ 0x2F9B2, 3298, 1 },
+	{ 0x2F9B3, 3299, 1 },
+	{ 0x2F9B4, 3300, 1 },
+	{ 0x2F9B5, 3301, 1 },
+	{ 0x2F9B6, 3302, 1 },
+	{ 0x2F9B7, 3303, 1 },
+	{ 0x2F9B8, 3304, 1 },
+	{ 0x2F9B9, 3305, 1 },
+	{ 0x2F9BA, 3306, 1 },
+	{ 0x2F9BB, 3307, 1 },
+	{ 0x2F9BC, 3308, 1 },
+	{ 0x2F9BD, 3309, 1 },
+	{ 0x2F9BE, 3310, 1 },
+	{ 0x2F9BF, 3311, 1 },
+	{ 0x2F9C0, 3312, 1 },
+	{ 0x2F9C1, 3313, 1 },
+	{ 0x2F9C2, 3314, 1 },
+	{ 0x2F9C3, 3315, 1 },
+	{ 0x2F9C4, 3316, 1 },
+	{ 0x2F9C5, 3317, 1 },
+	{ 0x2F9C6, 3318, 1 },
+	{ 0x2F9C7, 3319, 1 },
+	{ 0x2F9C8, 3320, 1 },
+	{ 0x2F9C9, 3321, 1 },
+	{ 0x2F9CA, 3322, 1 },
+	{ 0x2F9CB, 3323, 1 },
+	{ 0x2F9CC, 3324, 1 },
+	{ 0x2F9CD, 3325, 1 },
+	{ 0x2F9CE, 3326, 1 },
+	{ 0x2F9CF, 3327, 1 },
+	{ 0x2F9D0, 3328, 1 },
+	{ 0x2F9D1, 3329, 1 },
+	{ 0x2F9D2, 3330, 1 },
+	{ 0x2F9D3, 3331, 1 },
+	{ 0x2F9D4, 3332, 1 },
+	{ 0x2F9D5, 3333, 1 },
+	{ 0x2F9D6, 3334, 1 },
+	{ 0x2F9D7, 3335, 1 },
+	{ 0x2F9D8, 3336, 1 },
+	{ 0x2F9D9, 3337, 1 },
+	{ 0x2F9DA, 3338, 1 },
+	{ 0x2F9DB, 3339, 1 },
+	{ 0x2F9DC, 3340, 1 },
+	{ 0x2F9DD, 3341, 1 },
+	{ 0x2F9DE, 3342, 1 },
+	{ 0x2F9DF, 3343, 1 },
+	{ 0x2F9E0, 3344, 1 },
+	{ 0x2F9E1, 3345, 1 },
+	{ 0x2F9E2, 3346, 1 },
+	{ 0x2F9E3, 3347, 1 },
+	{ 0x2F9E4, 3348, 1 },
+	{ 0x2F9E5, 3349, 1 },
+	{ 0x2F9E6, 3350, 1 },
+	{ 0x2F9E7, 3351, 1 },
+	{ 0x2F9E8, 3352, 1 },
+	{ 0x2F9E9, 3353, 1 },
+	{ 0x2F9EA, 3354, 1 },
+	{ 0x2F9EB, 3355, 1 },
+	{ 0x2F9EC, 3356, 1 },
+	{ 0x2F9ED, 3357, 1 },
+	{ 0x2F9EE, 3358, 1 },
+	{ 0x2F9EF, 3359, 1 },
+	{ 0x2F9F0, 3360, 1 },
+	{ 0x2F9F1, 3361, 1 },
+	{ 0x2F9F2, 3362, 1 },
+	{ 0x2F9F3, 3363, 1 },
+	{ 0x2F9F4, 3364, 1 },
+	{ 0x2F9F5, 3365, 1 },
+	{ 0x2F9F6, 3366, 1 },
+	{ 0x2F9F7, 3367, 1 },
+	{ 0x2F9F8, 3368, 1 },
+	{ 0x2F9F9, 3369, 1 },
+	{ 0x2F9FA, 3370, 1 },
+	{ 0x2F9FB, 3371, 1 },
+	{ 0x2F9FC, 3372, 1 },
+	{ 0x2F9FD, 3373, 1 },
+	{ 0x2F9FE, 3374, 1 },
+	{ 0x2F9FF, 3375, 1 },
+	{ 0x2FA00, 3376, 1 },
+	{ 0x2FA01, 3377, 1 },
+	{ 0x2FA02, 3378, 1 },
+	{ 0x2FA03, 3379, 1 },
+	{ 0x2FA04, 3380, 1 },
+	{ 0x2FA05, 3381, 1 },
+	{ 0x2FA06, 3382, 1 },
+	{ 0x2FA07, 3383, 1 },
+	{ 0x2FA08, 3384, 1 },
+	{ 0x2FA09, 3385, 1 },
+	{ 0x2FA0A, 3386, 1 },
+	{ 0x2FA0B, 3387, 1 },
+	{ 0x2FA0C, 3388, 1 },
+	{ 0x2FA0D, 3389, 1 },
+	{ 0x2FA0E, 3390, 1 },
+	{ 0x2FA0F, 3391, 1 },
+	{ 0x2FA10, 3392, 1 },
+	{ 0x2FA11, 3393, 1 },
+	{ 0x2FA12, 3394, 1 },
+	{ 0x2FA13, 3395, 1 },
+	{ 0x2FA14, 3396, 1 },
+	{ 0x2FA15, 3397, 1 },
+	{ 0x2FA16, 3398, 1 },
+	{ 0x2FA17, 3399, 1 },
+	{ 0x2FA18, 3400, 1 },
+	{ 0x2FA19, 3401, 1 },
+	{ 0x2FA1A, 3402, 1 },
+	{ 0x2FA1B, 3403, 1 },
+	{ 0x2FA1C, 3404, 1 },
+	{ 0x2FA1D, 3405, 1 },
+};
+
+const uint32_t kDecomposed[] = {
+	0x41, 0x300, 0x41, 0x301, 0x41, 0x302, 0x41, 0x303,
+	0x41, 0x308, 0x41, 0x30A, 0x43, 0x327, 0x45, 0x300,
+	0x45, 0x301, 0x45, 0x302, 0x45, 0x308, 0x49, 0x300,
+	0x49, 0x301, 0x49, 0x302, 0x49, 0x308, 0x4E, 0x303,
+	0x4F, 0x300, 0x4F, 0x301, 0x4F, 0x302, 0x4F, 0x303,
+	0x4F, 0x308, 0x55, 0x300, 0x55, 0x301, 0x55, 0x302,
+	0x55, 0x308, 0x59, 0x301, 0x61, 0x300, 0x61, 0x301,
+	0x61, 0x302, 0x61, 0x303, 0x61, 0x308, 0x61, 0x30A,
+	0x63, 0x327, 0x65, 0x300, 0x65, 0x301, 0x65, 0x302,
+	0x65, 0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302,
+	0x69, 0x308, 0x6E, 0x303, 0x6F, 0x300, 0x6F, 0x301,
+	0x6F, 0x302, 0x6F, 0x303, 0x6F, 0x308, 0x75, 0x300,
+	0x75, 0x301, 0x75, 0x302, 0x75, 0x308, 0x79, 0x301,
+	0x79, 0x308, 0x41, 0x304, 0x61, 0x304, 0x41, 0x306,
+	0x61, 0x306, 0x41, 0x328, 0x61, 0x328, 0x43, 0x301,
+	0x63, 0x301, 0x43, 0x302, 0x63, 0x302, 0x43, 0x307,
+	0x63, 0x307, 0x43, 0x30C, 0x63, 0x30C, 0x44, 0x30C,
+	0x64, 0x30C, 0x45, 0x304, 0x65, 0x304, 0x45, 0x306,
+	0x65, 0x306, 0x45, 0x307, 0x65, 0x307, 0x45, 0x328,
+	0x65, 0x328, 0x45, 0x30C, 0x65, 0x30C, 0x47, 0x302,
+	0x67, 0x302, 0x47, 0x306, 0x67, 0x306, 0x47, 0x307,
+	0x67, 0x307, 0x47, 0x327, 0x67, 0x327, 0x48, 0x302,
+	0x68, 0x302, 0x49, 0x303, 0x69, 0x303, 0x49, 0x304,
+	0x69, 0x304, 0x49, 0x306, 0x69, 0x306, 0x49, 0x328,
+	0x69, 0x328, 0x49, 0x307, 0x4A, 0x302, 0x6A, 0x302,
+	0x4B, 0x327, 0x6B, 0x327, 0x4C, 0x301, 0x6C, 0x301,
+	0x4C, 0x327, 0x6C, 0x327, 0x4C, 0x30C, 0x6C, 0x30C,
+	0x4E, 0x301, 0x6E, 0x301, 0x4E, 0x327, 0x6E, 0x327,
+	0x4E, 0x30C, 0x6E, 0x30C, 0x4F, 0x304, 0x6F, 0x304,
+	0x4F, 0x306, 0x6F, 0x306, 0x4F, 0x30B, 0x6F, 0x30B,
+	0x52, 0x301, 0x72, 0x301, 0x52, 0x327, 0x72, 0x327,
+	0x52, 0x30C, 0x72, 0x30C, 0x53, 0x301, 0x73, 0x301,
+	0x53, 0x302, 0x73, 0x302, 0x53, 0x327, 0x73, 0x327,
+	0x53, 0x30C, 0x73, 0x30C, 0x54, 0x327, 0x74, 0x327,
+	0x54, 0x30C, 0x74, 0x30C, 0x55, 0x303, 0x75, 0x303,
+	0x55, 0x304, 0x75, 0x304, 0x55, 0x306, 0x75, 0x306,
+	0x55, 0x30A, 0x75, 0x30A, 0x55, 0x30B, 0x75, 0x30B,
+	0x55, 0x328, 0x75, 0x328, 0x57, 0x302, 0x77, 0x302,
+	0x59, 0x302, 0x79, 0x302, 0x59, 0x308, 0x5A, 0x301,
+	0x7A, 0x301, 0x5A, 0x307, 0x7A, 0x307, 0x5A, 0x30C,
+	0x7A, 0x30C, 0x4F, 0x31B, 0x6F, 0x31B, 0x55, 0x31B,
+	0x75, 0x31B, 0x41, 0x30C, 0x61, 0x30C, 0x49, 0x30C,
+	0x69, 0x30C, 0x4F, 0x30C, 0x6F, 0x30C, 0x55, 0x30C,
+	0x75, 0x30C, 0x55, 0x308, 0x304, 0x75, 0x308, 0x304,
+	0x55, 0x308, 0x301, 0x75, 0x308, 0x301, 0x55, 0x308,
+	0x30C, 0x75, 0x308, 0x30C, 0x55, 0x308, 0x300, 0x75,
+	0x308, 0x300, 0x41, 0x308, 0x304, 0x61, 0x308, 0x304,
+	0x41, 0x307, 0x304, 0x61, 0x307, 0x304, 0xC6, 0x304,
+	0xE6, 0x304, 0x47, 0x30C, 0x67, 0x30C, 0x4B, 0x30C,
+	0x6B, 0x30C, 0x4F, 0x328, 0x6F, 0x328, 0x4F, 0x328,
+	0x304, 0x6F, 0x328, 0x304, 0x1B7, 0x30C, 0x292, 0x30C,
+	0x6A, 0x30C, 0x47, 0x301, 0x67, 0x301, 0x4E, 0x300,
+	0x6E, 0x300, 0x41, 0x30A, 0x301, 0x61, 0x30A, 0x301,
+	0xC6, 0x301, 0xE6, 0x301, 0xD8, 0x301, 0xF8, 0x301,
+	0x41, 0x30F, 0x61, 0x30F, 0x41, 0x311, 0x61, 0x311,
+	0x45, 0x30F, 0x65, 0x30F, 0x45, 0x311, 0x65, 0x311,
+	0x49, 0x30F, 0x69, 0x30F, 0x49, 0x311, 0x69, 0x311,
+	0x4F, 0x30F, 0x6F, 0x30F, 0x4F, 0x311, 0x6F, 0x311,
+	0x52, 0x30F, 0x72, 0x30F, 0x52, 0x311, 0x72, 0x311,
+	0x55, 0x30F, 0x75, 0x30F, 0x55, 0x311, 0x75, 0x311,
+	0x53, 0x326, 0x73, 0x326, 0x54, 0x326, 0x74, 0x326,
+	0x48, 0x30C, 0x68, 0x30C, 0x41, 0x307, 0x61, 0x307,
+	0x45, 0x327, 0x65, 0x327, 0x4F, 0x308, 0x304, 0x6F,
+	0x308, 0x304, 0x4F, 0x303, 0x304, 0x6F, 0x303, 0x304,
+	0x4F, 0x307, 0x6F, 0x307, 0x4F, 0x307, 0x304, 0x6F,
+	0x307, 0x304, 0x59, 0x304, 0x79, 0x304, 0x300, 0x301,
+	0x313, 0x308, 0x301, 0x2B9, 0x3B, 0xA8, 0x301, 0x391,
+	0x301, 0xB7, 0x395, 0x301, 0x397, 0x301, 0x399, 0x301,
+	0x39F, 0x301, 0x3A5, 0x301, 0x3A9, 0x301, 0x3B9, 0x308,
+	0x301, 0x399, 0x308, 0x3A5, 0x308, 0x3B1, 0x301, 0x3B5,
+	0x301, 0x3B7, 0x301, 0x3B9, 0x301, 0x3C5, 0x308, 0x301,
+	0x3B9, 0x308, 0x3C5, 0x308, 0x3BF, 0x301, 0x3C5, 0x301,
+	0x3C9, 0x301, 0x3D2, 0x301, 0x3D2, 0x308, 0x415, 0x300,
+	0x415, 0x308, 0x413, 0x301, 0x406, 0x308, 0x41A, 0x301,
+	0x418, 0x300, 0x423, 0x306, 0x418, 0x306, 0x438, 0x306,
+	0x435, 0x300, 0x435, 0x308, 0x433, 0x301, 0x456, 0x308,
+	0x43A, 0x301, 0x438, 0x300, 0x443, 0x306, 0x474, 0x30F,
+	0x475, 0x30F, 0x416, 0x306, 0x436, 0x306, 0x410, 0x306,
+	0x430, 0x306, 0x410, 0x308, 0x430, 0x308, 0x415, 0x306,
+	0x435, 0x306, 0x4D8, 0x308, 0x4D9, 0x308, 0x416, 0x308,
+	0x436, 0x308, 0x417, 0x308, 0x437, 0x308, 0x418, 0x304,
+	0x438, 0x304, 0x418, 0x308, 0x438, 0x308, 0x41E, 0x308,
+	0x43E, 0x308, 0x4E8, 0x308, 0x4E9, 0x308, 0x42D, 0x308,
+	0x44D, 0x308, 0x423, 0x304, 0x443, 0x304, 0x423, 0x308,
+	0x443, 0x308, 0x423, 0x30B, 0x443, 0x30B, 0x427, 0x308,
+	0x447, 0x308, 0x42B, 0x308, 0x44B, 0x308, 0x627, 0x653,
+	0x627, 0x654, 0x648, 0x654, 0x627, 0x655, 0x64A, 0x654,
+	0x6D5, 0x654, 0x6C1, 0x654, 0x6D2, 0x654, 0x928, 0x93C,
+	0x930, 0x93C, 0x933, 0x93C, 0x915, 0x93C, 0x916, 0x93C,
+	0x917, 0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922, 0x93C,
+	0x92B, 0x93C, 0x92F, 0x93C, 0x9C7, 0x9BE, 0x9C7, 0x9D7,
+	0x9A1, 0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C,
+	0xA38, 0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C, 0xA1C, 0xA3C,
+	0xA2B, 0xA3C, 0xB47, 0xB56, 0xB47, 0xB3E, 0xB47, 0xB57,
+	0xB21, 0xB3C, 0xB22, 0xB3C, 0xB92, 0xBD7, 0xBC6, 0xBBE,
+	0xBC7, 0xBBE, 0xBC6, 0xBD7, 0xC46, 0xC56, 0xCBF, 0xCD5,
+	0xCC6, 0xCD5, 0xCC6, 0xCD6, 0xCC6, 0xCC2, 0xCC6, 0xCC2,
+	0xCD5, 0xD46, 0xD3E, 0xD47, 0xD3E, 0xD46, 0xD57, 0xDD9,
+	0xDCA, 0xDD9, 0xDCF, 0xDD9, 0xDCF, 0xDCA, 0xDD9, 0xDDF,
+	0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7, 0xF56, 0xFB7,
+	0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71, 0xF74,
+	0xFB2, 0xF80, 0xFB3, 0xF80, 0xF71, 0xF80, 0xF92, 0xFB7,
+	0xF9C, 0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB, 0xFB7,
+	0xF90, 0xFB5, 0x1025, 0x102E, 0x1B05, 0x1B35, 0x1B07, 0x1B35,
+	0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35,
+	0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35,
+	0x1B42, 0x1B35, 0x41, 0x325, 0x61, 0x325, 0x42, 0x307,
+	0x62, 0x307, 0x42, 0x323, 0x62, 0x323, 0x42, 0x331,
+	0x62, 0x331, 0x43, 0x327, 0x301, 0x63, 0x327, 0x301,
+	0x44, 0x307, 0x64, 0x307, 0x44, 0x323, 0x64, 0x323,
+	0x44, 0x331, 0x64, 0x331, 0x44, 0x327, 0x64, 0x327,
+	0x44, 0x32D, 0x64, 0x32D, 0x45, 0x304, 0x300, 0x65,
+	0x304, 0x300, 0x45, 0x304, 0x301, 0x65, 0x304, 0x301,
+	0x45, 0x32D, 0x65, 0x32D, 0x45, 0x330, 0x65, 0x330,
+	0x45, 0x327, 0x306, 0x65, 0x327, 0x306, 0x46, 0x307,
+	0x66, 0x307, 0x47, 0x304, 0x67, 0x304, 0x48, 0x307,
+	0x68, 0x307, 0x48, 0x323, 0x68, 0x323, 0x48, 0x308,
+	0x68, 0x308, 0x48, 0x327, 0x68, 0x327, 0x48, 0x32E,
+	0x68, 0x32E, 0x49, 0x330, 0x69, 0x330, 0x49, 0x308,
+	0x301, 0x69, 0x308, 0x301, 0x4B, 0x301, 0x6B, 0x301,
+	0x4B, 0x323, 0x6B, 0x323, 0x4B, 0x331, 0x6B, 0x331,
+	0x4C, 0x323, 0x6C, 0x323, 0x4C, 0x323, 0x304, 0x6C,
+	0x323, 0x304, 0x4C, 0x331, 0x6C, 0x331, 0x4C, 0x32D,
+	0x6C, 0x32D, 0x4D, 0x301, 0x6D, 0x301, 0x4D, 0x307,
+	0x6D, 0x307, 0x4D, 0x323, 0x6D, 0x323, 0x4E, 0x307,
+	0x6E, 0x307, 0x4E, 0x323, 0x6E, 0x323, 0x4E, 0x331,
+	0x6E, 0x331, 0x4E, 0x32D, 0x6E, 0x32D, 0x4F, 0x303,
+	0x301, 0x6F, 0x303, 0x301, 0x4F, 0x303, 0x308, 0x6F,
+	0x303, 0x308, 0x4F, 0x304, 0x300, 0x6F, 0x304, 0x300,
+	0x4F, 0x304, 0x301, 0x6F, 0x304, 0x301, 0x50, 0x301,
+	0x70, 0x301, 0x50, 0x307, 0x70, 0x307, 0x52, 0x307,
+	0x72, 0x307, 0x52, 0x323, 0x72, 0x323, 0x52, 0x323,
+	0x304, 0x72, 0x323, 0x304, 0x52, 0x331, 0x72, 0x331,
+	0x53, 0x307, 0x73, 0x307, 0x53, 0x323, 0x73, 0x323,
+	0x53, 0x301, 0x307, 0x73, 0x301, 0x307, 0x53, 0x30C,
+	0x307, 0x73, 0x30C, 0x307, 0x53, 0x323, 0x307, 0x73,
+	0x323, 0x307, 0x54, 0x307, 0x74, 0x307, 0x54, 0x323,
+	0x74, 0x323, 0x54, 0x331, 0x74, 0x331, 0x54, 0x32D,
+	0x74, 0x32D, 0x55, 0x324, 0x75, 0x324, 0x55, 0x330,
+	0x75, 0x330, 0x55, 0x32D, 0x75, 0x32D, 0x55, 0x303,
+	0x301, 0x75, 0x303, 0x301, 0x55, 0x304, 0x308, 0x75,
+	0x304, 0x308, 0x56, 0x303, 0x76, 0x303, 0x56, 0x323,
+	0x76, 0x323, 0x57, 0x300, 0x77, 0x300, 0x57, 0x301,
+	0x77, 0x301, 0x57, 0x308, 0x77, 0x308, 0x57, 0x307,
+	0x77, 0x307, 0x57, 0x323, 0x77, 0x323, 0x58, 0x307,
+	0x78, 0x307, 0x58, 0x308, 0x78, 0x308, 0x59, 0x307,
+	0x79, 0x307, 0x5A, 0x302, 0x7A, 0x302, 0x5A, 0x323,
+	0x7A, 0x323, 0x5A, 0x331, 0x7A, 0x331, 0x68, 0x331,
+	0x74, 0x308, 0x77, 0x30A, 0x79, 0x30A, 0x17F, 0x307,
+	0x41, 0x323, 0x61, 0x323, 0x41, 0x309, 0x61, 0x309,
+	0x41, 0x302, 0x301, 0x61, 0x302, 0x301, 0x41, 0x302,
+	0x300, 0x61, 0x302, 0x300, 0x41, 0x302, 0x309, 0x61,
+	0x302, 0x309, 0x41, 0x302, 0x303, 0x61, 0x302, 0x303,
+	0x41, 0x323, 0x302, 0x61, 0x323, 0x302, 0x41, 0x306,
+	0x301, 0x61, 0x306, 0x301, 0x41, 0x306, 0x300, 0x61,
+	0x306, 0x300, 0x41, 0x306, 0x309, 0x61, 0x306, 0x309,
+	0x41, 0x306, 0x303, 0x61, 0x306, 0x303, 0x41, 0x323,
+	0x306, 0x61, 0x323, 0x306, 0x45, 0x323, 0x65, 0x323,
+	0x45, 0x309, 0x65, 0x309, 0x45, 0x303, 0x65, 0x303,
+	0x45, 0x302, 0x301, 0x65, 0x302, 0x301, 0x45, 0x302,
+	0x300, 0x65, 0x302, 0x300, 0x45, 0x302, 0x309, 0x65,
+	0x302, 0x309, 0x45, 0x302, 0x303, 0x65, 0x302, 0x303,
+	0x45, 0x323, 0x302, 0x65, 0x323, 0x302, 0x49, 0x309,
+	0x69, 0x309, 0x49, 0x323, 0x69, 0x323, 0x4F, 0x323,
+	0x6F, 0x323, 0x4F, 0x309, 0x6F, 0x309, 0x4F, 0x302,
+	0x301, 0x6F, 0x302, 0x301, 0x4F, 0x302, 0x300, 0x6F,
+	0x302, 0x300, 0x4F, 0x302, 0x309, 0x6F, 0x302, 0x309,
+	0x4F, 0x302, 0x303, 0x6F, 0x302, 0x303, 0x4F, 0x323,
+	0x302, 0x6F, 0x323, 0x302, 0x4F, 0x31B, 0x301, 0x6F,
+	0x31B, 0x301, 0x4F, 0x31B, 0x300, 0x6F, 0x31B, 0x300,
+	0x4F, 0x31B, 0x309, 0x6F, 0x31B, 0x309, 0x4F, 0x31B,
+	0x303, 0x6F, 0x31B, 0x303, 0x4F, 0x31B, 0x323, 0x6F,
+	0x31B, 0x323, 0x55, 0x323, 0x75, 0x323, 0x55, 0x309,
+	0x75, 0x309, 0x55, 0x31B, 0x301, 0x75, 0x31B, 0x301,
+	0x55, 0x31B, 0x300, 0x75, 0x31B, 0x300, 0x55, 0x31B,
+	0x309, 0x75, 0x31B, 0x309, 0x55, 0x31B, 0x303, 0x75,
+	0x31B, 0x303, 0x55, 0x31B, 0x323, 0x75, 0x31B, 0x323,
+	0x59, 0x300, 0x79, 0x300, 0x59, 0x323, 0x79, 0x323,
+	0x59, 0x309, 0x79, 0x309, 0x59, 0x303, 0x79, 0x303,
+	0x3B1, 0x313, 0x3B1, 0x314, 0x3B1, 0x313, 0x300, 0x3B1,
+	0x314, 0x300, 0x3B1, 0x313, 0x301, 0x3B1, 0x314, 0x301,
+	0x3B1, 0x313, 0x342, 0x3B1, 0x314, 0x342, 0x391, 0x313,
+	0x391, 0x314, 0x391, 0x313, 0x300, 0x391, 0x314, 0x300,
+	0x391, 0x313, 0x301, 0x391, 0x314, 0x301, 0x391, 0x313,
+	0x342, 0x391, 0x314, 0x342, 0x3B5, 0x313, 0x3B5, 0x314,
+	0x3B5, 0x313, 0x300, 0x3B5, 0x314, 0x300, 0x3B5, 0x313,
+	0x301, 0x3B5, 0x314, 0x301, 0x395, 0x313, 0x395, 0x314,
+	0x395, 0x313, 0x300, 0x395, 0x314, 0x300, 0x395, 0x313,
+	0x301, 0x395, 0x314, 0x301, 0x3B7, 0x313, 0x3B7, 0x314,
+	0x3B7, 0x313, 0x300, 0x3B7, 0x314, 0x300, 0x3B7, 0x313,
+	0x301, 0x3B7, 0x314, 0x301, 0x3B7, 0x313, 0x342, 0x3B7,
+	0x314, 0x342, 0x397, 0x313, 0x397, 0x314, 0x397, 0x313,
+	0x300, 0x397, 0x314, 0x300, 0x397, 0x313, 0x301, 0x397,
+	0x314, 0x301, 0x397, 0x313, 0x342, 0x397, 0x314, 0x342,
+	0x3B9, 0x313, 0x3B9, 0x314, 0x3B9, 0x313, 0x300, 0x3B9,
+	0x314, 0x300, 0x3B9, 0x313, 0x301, 0x3B9, 0x314, 0x301,
+	0x3B9, 0x313, 0x342, 0x3B9, 0x314, 0x342, 0x399, 0x313,
+	0x399, 0x314, 0x399, 0x313, 0x300, 0x399, 0x314, 0x300,
+	0x399, 0x313, 0x301, 0x399, 0x314, 0x301, 0x399, 0x313,
+	0x342, 0x399, 0x314, 0x342, 0x3BF, 0x313, 0x3BF, 0x314,
+	0x3BF, 0x313, 0x300, 0x3BF, 0x314, 0x300, 0x3BF, 0x313,
+	0x301, 0x3BF, 0x314, 0x301, 0x39F, 0x313, 0x39F, 0x314,
+	0x39F, 0x313, 0x300, 0x39F, 0x314, 0x300, 0x39F, 0x313,
+	0x301, 0x39F, 0x314, 0x301, 0x3C5, 0x313, 0x3C5, 0x314,
+	0x3C5, 0x313, 0x300, 0x3C5, 0x314, 0x300, 0x3C5, 0x313,
+	0x301, 0x3C5, 0x314, 0x301, 0x3C5, 0x313, 0x342, 0x3C5,
+	0x314, 0x342, 0x3A5, 0x314, 0x3A5, 0x314, 0x300, 0x3A5,
+	0x314, 0x301, 0x3A5, 0x314, 0x342, 0x3C9, 0x313, 0x3C9,
+	0x314, 0x3C9, 0x313, 0x300, 0x3C9, 0x314, 0x300, 0x3C9,
+	0x313, 0x301, 0x3C9, 0x314, 0x301, 0x3C9, 0x313, 0x342,
+	0x3C9, 0x314, 0x342, 0x3A9, 0x313, 0x3A9, 0x314, 0x3A9,
+	0x313, 0x300, 0x3A9, 0x314, 0x300, 0x3A9, 0x313, 0x301,
+	0x3A9, 0x314, 0x301, 0x3A9, 0x313, 0x342, 0x3A9, 0x314,
+	0x342, 0x3B1, 0x300, 0x3B1, 0x301, 0x3B5, 0x300, 0x3B5,
+	0x301, 0x3B7, 0x300, 0x3B7, 0x301, 0x3B9, 0x300, 0x3B9,
+	0x301, 0x3BF, 0x300, 0x3BF, 0x301, 0x3C5, 0x300, 0x3C5,
+	0x301, 0x3C9, 0x300, 0x3C9, 0x301, 0x3B1, 0x313, 0x345,
+	0x3B1, 0x314, 0x345, 0x3B1, 0x313, 0x300, 0x345, 0x3B1,
+	0x314, 0x300, 0x345, 0x3B1, 0x313, 0x301, 0x345, 0x3B1,
+	0x314, 0x301, 0x345, 0x3B1, 0x313, 0x342, 0x345, 0x3B1,
+	0x314, 0x342, 0x345, 0x391, 0x313, 0x345, 0x391, 0x314,
+	0x345, 0x391, 0x313, 0x300, 0x345, 0x391, 0x314, 0x300,
+	0x345, 0x391, 0x313, 0x301, 0x345, 0x391, 0x314, 0x301,
+	0x345, 0x391, 0x313, 0x342, 0x345, 0x391, 0x314, 0x342,
+	0x345, 0x3B7, 0x313, 0x345, 0x3B7, 0x314, 0x345, 0x3B7,
+	0x313, 0x300, 0x345, 0x3B7, 0x314, 0x300, 0x345, 0x3B7,
+	0x313, 0x301, 0x345, 0x3B7, 0x314, 0x301, 0x345, 0x3B7,
+	0x313, 0x342, 0x345, 0x3B7, 0x314, 0x342, 0x345, 0x397,
+	0x313, 0x345, 0x397, 0x314, 0x345, 0x397, 0x313, 0x300,
+	0x345, 0x397, 0x314, 0x300, 0x345, 0x397, 0x313, 0x301,
+	0x345, 0x397, 0x314, 0x301, 0x345, 0x397, 0x313, 0x342,
+	0x345, 0x397, 0x314, 0x342, 0x345, 0x3C9, 0x313, 0x345,
+	0x3C9, 0x314, 0x345, 0x3C9, 0x313, 0x300, 0x345, 0x3C9,
+	0x314, 0x300, 0x345, 0x3C9, 0x313, 0x301, 0x345, 0x3C9,
+	0x314, 0x301, 0x345, 0x3C9, 0x313, 0x342, 0x345, 0x3C9,
+	0x314, 0x342, 0x345, 0x3A9, 0x313, 0x345, 0x3A9, 0x314,
+	0x345, 0x3A9, 0x313, 0x300, 0x345, 0x3A9, 0x314, 0x300,
+	0x345, 0x3A9, 0x313, 0x301, 0x345, 0x3A9, 0x314, 0x301,
+	0x345, 0x3A9, 0x313, 0x342, 0x345, 0x3A9, 0x314, 0x342,
+	0x345, 0x3B1, 0x306, 0x3B1, 0x304, 0x3B1, 0x300, 0x345,
+	0x3B1, 0x345, 0x3B1, 0x301, 0x345, 0x3B1, 0x342, 0x3B1,
+	0x342, 0x345, 0x391, 0x306, 0x391, 0x304, 0x391, 0x300,
+	0x391, 0x301, 0x391, 0x345, 0x3B9, 0xA8, 0x342, 0x3B7,
+	0x300, 0x345, 0x3B7, 0x345, 0x3B7, 0x301, 0x345, 0x3B7,
+	0x342, 0x3B7, 0x342, 0x345, 0x395, 0x300, 0x395, 0x301,
+	0x397, 0x300, 0x397, 0x301, 0x397, 0x345, 0x1FBF, 0x300,
+	0x1FBF, 0x301, 0x1FBF, 0x342, 0x3B9, 0x306, 0x3B9, 0x304,
+	0x3B9, 0x308, 0x300, 0x3B9, 0x308, 0x301, 0x3B9, 0x342,
+	0x3B9, 0x308, 0x342, 0x399, 0x306, 0x399, 0x304, 0x399,
+	0x300, 0x399, 0x301, 0x1FFE, 0x300, 0x1FFE, 0x301, 0x1FFE,
+	0x342, 0x3C5, 0x306, 0x3C5, 0x304, 0x3C5, 0x308, 0x300,
+	0x3C5, 0x308, 0x301, 0x3C1, 0x313, 0x3C1, 0x314, 0x3C5,
+	0x342, 0x3C5, 0x308, 0x342, 0x3A5, 0x306, 0x3A5, 0x304,
+	0x3A5, 0x300, 0x3A5, 0x301, 0x3A1, 0x314, 0xA8, 0x300,
+	0xA8, 0x301, 0x60, 0x3C9, 0x300, 0x345, 0x3C9, 0x345,
+	0x3C9, 0x301, 0x345, 0x3C9, 0x342, 0x3C9, 0x342, 0x345,
+	0x39F, 0x300, 0x39F, 0x301, 0x3A9, 0x300, 0x3A9, 0x301,
+	0x3A9, 0x345, 0xB4, 0x2002, 0x2003, 0x3A9, 0x4B, 0x41,
+	0x30A, 0x2190, 0x338, 0x2192, 0x338, 0x2194, 0x338, 0x21D0,
+	0x338, 0x21D4, 0x338, 0x21D2, 0x338, 0x2203, 0x338, 0x2208,
+	0x338, 0x220B, 0x338, 0x2223, 0x338, 0x2225, 0x338, 0x223C,
+	0x338, 0x2243, 0x338, 0x2245, 0x338, 0x2248, 0x338, 0x3D,
+	0x338, 0x2261, 0x338, 0x224D, 0x338, 0x3C, 0x338, 0x3E,
+	0x338, 0x2264, 0x338, 0x2265, 0x338, 0x2272, 0x338, 0x2273,
+	0x338, 0x2276, 0x338, 0x2277, 0x338, 0x227A, 0x338, 0x227B,
+	0x338, 0x2282, 0x338, 0x2283, 0x338, 0x2286, 0x338, 0x2287,
+	0x338, 0x22A2, 0x338, 0x22A8, 0x338, 0x22A9, 0x338, 0x22AB,
+	0x338, 0x227C, 0x338, 0x227D, 0x338, 0x2291, 0x338, 0x2292,
+	0x338, 0x22B2, 0x338, 0x22B3, 0x338, 0x22B4, 0x338, 0x22B5,
+	0x338, 0x3008, 0x3009, 0x2ADD, 0x338, 0x304B, 0x3099, 0x304D,
+	0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055,
+	0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D,
+	0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+	0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072,
+	0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078,
+	0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046,
+	0x3099, 0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF,
+	0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7,
+	0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF,
+	0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8,
+	0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2,
+	0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8,
+	0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF,
+	0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD,
+	0x3099, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5,
+	0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669,
+	0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9,
+	0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B,
+	0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8,
+	0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7,
+	0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C,
+	0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9,
+	0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262,
+	0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F,
+	0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C,
+	0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39,
+	0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+	0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449,
+	0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565,
+	0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF,
+	0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD,
+	0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74,
+	0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+	0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD,
+	0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E,
+	0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469,
+	0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE,
+	0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599,
+	0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E,
+	0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B,
+	0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA,
+	0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F,
+	0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79,
+	0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0,
+	0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8,
+	0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336,
+	0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4,
+	0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A,
+	0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F,
+	0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF,
+	0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+	0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8,
+	0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2,
+	0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422,
+	0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D,
+	0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72,
+	0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01,
+	0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B,
+	0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145,
+	0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A,
+	0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69,
+	0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234,
+	0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756,
+	0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E,
+	0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D,
+	0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1,
+	0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF,
+	0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01,
+	0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199,
+	0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B,
+	0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039,
+	0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x5D9, 0x5B4, 0x5F2,
+	0x5B7, 0x5E9, 0x5C1, 0x5E9, 0x5C2, 0x5E9, 0x5BC, 0x5C1,
+	0x5E9, 0x5BC, 0x5C2, 0x5D0, 0x5B7, 0x5D0, 0x5B8, 0x5D0,
+	0x5BC, 0x5D1, 0x5BC, 0x5D2, 0x5BC, 0x5D3, 0x5BC, 0x5D4,
+	0x5BC, 0x5D5, 0x5BC, 0x5D6, 0x5BC, 0x5D8, 0x5BC, 0x5D9,
+	0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC, 0x5BC, 0x5DE,
+	0x5BC, 0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3, 0x5BC, 0x5E4,
+	0x5BC, 0x5E6, 0x5BC, 0x5E7, 0x5BC, 0x5E8, 0x5BC, 0x5E9,
+	0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9, 0x5D1, 0x5BF, 0x5DB,
+	0x5BF, 0x5E4, 0x5BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+	0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347,
+	0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8,
+	0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158,
+	0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+	0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+	0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+	0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F,
+	0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB, 0x5002,
+	0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154,
+	0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B, 0x5197,
+	0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF,
+	0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4,
+	0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373,
+	0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF,
+	0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468,
+	0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599,
+	0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674,
+	0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831,
+	0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922, 0x5962,
+	0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE,
+	0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7,
+	0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60,
+	0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B,
+	0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69,
+	0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392,
+	0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22, 0x38C7, 0x232B8,
+	0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9,
+	0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148, 0x614C,
+	0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF, 0x61DE,
+	0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350,
+	0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422,
+	0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C,
+	0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691,
+	0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9,
+	0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA,
+	0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D,
+	0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21,
+	0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D,
+	0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16,
+	0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34,
+	0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E,
+	0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A,
+	0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C, 0x243AB,
+	0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814,
+	0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C,
+	0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92,
+	0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008,
+	0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x771F,
+	0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C,
+	0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5, 0x798F, 0x79EB,
+	0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE,
+	0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0,
+	0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02,
+	0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E,
+	0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070,
+	0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7,
+	0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291,
+	0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C,
+	0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457,
+	0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B,
+	0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561,
+	0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669, 0x86A9,
+	0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7,
+	0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7, 0x88DE,
+	0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0,
+	0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77,
+	0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38,
+	0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238,
+	0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995,
+	0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A,
+	0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x980B,
+	0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE,
+	0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67,
+	0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56, 0x9EF9,
+	0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+};
+
+struct Composition
+{
+	uint32_t first;
+	uint32_t second;
+	uint32_t composite;
+};
+
+// Primary composites other than Hangul syllables, in order of the pair
+// they compose from.
+const Composition kCompositions[] = {
+	{ 0x3C, 0x338, 0x226E },
+	{ 0x3D, 0x338, 0x2260 },
+	{ 0x3E, 0x338, 0x226F },
+	{ 0x41, 0x300, 0xC0 },
+	{ 0x41, 0x301, 0xC1 },
+	{ 0x41, 0x302, 0xC2 },
+	{ 0x41, 0x303, 0xC3 },
+	{ 0x41, 0x304, 0x100 },
+	{ 0x41, 0x306, 0x102 },
+	{ 0x41, 0x307, 0x226 },
+	{ 0x41, 0x308, 0xC4 },
+	{ 0x41, 0x309, 0x1EA2 },
+	{ 0x41, 0x30A, 0xC5 },
+	{ 0x41, 0x30C, 0x1CD },
+	{ 0x41, 0x30F, 0x200 },
+	{ 0x41, 0x311, 0x202 },
+	{ 0x41, 0x323, 0x1EA0 },
+	{ 0x41, 0x325, 0x1E00 },
+	{ 0x41, 0x328, 0x104 },
+	{ 0x42, 0x307, 0x1E02 },
+	{ 0x42, 0x323, 0x1E04 },
+	{ 0x42, 0x331, 0x1E06 },
+	{ 0x43, 0x301, 0x106 },
+	{ 0x43, 0x302, 0x108 },
+	{ 0x43, 0x307, 0x10A },
+	{ 0x43, 0x30C, 0x10C },
+	{ 0x43, 0x327, 0xC7 },
+	{ 0x44, 0x307, 0x1E0A },
+	{ 0x44, 0x30C, 0x10E },
+	{ 0x44, 0x323, 0x1E0C },
+	{ 0x44, 0x327, 0x1E10 },
+	{ 0x44, 0x32D, 0x1E12 },
+	{ 0x44, 0x331, 0x1E0E },
+	{ 0x45, 0x300, 0xC8 },
+	{ 0x45, 0x301, 0xC9 },
+	{ 0x45, 0x302, 0xCA },
+	{ 0x45, 0x303, 0x1EBC },
+	{ 0x45, 0x304, 0x112 },
+	{ 0x45, 0x306, 0x114 },
+	{ 0x45, 0x307, 0x116 },
+	{ 0x45, 0x308, 0xCB },
+	{ 0x45, 0x309, 0x1EBA },
+	{ 0x45, 0x30C, 0x11A },
+	{ 0x45, 0x30F, 0x204 },
+	{ 0x45, 0x311, 0x206 },
+	{ 0x45, 0x323, 0x1EB8 },
+	{ 0x45, 0x327, 0x228 },
+	{ 0x45, 0x328, 0x118 },
+	{ 0x45, 0x32D, 0x1E18 },
+	{ 0x45, 0x330, 0x1E1A },
+	{ 0x46, 0x307, 0x1E1E },
+	{ 0x47, 0x301, 0x1F4 },
+	{ 0x47, 0x302, 0x11C },
+	{ 0x47, 0x304, 0x1E20 },
+	{ 0x47, 0x306, 0x11E },
+	{ 0x47, 0x307, 0x120 },
+	{ 0x47, 0x30C, 0x1E6 },
+	{ 0x47, 0x327, 0x122 },
+	{ 0x48, 0x302, 0x124 },
+	{ 0x48, 0x307, 0x1E22 },
+	{ 0x48, 0x308, 0x1E26 },
+	{ 0x48, 0x30C, 0x21E },
+	{ 0x48, 0x323, 0x1E24 },
+	{ 0x48, 0x327, 0x1E28 },
+	{ 0x48, 0x32E, 0x1E2A },
+	{ 0x49, 0x300, 0xCC },
+	{ 0x49, 0x301, 0xCD },
+	{ 0x49, 0x302, 0xCE },
+	{ 0x49, 0x303, 0x128 },
+	{ 0x49, 0x304, 0x12A },
+	{ 0x49, 0x306, 0x12C },
+	{ 0x49, 0x307, 0x130 },
+	{ 0x49, 0x308, 0xCF },
+	{ 0x49, 0x309, 0x1EC8 },
+	{ 0x49, 0x30C, 0x1CF },
+	{ 0x49, 0x30F, 0x208 },
+	{ 0x49, 0x311, 0x20A },
+	{ 0x49, 0x323, 0x1ECA },
+	{ 0x49, 0x328, 0x12E },
+	{ 0x49, 0x330, 0x1E2C },
+	{ 0x4A, 0x302, 0x134 },
+	{ 0x4B, 0x301, 0x1E30 },
+	{ 0x4B, 0x30C, 0x1E8 },
+	{ 0x4B, 0x323, 0x1E32 },
+	{ 0x4B, 0x327, 0x136 },
+	{ 0x4B, 0x331, 0x1E34 },
+	{ 0x4C, 0x301, 0x139 },
+	{ 0x4C, 0x30C, 0x13D },
+	{ 0x4C, 0x323, 0x1E36 },
+	{ 0x4C, 0x327, 0x13B },
+	{ 0x4C, 0x32D, 0x1E3C },
+	{ 0x4C, 0x331, 0x1E3A },
+	{ 0x4D, 0x301, 0x1E3E },
+	{ 0x4D, 0x307, 0x1E40 },
+	{ 0x4D, 0x323, 0x1E42 },
+	{ 0x4E, 0x300, 0x1F8 },
+	{ 0x4E, 0x301, 0x143 },
+	{ 0x4E, 0x303, 0xD1 },
+	{ 0x4E, 0x307, 0x1E44 },
+	{ 0x4E, 0x30C, 0x147 },
+	{ 0x4E, 0x323, 0x1E46 },
+	{ 0x4E, 0x327, 0x145 },
+	{ 0x4E, 0x32D, 0x1E4A },
+	{ 0x4E, 0x331, 0x1E48 },
+	{ 0x4F, 0x300, 0xD2 },
+	{ 0x4F, 0x301, 0xD3 },
+	{ 0x4F, 0x302, 0xD4 },
+	{ 0x4F, 0x303, 0xD5 },
+	{ 0x4F, 0x304, 0x14C },
+	{ 0x4F, 0x306, 0x14E },
+	{ 0x4F, 0x307, 0x22E },
+	{ 0x4F, 0x308, 0xD6 },
+	{ 0x4F, 0x309, 0x1ECE },
+	{ 0x4F, 0x30B, 0x150 },
+	{ 0x4F, 0x30C, 0x1D1 },
+	{ 0x4F, 0x30F, 0x20C },
+	{ 0x4F, 0x311, 0x20E },
+	{ 0x4F, 0x31B, 0x1A0 },
+	{ 0x4F, 0x323, 0x1ECC },
+	{ 0x4F, 0x328, 0x1EA },
+	{ 0x50, 0x301, 0x1E54 },
+	{ 0x50, 0x307, 0x1E56 },
+	{ 0x52, 0x301, 0x154 },
+	{ 0x52, 0x307, 0x1E58 },
+	{ 0x52, 0x30C, 0x158 },
+	{ 0x52, 0x30F, 0x210 },
+	{ 0x52, 0x311, 0x212 },
+	{ 0x52, 0x323, 0x1E5A },
+	{ 0x52, 0x327, 0x156 },
+	{ 0x52, 0x331, 0x1E5E },
+	{ 0x53, 0x301, 0x15A },
+	{ 0x53, 0x302, 0x15C },
+	{ 0x53, 0x307, 0x1E60 },
+	{ 0x53, 0x30C, 0x160 },
+	{ 0x53, 0x323, 0x1E62 },
+	{ 0x53, 0x326, 0x218 },
+	{ 0x53, 0x327, 0x15E },
+	{ 0x54, 0x307, 0x1E6A },
+	{ 0x54, 0x30C, 0x164 },
+	{ 0x54, 0x323, 0x1E6C },
+	{ 0x54, 0x326, 0x21A },
+	{ 0x54, 0x327, 0x162 },
+	{ 0x54, 0x32D, 0x1E70 },
+	{ 0x54, 0x331, 0x1E6E },
+	{ 0x55, 0x300, 0xD9 },
+	{ 0x55, 0x301, 0xDA },
+	{ 0x55, 0x302, 0xDB },
+	{ 0x55, 0x303, 0x168 },
+	{ 0x55, 0x304, 0x16A },
+	{ 0x55, 0x306, 0x16C },
+	{ 0x55, 0x308, 0xDC },
+	{ 0x55, 0x309, 0x1EE6 },
+	{ 0x55, 0x30A, 0x16E },
+	{ 0x55, 0x30B, 0x170 },
+	{ 0x55, 0x30C, 0x1D3 },
+	{ 0x55, 0x30F, 0x214 },
+	{ 0x55, 0x311, 0x216 },
+	{ 0x55, 0x31B, 0x1AF },
+	{ 0x55, 0x323, 0x1EE4 },
+	{ 0x55, 0x324, 0x1E72 },
+	{ 0x55, 0x328, 0x172 },
+	{ 0x55, 0x32D, 0x1E76 },
+	{ 0x55, 0x330, 0x1E74 },
+	{ 0x56, 0x303, 0x1E7C },
+	{ 0x56, 0x323, 0x1E7E },
+	{ 0x57, 0x300, 0x1E80 },
+	{ 0x57, 0x301, 0x1E82 },
+	{ 0x57, 0x302, 0x174 },
+	{ 0x57, 0x307, 0x1E86 },
+	{ 0x57, 0x308, 0x1E84 },
+	{ 0x57, 0x323, 0x1E88 },
+	{ 0x58, 0x307, 0x1E8A },
+	{ 0x58, 0x308, 0x1E8C },
+	{ 0x59, 0x300, 0x1EF2 },
+	{ 0x59, 0x301, 0xDD },
+	{ 0x59, 0x302, 0x176 },
+	{ 0x59, 0x303, 0x1EF8 },
+	{ 0x59, 0x304, 0x232 },
+	{ 0x59, 0x307, 0x1E8E },
+	{ 0x59, 0x308, 0x178 },
+	{ 0x59, 0x309, 0x1EF6 },
+	{ 0x59, 0x323, 0x1EF4 },
+	{ 0x5A, 0x301, 0x179 },
+	{ 0x5A, 0x302, 0x1E90 },
+	{ 0x5A, 0x307, 0x17B },
+	{ 0x5A, 0x30C, 0x17D },
+	{ 0x5A, 0x323, 0x1E92 },
+	{ 0x5A, 0x331, 0x1E94 },
+	{ 0x61, 0x300, 0xE0 },
+	{ 0x61, 0x301, 0xE1 },
+	{ 0x61, 0x302, 0xE2 },
+	{ 0x61, 0x303, 0xE3 },
+	{ 0x61, 0x304, 0x101 },
+	{ 0x61, 0x306, 0x103 },
+	{ 0x61, 0x307, 0x227 },
+	{ 0x61, 0x308, 0xE4 },
+	{ 0x61, 0x309, 0x1EA3 },
+	{ 0x61, 0x30A, 0xE5 },
+	{ 0x61, 0x30C, 0x1CE },
+	{ 0x61, 0x30F, 0x201 },
+	{ 0x61, 0x311, 0x203 },
+	{ 0x61, 0x323, 0x1EA1 },
+	{ 0x61, 0x325, 0x1E01 },
+	{ 0x61, 0x328, 0x105 },
+	{ 0x62, 0x307, 0x1E03 },
+	{ 0x62, 0x323, 0x1E05 },
+	{ 0x62, 0x331, 0x1E07 },
+	{ 0x63, 0x301, 0x107 },
+	{ 0x63, 0x302, 0x109 },
+	{ 0x63, 0x307, 0x10B },
+	{ 0x63, 0x30C, 0x10D },
+	{ 0x63, 0x327, 0xE7 },
+	{ 0x64, 0x307, 0x1E0B },
+	{ 0x64, 0x30C, 0x10F },
+	{ 0x64, 0x323, 0x1E0D },
+	{ 0x64, 0x327, 0x1E11 },
+	{ 0x64, 0x32D, 0x1E13 },
+	{ 0x64, 0x331, 0x1E0F },
+	{ 0x65, 0x300, 0xE8 },
+	{ 0x65, 0x301, 0xE9 },
+	{ 0x65, 0x302, 0xEA },
+	{ 0x65, 0x303, 0x1EBD },
+	{ 0x65, 0x304, 0x113 },
+	{ 0x65, 0x306, 0x115 },
+	{ 0x65, 0x307, 0x117 },
+	{ 0x65, 0x308, 0xEB },
+	{ 0x65, 0x309, 0x1EBB },
+	{ 0x65, 0x30C, 0x11B },
+	{ 0x65, 0x30F, 0x205 },
+	{ 0x65, 0x311, 0x207 },
+	{ 0x65, 0x323, 0x1EB9 },
+	{ 0x65, 0x327, 0x229 },
+	{ 0x65, 0x328, 0x119 },
+	{ 0x65, 0x32D, 0x1E19 },
+	{ 0x65, 0x330, 0x1E1B },
+	{ 0x66, 0x307, 0x1E1F },
+	{ 0x67, 0x301, 0x1F5 },
+	{ 0x67, 0x302, 0x11D },
+	{ 0x67, 0x304, 0x1E21 },
+	{ 0x67, 0x306, 0x11F },
+	{ 0x67, 0x307, 0x121 },
+	{ 0x67, 0x30C, 0x1E7 },
+	{ 0x67, 0x327, 0x123 },
+	{ 0x68, 0x302, 0x125 },
+	{ 0x68, 0x307, 0x1E23 },
+	{ 0x68, 0x308, 0x1E27 },
+	{ 0x68, 0x30C, 0x21F },
+	{ 0x68, 0x323, 0x1E25 },
+	{ 0x68, 0x327, 0x1E29 },
+	{ 0x68, 0x32E, 0x1E2B },
+	{ 0x68, 0x331, 0x1E96 },
+	{ 0x69, 0x300, 0xEC },
+	{ 0x69, 0x301, 0xED },
+	{ 0x69, 0x302, 0xEE },
+	{ 0x69, 0x303, 0x129 },
+	{ 0x69, 0x304, 0x12B },
+	{ 0x69, 0x306, 0x12D },
+	{ 0x69, 0x308, 0xEF },
+	{ 0x69, 0x309, 0x1EC9 },
+	{ 0x69, 0x30C, 0x1D0 },
+	{ 0x69, 0x30F, 0x209 },
+	{ 0x69, 0x311, 0x20B },
+	{ 0x69, 0x323, 0x1ECB },
+	{ 0x69, 0x328, 0x12F },
+	{ 0x69, 0x330, 0x1E2D },
+	{ 0x6A, 0x302, 0x135 },
+	{ 0x6A, 0x30C, 0x1F0 },
+	{ 0x6B, 0x301, 0x1E31 },
+	{ 0x6B, 0x30C, 0x1E9 },
+	{ 0x6B, 0x323, 0x1E33 },
+	{ 0x6B, 0x327, 0x137 },
+	{ 0x6B, 0x331, 0x1E35 },
+	{ 0x6C, 0x301, 0x13A },
+	{ 0x6C, 0x30C, 0x13E },
+	{ 0x6C, 0x323, 0x1E37 },
+	{ 0x6C, 0x327, 0x13C },
+	{ 0x6C, 0x32D, 0x1E3D },
+	{ 0x6C, 0x331, 0x1E3B },
+	{ 0x6D, 0x301, 0x1E3F },
+	{ 0x6D, 0x307, 0x1E41 },
+	{ 0x6D, 0x323, 0x1E43 },
+	{ 0x6E, 0x300, 0x1F9 },
+	{ 0x6E, 0x301, 0x144 },
+	{ 0x6E, 0x303, 0xF1 },
+	{ 0x6E, 0x307, 0x1E45 },
+	{ 0x6E, 0x30C, 0x148 },
+	{ 0x6E, 0x323, 0x1E47 },
+	{ 0x6E, 0x327, 0x146 },
+	{ 0x6E, 0x32D, 0x1E4B },
+	{ 0x6E, 0x331, 0x1E49 },
+	{ 0x6F, 0x300, 0xF2 },
+	{ 0x6F, 0x301, 0xF3 },
+	{ 0x6F, 0x302, 0xF4 },
+	{ 0x6F, 0x303, 0xF5 },
+	{ 0x6F, 0x304, 0x14D },
+	{ 0x6F, 0x306, 0x14F },
+	{ 0x6F, 0x307, 0x22F },
+	{ 0x6F, 0x308, 0xF6 },
+	{ 0x6F, 0x309, 0x1ECF },
+	{ 0x6F, 0x30B, 0x151 },
+	{ 0x6F, 0x30C, 0x1D2 },
+	{ 0x6F, 0x30F, 0x20D },
+	{ 0x6F, 0x311, 0x20F },
+	{ 0x6F, 0x31B, 0x1A1 },
+	{ 0x6F, 0x323, 0x1ECD },
+	{ 0x6F, 0x328, 0x1EB },
+	{ 0x70, 0x301, 0x1E55 },
+	{ 0x70, 0x307, 0x1E57 },
+	{ 0x72, 0x301, 0x155 },
+	{ 0x72, 0x307, 0x1E59 },
+	{ 0x72, 0x30C, 0x159 },
+	{ 0x72, 0x30F, 0x211 },
+	{ 0x72, 0x311, 0x213 },
+	{ 0x72, 0x323, 0x1E5B },
+	{ 0x72, 0x327, 0x157 },
+	{ 0x72, 0x331, 0x1E5F },
+	{ 0x73, 0x301, 0x15B },
+	{ 0x73, 0x302, 0x15D },
+	{ 0x73, 0x307, 0x1E61 },
+	{ 0x73, 0x30C, 0x161 },
+	{ 0x73, 0x323, 0x1E63 },
+	{ 0x73, 0x326, 0x219 },
+	{ 0x73, 0x327, 0x15F },
+	{ 0x74, 0x307, 0x1E6B },
+	{ 0x74, 0x308, 0x1E97 },
+	{ 0x74, 0x30C, 0x165 },
+	{ 0x74, 0x323, 0x1E6D },
+	{ 0x74, 0x326, 0x21B },
+	{ 0x74, 0x327, 0x163 },
+	{ 0x74, 0x32D, 0x1E71 },
+	{ 0x74, 0x331, 0x1E6F },
+	{ 0x75, 0x300, 0xF9 },
+	{ 0x75, 0x301, 0xFA },
+	{ 0x75, 0x302, 0xFB },
+	{ 0x75, 0x303, 0x169 },
+	{ 0x75, 0x304, 0x16B },
+	{ 0x75, 0x306, 0x16D },
+	{ 0x75, 0x308, 0xFC },
+	{ 0x75, 0x309, 0x1EE7 },
+	{ 0x75, 0x30A, 0x16F },
+	{ 0x75, 0x30B, 0x171 },
+	{ 0x75, 0x30C, 0x1D4 },
+	{ 0x75, 0x30F, 0x215 },
+	{ 0x75, 0x311, 0x217 },
+	{ 0x75, 0x31B, 0x1B0 },
+	{ 0x75, 0x323, 0x1EE5 },
+	{ 0x75, 0x324, 0x1E73 },
+	{ 0x75, 0x328, 0x173 },
+	{ 0x75, 0x32D, 0x1E77 },
+	{ 0x75, 0x330, 0x1E75 },
+	{ 0x76, 0x303, 0x1E7D },
+	{ 0x76, 0x323, 0x1E7F },
+	{ 0x77, 0x300, 0x1E81 },
+	{ 0x77, 0x301, 0x1E83 },
+	{ 0x77, 0x302, 0x175 },
+	{ 0x77, 0x307, 0x1E87 },
+	{ 0x77, 0x308, 0x1E85 },
+	{ 0x77, 0x30A, 0x1E98 },
+	{ 0x77, 0x323, 0x1E89 },
+	{ 0x78, 0x307, 0x1E8B },
+	{ 0x78, 0x308, 0x1E8D },
+	{ 0x79, 0x300, 0x1EF3 },
+	{ 0x79, 0x301, 0xFD },
+	{ 0x79, 0x302, 0x177 },
+	{ 0x79, 0x303, 0x1EF9 },
+	{ 0x79, 0x304, 0x233 },
+	{ 0x79, 0x307, 0x1E8F },
+	{ 0x79, 0x308, 0xFF },
+	{ 0x79, 0x309, 0x1EF7 },
+	{ 0x79, 0x30A, 0x1E99 },
+	{ 0x79, 0x323, 0x1EF5 },
+	{ 0x7A, 0x301, 0x17A },
+	{ 0x7A, 0x302, 0x1E91 },
+	{ 0x7A, 0x307, 0x17C },
+	{ 0x7A, 0x30C, 0x17E },
+	{ 0x7A, 0x323, 0x1E93 },
+	{ 0x7A, 0x331, 0x1E95 },
+	{ 0xA8, 0x300, 0x1FED },
+	{ 0xA8, 0x301, 0x385 },
+	{ 0xA8, 0x342, 0x1FC1 },
+	{ 0xC2, 0x300, 0x1EA6 },
+	{ 0xC2, 0x301, 0x1EA4 },
+	{ 0xC2, 0x303, 0x1EAA },
+	{ 0xC2, 0x309, 0x1EA8 },
+	{ 0xC4, 0x304, 0x1DE },
+	{ 0xC5, 0x301, 0x1FA },
+	{ 0xC6, 0x301, 0x1FC },
+	{ 0xC6, 0x304, 0x1E2 },
+	{ 0xC7, 0x301, 0x1E08 },
+	{ 0xCA, 0x300, 0x1EC0 },
+	{ 0xCA, 0x301, 0x1EBE },
+	{ 0xCA, 0x303, 0x1EC4 },
+	{ 0xCA, 0x309, 0x1EC2 },
+	{ 0xCF, 0x301, 0x1E2E },
+	{ 0xD4, 0x300, 0x1ED2 },
+	{ 0xD4, 0x301, 0x1ED0 },
+	{ 0xD4, 0x303, 0x1ED6 },
+	{ 0xD4, 0x309, 0x1ED4 },
+	{ 0xD5, 0x301, 0x1E4C },
+	{ 0xD5, 0x304, 0x22C },
+	{ 0xD5, 0x308, 0x1E4E },
+	{ 0xD6, 0x304, 0x22A },
+	{ 0xD8, 0x301, 0x1FE },
+	{ 0xDC, 0x300, 0x1DB },
+	{ 0xDC, 0x301, 0x1D7 },
+	{ 0xDC, 0x304, 0x1D5 },
+	{ 0xDC, 0x30C, 0x1D9 },
+	{ 0xE2, 0x300, 0x1EA7 },
+	{ 0xE2, 0x301, 0x1EA5 },
+	{ 0xE2, 0x303, 0x1EAB },
+	{ 0xE2, 0x309, 0x1EA9 },
+	{ 0xE4, 0x304, 0x1DF },
+	{ 0xE5, 0x301, 0x1FB },
+	{ 0xE6, 0x301, 0x1FD },
+	{ 0xE6, 0x304, 0x1E3 },
+	{ 0xE7, 0x301, 0x1E09 },
+	{ 0xEA, 0x300, 0x1EC1 },
+	{ 0xEA, 0x301, 0x1EBF },
+	{ 0xEA, 0x303, 0x1EC5 },
+	{ 0xEA, 0x309, 0x1EC3 },
+	{ 0xEF, 0x301, 0x1E2F },
+	{ 0xF4, 0x300, 0x1ED3 },
+	{ 0xF4, 0x301, 0x1ED1 },
+	{ 0xF4, 0x303, 0x1ED7 },
+	{ 0xF4, 0x309, 0x1ED5 },
+	{ 0xF5, 0x301, 0x1E4D },
+	{ 0xF5, 0x304, 0x22D },
+	{ 0xF5, 0x308, 0x1E4F },
+	{ 0xF6, 0x304, 0x22B },
+	{ 0xF8, 0x301, 0x1FF },
+	{ 0xFC, 0x300, 0x1DC },
+	{ 0xFC, 0x301, 0x1D8 },
+	{ 0xFC, 0x304, 0x1D6 },
+	{ 0xFC, 0x30C, 0x1DA },
+	{ 0x102, 0x300, 0x1EB0 },
+	{ 0x102, 0x301, 0x1EAE },
+	{ 0x102, 0x303, 0x1EB4 },
+	{ 0x102, 0x309, 0x1EB2 },
+	{ 0x103, 0x300, 0x1EB1 },
+	{ 0x103, 0x301, 0x1EAF },
+	{ 0x103, 0x303, 0x1EB5 },
+	{ 0x103, 0x309, 0x1EB3 },
+	{ 0x112, 0x300, 0x1E14 },
+	{ 0x112, 0x301, 0x1E16 },
+	{ 0x113, 0x300, 0x1E15 },
+	{ 0x113, 0x301, 0x1E17 },
+	{ 0x14C, 0x300, 0x1E50 },
+	{ 0x14C, 0x301, 0x1E52 },
+	{ 0x14D, 0x300, 0x1E51 },
+	{ 0x14D, 0x301, 0x1E53 },
+	{ 0x15A, 0x307, 0x1E64 },
+	{ 0x15B, 0x307, 0x1E65 },
+	{ 0x160, 0x307, 0x1E66 },
+	{ 0x161, 0x307, 0x1E67 },
+	{ 0x168, 0x301, 0x1E78 },
+	{ 0x169, 0x301, 0x1E79 },
+	{ 0x16A, 0x308, 0x1E7A },
+	{ 0x16B, 0x308, 0x1E7B },
+	{ 0x17F, 0x307, 0x1E9B },
+	{ 0x1A0, 0x300, 0x1EDC },
+	{ 0x1A0, 0x301, 0x1EDA },
+	{ 0x1A0, 0x303, 0x1EE0 },
+	{ 0x1A0, 0x309, 0x1EDE },
+	{ 0x1A0, 0x323, 0x1EE2 },
+	{ 0x1A1, 0x300, 0x1EDD },
+	{ 0x1A1, 0x301, 0x1EDB },
+	{ 0x1A1, 0x303, 0x1EE1 },
+	{ 0x1A1, 0x309, 0x1EDF },
+	{ 0x1A1, 0x323, 0x1EE3 },
+	{ 0x1AF, 0x300, 0x1EEA },
+	{ 0x1AF, 0x301, 0x1EE8 },
+	{ 0x1AF, 0x303, 0x1EEE },
+	{ 0x1AF, 0x309, 0x1EEC },
+	{ 0x1AF, 0x323, 0x1EF0 },
+	{ 0x1B0, 0x300, 0x1EEB },
+	{ 0x1B0, 0x301, 0x1EE9 },
+	{ 0x1B0, 0x303, 0x1EEF },
+	{ 0x1B0, 0x309, 0x1EED },
+	{ 0x1B0, 0x323, 0x1EF1 },
+	{ 0x1B7, 0x30C, 0x1EE },
+	{ 0x1EA, 0x304, 0x1EC },
+	{ 0x1EB, 0x304, 0x1ED },
+	{ 0x226, 0x304, 0x1E0 },
+	{ 0x227, 0x304, 0x1E1 },
+	{ 0x228, 0x306, 0x1E1C },
+	{ 0x229, 0x306, 0x1E1D },
+	{ 0x22E, 0x304, 0x230 },
+	{ 0x22F, 0x304, 0x231 },
+	{ 0x292, 0x30C, 0x1EF },
+	{ 0x391, 0x300, 0x1FBA },
+	{ 0x391, 0x301, 0x386 },
+	{ 0x391, 0x304, 0x1FB9 },
+	{ 0x391, 0x306, 0x1FB8 },
+	{ 0x391, 0x313, 0x1F08 },
+	{ 0x391, 0x314, 0x1F09 },
+	{ 0x391, 0x345, 0x1FBC },
+	{ 0x395, 0x300, 0x1FC8 },
+	{ 0x395, 0x301, 0x388 },
+	{ 0x395, 0x313, 0x1F18 },
+	{ 0x395, 0x314, 0x1F19 },
+	{ 0x397, 0x300, 0x1FCA },
+	{ 0x397, 0x301, 0x389 },
+	{ 0x397, 0x313, 0x1F28 },
+	{ 0x397, 0x314, 0x1F29 },
+	{ 0x397, 0x345, 0x1FCC },
+	{ 0x399, 0x300, 0x1FDA },
+	{ 0x399, 0x301, 0x38A },
+	{ 0x399, 0x304, 0x1FD9 },
+	{ 0x399, 0x306, 0x1FD8 },
+	{ 0x399, 0x308, 0x3AA },
+	{ 0x399, 0x313, 0x1F38 },
+	{ 0x399, 0x314, 0x1F39 },
+	{ 0x39F, 0x300, 0x1FF8 },
+	{ 0x39F, 0x301, 0x38C },
+	{ 0x39F, 0x313, 0x1F48 },
+	{ 0x39F, 0x314, 0x1F49 },
+	{ 0x3A1, 0x314, 0x1FEC },
+	{ 0x3A5, 0x300, 0x1FEA },
+	{ 0x3A5, 0x301, 0x38E },
+	{ 0x3A5, 0x304, 0x1FE9 },
+	{ 0x3A5, 0x306, 0x1FE8 },
+	{ 0x3A5, 0x308, 0x3AB },
+	{ 0x3A5, 0x314, 0x1F59 },
+	{ 0x3A9, 0x300, 0x1FFA },
+	{ 0x3A9, 0x301, 0x38F },
+	{ 0x3A9, 0x313, 0x1F68 },
+	{ 0x3A9, 0x314, 0x1F69 },
+	{ 0x3A9, 0x345, 0x1FFC },
+	{ 0x3AC, 0x345, 0x1FB4 },
+	{ 0x3AE, 0x345, 0x1FC4 },
+	{ 0x3B1, 0x300, 0x1F70 },
+	{ 0x3B1, 0x301, 0x3AC },
+	{ 0x3B1, 0x304, 0x1FB1 },
+	{ 0x3B1, 0x306, 0x1FB0 },
+	{ 0x3B1, 0x313, 0x1F00 },
+	{ 0x3B1, 0x314, 0x1F01 },
+	{ 0x3B1, 0x342, 0x1FB6 },
+	{ 0x3B1, 0x345, 0x1FB3 },
+	{ 0x3B5, 0x300, 0x1F72 },
+	{ 0x3B5, 0x301, 0x3AD },
+	{ 0x3B5, 0x313, 0x1F10 },
+	{ 0x3B5, 0x314, 0x1F11 },
+	{ 0x3B7, 0x300, 0x1F74 },
+	{ 0x3B7, 0x301, 0x3AE },
+	{ 0x3B7, 0x313, 0x1F20 },
+	{ 0x3B7, 0x314, 0x1F21 },
+	{ 0x3B7, 0x342, 0x1FC6 },
+	{ 0x3B7, 0x345, 0x1FC3 },
+	{ 0x3B9, 0x300, 0x1F76 },
+	{ 0x3B9, 0x301, 0x3AF },
+	{ 0x3B9, 0x304, 0x1FD1 },
+	{ 0x3B9, 0x306, 0x1FD0 },
+	{ 0x3B9, 0x308, 0x3CA },
+	{ 0x3B9, 0x313, 0x1F30 },
+	{ 0x3B9, 0x314, 0x1F31 },
+	{ 0x3B9, 0x342, 0x1FD6 },
+	{ 0x3BF, 0x300, 0x1F78 },
+	{ 0x3BF, 0x301, 0x3CC },
+	{ 0x3BF, 0x313, 0x1F40 },
+	{ 0x3BF, 0x314, 0x1F41 },
+	{ 0x3C1, 0x313, 0x1FE4 },
+	{ 0x3C1, 0x314, 0x1FE5 },
+	{ 0x3C5, 0x300, 0x1F7A },
+	{ 0x3C5, 0x301, 0x3CD },
+	{ 0x3C5, 0x304, 0x1FE1 },
+	{ 0x3C5, 0x306, 0x1FE0 },
+	{ 0x3C5, 0x308, 0x3CB },
+	{ 0x3C5, 0x313, 0x1F50 },
+	{ 0x3C5, 0x314, 0x1F51 },
+	{ 0x3C5, 0x342, 0x1FE6 },
+	{ 0x3C9, 0x300, 0x1F7C },
+	{ 0x3C9, 0x301, 0x3CE },
+	{ 0x3C9, 0x313, 0x1F60 },
+	{ 0x3C9, 0x314, 0x1F61 },
+	{ 0x3C9, 0x342, 0x1FF6 },
+	{ 0x3C9, 0x345, 0x1FF3 },
+	{ 0x3CA, 0x300, 0x1FD2 },
+	{ 0x3CA, 0x301, 0x390 },
+	{ 0x3CA, 0x342, 0x1FD7 },
+	{ 0x3CB, 0x300, 0x1FE2 },
+	{ 0x3CB, 0x301, 0x3B0 },
+	{ 0x3CB, 0x342, 0x1FE7 },
+	{ 0x3CE, 0x345, 0x1FF4 },
+	{ 0x3D2, 0x301, 0x3D3 },
+	{ 0x3D2, 0x308, 0x3D4 },
+	{ 0x406, 0x308, 0x407 },
+	{ 0x410, 0x306, 0x4D0 },
+	{ 0x410, 0x308, 0x4D2 },
+	{ 0x413, 0x301, 0x403 },
+	{ 0x415, 0x300, 0x400 },
+	{ 0x415, 0x306, 0x4D6 },
+	{ 0x415, 0x308, 0x401 },
+	{ 0x416, 0x306, 0x4C1 },
+	{ 0x416, 0x308, 0x4DC },
+	{ 0x417, 0x308, 0x4DE },
+	{ 0x418, 0x300, 0x40D },
+	{ 0x418, 0x304, 0x4E2 },
+	{ 0x418, 0x306, 0x419 },
+	{ 0x418, 0x308, 0x4E4 },
+	{ 0x41A, 0x301, 0x40C },
+	{ 0x41E, 0x308, 0x4E6 },
+	{ 0x423, 0x304, 0x4EE },
+	{ 0x423, 0x306, 0x40E },
+	{ 0x423, 0x308, 0x4F0 },
+	{ 0x423, 0x30B, 0x4F2 },
+	{ 0x427, 0x308, 0x4F4 },
+	{ 0x42B, 0x308, 0x4F8 },
+	{ 0x42D, 0x308, 0x4EC },
+	{ 0x430, 0x306, 0x4D1 },
+	{ 0x430, 0x308, 0x4D3 },
+	{ 0x433, 0x301, 0x453 },
+	{ 0x435, 0x300, 0x450 },
+	{ 0x435, 0x306, 0x4D7 },
+	{ 0x435, 0x308, 0x451 },
+	{ 0x436, 0x306, 0x4C2 },
+	{ 0x436, 0x308, 0x4DD },
+	{ 0x437, 0x308, 0x4DF },
+	{ 0x438, 0x300, 0x45D },
+	{ 0x438, 0x304, 0x4E3 },
+	{ 0x438, 0x306, 0x439 },
+	{ 0x438, 0x308, 0x4E5 },
+	{ 0x43A, 0x301, 0x45C },
+	{ 0x43E, 0x308, 0x4E7 },
+	{ 0x443, 0x304, 0x4EF },
+	{ 0x443, 0x306, 0x45E },
+	{ 0x443, 0x308, 0x4F1 },
+	{ 0x443, 0x30B, 0x4F3 },
+	{ 0x447, 0x308, 0x4F5 },
+	{ 0x44B, 0x308, 0x4F9 },
+	{ 0x44D, 0x308, 0x4ED },
+	{ 0x456, 0x308, 0x457 },
+	{ 0x474, 0x30F, 0x476 },
+	{ 0x475, 0x30F, 0x477 },
+	{ 0x4D8, 0x308, 0x4DA },
+	{ 0x4D9, 0x308, 0x4DB },
+	{ 0x4E8, 0x308, 0x4EA },
+	{ 0x4E9, 0x308, 0x4EB },
+	{ 0x627, 0x653, 0x622 },
+	{ 0x627, 0x654, 0x623 },
+	{ 0x627, 0x655, 0x625 },
+	{ 0x648, 0x654, 0x624 },
+	{ 0x64A, 0x654, 0x626 },
+	{ 0x6C1, 0x654, 0x6C2 },
+	{ 0x6D2, 0x654, 0x6D3 },
+	{ 0x6D5, 0x654, 0x6C0 },
+	{ 0x928, 0x93C, 0x929 },
+	{ 0x930, 0x93C, 0x931 },
+	{ 0x933, 0x93C, 0x934 },
+	{ 0x9C7, 0x9BE, 0x9CB },
+	{ 0x9C7, 0x9D7, 0x9CC },
+	{ 0xB47, 0xB3E, 0xB4B },
+	{ 0xB47, 0xB56, 0xB48 },
+	{ 0xB47, 0xB57, 0xB4C },
+	{ 0xB92, 0xBD7, 0xB94 },
+	{ 0xBC6, 0xBBE, 0xBCA },
+	{ 0xBC6, 0xBD7, 0xBCC },
+	{ 0xBC7, 0xBBE, 0xBCB },
+	{ 0xC46, 0xC56, 0xC48 },
+	{ 0xCBF, 0xCD5, 0xCC0 },
+	{ 0xCC6, 0xCC2, 0xCCA },
+	{ 0xCC6, 0xCD5, 0xCC7 },
+	{ 0xCC6, 0xCD6, 0xCC8 },
+	{ 0xCCA, 0xCD5, 0xCCB },
+	{ 0xD46, 0xD3E, 0xD4A },
+	{ 0xD46, 0xD57, 0xD4C },
+	{ 0xD47, 0xD3E, 0xD4B },
+	{ 0xDD9, 0xDCA, 0xDDA },
+	{ 0xDD9, 0xDCF, 0xDDC },
+	{ 0xDD9, 0xDDF, 0xDDE },
+	{ 0xDDC, 0xDCA, 0xDDD },
+	{ 0x1025, 0x102E, 0x1026 },
+	{ 0x1B05, 0x1B35, 0x1B06 },
+	{ 0x1B07, 0x1B35, 0x1B08 },
+	{ 0x1B09, 0x1B35, 0x1B0A },
+	{ 0x1B0B, 0x1B35, 0x1B0C },
+	{ 0x1B0D, 0x1B35, 0x1B0E },
+	{ 0x1B11, 0x1B35, 0x1B12 },
+	{ 0x1B3A, 0x1B35, 0x1B3B },
+	{ 0x1B3C, 0x1B35, 0x1B3D },
+	{ 0x1B3E, 0x1B35, 0x1B40 },
+	{ 0x1B3F, 0x1B35, 0x1B41 },
+	{ 0x1B42, 0x1B35, 0x1B43 },
+	{ 0x1E36, 0x304, 0x1E38 },
+	{ 0x1E37, 0x304, 0x1E39 },
+	{ 0x1E5A, 0x304, 0x1E5C },
+	{ 0x1E5B, 0x304, 0x1E5D },
+	{ 0x1E62, 0x307, 0x1E68 },
+	{ 0x1E63, 0x307, 0x1E69 },
+	{ 0x1EA0, 0x302, 0x1EAC },
+	{ 0x1EA0, 0x306, 0x1EB6 },
+	{ 0x1EA1, 0x302, 0x1EAD },
+	{ 0x1EA1, 0x306, 0x1EB7 },
+	{ 0x1EB8, 0x302, 0x1EC6 },
+	{ 0x1EB9, 0x302, 0x1EC7 },
+	{ 0x1ECC, 0x302, 0x1ED8 },
+	{ 0x1ECD, 0x302, 0x1ED9 },
+	{ 0x1F00, 0x300, 0x1F02 },
+	{ 0x1F00, 0x301, 0x1F04 },
+	{ 0x1F00, 0x342, 0x1F06 },
+	{ 0x1F00, 0x345, 0x1F80 },
+	{ 0x1F01, 0x300, 0x1F03 },
+	{ 0x1F01, 0x301, 0x1F05 },
+	{ 0x1F01, 0x342, 0x1F07 },
+	{ 0x1F01, 0x345, 0x1F81 },
+	{ 0x1F02, 0x345, 0x1F82 },
+	{ 0x1F03, 0x345, 0x1F83 },
+	{ 0x1F04, 0x345, 0x1F84 },
+	{ 0x1F05, 0x345, 0x1F85 },
+	{ 0x1F06, 0x345, 0x1F86 },
+	{ 0x1F07, 0x345, 0x1F87 },
+	{ 0x1F08, 0x300, 0x1F0A },
+	{ 0x1F08, 0x301, 0x1F0C },
+	{ 0x1F08, 0x342, 0x1F0E },
+	{ 0x1F08, 0x345, 0x1F88 },
+	{ 0x1F09, 0x300, 0x1F0B },
+	{ 0x1F09, 0x301, 0x1F0D },
+	{ 0x1F09, 0x342, 0x1F0F },
+	{ 0x1F09, 0x345, 0x1F89 },
+	{ 0x1F0A, 0x345, 0x1F8A },
+	{ 0x1F0B, 0x345, 0x1F8B },
+	{ 0x1F0C, 0x345, 0x1F8C },
+	{ 0x1F0D, 0x345, 0x1F8D },
+	{ 0x1F0E, 0x345, 0x1F8E },
+	{ 0x1F0F, 0x345, 0x1F8F },
+	{ 0x1F10, 0x300, 0x1F12 },
+	{ 0x1F10, 0x301, 0x1F14 },
+	{ 0x1F11, 0x300, 0x1F13 },
+	{ 0x1F11, 0x301, 0x1F15 },
+	{ 0x1F18, 0x300, 0x1F1A },
+	{ 0x1F18, 0x301, 0x1F1C },
+	{ 0x1F19, 0x300, 0x1F1B },
+	{ 0x1F19, 0x301, 0x1F1D },
+	{ 0x1F20, 0x300, 0x1F22 },
+	{ 0x1F20, 0x301, 0x1F24 },
+	{ 0x1F20, 0x342, 0x1F26 },
+	{ 0x1F20, 0x345, 0x1F90 },
+	{ 0x1F21, 0x300, 0x1F23 },
+	{ 0x1F21, 0x301, 0x1F25 },
+	{ 0x1F21, 0x342, 0x1F27 },
+	{ 0x1F21, 0x345, 0x1F91 },
+	{ 0x1F22, 0x345, 0x1F92 },
+	{ 0x1F23, 0x345, 0x1F93 },
+	{ 0x1F24, 0x345, 0x1F94 },
+	{ 0x1F25, 0x345, 0x1F95 },
+	{ 0x1F26, 0x345, 0x1F96 },
+	{ 0x1F27, 0x345, 0x1F97 },
+	{ 0x1F28, 0x300, 0x1F2A },
+	{ 0x1F28, 0x301, 0x1F2C },
+	{ 0x1F28, 0x342, 0x1F2E },
+	{ 0x1F28, 0x345, 0x1F98 },
+	{ 0x1F29, 0x300, 0x1F2B },
+	{ 0x1F29, 0x301, 0x1F2D },
+	{ 0x1F29, 0x342, 0x1F2F },
+	{ 0x1F29, 0x345, 0x1F99 },
+	{ 0x1F2A, 0x345, 0x1F9A },
+	{ 0x1F2B, 0x345, 0x1F9B },
+	{ 0x1F2C, 0x345, 0x1F9C },
+	{ 0x1F2D, 0x345, 0x1F9D },
+	{ 0x1F2E, 0x345, 0x1F9E },
+	{ 0x1F2F, 0x345, 0x1F9F },
+	{ 0x1F30, 0x300, 0x1F32 },
+	{ 0x1F30, 0x301, 0x1F34 },
+	{ 0x1F30, 0x342, 0x1F36 },
+	{ 0x1F31, 0x300, 0x1F33 },
+	{ 0x1F31, 0x301, 0x1F35 },
+	{ 0x1F31, 0x342, 0x1F37 },
+	{ 0x1F38, 0x300, 0x1F3A },
+	{ 0x1F38, 0x301, 0x1F3C },
+	{ 0x1F38, 0x342, 0x1F3E },
+	{ 0x1F39, 0x300, 0x1F3B },
+	{ 0x1F39, 0x301, 0x1F3D },
+	{ 0x1F39, 0x342, 0x1F3F },
+	{ 0x1F40, 0x300, 0x1F42 },
+	{ 0x1F40, 0x301, 0x1F44 },
+	{ 0x1F41, 0x300, 0x1F43 },
+	{ 0x1F41, 0x301, 0x1F45 },
+	{ 0x1F48, 0x300, 0x1F4A },
+	{ 0x1F48, 0x301, 0x1F4C },
+	{ 0x1F49, 0x300, 0x1F4B },
+	{ 0x1F49, 0x301, 0x1F4D },
+	{ 0x1F50, 0x300, 0x1F52 },
+	{ 0x1F50, 0x301, 0x1F54 },
+	{ 0x1F50, 0x342, 0x1F56 },
+	{ 0x1F51, 0x300, 0x1F53 },
+	{ 0x1F51, 0x301, 0x1F55 },
+	{ 0x1F51, 0x342, 0x1F57 },
+	{ 0x1F59, 0x300, 0x1F5B },
+	{ 0x1F59, 0x301, 0x1F5D },
+	{ 0x1F59, 0x342, 0x1F5F },
+	{ 0x1F60, 0x300, 0x1F62 },
+	{ 0x1F60, 0x301, 0x1F64 },
+	{ 0x1F60, 0x342, 0x1F66 },
+	{ 0x1F60, 0x345, 0x1FA0 },
+	{ 0x1F61, 0x300, 0x1F63 },
+	{ 0x1F61, 0x301, 0x1F65 },
+	{ 0x1F61, 0x342, 0x1F67 },
+	{ 0x1F61, 0x345, 0x1FA1 },
+	{ 0x1F62, 0x345, 0x1FA2 },
+	{ 0x1F63, 0x345, 0x1FA3 },
+	{ 0x1F64, 0x345, 0x1FA4 },
+	{ 0x1F65, 0x345, 0x1FA5 },
+	{ 0x1F66, 0x345, 0x1FA6 },
+	{ 0x1F67, 0x345, 0x1FA7 },
+	{ 0x1F68, 0x300, 0x1F6A },
+	{ 0x1F68, 0x301, 0x1F6C },
+	{ 0x1F68, 0x342, 0x1F6E },
+	{ 0x1F68, 0x345, 0x1FA8 },
+	{ 0x1F69, 0x300, 0x1F6B },
+	{ 0x1F69, 0x301, 0x1F6D },
+	{ 0x1F69, 0x342, 0x1F6F },
+	{ 0x1F69, 0x345, 0x1FA9 },
+	{ 0x1F6A, 0x345, 0x1FAA },
+	{ 0x1F6B, 0x345, 0x1FAB },
+	{ 0x1F6C, 0x345, 0x1FAC },
+	{ 0x1F6D, 0x345, 0x1FAD },
+	{ 0x1F6E, 0x345, 0x1FAE },
+	{ 0x1F6F, 0x345, 0x1FAF },
+	{ 0x1F70, 0x345, 0x1FB2 },
+	{ 0x1F74, 0x345, 0x1FC2 },
+	{ 0x1F7C, 0x345, 0x1FF2 },
+	{ 0x1FB6, 0x345, 0x1FB7 },
+	{ 0x1FBF, 0x300, 0x1FCD },
+	{ 0x1FBF, 0x301, 0x1FCE },
+	{ 0x1FBF, 0x342, 0x1FCF },
+	{ 0x1FC6, 0x345, 0x1FC7 },
+	{ 0x1FF6, 0x345, 0x1FF7 },
+	{ 0x1FFE, 0x300, 0x1FDD },
+	{ 0x1FFE, 0x301, 0x1FDE },
+	{ 0x1FFE, 0x342, 0x1FDF },
+	{ 0x2190, 0x338, 0x219A },
+	{ 0x2192, 0x338, 0x219B },
+	{ 0x2194, 0x338, 0x21AE },
+	{ 0x21D0, 0x338, 0x21CD },
+	{ 0x21D2, 0x338, 0x21CF },
+	{ 0x21D4, 0x338, 0x21CE },
+	{ 0x2203, 0x338, 0x2204 },
+	{ 0x2208, 0x338, 0x2209 },
+	{ 0x220B, 0x338, 0x220C },
+	{ 0x2223, 0x338, 0x2224 },
+	{ 0x2225, 0x338, 0x2226 },
+	{ 0x223C, 0x338, 0x2241 },
+	{ 0x2243, 0x338, 0x2244 },
+	{ 0x2245, 0x338, 0x2247 },
+	{ 0x2248, 0x338, 0x2249 },
+	{ 0x224D, 0x338, 0x226D },
+	{ 0x2261, 0x338, 0x2262 },
+	{ 0x2264, 0x338, 0x2270 },
+	{ 0x2265, 0x338, 0x2271 },
+	{ 0x2272, 0x338, 0x2274 },
+	{ 0x2273, 0x338, 0x2275 },
+	{ 0x2276, 0x338, 0x2278 },
+	{ 0x2277, 0x338, 0x2279 },
+	{ 0x227A, 0x338, 0x2280 },
+	{ 0x227B, 0x338, 0x2281 },
+	{ 0x227C, 0x338, 0x22E0 },
+	{ 0x227D, 0x338, 0x22E1 },
+	{ 0x2282, 0x338, 0x2284 },
+	{ 0x2283, 0x338, 0x2285 },
+	{ 0x2286, 0x338, 0x2288 },
+	{ 0x2287, 0x338, 0x2289 },
+	{ 0x2291, 0x338, 0x22E2 },
+	{ 0x2292, 0x338, 0x22E3 },
+	{ 0x22A2, 0x338, 0x22AC },
+	{ 0x22A8, 0x338, 0x22AD },
+	{ 0x22A9, 0x338, 0x22AE },
+	{ 0x22AB, 0x338, 0x22AF },
+	{ 0x22B2, 0x338, 0x22EA },
+	{ 0x22B3, 0x338, 0x22EB },
+	{ 0x22B4, 0x338, 0x22EC },
+	{ 0x22B5, 0x338, 0x22ED },
+	{ 0x3046, 0x3099, 0x3094 },
+	{ 0x304B, 0x3099, 0x304C },
+	{ 0x304D, 0x3099, 0x304E },
+	{ 0x304F, 0x3099, 0x3050 },
+	{ 0x3051, 0x3099, 0x3052 },
+	{ 0x3053, 0x3099, 0x3054 },
+	{ 0x3055, 0x3099, 0x3056 },
+	{ 0x3057, 0x3099, 0x3058 },
+	{ 0x3059, 0x3099, 0x305A },
+	{ 0x305B, 0x3099, 0x305C },
+	{ 0x305D, 0x3099, 0x305E },
+	{ 0x305F, 0x3099, 0x3060 },
+	{ 0x3061, 0x3099, 0x3062 },
+	{ 0x3064, 0x3099, 0x3065 },
+	{ 0x3066, 0x3099, 0x3067 },
+	{ 0x3068, 0x3099, 0x3069 },
+	{ 0x306F, 0x3099, 0x3070 },
+	{ 0x306F, 0x309A, 0x3071 },
+	{ 0x3072, 0x3099, 0x3073 },
+	{ 0x3072, 0x309A, 0x3074 },
+	{ 0x3075, 0x3099, 0x3076 },
+	{ 0x3075, 0x309A, 0x3077 },
+	{ 0x3078, 0x3099, 0x3079 },
+	{ 0x3078, 0x309A, 0x307A },
+	{ 0x307B, 0x3099, 0x307C },
+	{ 0x307B, 0x309A, 0x307D },
+	{ 0x309D, 0x3099, 0x309E },
+	{ 0x30A6, 0x3099, 0x30F4 },
+	{ 0x30AB, 0x3099, 0x30AC },
+	{ 0x30AD, 0x3099, 0x30AE },
+	{ 0x30AF, 0x3099, 0x30B0 },
+	{ 0x30B1, 0x3099, 0x30B2 },
+	{ 0x30B3, 0x3099, 0x30B4 },
+	{ 0x30B5, 0x3099, 0x30B6 },
+	{ 0x30B7, 0x3099, 0x30B8 },
+	{ 0x30B9, 0x3099, 0x30BA },
+	{ 0x30BB, 0x3099, 0x30BC },
+	{ 0x30BD, 0x3099, 0x30BE },
+	{ 0x30BF, 0x3099, 0x30C0 },
+	{ 0x30C1, 0x3099, 0x30C2 },
+	{ 0x30C4, 0x3099, 0x30C5 },
+	{ 0x30C6, 0x3099, 0x30C7 },
+	{ 0x30C8, 0x3099, 0x30C9 },
+	{ 0x30CF, 0x3099, 0x30D0 },
+	{ 0x30CF, 0x309A, 0x30D1 },
+	{ 0x30D2, 0x3099, 0x30D3 },
+	{ 0x30D2, 0x309A, 0x30D4 },
+	{ 0x30D5, 0x3099, 0x30D6 },
+	{ 0x30D5, 0x309A, 0x30D7 },
+	{ 0x30D8, 0x3099, 0x30D9 },
+	{ 0x30D8, 0x309A, 0x30DA },
+	{ 0x30DB, 0x3099, 0x30DC },
+	{ 0x30DB, 0x309A, 0x30DD },
+	{ 0x30EF, 0x3099, 0x30F7 },
+	{ 0x30F0, 0x3099, 0x30F8 },
+	{ 0x30F1, 0x3099, 0x30F9 },
+	{ 0x30F2, 0x3099, 0x30FA },
+	{ 0x30FD, 0x3099, 0x30FE },
+	{ 0x11099, 0x110BA, 0x1109A },
+	{ 0x1109B, 0x110BA, 0x1109C },
+	{ 0x110A5, 0x110BA, 0x110AB },
+	{ 0x11131, 0x11127, 0x1112E },
+	{ 0x11132, 0x11127, 0x1112F },
+	{ 0x11347, 0x1133E, 0x1134B },
+	{ 0x11347, 0x11357, 0x1134C },
+	{ 0x114B9, 0x114B0, 0x114BC },
+	{ 0x114B9, 0x114BA, 0x114BB },
+	{ 0x114B9, 0x114BD, 0x114BE },
+	{ 0x115B8, 0x115AF, 0x115BA },
+	{ 0x115B9, 0x115AF, 0x115BB },
+	{ 0x11935, 0x11930, 0x11938 },
+};
+
+} // namespace nfc_tables
+
+#endif
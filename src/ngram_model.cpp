@@ -0,0 +1,382 @@
+// enchant_windows - word n-gram language model for real-word errors.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "ngram_model.h"
+
+#include "wordlist_spell_backend.h"
+
+#include <cstring>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENCHANT_WINDOWS_NGRAM_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// The file starts with this, padded to kHeaderBytes; the buckets follow,
+// then the confusion sets as text, a line per set and its words separated
+// by spaces. All little-endian, as tools/build_ngram_model.py writes it.
+struct NgramFileHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t bucketBits;
+	float scale;       // log10 units per quantization step
+	float backoff;
+	float unknown;
+	float margin;
+	uint32_t setCount;
+	uint32_t setOffset;
+	uint32_t setBytes;
+	uint32_t tokens;   // in the corpus, for information
+};
+
+static const char kMagic[8] = { 'E', 'W', 'N', 'G', 'R', 'A', 'M', '\0' };
+static const uint32_t kVersion = 1;
+static const size_t kHeaderBytes = 64;
+static const size_t kBucketEntries = 16;
+// More would not be a model anyone has a corpus for.
+static const uint32_t kMaxBucketBits = 26;
+
+static_assert(sizeof(NgramFileHeader) <= kHeaderBytes, "header does not fit");
+
+static uint64_t fnv1a64(const char* s, size_t len)
+{
+	uint64_t h = 0xCBF29CE484222325ull;
+	for (size_t i = 0; i < len; ++i)
+	{
+		h ^= static_cast<unsigned char>(s[i]);
+		h *= 0x100000001B3ull;
+	}
+	return h;
+}
+
+const uint64_t NgramModel::kSentenceStart = fnv1a64("<s>", 3);
+const uint64_t NgramModel::kSentenceEnd = fnv1a64("</s>", 4);
+
+static uint32_t fingerprint(uint64_t key)
+{
+	uint32_t fp = static_cast<uint32_t>(key >> 8) & 0xFFFFFF;
+	return fp ? fp : 1;
+}
+
+struct NgramModel::Mapping
+{
+#if defined(_WIN32)
+	Mapping() : view(nullptr) {}
+	~Mapping()
+	{
+		if (view)
+			UnmapViewOfFile(view);
+	}
+
+	const void* map(const std::string& path, size_t& size)
+	{
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return nullptr;
+		LARGE_INTEGER length;
+		HANDLE section = nullptr;
+		if (GetFileSizeEx(file, &length) && length.QuadPart > 0 && static_cast<unsigned long long>(length.QuadPart) <= SIZE_MAX)
+			section = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (section)
+		{
+			// The view keeps the file open.
+			view = MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(section);
+		}
+		CloseHandle(file);
+		size = view ? static_cast<size_t>(length.QuadPart) : 0;
+		return view;
+	}
+
+	void* view;
+#else
+	Mapping() : view(MAP_FAILED), length(0) {}
+	~Mapping()
+	{
+		if (view != MAP_FAILED)
+			munmap(view, length);
+	}
+
+	const void* map(const std::string& path, size_t& size)
+	{
+		int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return nullptr;
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0)
+		{
+			length = static_cast<size_t>(st.st_size);
+			view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		}
+		// The mapping keeps the file open.
+		close(fd);
+		if (view == MAP_FAILED)
+			return nullptr;
+		size = length;
+		return view;
+	}
+
+	void* view;
+	size_t length;
+#endif
+};
+
+NgramModel::NgramModel() :
+	data(nullptr),
+	size(0),
+	buckets(nullptr),
+	bucketMask(0),
+	scale(0.0f),
+	backoffLog(0.0f),
+	unknownLog(0.0f),
+	marginLog(0.0f)
+{
+}
+
+NgramModel::~NgramModel()
+{
+}
+
+std::unique_ptr<NgramModel> NgramModel::open(const std::string& path)
+{
+	std::unique_ptr<NgramModel> model(new NgramModel);
+	model->mapping = std::make_unique<Mapping>();
+	model->data = static_cast<const unsigned char*>(model->mapping->map(path, model->size));
+	if (!model->data || !model->parse())
+		return nullptr;
+	return model;
+}
+
+std::unique_ptr<NgramModel> NgramModel::open_for(const LanguageTagRef& language)
+{
+	if (!language)
+		return nullptr;
+
+	const std::vector<std::string> directories = search_path_or_wordlists("ENCHANT_WINDOWS_NGRAM_PATH");
+	for (const LanguageTag* candidate : language_tag_candidates(*language))
+	{
+		for (const auto& directory : directories)
+		{
+			auto model = open(directory + "/" + candidate->enchant + ".ngram");
+			if (model)
+				return model;
+		}
+	}
+	return nullptr;
+}
+
+bool NgramModel::parse()
+{
+	NgramFileHeader header;
+	if (size < kHeaderBytes)
+		return false;
+	memcpy(&header, data, sizeof(header));
+	if (memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion || header.bucketBits > kMaxBucketBits)
+		return false;
+
+	const size_t bucketCount = size_t(1) << header.bucketBits;
+	const size_t tableBytes = bucketCount * kBucketEntries * sizeof(uint32_t);
+	if (header.setOffset != kHeaderBytes + tableBytes || header.setOffset > size || header.setBytes > size - header.setOffset)
+		return false;
+	if (!(header.scale > 0.0f) || !(header.backoff <= 0.0f) || !(header.unknown < 0.0f) || !(header.margin >= 0.0f))
+		return false;
+
+	buckets = reinterpret_cast<const uint32_t*>(data + kHeaderBytes);
+	bucketMask = static_cast<uint32_t>(bucketCount - 1);
+	scale = header.scale;
+	backoffLog = header.backoff;
+	unknownLog = header.unknown;
+	marginLog = header.margin;
+
+	// The sets are few and small; copy them out rather than search the text.
+	const char* text = reinterpret_cast<const char*>(data + header.setOffset);
+	const char* end = text + header.setBytes;
+	while (text < end)
+	{
+		const char* lineEnd = static_cast<const char*>(memchr(text, '\n', end - text));
+		if (!lineEnd)
+			lineEnd = end;
+		std::vector<std::string> words;
+		while (text < lineEnd)
+		{
+			const char* space = static_cast<const char*>(memchr(text, ' ', lineEnd - text));
+			if (!space)
+				space = lineEnd;
+			if (space > text)
+				words.emplace_back(text, space - text);
+			text = space + 1;
+		}
+		text = lineEnd + 1;
+		if (words.size() < 2)
+			return false;
+		sets.push_back(std::move(words));
+	}
+	if (sets.size() != header.setCount)
+		return false;
+
+	size_t slots = 16;
+	size_t wordCount = 0;
+	for (const auto& set : sets)
+		wordCount += set.size();
+	while (slots < wordCount * 2)
+		slots *= 2;
+	confusionWords.assign(slots, 0);
+	confusionSets.assign(slots, -1);
+	for (size_t s = 0; s < sets.size(); ++s)
+	{
+		setHashes.emplace_back();
+		for (const std::string& word : sets[s])
+		{
+			const uint64_t h = word_hash(word.data(), word.size());
+			setHashes.back().push_back(h);
+			size_t slot = static_cast<size_t>(h) & (slots - 1);
+			while (confusionWords[slot] && confusionWords[slot] != h)
+				slot = (slot + 1) & (slots - 1);
+			confusionWords[slot] = h;
+			confusionSets[slot] = static_cast<int>(s);
+		}
+	}
+	return true;
+}
+
+uint64_t NgramModel::word_hash(const char* word, size_t len)
+{
+	// FNV-1a over the word as tools/build_ngram_model.py folds it.
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(word);
+	uint64_t h = 0xCBF29CE484222325ull;
+	for (size_t i = 0; i < len; ++i)
+	{
+		unsigned char b = p[i];
+		if (b == 0xE2 && i + 2 < len && p[i + 1] == 0x80 && p[i + 2] == 0x99)
+		{
+			b = '\'';
+			i += 2;
+		}
+		else if (b >= 'A' && b <= 'Z')
+		{
+			b += 0x20;
+		}
+		else if (i && p[i - 1] == 0xC3 && b >= 0x80 && b <= 0x9E && b != 0x97)
+		{
+			b += 0x20;
+		}
+		h ^= b;
+		h *= 0x100000001B3ull;
+	}
+	return h;
+}
+
+uint64_t NgramModel::ngram_key(const uint64_t* words, size_t n)
+{
+	uint64_t k = words[0];
+	for (size_t i = 1; i < n; ++i)
+		k = (((k << 23) | (k >> 41)) ^ words[i]) * 0x9E3779B97F4A7C15ull;
+	k ^= n;
+	k ^= k >> 33;
+	k *= 0xFF51AFD7ED558CCDull;
+	k ^= k >> 33;
+	return k;
+}
+
+void NgramModel::prefetch(uint64_t key) const
+{
+	const uint32_t* bucket = buckets + (static_cast<uint32_t>(key >> 32) & bucketMask) * kBucketEntries;
+#if defined(ENCHANT_WINDOWS_NGRAM_SSE2)
+	_mm_prefetch(reinterpret_cast<const char*>(bucket), _MM_HINT_T0);
+#elif defined(__GNUC__)
+	__builtin_prefetch(bucket);
+#else
+	(void)bucket;
+#endif
+}
+
+bool NgramModel::lookup(uint64_t key, float& logp) const
+{
+	const uint32_t fp = fingerprint(key) << 8;
+	uint32_t b = static_cast<uint32_t>(key >> 32) & bucketMask;
+	for (uint32_t probes = 0; probes <= bucketMask; ++probes)
+	{
+		const uint32_t* bucket = buckets + b * kBucketEntries;
+#if defined(ENCHANT_WINDOWS_NGRAM_SSE2)
+		// All sixteen fingerprints at once, narrowed to a byte per slot for
+		// one movemask; then the empty slots, only on a miss.
+		const __m128i e0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bucket));
+		const __m128i e1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bucket + 4));
+		const __m128i e2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bucket + 8));
+		const __m128i e3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bucket + 12));
+		const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF00u));
+		const __m128i want = _mm_set1_epi32(static_cast<int>(fp));
+		const int found = _mm_movemask_epi8(_mm_packs_epi16(
+			_mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(e0, mask), want), _mm_cmpeq_epi32(_mm_and_si128(e1, mask), want)),
+			_mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(e2, mask), want), _mm_cmpeq_epi32(_mm_and_si128(e3, mask), want))));
+		if (found)
+		{
+			unsigned slot = 0;
+			while (!(found & (1 << slot)))
+				++slot;
+			logp = -static_cast<float>(bucket[slot] & 0xFF) * scale;
+			return true;
+		}
+		const __m128i zero = _mm_setzero_si128();
+		const int empty = _mm_movemask_epi8(_mm_packs_epi16(
+			_mm_packs_epi32(_mm_cmpeq_epi32(e0, zero), _mm_cmpeq_epi32(e1, zero)),
+			_mm_packs_epi32(_mm_cmpeq_epi32(e2, zero), _mm_cmpeq_epi32(e3, zero))));
+		if (empty)
+			return false;
+#else
+		bool empty = false;
+		for (size_t i = 0; i < kBucketEntries; ++i)
+		{
+			if ((bucket[i] & 0xFFFFFF00u) == fp)
+			{
+				logp = -static_cast<float>(bucket[i] & 0xFF) * scale;
+				return true;
+			}
+			empty = empty || bucket[i] == 0;
+		}
+		if (empty)
+			return false;
+#endif
+		b = (b + 1) & bucketMask;
+	}
+	return false;
+}
+
+int NgramModel::confusion_set(uint64_t word) const
+{
+	const size_t mask = confusionWords.size() - 1;
+	size_t slot = static_cast<size_t>(word) & mask;
+	while (confusionWords[slot])
+	{
+		if (confusionWords[slot] == word)
+			return confusionSets[slot];
+		slot = (slot + 1) & mask;
+	}
+	return -1;
+}
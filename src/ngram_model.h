@@ -0,0 +1,123 @@
+// enchant_windows - word n-gram language model for real-word errors.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_NGRAM_MODEL_H
+#define ENCHANT_WINDOWS_NGRAM_MODEL_H
+
+#include "language_tags.h"
+
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// How likely a word is after the one or two before it, for telling which
+// of a set of easily confused words ("their", "there", "they're") belongs
+// in a sentence. A model is a '<tag>.ngram' file built from a corpus by
+// tools/build_ngram_model.py, and lists the confusion sets it is for.
+//
+// The file is mapped into memory, not read: opening it costs no more for a
+// large model than a small one, pages are only loaded as lookups touch
+// them, and processes using the same model share them. It holds the log10
+// probabilities of 1-, 2- and 3-grams, quantized to a byte, in a hash table
+// of 64-byte buckets of sixteen 32-bit entries, a 24-bit fingerprint of the
+// n-gram and its quantized probability. A lookup reads one bucket, so one
+// cache line, unless the bucket overflowed; prefetch() fetches it ahead.
+// Words are hashed as they fold (ASCII and Latin-1 capitals lowercased,
+// U+2019 read as an apostrophe), so only lowercase forms are counted.
+class NgramModel
+{
+public:
+	// Sentence boundaries, as words.
+	static const uint64_t kSentenceStart;
+	static const uint64_t kSentenceEnd;
+
+	// The model in 'path', or null if it can't be mapped or isn't one.
+	static std::unique_ptr<NgramModel> open(const std::string& path);
+
+	// The model for 'language' or one of its fallbacks, '<tag>.ngram' in one
+	// of the directories in ENCHANT_WINDOWS_NGRAM_PATH, or else the word list
+	// search path (wordlist_spell_backend.h). Null if there is none.
+	static std::unique_ptr<NgramModel> open_for(const LanguageTagRef& language);
+
+	~NgramModel();
+
+	NgramModel(const NgramModel&) = delete;
+	NgramModel& operator=(const NgramModel&) = delete;
+
+	// 'word' (UTF-8) as the model knows it.
+	static uint64_t word_hash(const char* word, size_t len);
+
+	// The key of the n-gram of 'n' words, the one predicted last.
+	static uint64_t ngram_key(const uint64_t* words, size_t n);
+
+	// Start loading the bucket 'key' is in.
+	void prefetch(uint64_t key) const;
+
+	// Set 'logp' to log10 of the probability of the n-gram's last word
+	// after the others, or of the word, for a unigram. False if the n-gram
+	// was never seen.
+	bool lookup(uint64_t key, float& logp) const;
+
+	// log10 of the factor a probability is scaled by for each order backed
+	// off, and what is taken for a word never seen.
+	float backoff() const { return backoffLog; }
+	float unknown() const { return unknownLog; }
+
+	// How many times likelier, in log10, another word of a confusion set
+	// must make a sentence before the word written is flagged.
+	float margin() const { return marginLog; }
+
+	// The confusion set a word hash is in, or -1.
+	int confusion_set(uint64_t word) const;
+
+	size_t set_count() const { return sets.size(); }
+
+	// The words of a set, folded, and their hashes.
+	const std::vector<std::string>& set_words(int set) const { return sets[set]; }
+	const std::vector<uint64_t>& set_hashes(int set) const { return setHashes[set]; }
+
+	// Bytes mapped.
+	size_t mapped_bytes() const { return size; }
+
+private:
+	struct Mapping;
+
+	NgramModel();
+	bool parse();
+
+	std::unique_ptr<Mapping> mapping;
+	const unsigned char* data;
+	size_t size;
+
+	const uint32_t* buckets;
+	uint32_t bucketMask;
+	float scale;
+	float backoffLog;
+	float unknownLog;
+	float marginLog;
+
+	std::vector<std::vector<std::string>> sets;
+	std::vector<std::vector<uint64_t>> setHashes;
+	// Open addressing from word hash to set, zero hashes empty.
+	std::vector<uint64_t> confusionWords;
+	std::vector<int> confusionSets;
+};
+
+#endif
@@ -0,0 +1,338 @@
+// enchant_windows - canonical forms of words for caching and checking.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "normalize.h"
+
+#include "nfc_tables.h"
+
+#include <algorithm>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+// Hangul syllables compose and decompose arithmetically (Unicode 3.12).
+static const char32_t kHangulSBase = 0xAC00;
+static const char32_t kHangulLBase = 0x1100;
+static const char32_t kHangulVBase = 0x1161;
+static const char32_t kHangulTBase = 0x11A7;
+static const unsigned kHangulLCount = 19;
+static const unsigned kHangulVCount = 21;
+static const unsigned kHangulTCount = 28;
+static const unsigned kHangulNCount = kHangulVCount * kHangulTCount;
+static const unsigned kHangulSCount = kHangulLCount * kHangulNCount;
+
+static bool is_apostrophe(char32_t cp)
+{
+	return cp == 0x2018 || cp == 0x2019;
+}
+
+static nfc_tables::Property property(char32_t cp)
+{
+	const nfc_tables::Property none = { cp, cp, 0, nfc_tables::kYes };
+	if (cp < nfc_tables::kFirstInteresting)
+		return none;
+
+	const nfc_tables::Property* begin = nfc_tables::kProperties;
+	const nfc_tables::Property* end = begin + sizeof(nfc_tables::kProperties) / sizeof(nfc_tables::kProperties[0]);
+	const nfc_tables::Property* found = std::upper_bound(begin, end, cp,
+		[](char32_t value, const nfc_tables::Property& p) { return value < p.first; });
+	if (found == begin || cp > found[-1].last)
+		return none;
+	return found[-1];
+}
+
+static uint8_t combining_class(char32_t cp)
+{
+	return property(cp).ccc;
+}
+
+// Decode one code point starting at in[i], advancing i past it. False if the
+// input isn't well-formed UTF-8 there.
+static bool decode(const unsigned char* in, size_t len, size_t& i, char32_t& cp)
+{
+	unsigned char lead = in[i++];
+	if (lead < 0x80)
+	{
+		cp = lead;
+		return true;
+	}
+
+	size_t extra;
+	char32_t min;
+	if ((lead & 0xE0) == 0xC0) { extra = 1; cp = lead & 0x1F; min = 0x80; }
+	else if ((lead & 0xF0) == 0xE0) { extra = 2; cp = lead & 0x0F; min = 0x800; }
+	else if ((lead & 0xF8) == 0xF0) { extra = 3; cp = lead & 0x07; min = 0x10000; }
+	else return false;
+
+	for (size_t k = 0; k < extra; ++k)
+	{
+		if (i >= len || (in[i] & 0xC0) != 0x80)
+			return false;
+		cp = (cp << 6) | (in[i++] & 0x3F);
+	}
+	return cp >= min && cp <= 0x10FFFF && !(cp >= 0xD800 && cp <= 0xDFFF);
+}
+
+static bool decode_all(const char* word, size_t len, std::u32string& out)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(word);
+	out.clear();
+	size_t i = 0;
+	while (i < len)
+	{
+		char32_t cp;
+		if (!decode(bytes, len, i, cp))
+			return false;
+		out.push_back(cp);
+	}
+	return true;
+}
+
+static void encode_all(const std::u32string& in, std::string& out)
+{
+	out.clear();
+	for (char32_t cp : in)
+	{
+		if (cp < 0x80)
+		{
+			out.push_back(static_cast<char>(cp));
+		}
+		else if (cp < 0x800)
+		{
+			out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+			out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+		else if (cp < 0x10000)
+		{
+			out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+			out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+			out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+		else
+		{
+			out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+			out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+			out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+			out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+	}
+}
+
+// Full canonical decomposition followed by the canonical ordering of marks.
+static void decompose(const std::u32string& in, std::u32string& out)
+{
+	const nfc_tables::Decomposition* begin = nfc_tables::kDecompositions;
+	const nfc_tables::Decomposition* end = begin + sizeof(nfc_tables::kDecompositions) / sizeof(nfc_tables::kDecompositions[0]);
+
+	out.clear();
+	for (char32_t cp : in)
+	{
+		if (cp >= kHangulSBase && cp < kHangulSBase + kHangulSCount)
+		{
+			const unsigned s = cp - kHangulSBase;
+			out.push_back(kHangulLBase + s / kHangulNCount);
+			out.push_back(kHangulVBase + (s % kHangulNCount) / kHangulTCount);
+			if (s % kHangulTCount != 0)
+				out.push_back(kHangulTBase + s % kHangulTCount);
+			continue;
+		}
+
+		const nfc_tables::Decomposition* found = cp < begin->code_point ? end : std::lower_bound(begin, end, cp,
+			[](const nfc_tables::Decomposition& d, char32_t value) { return d.code_point < value; });
+		if (found != end && found->code_point == cp)
+			out.append(nfc_tables::kDecomposed + found->offset, nfc_tables::kDecomposed + found->offset + found->length);
+		else
+			out.push_back(cp);
+	}
+
+	// Runs of marks are nearly always short and in order already, so each is
+	// only sorted once found out of order. The sort is stable, which the
+	// ordering has to be, and not quadratic, which a word of nothing but
+	// marks would make an insertion sort.
+	std::vector<std::pair<uint8_t, char32_t>> marks;
+	size_t i = 0;
+	while (i < out.size())
+	{
+		uint8_t last = combining_class(out[i]);
+		const size_t start = i++;
+		if (last == 0)
+			continue;
+		bool ordered = true;
+		for (; i < out.size(); ++i)
+		{
+			const uint8_t ccc = combining_class(out[i]);
+			if (ccc == 0)
+				break;
+			ordered = ordered && last <= ccc;
+			last = ccc;
+		}
+		if (ordered)
+			continue;
+
+		marks.clear();
+		for (size_t k = start; k < i; ++k)
+			marks.emplace_back(combining_class(out[k]), out[k]);
+		std::stable_sort(marks.begin(), marks.end(),
+			[](const std::pair<uint8_t, char32_t>& a, const std::pair<uint8_t, char32_t>& b) { return a.first < b.first; });
+		for (size_t k = start; k < i; ++k)
+			out[k] = marks[k - start].second;
+	}
+}
+
+// The primary composite of 'first' and 'second', or 0 if there is none.
+static char32_t compose_pair(char32_t first, char32_t second)
+{
+	if (first >= kHangulLBase && first < kHangulLBase + kHangulLCount &&
+		second >= kHangulVBase && second < kHangulVBase + kHangulVCount)
+	{
+		return kHangulSBase + ((first - kHangulLBase) * kHangulVCount + (second - kHangulVBase)) * kHangulTCount;
+	}
+	if (first >= kHangulSBase && first < kHangulSBase + kHangulSCount && (first - kHangulSBase) % kHangulTCount == 0 &&
+		second > kHangulTBase && second < kHangulTBase + kHangulTCount)
+	{
+		return first + (second - kHangulTBase);
+	}
+
+	const nfc_tables::Composition* begin = nfc_tables::kCompositions;
+	const nfc_tables::Composition* end = begin + sizeof(nfc_tables::kCompositions) / sizeof(nfc_tables::kCompositions[0]);
+	const nfc_tables::Composition* found = std::lower_bound(begin, end, first,
+		[=](const nfc_tables::Composition& c, char32_t value) {
+			return c.first < value || (c.first == value && c.second < second);
+		});
+	if (found != end && found->first == first && found->second == second)
+		return found->composite;
+	return 0;
+}
+
+// Canonical composition of a decomposed, ordered string, in place. A mark
+// combines with the last starter unless something between them is blocking
+// it: a starter, or a mark of the same or a higher class.
+static void compose(std::u32string& text)
+{
+	if (text.empty())
+		return;
+
+	size_t starter = 0;
+	unsigned lastClass = combining_class(text[0]);
+	if (lastClass != 0)
+		lastClass = 256;  // no starter to combine with yet
+	size_t written = 1;
+	for (size_t i = 1; i < text.size(); ++i)
+	{
+		const char32_t cp = text[i];
+		const nfc_tables::Property p = property(cp);
+		const unsigned ccc = p.ccc;
+		// Only the Maybes ever come second in a pair.
+		const bool combines = p.quick_check == nfc_tables::kMaybe && (lastClass < ccc || lastClass == 0);
+		const char32_t composite = combines ? compose_pair(text[starter], cp) : 0;
+		if (composite != 0)
+		{
+			text[starter] = composite;
+			continue;
+		}
+		if (ccc == 0)
+			starter = written;
+		lastClass = ccc;
+		text[written++] = cp;
+	}
+	text.resize(written);
+}
+
+bool is_canonical(const char* word, size_t len)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(word);
+
+	// Most words are ASCII, and ASCII is canonical.
+	size_t i = 0;
+	while (i < len && bytes[i] < 0x80)
+		++i;
+	if (i == len)
+		return true;
+
+	// The NFC quick check (UAX #15), with apostrophes. A Maybe is as good as
+	// a No here: the slow path sorts it out, and words with marks that
+	// combine are rare in text that is already NFC.
+	uint8_t lastClass = 0;
+	while (i < len)
+	{
+		char32_t cp;
+		if (!decode(bytes, len, i, cp))
+			return true;
+		if (cp < nfc_tables::kFirstInteresting)
+		{
+			lastClass = 0;
+			continue;
+		}
+		if (is_apostrophe(cp))
+			return false;
+
+		const nfc_tables::Property p = property(cp);
+		if ((p.ccc != 0 && lastClass > p.ccc) || p.quick_check != nfc_tables::kYes)
+			return false;
+		lastClass = p.ccc;
+	}
+	return true;
+}
+
+// Scratch space for the slow path, kept so that it doesn't allocate once it
+// has seen a long enough word.
+struct Scratch
+{
+	std::u32string text;
+	std::u32string decomposed;
+};
+
+static Scratch& scratch()
+{
+	static thread_local Scratch instance;
+	return instance;
+}
+
+void canonicalize(const char* word, size_t len, std::string& out)
+{
+	std::u32string& text = scratch().text;
+	std::u32string& decomposed = scratch().decomposed;
+	if (!decode_all(word, len, text))
+	{
+		out.assign(word, len);
+		return;
+	}
+
+	for (char32_t& cp : text)
+	{
+		if (is_apostrophe(cp))
+			cp = '\'';
+	}
+	decompose(text, decomposed);
+	compose(decomposed);
+	encode_all(decomposed, out);
+}
+
+void to_nfd(const char* word, size_t len, std::string& out)
+{
+	std::u32string& text = scratch().text;
+	std::u32string& decomposed = scratch().decomposed;
+	if (!decode_all(word, len, text))
+	{
+		out.assign(word, len);
+		return;
+	}
+
+	decompose(text, decomposed);
+	encode_all(decomposed, out);
+}
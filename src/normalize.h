@@ -0,0 +1,42 @@
+// enchant_windows - canonical forms of words for caching and checking.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_NORMALIZE_H
+#define ENCHANT_WINDOWS_NORMALIZE_H
+
+#include <cstddef>
+#include <string>
+
+// A word's canonical form is its Unicode NFC with typographic apostrophes
+// (U+2018, U+2019) folded to ASCII ones, so that "café" typed with a
+// combining accent, or "don’t" typed with a curly apostrophe, is the same
+// word to the cache and the backend as it is to the user. Malformed UTF-8 is
+// left as it is.
+
+// True if 'word' is already canonical. Quick for ASCII, and for text that is
+// NFC with no marks that could combine with what is before them: a scan and
+// a lookup per code point from U+0300 up.
+bool is_canonical(const char* word, size_t len);
+
+// The canonical form of 'word'.
+void canonicalize(const char* word, size_t len, std::string& out);
+
+// The NFD of 'word', with apostrophes left alone. Malformed UTF-8 is copied.
+void to_nfd(const char* word, size_t len, std::string& out);
+
+#endif
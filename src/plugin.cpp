@@ -0,0 +1,42 @@
+// enchant_windows - plugin entry point.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#include "windows_provider.h"
+
+// Which of the configurations in provider_policies.h to build.
+#ifndef ENCHANT_WINDOWS_POLICIES
+#define ENCHANT_WINDOWS_POLICIES DefaultProviderPolicies
+#endif
+
+ENCHANT_PLUGIN_DECLARE("windows")
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Create a new provider. Elsewhere than Windows the spell checker is word
+// lists (see wordlist_spell_backend.h).
+ENCHANT_WINDOWS_EXPORT EnchantProvider* init_enchant_provider() _NOEXCEPT
+{
+	return windows_provider_create<ENCHANT_WINDOWS_POLICIES>(create_default_spell_backend);
+}
+
+#ifdef __cplusplus
+}
+#endif
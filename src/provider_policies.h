@@ -0,0 +1,481 @@
+// enchant_windows - compile-time configuration of the provider core.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#ifndef ENCHANT_WINDOWS_PROVIDER_POLICIES_H
+#define ENCHANT_WINDOWS_PROVIDER_POLICIES_H
+
+#include "case_pattern.h"
+#include "co_thread_dispatcher.h"
+#include "enchant-windows.h"
+#include "normalize.h"
+#include "utf.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <type_traits>
+
+// The provider core (windows_provider.h) is a template over five policies,
+// so a plugin pays only for the features it is built with: a disabled
+// policy is a set of empty inline functions and empty state, and compiles
+// out. Each policy below comes with the alternatives it can be swapped for.
+
+// Dispatch: where backend calls run.
+//
+//   static void addref(); static void release();
+//       Bracket the life of each provider.
+//   static R dispatch(F&& f);
+//       Run f, serialized with all other backend calls, and return its
+//       result. While DispatchTiming::enabled(), also leaves how long f
+//       waited and ran in DispatchTiming::last().
+//   static void post(F&& f);
+//       The same without waiting for f to run. Calls to dispatch and post
+//       run in the order they were made.
+//   static void post(F&& f, A&& abandoned);
+//       The same, but if f hangs and is given up on, 'abandoned' runs
+//       in its place.
+//   static bool claim();
+//       Called by something posted before it makes its result known;
+//       false if it has been given up on, and so mustn't.
+
+// Everything on one worker thread, which is where COM wants it, or in
+// order on the application's executor if it has set one. A worker thread
+// that hangs is replaced; see CoThreadDispatcher.
+struct WorkerDispatch
+{
+	static void addref();
+	static void release();
+
+	template<typename F>
+	static typename std::result_of<F()>::type dispatch(F&& f)
+	{
+		return dispatcher->dispatch(std::forward<F>(f));
+	}
+
+	template<typename F>
+	static void post(F&& f)
+	{
+		dispatcher->post(std::forward<F>(f));
+	}
+
+	template<typename F, typename A>
+	static void post(F&& f, A&& abandoned)
+	{
+		dispatcher->post(std::forward<F>(f), std::forward<A>(abandoned));
+	}
+
+	static bool claim() { return CoThreadDispatcher::claim(); }
+
+	static std::unique_ptr<CoThreadDispatcher> dispatcher;
+};
+
+// On the caller's thread, under a lock. Saves the thread hop on every call,
+// but is only for backends that don't need COM (the word list backend).
+struct InlineDispatch
+{
+	static void addref() {}
+	static void release() {}
+
+	template<typename F>
+	static typename std::result_of<F()>::type dispatch(F&& f)
+	{
+		if (DispatchTiming::enabled().load(std::memory_order_relaxed))
+		{
+			// Waiting is for the lock.
+			Timer timer;
+			std::lock_guard<std::mutex> lock(mutex);
+			timer.started = std::chrono::steady_clock::now();
+			return f();
+		}
+		std::lock_guard<std::mutex> lock(mutex);
+		return f();
+	}
+
+	template<typename F>
+	static void post(F&& f)
+	{
+		dispatch(std::forward<F>(f));
+	}
+
+	// Nothing is ever given up on here.
+	template<typename F, typename A>
+	static void post(F&& f, A&&)
+	{
+		dispatch(std::forward<F>(f));
+	}
+
+	static bool claim() { return true; }
+
+	static std::mutex mutex;
+
+private:
+	struct Timer
+	{
+		Timer() : queued(std::chrono::steady_clock::now()) {}
+		~Timer()
+		{
+			DispatchTiming& timing = DispatchTiming::last();
+			timing.queued = started - queued;
+			timing.ran = std::chrono::steady_clock::now() - started;
+		}
+
+		std::chrono::steady_clock::time_point queued;
+		std::chrono::steady_clock::time_point started;
+	};
+};
+
+// Cache: check verdicts kept per dictionary.
+//
+//   struct State;
+//       Per-dictionary state, default constructible.
+//   static size_t bytes(const State&);
+//       Heap bytes held, charged to ENCHANT_WINDOWS_MEMORY_CACHE.
+//   static bool lookup(State&, const char* word, size_t len, int& result);
+//   static bool lookup_case_variant(State&, const char* word, size_t len, const CaseRules&, int& result);
+//       For when lookup() misses a Title Case or ALL CAPS word: true, with
+//       'result' 0, if its lowercase form, or an ALL CAPS word's Title Case
+//       form, is cached as correctly spelled.
+//   static size_t generation(State&);
+//   static void store(State&, size_t generation, const char* word, size_t len, int result);
+//       'generation' is read before asking the backend, so a verdict made
+//       stale by a concurrent invalidate() isn't stored.
+//   static void invalidate(State&);
+//       Called when the user's words change.
+
+struct NoCache
+{
+	struct State {};
+	static size_t bytes(const State&) { return 0; }
+	static bool lookup(State&, const char*, size_t, int&) { return false; }
+	static bool lookup_case_variant(State&, const char*, size_t, const CaseRules&, int&) { return false; }
+	static size_t generation(State&) { return 0; }
+	static void store(State&, size_t, const char*, size_t, int) {}
+	static void invalidate(State&) {}
+};
+
+// A direct-mapped table of recent verdicts for short words. Looked up on the
+// caller's thread, so a hit skips dispatch entirely. Lookups take no lock:
+// each entry is a sequence lock, and a lookup that races a store just
+// misses. Stores and invalidation are serialized by a mutex.
+template<size_t Slots = 512>
+struct VerdictCache
+{
+	static_assert((Slots & (Slots - 1)) == 0, "Slots must be a power of two");
+
+	// Longer words aren't cached; most words are shorter.
+	static const size_t kMaxWordBytes = 23;
+
+	// The length and the word, zero padded, as three machine words so that
+	// they can be read atomically and compared without memcmp.
+	struct Key
+	{
+		uint64_t parts[3];
+	};
+	static_assert(1 + kMaxWordBytes <= sizeof(Key), "Key must hold the length and the word");
+
+	struct Entry
+	{
+		std::atomic<uint32_t> sequence;  // odd while being written
+		std::atomic<int32_t> result;
+		std::atomic<uint64_t> key[3];
+	};
+
+	struct State
+	{
+		State() : entries(new Entry[Slots]), generation(0), empty(true)
+		{
+			for (size_t i = 0; i < Slots; ++i)
+			{
+				entries[i].sequence.store(0, std::memory_order_relaxed);
+				entries[i].result.store(0, std::memory_order_relaxed);
+				for (auto& part : entries[i].key)
+					part.store(0, std::memory_order_relaxed);
+			}
+		}
+		std::unique_ptr<Entry[]> entries;
+		std::mutex mutex;
+		std::atomic<size_t> generation;
+		// Nothing stored since the last invalidate, under 'mutex'. Words
+		// added in bulk then cost a generation bump each, not a sweep.
+		bool empty;
+	};
+
+	static size_t bytes(const State&) { return Slots * sizeof(Entry); }
+
+	static bool lookup(State& state, const char* word, size_t len, int& result)
+	{
+		if (len == 0 || len > kMaxWordBytes)
+			return false;
+		const Key key = make_key(word, len);
+		const Entry& entry = state.entries[slot(word, len)];
+
+		uint32_t before = entry.sequence.load(std::memory_order_acquire);
+		if (before & 1)
+			return false;
+		bool match = true;
+		for (size_t i = 0; i < 3; ++i)
+			match &= entry.key[i].load(std::memory_order_relaxed) == key.parts[i];
+		int32_t verdict = entry.result.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (!match || entry.sequence.load(std::memory_order_relaxed) != before)
+			return false;
+		result = verdict;
+		return true;
+	}
+
+	// Only a correct verdict carries over: "paris" may be misspelled where
+	// "Paris" isn't.
+	static bool lookup_case_variant(State& state, const char* word, size_t len, const CaseRules& rules, int& result)
+	{
+		if (len == 0 || len > kMaxWordBytes)
+			return false;
+		char folded[kMaxWordBytes];
+		const CasePattern pattern = case_pattern(word, len, rules, folded);
+		if (pattern != kCaseTitle && pattern != kCaseUpper)
+			return false;
+
+		int verdict = 0;
+		if (lookup(state, folded, len, verdict) && verdict == 0)
+		{
+			result = 0;
+			return true;
+		}
+		if (pattern == kCaseUpper)
+		{
+			// The first character as it is, which is one of the Latin-1
+			// letters if it starts with 0xC3.
+			const size_t first = static_cast<unsigned char>(word[0]) == 0xC3 ? 2 : 1;
+			memcpy(folded, word, first);
+			if (lookup(state, folded, len, verdict) && verdict == 0)
+			{
+				result = 0;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static size_t generation(State& state)
+	{
+		return state.generation.load(std::memory_order_acquire);
+	}
+
+	static void store(State& state, size_t generation, const char* word, size_t len, int result)
+	{
+		if (len == 0 || len > kMaxWordBytes || result < 0)
+			return;
+		const Key key = make_key(word, len);
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (generation != state.generation.load(std::memory_order_relaxed))
+			return;
+		write(state.entries[slot(word, len)], key, result);
+		state.empty = false;
+	}
+
+	static void invalidate(State& state)
+	{
+		const Key blank = {};
+		std::lock_guard<std::mutex> lock(state.mutex);
+		state.generation.fetch_add(1, std::memory_order_release);
+		if (state.empty)
+			return;
+		for (size_t i = 0; i < Slots; ++i)
+			write(state.entries[i], blank, 0);
+		state.empty = true;
+	}
+
+private:
+	static Key make_key(const char* word, size_t len)
+	{
+		unsigned char bytes[sizeof(Key)] = {};
+		bytes[0] = static_cast<unsigned char>(len);
+		memcpy(bytes + 1, word, len);
+		Key key;
+		memcpy(key.parts, bytes, sizeof(bytes));
+		return key;
+	}
+
+	// Called with the mutex held.
+	static void write(Entry& entry, const Key& key, int result)
+	{
+		uint32_t sequence = entry.sequence.load(std::memory_order_relaxed);
+		entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		for (size_t i = 0; i < 3; ++i)
+			entry.key[i].store(key.parts[i], std::memory_order_relaxed);
+		entry.result.store(result, std::memory_order_relaxed);
+		entry.sequence.store(sequence + 2, std::memory_order_release);
+	}
+
+	// FNV-1a.
+	static size_t slot(const char* word, size_t len)
+	{
+		uint32_t hash = 2166136261u;
+		for (size_t i = 0; i < len; ++i)
+			hash = (hash ^ static_cast<unsigned char>(word[i])) * 16777619u;
+		return hash & (Slots - 1);
+	}
+};
+
+// Conversion: UTF-8 to and from the backend's UTF-16, with the two-call
+// interface of utf.h.
+
+struct Utf8Conversion
+{
+	static size_t to_utf16(const char* in, size_t len, char16_t* out) { return utf8_to_utf16(in, len, out); }
+	static size_t to_utf8(const char16_t* in, size_t len, char* out) { return utf16_to_utf8(in, len, out); }
+};
+
+// Checks for an all-ASCII string up front and then widens or narrows it in a
+// plain loop, which is most words in most of the languages people type.
+struct AsciiFastPathConversion
+{
+	static size_t to_utf16(const char* in, size_t len, char16_t* out)
+	{
+		if (!is_ascii(in, len))
+			return utf8_to_utf16(in, len, out);
+		if (out)
+		{
+			for (size_t i = 0; i < len; ++i)
+				out[i] = static_cast<unsigned char>(in[i]);
+		}
+		return len;
+	}
+
+	static size_t to_utf8(const char16_t* in, size_t len, char* out)
+	{
+		char16_t bits = 0;
+		for (size_t i = 0; i < len; ++i)
+			bits |= in[i];
+		if (bits >= 0x80)
+			return utf16_to_utf8(in, len, out);
+		if (out)
+		{
+			for (size_t i = 0; i < len; ++i)
+				out[i] = static_cast<char>(in[i]);
+		}
+		return len;
+	}
+
+private:
+	static bool is_ascii(const char* in, size_t len)
+	{
+		unsigned char bits = 0;
+		for (size_t i = 0; i < len; ++i)
+			bits |= static_cast<unsigned char>(in[i]);
+		return bits < 0x80;
+	}
+};
+
+// Canonicalization: the form words take before they are looked up in the
+// cache or passed to the backend, so that spellings which are the same word
+// to the user are the same word to both.
+//
+//   struct Buffer;
+//       Where a canonical form is made, default constructible.
+//   static const char* canonical(const char* word, size_t& len, Buffer&);
+//       'word' if it is already canonical, otherwise its canonical form,
+//       held in the buffer, with 'len' set to its length.
+
+struct NoCanonicalization
+{
+	struct Buffer {};
+	static const char* canonical(const char* word, size_t&, Buffer&) { return word; }
+};
+
+// NFC with typographic apostrophes folded (normalize.h). Most words pass the
+// quick check and cost a scan; the rest are normalized into the buffer.
+struct NfcCanonicalization
+{
+	typedef std::string Buffer;
+
+	static const char* canonical(const char* word, size_t& len, Buffer& buffer)
+	{
+		if (is_canonical(word, len))
+			return word;
+		canonicalize(word, len, buffer);
+		len = buffer.size();
+		return buffer.c_str();
+	}
+};
+
+// Instrumentation: per-dictionary call statistics.
+//
+//   struct State;
+//   static void count(State&, EnchantWindowsStat);
+//   static bool snapshot(const State&, EnchantWindowsDictStats&);
+//       False if nothing is kept.
+
+struct NoInstrumentation
+{
+	struct State {};
+	static void count(State&, EnchantWindowsStat) {}
+	static bool snapshot(const State&, EnchantWindowsDictStats&) { return false; }
+};
+
+struct CallCounters
+{
+	struct State
+	{
+		State()
+		{
+			for (auto& c : counts)
+				c = 0;
+		}
+		std::atomic<unsigned long long> counts[ENCHANT_WINDOWS_STAT_COUNT];
+	};
+
+	static void count(State& state, EnchantWindowsStat stat)
+	{
+		state.counts[stat].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static bool snapshot(const State& state, EnchantWindowsDictStats& out)
+	{
+		for (int i = 0; i < ENCHANT_WINDOWS_STAT_COUNT; ++i)
+			out.counts[i] = state.counts[i].load(std::memory_order_relaxed);
+		return true;
+	}
+};
+
+template<class DispatchPolicy, class CachePolicy, class ConversionPolicy, class InstrumentationPolicy,
+	class CanonicalizationPolicy = NoCanonicalization>
+struct ProviderPolicies
+{
+	typedef DispatchPolicy Dispatch;
+	typedef CachePolicy Cache;
+	typedef ConversionPolicy Conversion;
+	typedef InstrumentationPolicy Instrumentation;
+	typedef CanonicalizationPolicy Canonicalization;
+};
+
+// The configurations plugins are built with; ENCHANT_WINDOWS_POLICIES names
+// one of these when building plugin.cpp. The default is the provider as it
+// has always been.
+typedef ProviderPolicies<WorkerDispatch, NoCache, Utf8Conversion, NoInstrumentation> DefaultProviderPolicies;
+typedef ProviderPolicies<WorkerDispatch, VerdictCache<>, Utf8Conversion, NoInstrumentation, NfcCanonicalization> CachedProviderPolicies;
+typedef ProviderPolicies<WorkerDispatch, NoCache, AsciiFastPathConversion, NoInstrumentation> AsciiProviderPolicies;
+typedef ProviderPolicies<WorkerDispatch, NoCache, Utf8Conversion, CallCounters> StatsProviderPolicies;
+typedef ProviderPolicies<InlineDispatch, NoCache, Utf8Conversion, NoInstrumentation> InlineProviderPolicies;
+typedef ProviderPolicies<WorkerDispatch, VerdictCache<>, AsciiFastPathConversion, CallCounters, NfcCanonicalization> FullProviderPolicies;
+
+#endif
@@ -0,0 +1,230 @@
+// enchant_windows - log of provider calls that took too long.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "slow_call_log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// Entries kept; the oldest are overwritten.
+static const size_t kSlowCallEntries = 256;
+
+static std::once_flag slow_call_configured;
+static std::mutex slow_call_mutex;
+// Settings and ring, under slow_call_mutex; the threshold is also read
+// without it, to skip the lock for calls that were quick.
+static std::atomic<unsigned long long> slow_call_threshold_ns(ULLONG_MAX);
+static int slow_call_capture(ENCHANT_WINDOWS_CAPTURE_HASH);
+static unsigned slow_call_sample_every(1);
+static EnchantWindowsSlowCall slow_call_ring[kSlowCallEntries];
+static unsigned long long slow_call_count(0);
+
+static const char* const kOpNames[ENCHANT_WINDOWS_OP_COUNT] = {
+	"check",
+	"suggest",
+	"add_to_personal",
+	"add_to_exclude",
+	"store_replacement",
+	"request_dict",
+	"dictionary_exists",
+	"list_dicts",
+	"check_async",
+	"complete",
+	"reload",
+	"request_dict_async",
+};
+
+// FNV-1a, 64-bit.
+static unsigned long long hash_word(const char* word, size_t len)
+{
+	unsigned long long hash = 14695981039346656037ull;
+	for (size_t i = 0; i < len; ++i)
+		hash = (hash ^ static_cast<unsigned char>(word[i])) * 1099511628211ull;
+	return hash;
+}
+
+// Called with slow_call_mutex held.
+static void apply_settings(unsigned long long threshold_us, int capture, unsigned sample_every)
+{
+	slow_call_threshold_ns = threshold_us < ULLONG_MAX / 1000 ? threshold_us * 1000 : ULLONG_MAX;
+	slow_call_capture = capture;
+	slow_call_sample_every = sample_every;
+	DispatchTiming::enabled() = threshold_us != ENCHANT_WINDOWS_SLOW_CALL_OFF;
+}
+
+static void configure_from_environment()
+{
+	const char* threshold = getenv("ENCHANT_WINDOWS_SLOW_CALL_US");
+	if (!threshold || !*threshold)
+		return;
+
+	int capture = ENCHANT_WINDOWS_CAPTURE_HASH;
+	const char* mode = getenv("ENCHANT_WINDOWS_SLOW_CALL_CAPTURE");
+	if (mode && strcmp(mode, "none") == 0)
+		capture = ENCHANT_WINDOWS_CAPTURE_NONE;
+	else if (mode && strcmp(mode, "word") == 0)
+		capture = ENCHANT_WINDOWS_CAPTURE_WORD;
+
+	unsigned long sample = 1;
+	const char* every = getenv("ENCHANT_WINDOWS_SLOW_CALL_SAMPLE");
+	if (every && *every)
+		sample = std::max(strtoul(every, nullptr, 10), 1ul);
+
+	std::lock_guard<std::mutex> lock(slow_call_mutex);
+	apply_settings(strtoull(threshold, nullptr, 10), capture, static_cast<unsigned>(sample));
+}
+
+void configure_slow_call_log()
+{
+	std::call_once(slow_call_configured, configure_from_environment);
+}
+
+void log_slow_call(EnchantWindowsOp op, std::chrono::steady_clock::time_point start, const char* tag, const char* word, size_t len)
+{
+	const unsigned long long total = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start).count();
+	if (total < slow_call_threshold_ns.load(std::memory_order_relaxed))
+		return;
+
+	const DispatchTiming& timing = DispatchTiming::last();
+	EnchantWindowsSlowCall entry = {};
+	entry.op = op;
+	if (tag)
+		memcpy(entry.tag, tag, std::min(strlen(tag), sizeof(entry.tag) - 1));
+	entry.word_length = len;
+	entry.total_ns = total;
+	entry.queue_wait_ns = timing.queued.count();
+	entry.backend_ns = timing.ran.count();
+
+	std::lock_guard<std::mutex> lock(slow_call_mutex);
+	entry.sequence = ++slow_call_count;
+	entry.capture = ENCHANT_WINDOWS_CAPTURE_NONE;
+	if (word && (entry.sequence - 1) % slow_call_sample_every == 0)
+	{
+		entry.capture = slow_call_capture;
+		if (entry.capture != ENCHANT_WINDOWS_CAPTURE_NONE)
+			entry.word_hash = hash_word(word, len);
+		if (entry.capture == ENCHANT_WINDOWS_CAPTURE_WORD)
+			memcpy(entry.word, word, std::min(len, sizeof(entry.word) - 1));
+	}
+	slow_call_ring[(entry.sequence - 1) % kSlowCallEntries] = entry;
+}
+
+// Called with slow_call_mutex held.
+static size_t copy_slow_calls(EnchantWindowsSlowCall* out, size_t max)
+{
+	const size_t held = static_cast<size_t>(std::min<unsigned long long>(slow_call_count, kSlowCallEntries));
+	const size_t n = std::min(held, max);
+	for (size_t i = 0; i < n; ++i)
+		out[i] = slow_call_ring[(slow_call_count - n + i) % kSlowCallEntries];
+	return n;
+}
+
+static int dump_slow_calls(const char* path)
+{
+	std::vector<EnchantWindowsSlowCall> entries(kSlowCallEntries);
+	{
+		std::lock_guard<std::mutex> lock(slow_call_mutex);
+		entries.resize(copy_slow_calls(entries.data(), entries.size()));
+	}
+
+	FILE* out = stderr;
+	if (strcmp(path, "-") != 0)
+	{
+#ifdef _MSC_VER
+		if (fopen_s(&out, path, "a") != 0)
+			out = nullptr;
+#else
+		out = fopen(path, "a");
+#endif
+		if (!out)
+			return -1;
+	}
+
+	for (const auto& entry : entries)
+	{
+		fprintf(out, "enchant_windows: slow call %llu: %s %s, %zu bytes: total %llu us, queued %llu us, backend %llu us",
+			entry.sequence, kOpNames[entry.op], entry.tag[0] ? entry.tag : "-", entry.word_length,
+			entry.total_ns / 1000, entry.queue_wait_ns / 1000, entry.backend_ns / 1000);
+		if (entry.capture != ENCHANT_WINDOWS_CAPTURE_NONE)
+			fprintf(out, ", hash %016llx", entry.word_hash);
+		if (entry.capture == ENCHANT_WINDOWS_CAPTURE_WORD)
+			fprintf(out, ", word \"%s\"", entry.word);
+		fputc('\n', out);
+	}
+
+	if (out != stderr)
+		fclose(out);
+	return static_cast<int>(entries.size());
+}
+
+void report_slow_calls()
+{
+	const char* path = getenv("ENCHANT_WINDOWS_SLOW_CALL_LOG");
+	if (path && *path)
+		dump_slow_calls(path);
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ENCHANT_MODULE_EXPORT(int) enchant_windows_set_slow_call_log(unsigned long long threshold_us, int capture, unsigned sample_every)
+{
+	if (capture < ENCHANT_WINDOWS_CAPTURE_NONE || capture > ENCHANT_WINDOWS_CAPTURE_WORD || sample_every == 0)
+		return -1;
+
+	// Settings made here win over the environment.
+	configure_slow_call_log();
+	std::lock_guard<std::mutex> lock(slow_call_mutex);
+	apply_settings(threshold_us, capture, sample_every);
+	return 0;
+}
+
+ENCHANT_MODULE_EXPORT(size_t) enchant_windows_slow_calls(EnchantWindowsSlowCall* out, size_t max)
+{
+	if (!out)
+		return 0;
+
+	std::lock_guard<std::mutex> lock(slow_call_mutex);
+	return copy_slow_calls(out, max);
+}
+
+ENCHANT_MODULE_EXPORT(int) enchant_windows_dump_slow_calls(const char* path)
+{
+	if (!path)
+		return -1;
+	return dump_slow_calls(path);
+}
+
+ENCHANT_MODULE_EXPORT(const char*) enchant_windows_op_name(int op)
+{
+	if (op < 0 || op >= ENCHANT_WINDOWS_OP_COUNT)
+		return nullptr;
+	return kOpNames[op];
+}
+
+#ifdef __cplusplus
+}
+#endif
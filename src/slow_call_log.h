@@ -0,0 +1,67 @@
+// enchant_windows - log of provider calls that took too long.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_SLOW_CALL_LOG_H
+#define ENCHANT_WINDOWS_SLOW_CALL_LOG_H
+
+#include "co_thread_dispatcher.h"
+#include "enchant-windows.h"
+
+#include <chrono>
+
+// Read the slow-call log settings from the environment, the first time only.
+void configure_slow_call_log();
+
+// Log a call to 'op' that started at 'start', if it took long enough. Its
+// queue wait and backend time come from DispatchTiming::last(), so it has
+// to be called on the thread that made the call. 'tag' may be null.
+void log_slow_call(EnchantWindowsOp op, std::chrono::steady_clock::time_point start, const char* tag, const char* word, size_t len);
+
+// If ENCHANT_WINDOWS_SLOW_CALL_LOG names a file, append the log to it.
+void report_slow_calls();
+
+// Times one provider call for the log. Costs a flag test while the log is
+// off, and two clock reads per call on top of the dispatcher's while it's on.
+class SlowCallScope
+{
+public:
+	explicit SlowCallScope(EnchantWindowsOp op) :
+		op(op),
+		timed(DispatchTiming::enabled().load(std::memory_order_relaxed))
+	{
+		if (timed)
+		{
+			DispatchTiming::last() = DispatchTiming();
+			start = std::chrono::steady_clock::now();
+		}
+	}
+
+	// The call is over; 'word' is its input, if any.
+	void done(const char* tag, const char* word = nullptr, size_t len = 0)
+	{
+		if (timed)
+			log_slow_call(op, start, tag, word, len);
+	}
+
+private:
+	EnchantWindowsOp op;
+	bool timed;
+	std::chrono::steady_clock::time_point start;
+};
+
+#endif
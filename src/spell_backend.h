@@ -0,0 +1,91 @@
+// enchant_windows - interface between the provider and a spell checking
+//                   engine.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_SPELL_BACKEND_H
+#define ENCHANT_WINDOWS_SPELL_BACKEND_H
+
+#include <functional>
+#include <memory>
+#include <string>
+
+// The interface mirrors ISpellCheckerFactory and ISpellChecker, which is
+// what the provider was written against: strings are NUL-terminated UTF-16,
+// language tags are in Windows form ("en-US"), and the provider does all the
+// conversion to and from Enchant's UTF-8. Backends are called from one
+// thread at a time: the provider's worker thread, except that reloading a
+// dictionary, or loading one asynchronously, creates a backend and spell
+// checker on a thread of its own and then hands the spell checker over to
+// the worker.
+
+// A forward-only sequence of strings, like IEnumString.
+class StringEnumerator
+{
+public:
+	virtual ~StringEnumerator() {}
+
+	// Fetch the next string. Returns false at the end or on error.
+	virtual bool next(std::u16string& out) = 0;
+};
+
+// A spell checker for one language, like ISpellChecker.
+class SpellChecker
+{
+public:
+	virtual ~SpellChecker() {}
+
+	// Returns 0 if 'word' is correctly spelled, 1 if not, -1 on error.
+	virtual int check(const char16_t* word) = 0;
+
+	// Suggestions for 'word'. Returns null on error, or when the word is
+	// spelled correctly and so there is nothing to suggest.
+	virtual std::unique_ptr<StringEnumerator> suggest(const char16_t* word) = 0;
+
+	// Add to the user's dictionary, ignore for the session and store an
+	// autocorrection. Return false on error.
+	virtual bool add(const char16_t* word) = 0;
+	virtual bool ignore(const char16_t* word) = 0;
+	virtual bool auto_correct(const char16_t* from, const char16_t* to) = 0;
+};
+
+// The engine as a whole, like ISpellCheckerFactory.
+class SpellBackend
+{
+public:
+	virtual ~SpellBackend() {}
+
+	// Tags of all languages available. Null on error.
+	virtual std::unique_ptr<StringEnumerator> supported_languages() = 0;
+
+	// Returns 1 if 'tag' is available, 0 if not, -1 on error.
+	virtual int is_supported(const char16_t* tag) = 0;
+
+	// Create a checker for 'tag'. Null on error or if it is unavailable.
+	virtual std::unique_ptr<SpellChecker> create_spell_checker(const char16_t* tag) = 0;
+};
+
+// Creates the backend. Run on the provider's worker thread, or a reload
+// thread, with any per-thread setup (COM) done. May return null.
+typedef std::function<std::unique_ptr<SpellBackend>()> SpellBackendFactory;
+
+// The backend the plugin uses: on Windows the system spell checker, unless
+// ENCHANT_WINDOWS_BACKEND is "wordlist"; elsewhere word lists. Follows the
+// same rules as a SpellBackendFactory.
+std::unique_ptr<SpellBackend> create_default_spell_backend();
+
+#endif
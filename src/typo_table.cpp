@@ -0,0 +1,85 @@
+// enchant_windows - common typos and their corrections.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#include "typo_table.h"
+
+#include "typo_table_data.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// tools/gen_typo_tables.py rejects longer typos.
+static const size_t kMaxTypoBytes = 64;
+
+constexpr const TypoTable* find_table(std::string_view language)
+{
+	for (const TypoTable& table : typo_table_data::kTables)
+	{
+		if (table.language == language)
+			return &table;
+	}
+	return nullptr;
+}
+
+static_assert(typo_correction(*find_table("en"), "teh") == "the", "English typo table");
+static_assert(typo_correction(*find_table("en"), "the").empty(), "English typo table");
+static_assert(typo_correction(*find_table("de"), "vieleicht") == "vielleicht", "German typo table");
+static_assert(typo_correction(*find_table("fr"), "malgr\303\251s") == "malgr\303\251", "French typo table");
+static_assert(typo_correction(*find_table("es"), "tambien") == "tambi\303\251n", "Spanish typo table");
+
+static bool typo_table_enabled()
+{
+	const char* enabled = getenv("ENCHANT_WINDOWS_TYPO_TABLE");
+	return !enabled || strcmp(enabled, "0") != 0;
+}
+
+const TypoTable* typo_table_for(const LanguageTag& language)
+{
+	if (!typo_table_enabled())
+		return nullptr;
+
+	const std::string& tag = language.bcp47;
+	return find_table(std::string_view(tag).substr(0, tag.find('-')));
+}
+
+bool correct_typo(const TypoTable* table, const char* word, size_t len, const CaseRules& rules, std::string& out)
+{
+	if (!table)
+		return false;
+
+	// Typos are short; anything longer can't be one.
+	char lower[kMaxTypoBytes];
+	if (len > sizeof(lower))
+		return false;
+
+	// Without folding only lowercase words can match.
+	const CasePattern pattern = rules.fold ? case_pattern(word, len, rules, lower) : kCaseLower;
+	if (pattern == kCaseMixed)
+		return false;
+
+	const std::string_view correction = typo_correction(*table,
+		std::string_view(pattern == kCaseLower ? word : lower, len));
+	if (correction.empty())
+		return false;
+
+	out.assign(correction.data(), correction.size());
+	if (pattern != kCaseLower)
+		capitalize(out, pattern == kCaseUpper, rules);
+	return true;
+}
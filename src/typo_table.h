@@ -0,0 +1,89 @@
+// enchant_windows - common typos and their corrections.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#ifndef ENCHANT_WINDOWS_TYPO_TABLE_H
+#define ENCHANT_WINDOWS_TYPO_TABLE_H
+
+#include "case_pattern.h"
+#include "language_tags.h"
+
+#include <stdint.h>
+#include <string>
+#include <string_view>
+
+// Typos common enough that the best suggestion for them is known in advance
+// ("teh": "the"), so it can be offered without asking the backend. The
+// tables are compiled from data/typos/<lang>.txt by tools/gen_typo_tables.py
+// into typo_table_data.h, one minimal perfect hash per language: a typo
+// hashes to a bucket, the bucket's seed rehashes it to the one slot it can
+// be in, and a single compare says whether it is there. Everything about a
+// lookup is constexpr, so the tables are checked at compile time as well.
+
+struct TypoEntry
+{
+	std::string_view typo;        // lowercase, as case_pattern folds it
+	std::string_view correction;  // as it should be written
+};
+
+struct TypoTable
+{
+	std::string_view language;  // primary subtag, "en"
+	const uint16_t* seeds;
+	uint32_t bucketCount;
+	const TypoEntry* entries;   // in slot order
+	uint32_t entryCount;
+};
+
+// FNV-1a from a seed, then a finalizer so that the seed reaches the low
+// bits. Must match tools/gen_typo_tables.py.
+constexpr uint32_t typo_hash(uint32_t seed, std::string_view word)
+{
+	uint32_t h = 2166136261u ^ seed;
+	for (char c : word)
+	{
+		h ^= static_cast<unsigned char>(c);
+		h *= 16777619u;
+	}
+	h ^= h >> 16;
+	h *= 0x85EBCA6Bu;
+	h ^= h >> 13;
+	return h;
+}
+
+// The correction for 'typo', which must already be lowercase, or an empty
+// view if it isn't in 'table'.
+constexpr std::string_view typo_correction(const TypoTable& table, std::string_view typo)
+{
+	if (table.entryCount == 0)
+		return std::string_view();
+	const uint32_t seed = table.seeds[typo_hash(0, typo) % table.bucketCount];
+	const TypoEntry& entry = table.entries[typo_hash(seed, typo) % table.entryCount];
+	return entry.typo == typo ? entry.correction : std::string_view();
+}
+
+// The table for 'language', by its primary subtag, or null if there is none
+// or ENCHANT_WINDOWS_TYPO_TABLE is 0.
+const TypoTable* typo_table_for(const LanguageTag& language);
+
+// If 'word' (canonical UTF-8) is a typo in 'table', set 'out' to its
+// correction capitalized as the word is ("Teh": "The") and return true.
+// Mixed case words never match; nor does anything when 'table' is null.
+bool correct_typo(const TypoTable* table, const char* word, size_t len, const CaseRules& rules, std::string& out);
+
+#endif
@@ -0,0 +1,481 @@
+// enchant_windows - common typo tables.
+//
+// Generated by tools/gen_typo_tables.py from data/typos. Do not edit.
+
+#ifndef ENCHANT_WINDOWS_TYPO_TABLE_DATA_H
+#define ENCHANT_WINDOWS_TYPO_TABLE_DATA_H
+
+#include "typo_table.h"
+
+namespace typo_table_data {
+
+// English: 230 typos.
+constexpr uint16_t kEnglishSeeds[58] = {
+	307, 182, 111, 93, 39, 7, 0, 1, 22, 16, 148, 2, 2, 17, 217, 12,
+	63, 712, 93, 4, 14, 870, 223, 7, 20, 63, 324, 349, 4, 5, 7, 1084,
+	20, 289, 1, 0, 1503, 63, 38, 33, 85, 177, 15, 176, 1, 204, 5955, 72,
+	22, 2124, 233, 278, 274, 1, 1, 3, 837, 21,
+};
+
+constexpr TypoEntry kEnglishEntries[230] = {
+	{ "orignal", "original" },
+	{ "speach", "speech" },
+	{ "langauge", "language" },
+	{ "eveything", "everything" },
+	{ "perfomance", "performance" },
+	{ "begining", "beginning" },
+	{ "seperately", "separately" },
+	{ "recieved", "received" },
+	{ "whcih", "which" },
+	{ "goverment", "government" },
+	{ "togehter", "together" },
+	{ "fourty", "forty" },
+	{ "littel", "little" },
+	{ "enought", "enough" },
+	{ "otehr", "other" },
+	{ "whihc", "which" },
+	{ "improtant", "important" },
+	{ "necesary", "necessary" },
+	{ "yoru", "your" },
+	{ "occurrance", "occurrence" },
+	{ "mispell", "misspell" },
+	{ "tehre", "there" },
+	{ "woudl", "would" },
+	{ "prefered", "preferred" },
+	{ "mesage", "message" },
+	{ "definatly", "definitely" },
+	{ "youre", "you're" },
+	{ "becaus", "because" },
+	{ "foriegn", "foreign" },
+	{ "usally", "usually" },
+	{ "wich", "which" },
+	{ "tihs", "this" },
+	{ "occassionally", "occasionally" },
+	{ "tounge", "tongue" },
+	{ "dissapoint", "disappoint" },
+	{ "possable", "possible" },
+	{ "gerat", "great" },
+	{ "studing", "studying" },
+	{ "acheive", "achieve" },
+	{ "problme", "problem" },
+	{ "relevent", "relevant" },
+	{ "arguement", "argument" },
+	{ "remeber", "remember" },
+	{ "interupt", "interrupt" },
+	{ "basicly", "basically" },
+	{ "calender", "calendar" },
+	{ "comming", "coming" },
+	{ "recieving", "receiving" },
+	{ "unforseen", "unforeseen" },
+	{ "yuo", "you" },
+	{ "unfortunatly", "unfortunately" },
+	{ "belive", "believe" },
+	{ "tommorow", "tomorrow" },
+	{ "unkown", "unknown" },
+	{ "wheather", "weather" },
+	{ "seperate", "separate" },
+	{ "oportunity", "opportunity" },
+	{ "accomodation", "accommodation" },
+	{ "wasnt", "wasn't" },
+	{ "couldnt", "couldn't" },
+	{ "govenment", "government" },
+	{ "hapened", "happened" },
+	{ "occurence", "occurrence" },
+	{ "comapny", "company" },
+	{ "recieve", "receive" },
+	{ "greatful", "grateful" },
+	{ "threshhold", "threshold" },
+	{ "grammer", "grammar" },
+	{ "becasue", "because" },
+	{ "beacuse", "because" },
+	{ "tendancy", "tendency" },
+	{ "origional", "original" },
+	{ "supercede", "supersede" },
+	{ "wnat", "want" },
+	{ "aswell", "as well" },
+	{ "immediatly", "immediately" },
+	{ "waht", "what" },
+	{ "abotu", "about" },
+	{ "definately", "definitely" },
+	{ "mroe", "more" },
+	{ "befor", "before" },
+	{ "tatoo", "tattoo" },
+	{ "yera", "year" },
+	{ "adress", "address" },
+	{ "neccessary", "necessary" },
+	{ "allways", "always" },
+	{ "someting", "something" },
+	{ "aslo", "also" },
+	{ "appearence", "appearance" },
+	{ "diffrent", "different" },
+	{ "dont", "don't" },
+	{ "buisness", "business" },
+	{ "becuase", "because" },
+	{ "infact", "in fact" },
+	{ "freinds", "friends" },
+	{ "oppurtunity", "opportunity" },
+	{ "thge", "the" },
+	{ "decieve", "deceive" },
+	{ "persue", "pursue" },
+	{ "lenght", "length" },
+	{ "adn", "and" },
+	{ "intresting", "interesting" },
+	{ "sentance", "sentence" },
+	{ "libary", "library" },
+	{ "thier", "their" },
+	{ "havent", "haven't" },
+	{ "knwo", "know" },
+	{ "visable", "visible" },
+	{ "shuold", "should" },
+	{ "somthing", "something" },
+	{ "alwasy", "always" },
+	{ "probelm", "problem" },
+	{ "didnt", "didn't" },
+	{ "finaly", "finally" },
+	{ "pasword", "password" },
+	{ "probaly", "probably" },
+	{ "compnay", "company" },
+	{ "reccomend", "recommend" },
+	{ "recomend", "recommend" },
+	{ "noticable", "noticeable" },
+	{ "dissapear", "disappear" },
+	{ "quesiton", "question" },
+	{ "expecially", "especially" },
+	{ "happend", "happened" },
+	{ "twelth", "twelfth" },
+	{ "nad", "and" },
+	{ "persistant", "persistent" },
+	{ "peole", "people" },
+	{ "occured", "occurred" },
+	{ "soemthing", "something" },
+	{ "differnt", "different" },
+	{ "konw", "know" },
+	{ "peopel", "people" },
+	{ "freind", "friend" },
+	{ "posession", "possession" },
+	{ "sucess", "success" },
+	{ "experiance", "experience" },
+	{ "accomodate", "accommodate" },
+	{ "wiht", "with" },
+	{ "wouldnt", "wouldn't" },
+	{ "apparantly", "apparently" },
+	{ "hte", "the" },
+	{ "curiousity", "curiosity" },
+	{ "enviroment", "environment" },
+	{ "languege", "language" },
+	{ "yeild", "yield" },
+	{ "posible", "possible" },
+	{ "nothign", "nothing" },
+	{ "familar", "familiar" },
+	{ "maintainance", "maintenance" },
+	{ "completly", "completely" },
+	{ "truely", "truly" },
+	{ "doesnt", "doesn't" },
+	{ "realy", "really" },
+	{ "beleive", "believe" },
+	{ "untill", "until" },
+	{ "teh", "the" },
+	{ "idiosyncracy", "idiosyncrasy" },
+	{ "resturant", "restaurant" },
+	{ "thankyou", "thank you" },
+	{ "wierd", "weird" },
+	{ "jsut", "just" },
+	{ "thsi", "this" },
+	{ "acheived", "achieved" },
+	{ "explaination", "explanation" },
+	{ "existance", "existence" },
+	{ "cemetary", "cemetery" },
+	{ "succesful", "successful" },
+	{ "shouldnt", "shouldn't" },
+	{ "vegatable", "vegetable" },
+	{ "poeple", "people" },
+	{ "sincerly", "sincerely" },
+	{ "reciept", "receipt" },
+	{ "shoudl", "should" },
+	{ "humerous", "humorous" },
+	{ "importent", "important" },
+	{ "similarily", "similarly" },
+	{ "vaccuum", "vacuum" },
+	{ "isnt", "isn't" },
+	{ "taht", "that" },
+	{ "prescence", "presence" },
+	{ "stoped", "stopped" },
+	{ "millenium", "millennium" },
+	{ "occassion", "occasion" },
+	{ "independant", "independent" },
+	{ "ocasion", "occasion" },
+	{ "theyre", "they're" },
+	{ "aobut", "about" },
+	{ "useing", "using" },
+	{ "interseting", "interesting" },
+	{ "religous", "religious" },
+	{ "writting", "writing" },
+	{ "suprise", "surprise" },
+	{ "exmaple", "example" },
+	{ "rythm", "rhythm" },
+	{ "publically", "publicly" },
+	{ "htis", "this" },
+	{ "alot", "a lot" },
+	{ "gaurd", "guard" },
+	{ "refrence", "reference" },
+	{ "busness", "business" },
+	{ "similiar", "similar" },
+	{ "everthing", "everything" },
+	{ "liason", "liaison" },
+	{ "concious", "conscious" },
+	{ "wrok", "work" },
+	{ "tyrany", "tyranny" },
+	{ "mabye", "maybe" },
+	{ "propoganda", "propaganda" },
+	{ "successfull", "successful" },
+	{ "remmember", "remember" },
+	{ "commitee", "committee" },
+	{ "usualy", "usually" },
+	{ "resistence", "resistance" },
+	{ "questoin", "question" },
+	{ "embarass", "embarrass" },
+	{ "strenght", "strength" },
+	{ "refered", "referred" },
+	{ "hierachy", "hierarchy" },
+	{ "knowlege", "knowledge" },
+	{ "whereever", "wherever" },
+	{ "collegue", "colleague" },
+	{ "tomorow", "tomorrow" },
+	{ "responsability", "responsibility" },
+	{ "sucessful", "successful" },
+	{ "agressive", "aggressive" },
+	{ "naturaly", "naturally" },
+	{ "harrass", "harass" },
+	{ "rember", "remember" },
+	{ "sieze", "seize" },
+};
+
+// German: 72 typos.
+constexpr uint16_t kGermanSeeds[18] = {
+	270, 1, 3, 377, 1, 242, 7, 3, 4, 36, 1465, 28, 5, 6858, 41, 309,
+	218, 5,
+};
+
+constexpr TypoEntry kGermanEntries[72] = {
+	{ "kommision", "Kommission" },
+	{ "wiedersprechen", "widersprechen" },
+	{ "billiard", "Billard" },
+	{ "rythmus", "Rhythmus" },
+	{ "eigendlich", "eigentlich" },
+	{ "diskusion", "Diskussion" },
+	{ "karussel", "Karussell" },
+	{ "satelit", "Satellit" },
+	{ "fahrad", "Fahrrad" },
+	{ "vorrausetzung", "Voraussetzung" },
+	{ "ncht", "nicht" },
+	{ "zahnartz", "Zahnarzt" },
+	{ "sympatisch", "sympathisch" },
+	{ "vorraussetzung", "Voraussetzung" },
+	{ "reperatur", "Reparatur" },
+	{ "wrden", "werden" },
+	{ "vileicht", "vielleicht" },
+	{ "atmosf\303\244re", "Atmosph\303\244re" },
+	{ "terasse", "Terrasse" },
+	{ "resourcen", "Ressourcen" },
+	{ "interressant", "interessant" },
+	{ "wahrscheinlig", "wahrscheinlich" },
+	{ "paralell", "parallel" },
+	{ "atmossph\303\244re", "Atmosph\303\244re" },
+	{ "maschiene", "Maschine" },
+	{ "eigentlig", "eigentlich" },
+	{ "widerholen", "wiederholen" },
+	{ "vorraus", "voraus" },
+	{ "probelm", "Problem" },
+	{ "udn", "und" },
+	{ "interresse", "Interesse" },
+	{ "zuende", "zu Ende" },
+	{ "wiederspiegeln", "widerspiegeln" },
+	{ "ncoh", "noch" },
+	{ "ergebniss", "Ergebnis" },
+	{ "warscheinlich", "wahrscheinlich" },
+	{ "gallerie", "Galerie" },
+	{ "wiederspruch", "Widerspruch" },
+	{ "habne", "haben" },
+	{ "tolleranz", "Toleranz" },
+	{ "ziemlig", "ziemlich" },
+	{ "nciht", "nicht" },
+	{ "detailiert", "detailliert" },
+	{ "addresse", "Adresse" },
+	{ "shcon", "schon" },
+	{ "vieleicht", "vielleicht" },
+	{ "aktzeptanz", "Akzeptanz" },
+	{ "n\303\244hmlich", "n\303\244mlich" },
+	{ "seperat", "separat" },
+	{ "pappst", "Papst" },
+	{ "dilletant", "Dilettant" },
+	{ "imemr", "immer" },
+	{ "brilliant", "brillant" },
+	{ "rhytmus", "Rhythmus" },
+	{ "lebensmitel", "Lebensmittel" },
+	{ "acuh", "auch" },
+	{ "wiederrum", "wiederum" },
+	{ "lizens", "Lizenz" },
+	{ "akkustik", "Akustik" },
+	{ "nohc", "noch" },
+	{ "n\303\244mlig", "n\303\244mlich" },
+	{ "standart", "Standard" },
+	{ "entg\303\274ltig", "endg\303\274ltig" },
+	{ "endlig", "endlich" },
+	{ "medizien", "Medizin" },
+	{ "konkurenz", "Konkurrenz" },
+	{ "zeugniss", "Zeugnis" },
+	{ "auhc", "auch" },
+	{ "ahben", "haben" },
+	{ "widerholung", "Wiederholung" },
+	{ "agressiv", "aggressiv" },
+	{ "wehrmutstropfen", "Wermutstropfen" },
+};
+
+// French: 59 typos.
+constexpr uint16_t kFrenchSeeds[15] = {
+	494, 27, 6, 28, 1, 9, 21, 60, 528, 682, 2, 179, 2, 155, 0,
+};
+
+constexpr TypoEntry kFrenchEntries[59] = {
+	{ "fonctionement", "fonctionnement" },
+	{ "beaucoups", "beaucoup" },
+	{ "quelquechose", "quelque chose" },
+	{ "d\303\251velopement", "d\303\251veloppement" },
+	{ "dilemne", "dilemme" },
+	{ "aparement", "apparemment" },
+	{ "tranquile", "tranquille" },
+	{ "pourqoui", "pourquoi" },
+	{ "vraiement", "vraiment" },
+	{ "traditionel", "traditionnel" },
+	{ "personel", "personnel" },
+	{ "bizzare", "bizarre" },
+	{ "maintenent", "maintenant" },
+	{ "accueuil", "accueil" },
+	{ "rapeller", "rappeler" },
+	{ "appeller", "appeler" },
+	{ "porquoi", "pourquoi" },
+	{ "evenement", "\303\251v\303\251nement" },
+	{ "syt\303\250me", "syst\303\250me" },
+	{ "acceuil", "accueil" },
+	{ "tr\303\251s", "tr\303\250s" },
+	{ "etre", "\303\252tre" },
+	{ "aujourdhui", "aujourd'hui" },
+	{ "apparament", "apparemment" },
+	{ "d\303\251ja", "d\303\251j\303\240" },
+	{ "boucoup", "beaucoup" },
+	{ "deja", "d\303\251j\303\240" },
+	{ "parceque", "parce que" },
+	{ "vraimment", "vraiment" },
+	{ "cauchemard", "cauchemar" },
+	{ "enfaite", "en fait" },
+	{ "ressourse", "ressource" },
+	{ "developement", "d\303\251veloppement" },
+	{ "courrir", "courir" },
+	{ "r\303\251cement", "r\303\251cemment" },
+	{ "ceuillir", "cueillir" },
+	{ "apeller", "appeler" },
+	{ "professionel", "professionnel" },
+	{ "biens\303\273r", "bien s\303\273r" },
+	{ "comission", "commission" },
+	{ "malgr\303\251s", "malgr\303\251" },
+	{ "aggr\303\251able", "agr\303\251able" },
+	{ "voila", "voil\303\240" },
+	{ "parmis", "parmi" },
+	{ "maintenat", "maintenant" },
+	{ "parcontre", "par contre" },
+	{ "appartemment", "appartement" },
+	{ "batiment", "b\303\242timent" },
+	{ "occurence", "occurrence" },
+	{ "addresse", "adresse" },
+	{ "systeme", "syst\303\250me" },
+	{ "toujour", "toujours" },
+	{ "bientot", "bient\303\264t" },
+	{ "mourrir", "mourir" },
+	{ "apartement", "appartement" },
+	{ "pluspart", "plupart" },
+	{ "ajourd'hui", "aujourd'hui" },
+	{ "d\303\251vellopement", "d\303\251veloppement" },
+	{ "beacoup", "beaucoup" },
+};
+
+// Spanish: 63 typos.
+constexpr uint16_t kSpanishSeeds[16] = {
+	55, 1, 186, 1, 6, 7, 208, 66, 53, 3, 14, 6, 31, 68, 3, 37,
+};
+
+constexpr TypoEntry kSpanishEntries[63] = {
+	{ "corazon", "coraz\303\263n" },
+	{ "fuistes", "fuiste" },
+	{ "proximo", "pr\303\263ximo" },
+	{ "quizas", "quiz\303\241s" },
+	{ "asi", "as\303\255" },
+	{ "enserio", "en serio" },
+	{ "rapido", "r\303\241pido" },
+	{ "derrepente", "de repente" },
+	{ "haci", "as\303\255" },
+	{ "aprovar", "aprobar" },
+	{ "hize", "hice" },
+	{ "cancion", "canci\303\263n" },
+	{ "nacion", "naci\303\263n" },
+	{ "nececario", "necesario" },
+	{ "bibir", "vivir" },
+	{ "atravez", "a trav\303\251s" },
+	{ "extrangero", "extranjero" },
+	{ "exhuberante", "exuberante" },
+	{ "ultimo", "\303\272ltimo" },
+	{ "abia", "hab\303\255a" },
+	{ "educacion", "educaci\303\263n" },
+	{ "tenia", "ten\303\255a" },
+	{ "telefono", "tel\303\251fono" },
+	{ "dificil", "dif\303\255cil" },
+	{ "osea", "o sea" },
+	{ "travez", "trav\303\251s" },
+	{ "pagina", "p\303\241gina" },
+	{ "ademas", "adem\303\241s" },
+	{ "acer", "hacer" },
+	{ "nesesario", "necesario" },
+	{ "expont\303\241neo", "espont\303\241neo" },
+	{ "huvo", "hubo" },
+	{ "nesecito", "necesito" },
+	{ "solucion", "soluci\303\263n" },
+	{ "atraves", "a trav\303\251s" },
+	{ "hechar", "echar" },
+	{ "musica", "m\303\272sica" },
+	{ "ojala", "ojal\303\241" },
+	{ "iendo", "yendo" },
+	{ "despues", "despu\303\251s" },
+	{ "porfavor", "por favor" },
+	{ "avia", "hab\303\255a" },
+	{ "dijistes", "dijiste" },
+	{ "espontaneo", "espont\303\241neo" },
+	{ "desici\303\263n", "decisi\303\263n" },
+	{ "nececito", "necesito" },
+	{ "situacion", "situaci\303\263n" },
+	{ "aser", "hacer" },
+	{ "dijieron", "dijeron" },
+	{ "havia", "hab\303\255a" },
+	{ "tanbien", "tambi\303\251n" },
+	{ "decici\303\263n", "decisi\303\263n" },
+	{ "habia", "hab\303\255a" },
+	{ "iva", "iba" },
+	{ "podria", "podr\303\255a" },
+	{ "sinembargo", "sin embargo" },
+	{ "hiba", "iba" },
+	{ "razon", "raz\303\263n" },
+	{ "informacion", "informaci\303\263n" },
+	{ "facil", "f\303\241cil" },
+	{ "relacion", "relaci\303\263n" },
+	{ "exito", "\303\251xito" },
+	{ "tambien", "tambi\303\251n" },
+};
+
+constexpr TypoTable kTables[4] = {
+	{ "en", kEnglishSeeds, 58, kEnglishEntries, 230 },
+	{ "de", kGermanSeeds, 18, kGermanEntries, 72 },
+	{ "fr", kFrenchSeeds, 15, kFrenchEntries, 59 },
+	{ "es", kSpanishSeeds, 16, kSpanishEntries, 63 },
+};
+
+} // namespace typo_table_data
+
+#endif
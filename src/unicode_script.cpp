@@ -0,0 +1,361 @@
+// enchant_windows - Unicode script of words.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#include "unicode_script.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENCHANT_WINDOWS_SCRIPT_SSE2 1
+#include <emmintrin.h>
+#endif
+
+static const char* const kScriptNames[kScriptCount] = {
+	"Latin", "Greek", "Cyrillic", "Armenian", "Hebrew", "Arabic", "Devanagari",
+	"Thai", "Hangul", "Kana", "Han", "Emoji", "Other",
+};
+
+const char* script_name(UnicodeScript script)
+{
+	return script < kScriptCount ? kScriptNames[script] : "";
+}
+
+static bool in(unsigned char b, unsigned char lo, unsigned char hi)
+{
+	return b >= lo && b <= hi;
+}
+
+// The script of the character led by 'b', followed by 'n'. Continuation
+// bytes lead nothing. Lead bytes map onto blocks as:
+//   C3..CA Latin-1 Supplement to IPA     E1 84..87 Hangul Jamo
+//   CE..CF Greek                         E1 B8..BB Latin Extended Additional
+//   D0..D4 Cyrillic                      E1 BC..BF Greek Extended
+//   D5..D6 Armenian                      E2 98..9E, E2 AC..AD symbols, dingbats
+//   D7 Hebrew                            E3 81..83, E3 87 Kana
+//   D8..DB Arabic                        E3 84..86, EA B0..ED 9F Hangul
+//   E0 A4..A5 Devanagari                 E3 90..E9 BF, EF A4..AB, F0 A0..AF Han
+//   E0 B8..B9 Thai                       F0 9F emoji
+// and, belonging to no script, C2 (Latin-1 punctuation), CB..CD (modifier
+// letters and combining marks), the rest of E2 (punctuation and symbols),
+// E3 80 and E3 88..8F (CJK punctuation and enclosed forms), EF B8..B9
+// (variation selectors) and F3 A0 (tags).
+static ScriptSet classify(unsigned char b, unsigned char n)
+{
+	if (b < 0x80)
+		return in(b | 0x20, 'a', 'z') ? script_bit(kScriptLatin) : 0;
+	if (b < 0xC0 || b == 0xC2 || in(b, 0xCB, 0xCD))
+		return 0;
+	if (in(b, 0xC3, 0xCA))
+		return script_bit(kScriptLatin);
+	if (in(b, 0xCE, 0xCF))
+		return script_bit(kScriptGreek);
+	if (in(b, 0xD0, 0xD4))
+		return script_bit(kScriptCyrillic);
+	if (in(b, 0xD5, 0xD6))
+		return script_bit(kScriptArmenian);
+	if (b == 0xD7)
+		return script_bit(kScriptHebrew);
+	if (in(b, 0xD8, 0xDB))
+		return script_bit(kScriptArabic);
+
+	switch (b)
+	{
+	case 0xE0:
+		if (in(n, 0xA4, 0xA5))
+			return script_bit(kScriptDevanagari);
+		if (in(n, 0xB8, 0xB9))
+			return script_bit(kScriptThai);
+		break;
+	case 0xE1:
+		if (in(n, 0x84, 0x87))
+			return script_bit(kScriptHangul);
+		if (in(n, 0xB8, 0xBB))
+			return script_bit(kScriptLatin);
+		if (in(n, 0xBC, 0xBF))
+			return script_bit(kScriptGreek);
+		break;
+	case 0xE2:
+		return in(n, 0x98, 0x9E) || in(n, 0xAC, 0xAD) ? script_bit(kScriptEmoji) : 0;
+	case 0xE3:
+		if (n == 0x80 || in(n, 0x88, 0x8F))
+			return 0;
+		if (in(n, 0x81, 0x83) || n == 0x87)
+			return script_bit(kScriptKana);
+		if (in(n, 0x84, 0x86))
+			return script_bit(kScriptHangul);
+		if (in(n, 0x90, 0xBF))
+			return script_bit(kScriptHan);
+		break;
+	case 0xEA:
+		if (in(n, 0xB0, 0xBF))
+			return script_bit(kScriptHangul);
+		break;
+	case 0xEB:
+	case 0xEC:
+		return script_bit(kScriptHangul);
+	case 0xED:
+		if (in(n, 0x80, 0x9F))
+			return script_bit(kScriptHangul);
+		break;
+	case 0xEF:
+		if (in(n, 0xA4, 0xAB))
+			return script_bit(kScriptHan);
+		if (in(n, 0xB8, 0xB9))
+			return 0;
+		break;
+	case 0xF0:
+		if (n == 0x9F)
+			return script_bit(kScriptEmoji);
+		if (in(n, 0xA0, 0xAF))
+			return script_bit(kScriptHan);
+		break;
+	case 0xF3:
+		if (n == 0xA0)
+			return 0;
+		break;
+	}
+	if (in(b, 0xE4, 0xE9))
+		return script_bit(kScriptHan);
+	return script_bit(kScriptOther);
+}
+
+// Every byte is looked at as a possible lead byte, so that the SIMD version
+// can do the same a block at a time; continuation bytes classify as nothing.
+// The byte after the end counts as 0.
+ScriptSet word_scripts_scalar(const char* word, size_t len)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(word);
+	ScriptSet scripts = 0;
+	for (size_t i = 0; i < len; ++i)
+		scripts |= classify(bytes[i], i + 1 < len ? bytes[i + 1] : 0);
+	return scripts;
+}
+
+#ifdef ENCHANT_WINDOWS_SCRIPT_SSE2
+// Lanes of 'v' in [lo, hi], unsigned: v - lo, saturated down by hi - lo,
+// is zero.
+static inline __m128i between(__m128i v, int lo, int hi)
+{
+	const __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8(static_cast<char>(lo)));
+	return _mm_cmpeq_epi8(_mm_subs_epu8(offset, _mm_set1_epi8(static_cast<char>(hi - lo))), _mm_setzero_si128());
+}
+
+static inline __m128i equal(__m128i v, int value)
+{
+	return _mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(value)));
+}
+
+static inline void add_if_any(ScriptSet& scripts, __m128i mask, UnicodeScript script)
+{
+	if (_mm_movemask_epi8(mask))
+		scripts |= script_bit(script);
+}
+
+// The scripts of the 16 lead bytes in 'b', each followed by the byte at the
+// same lane of 'n'; classify() for each lane at once.
+static ScriptSet block_scripts(__m128i b, __m128i n)
+{
+	ScriptSet scripts = 0;
+	const __m128i letter = between(_mm_or_si128(b, _mm_set1_epi8(0x20)), 'a', 'z');
+	if (_mm_movemask_epi8(b) == 0)
+		return _mm_movemask_epi8(letter) ? script_bit(kScriptLatin) : 0;
+
+	// Two-byte characters, which the lead byte alone decides.
+	const __m128i latin = _mm_or_si128(letter, between(b, 0xC3, 0xCA));
+	const __m128i greek = between(b, 0xCE, 0xCF);
+	const __m128i cyrillic = between(b, 0xD0, 0xD4);
+	const __m128i armenian = between(b, 0xD5, 0xD6);
+	const __m128i hebrew = equal(b, 0xD7);
+	const __m128i arabic = between(b, 0xD8, 0xDB);
+	add_if_any(scripts, cyrillic, kScriptCyrillic);
+	add_if_any(scripts, armenian, kScriptArmenian);
+	add_if_any(scripts, hebrew, kScriptHebrew);
+	add_if_any(scripts, arabic, kScriptArabic);
+	__m128i known = _mm_or_si128(_mm_or_si128(_mm_or_si128(latin, greek), _mm_or_si128(cyrillic, armenian)),
+		_mm_or_si128(_mm_or_si128(hebrew, arabic), _mm_or_si128(equal(b, 0xC2), between(b, 0xCB, 0xCD))));
+
+	const __m128i longer = between(b, 0xE0, 0xFF);
+	if (_mm_movemask_epi8(longer) == 0)
+	{
+		add_if_any(scripts, latin, kScriptLatin);
+		add_if_any(scripts, greek, kScriptGreek);
+		if (_mm_movemask_epi8(_mm_andnot_si128(known, between(b, 0xC0, 0xDF))))
+			scripts |= script_bit(kScriptOther);
+		return scripts;
+	}
+
+	// Three- and four-byte characters, which take the next byte as well.
+	const __m128i e0 = equal(b, 0xE0);
+	const __m128i e1 = equal(b, 0xE1);
+	const __m128i e2 = equal(b, 0xE2);
+	const __m128i e3 = equal(b, 0xE3);
+	const __m128i ef = equal(b, 0xEF);
+	const __m128i f0 = equal(b, 0xF0);
+	add_if_any(scripts, _mm_or_si128(latin, _mm_and_si128(e1, between(n, 0xB8, 0xBB))), kScriptLatin);
+	add_if_any(scripts, _mm_or_si128(greek, _mm_and_si128(e1, between(n, 0xBC, 0xBF))), kScriptGreek);
+	const __m128i devanagari = _mm_and_si128(e0, between(n, 0xA4, 0xA5));
+	const __m128i thai = _mm_and_si128(e0, between(n, 0xB8, 0xB9));
+	const __m128i hangul = _mm_or_si128(
+		_mm_or_si128(_mm_and_si128(e1, between(n, 0x84, 0x87)), _mm_and_si128(e3, between(n, 0x84, 0x86))),
+		_mm_or_si128(
+			_mm_or_si128(_mm_and_si128(equal(b, 0xEA), between(n, 0xB0, 0xBF)), between(b, 0xEB, 0xEC)),
+			_mm_and_si128(equal(b, 0xED), between(n, 0x80, 0x9F))));
+	const __m128i kana = _mm_and_si128(e3, _mm_or_si128(between(n, 0x81, 0x83), equal(n, 0x87)));
+	const __m128i han = _mm_or_si128(
+		_mm_or_si128(_mm_and_si128(e3, between(n, 0x90, 0xBF)), between(b, 0xE4, 0xE9)),
+		_mm_or_si128(_mm_and_si128(ef, between(n, 0xA4, 0xAB)), _mm_and_si128(f0, between(n, 0xA0, 0xAF))));
+	const __m128i emoji = _mm_or_si128(
+		_mm_and_si128(e2, _mm_or_si128(between(n, 0x98, 0x9E), between(n, 0xAC, 0xAD))),
+		_mm_and_si128(f0, equal(n, 0x9F)));
+	add_if_any(scripts, devanagari, kScriptDevanagari);
+	add_if_any(scripts, thai, kScriptThai);
+	add_if_any(scripts, hangul, kScriptHangul);
+	add_if_any(scripts, kana, kScriptKana);
+	add_if_any(scripts, han, kScriptHan);
+	add_if_any(scripts, emoji, kScriptEmoji);
+
+	// What is left of the lead bytes, less those in no script at all.
+	known = _mm_or_si128(known, _mm_or_si128(
+		_mm_or_si128(_mm_or_si128(devanagari, thai), _mm_or_si128(hangul, kana)),
+		_mm_or_si128(_mm_or_si128(han, _mm_or_si128(e2, emoji)), _mm_and_si128(e1, between(n, 0xB8, 0xBF)))));
+	known = _mm_or_si128(known, _mm_or_si128(
+		_mm_or_si128(_mm_and_si128(e3, _mm_or_si128(equal(n, 0x80), between(n, 0x88, 0x8F))), _mm_and_si128(ef, between(n, 0xB8, 0xB9))),
+		_mm_and_si128(equal(b, 0xF3), equal(n, 0xA0))));
+	if (_mm_movemask_epi8(_mm_andnot_si128(known, between(b, 0xC0, 0xFF))))
+		scripts |= script_bit(kScriptOther);
+	return scripts;
+}
+
+static ScriptSet word_scripts_sse2(const char* word, size_t len)
+{
+	if (len < 9)
+		return word_scripts_scalar(word, len);
+
+	if (len < 16)
+	{
+		// The first and last eight bytes, each lane followed by its next.
+		const __m128i head = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(word));
+		const __m128i tail = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(word + len - 8));
+		const __m128i next = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(word + 1));
+		return block_scripts(_mm_unpacklo_epi64(head, tail), _mm_unpacklo_epi64(next, _mm_srli_epi64(tail, 8)));
+	}
+
+	ScriptSet scripts = 0;
+	for (size_t i = 0; i + 16 < len; i += 16)
+	{
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(word + i));
+		const __m128i n = _mm_loadu_si128(reinterpret_cast<const __m128i*>(word + i + 1));
+		scripts |= block_scripts(b, n);
+	}
+	// The last 16 bytes, overlapping the block before; nothing follows them.
+	const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(word + len - 16));
+	return scripts | block_scripts(b, _mm_srli_si128(b, 1));
+}
+#endif
+
+ScriptSet word_scripts(const char* word, size_t len)
+{
+#ifdef ENCHANT_WINDOWS_SCRIPT_SSE2
+	return word_scripts_sse2(word, len);
+#else
+	return word_scripts_scalar(word, len);
+#endif
+}
+
+struct LanguageScripts
+{
+	const char* language;
+	ScriptSet scripts;
+};
+
+static const ScriptSet kLatin = 1u << kScriptLatin;
+static const ScriptSet kCyrillic = 1u << kScriptCyrillic;
+static const ScriptSet kArabic = 1u << kScriptArabic;
+static const ScriptSet kDevanagari = 1u << kScriptDevanagari;
+
+// Languages written in something other than Latin. Latin ones are in the
+// next table; anything in neither is taken as written in every script.
+static const LanguageScripts kNonLatinLanguages[] = {
+	{ "ar", kArabic }, { "ba", kCyrillic }, { "be", kCyrillic }, { "bg", kCyrillic },
+	{ "ckb", kArabic }, { "cv", kCyrillic }, { "el", 1u << kScriptGreek }, { "fa", kArabic },
+	{ "he", 1u << kScriptHebrew }, { "hi", kDevanagari }, { "hy", 1u << kScriptArmenian },
+	{ "ja", (1u << kScriptKana) | (1u << kScriptHan) }, { "kk", kCyrillic }, { "ko", (1u << kScriptHangul) | (1u << kScriptHan) },
+	{ "kok", kDevanagari }, { "ky", kCyrillic }, { "mk", kCyrillic }, { "mn", kCyrillic }, { "mr", kDevanagari },
+	{ "ne", kDevanagari }, { "ps", kArabic }, { "ru", kCyrillic }, { "sa", kDevanagari }, { "sd", kArabic },
+	{ "sr", kCyrillic }, { "tg", kCyrillic }, { "th", 1u << kScriptThai }, { "tt", kCyrillic }, { "ug", kArabic },
+	{ "uk", kCyrillic }, { "ur", kArabic }, { "yi", 1u << kScriptHebrew }, { "yue", 1u << kScriptHan },
+	{ "zh", 1u << kScriptHan },
+};
+
+static const char* const kLatinLanguages[] = {
+	"af", "az", "bs", "ca", "cs", "cy", "da", "de", "en", "eo", "es", "et", "eu",
+	"fi", "fo", "fr", "ga", "gd", "gl", "hr", "hu", "id", "is", "it", "la", "lb",
+	"lt", "lv", "ms", "mt", "nb", "nl", "nn", "no", "pl", "pt", "ro", "sk", "sl",
+	"sq", "sv", "sw", "tl", "tr", "vi",
+};
+
+static const LanguageScripts kScriptSubtags[] = {
+	{ "Arab", kArabic }, { "Armn", 1u << kScriptArmenian }, { "Cyrl", kCyrillic }, { "Deva", kDevanagari },
+	{ "Grek", 1u << kScriptGreek }, { "Hang", 1u << kScriptHangul }, { "Hani", 1u << kScriptHan },
+	{ "Hans", 1u << kScriptHan }, { "Hant", 1u << kScriptHan }, { "Hebr", 1u << kScriptHebrew },
+	{ "Jpan", (1u << kScriptKana) | (1u << kScriptHan) }, { "Kore", (1u << kScriptHangul) | (1u << kScriptHan) },
+	{ "Latn", kLatin }, { "Thai", 1u << kScriptThai },
+};
+
+// The subtag of 'tag' starting at 'start', and where the next one starts.
+static std::string_view subtag(std::string_view tag, size_t& start)
+{
+	size_t end = tag.find('-', start);
+	if (end == std::string_view::npos)
+		end = tag.size();
+	const std::string_view part = tag.substr(start, end - start);
+	start = end < tag.size() ? end + 1 : tag.size();
+	return part;
+}
+
+ScriptSet dictionary_scripts(std::string_view tag)
+{
+	const char* skip = getenv("ENCHANT_WINDOWS_SCRIPT_SKIP");
+	if (skip && strcmp(skip, "0") == 0)
+		return kAllScripts;
+
+	size_t at = 0;
+	const std::string_view language = subtag(tag, at);
+	const std::string_view script = subtag(tag, at);
+	if (script.size() == 4)
+	{
+		for (const LanguageScripts& entry : kScriptSubtags)
+		{
+			if (script == entry.language)
+				return entry.scripts;
+		}
+	}
+	for (const LanguageScripts& entry : kNonLatinLanguages)
+	{
+		if (language == entry.language)
+			return entry.scripts;
+	}
+	for (const char* latin : kLatinLanguages)
+	{
+		if (language == latin)
+			return kLatin;
+	}
+	return kAllScripts;
+}
@@ -0,0 +1,84 @@
+// enchant_windows - Unicode script of words.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#ifndef ENCHANT_WINDOWS_UNICODE_SCRIPT_H
+#define ENCHANT_WINDOWS_UNICODE_SCRIPT_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <string_view>
+
+// Which writing systems a word uses, so that words a dictionary can't judge
+// (CJK, Thai or emoji in an English dictionary, Cyrillic in a German one)
+// can be left alone or sent to a dictionary that can. Characters are told
+// apart by their lead byte and the byte after it, which is enough for the
+// scripts below, a 16-byte block at a time with SSE2 where available.
+// Digits, punctuation, symbols and combining marks belong to no script.
+// Malformed UTF-8 is classified byte by byte and never fails.
+
+enum UnicodeScript
+{
+	kScriptLatin,
+	kScriptGreek,
+	kScriptCyrillic,
+	kScriptArmenian,
+	kScriptHebrew,
+	kScriptArabic,
+	kScriptDevanagari,
+	kScriptThai,
+	kScriptHangul,
+	kScriptKana,
+	kScriptHan,
+	kScriptEmoji,
+	kScriptOther,  // any other letter, and malformed lead bytes
+	kScriptCount,
+};
+
+// A bit per UnicodeScript.
+typedef uint32_t ScriptSet;
+const ScriptSet kAllScripts = (1u << kScriptCount) - 1;
+
+inline ScriptSet script_bit(UnicodeScript script)
+{
+	return 1u << script;
+}
+
+// "Latin", "Han" and so on.
+const char* script_name(UnicodeScript script);
+
+// The scripts of the characters in 'word' (UTF-8).
+ScriptSet word_scripts(const char* word, size_t len);
+
+// The same without SIMD, for comparison.
+ScriptSet word_scripts_scalar(const char* word, size_t len);
+
+// The scripts a dictionary for 'tag', in its canonical BCP 47 form ("ru-RU",
+// "sr-Latn", as LanguageTag::bcp47 has it), is written in: from a script
+// subtag if there is one, else the language's usual script.
+// All of them for a language not known here, or for dictionaries made
+// after ENCHANT_WINDOWS_SCRIPT_SKIP is set to 0.
+ScriptSet dictionary_scripts(std::string_view tag);
+
+// Whether a word with 'scripts' has letters, but none in 'handled'.
+inline bool outside_scripts(ScriptSet scripts, ScriptSet handled)
+{
+	return scripts != 0 && (scripts & handled) == 0;
+}
+
+#endif
@@ -0,0 +1,146 @@
+// enchant_windows - UTF-8 and UTF-16 conversion.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#include "utf.h"
+
+#include <stdint.h>
+
+static const char32_t kReplacementCharacter = 0xFFFD;
+
+// Decode one code point starting at in[i], advancing i past it. Overlong
+// forms, surrogates and out-of-range values decode to U+FFFD, consuming
+// only the bytes that could have been part of a valid sequence.
+static char32_t decode_utf8(const unsigned char* in, size_t len, size_t& i)
+{
+	unsigned char lead = in[i++];
+	if (lead < 0x80)
+		return lead;
+
+	size_t extra;
+	char32_t cp;
+	char32_t min;
+	if ((lead & 0xE0) == 0xC0) { extra = 1; cp = lead & 0x1F; min = 0x80; }
+	else if ((lead & 0xF0) == 0xE0) { extra = 2; cp = lead & 0x0F; min = 0x800; }
+	else if ((lead & 0xF8) == 0xF0) { extra = 3; cp = lead & 0x07; min = 0x10000; }
+	else return kReplacementCharacter;
+
+	for (size_t k = 0; k < extra; ++k)
+	{
+		if (i >= len || (in[i] & 0xC0) != 0x80)
+			return kReplacementCharacter;
+		cp = (cp << 6) | (in[i++] & 0x3F);
+	}
+
+	if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+		return kReplacementCharacter;
+	return cp;
+}
+
+size_t utf8_to_utf16(const char* in, size_t len, char16_t* out)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in);
+	size_t written = 0;
+	size_t i = 0;
+	while (i < len)
+	{
+		// Runs of ASCII are by far the common case.
+		if (bytes[i] < 0x80)
+		{
+			if (out)
+				out[written] = bytes[i];
+			++written;
+			++i;
+			continue;
+		}
+
+		char32_t cp = decode_utf8(bytes, len, i);
+		if (cp >= 0x10000)
+		{
+			if (out)
+			{
+				out[written] = static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10));
+				out[written + 1] = static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+			}
+			written += 2;
+		}
+		else
+		{
+			if (out)
+				out[written] = static_cast<char16_t>(cp);
+			++written;
+		}
+	}
+	return written;
+}
+
+size_t utf16_to_utf8(const char16_t* in, size_t len, char* out)
+{
+	size_t written = 0;
+	auto put = [&](uint8_t b) {
+		if (out)
+			out[written] = static_cast<char>(b);
+		++written;
+	};
+
+	for (size_t i = 0; i < len; ++i)
+	{
+		char32_t cp = in[i];
+		if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < len && in[i + 1] >= 0xDC00 && in[i + 1] <= 0xDFFF)
+		{
+			cp = 0x10000 + ((cp - 0xD800) << 10) + (in[i + 1] - 0xDC00);
+			++i;
+		}
+		else if (cp >= 0xD800 && cp <= 0xDFFF)
+		{
+			// Unpaired surrogate.
+			cp = kReplacementCharacter;
+		}
+
+		if (cp < 0x80)
+		{
+			put(static_cast<uint8_t>(cp));
+		}
+		else if (cp < 0x800)
+		{
+			put(static_cast<uint8_t>(0xC0 | (cp >> 6)));
+			put(static_cast<uint8_t>(0x80 | (cp & 0x3F)));
+		}
+		else if (cp < 0x10000)
+		{
+			put(static_cast<uint8_t>(0xE0 | (cp >> 12)));
+			put(static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F)));
+			put(static_cast<uint8_t>(0x80 | (cp & 0x3F)));
+		}
+		else
+		{
+			put(static_cast<uint8_t>(0xF0 | (cp >> 18)));
+			put(static_cast<uint8_t>(0x80 | ((cp >> 12) & 0x3F)));
+			put(static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F)));
+			put(static_cast<uint8_t>(0x80 | (cp & 0x3F)));
+		}
+	}
+	return written;
+}
+
+size_t utf16_strnlen(const char16_t* str, size_t max)
+{
+	size_t len = 0;
+	while (len < max && str[len] != 0)
+		++len;
+	return len;
+}
@@ -0,0 +1,41 @@
+// enchant_windows - UTF-8 and UTF-16 conversion.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+#ifndef ENCHANT_WINDOWS_UTF_H
+#define ENCHANT_WINDOWS_UTF_H
+
+#include <cstddef>
+
+// These follow MultiByteToWideChar/WideCharToMultiByte with CP_UTF8 and no
+// flags, which is what the provider used before it had to build anywhere
+// but Windows: call once with a null output to get the length, then again to
+// convert. Lengths are in code units and nothing is NUL-terminated unless the
+// input was. Malformed input becomes U+FFFD rather than failing.
+
+// Convert 'len' bytes of UTF-8. Returns the number of UTF-16 code units
+// written to 'out', or that would be if 'out' is null.
+size_t utf8_to_utf16(const char* in, size_t len, char16_t* out);
+
+// Convert 'len' UTF-16 code units. Returns the number of bytes written to
+// 'out', or that would be if 'out' is null.
+size_t utf16_to_utf8(const char16_t* in, size_t len, char* out);
+
+// Length of a NUL-terminated UTF-16 string, looking at most 'max' units.
+size_t utf16_strnlen(const char16_t* str, size_t max);
+
+#endif
@@ -1,6 +1,13 @@
 // enchant_windows - an Enchant provider plugin that uses the Windows 8
 //                   spell check API.
 //
+// This file has the parts of the provider core that don't depend on its
+// policies: the dispatcher and string list bookkeeping, and the exported
+// extension functions. The Enchant function tables are the WindowsProvider
+// template in windows_provider.h; the spell checker itself sits behind
+// SpellBackend (spell_backend.h); the plugin entry point in plugin.cpp picks
+// the backend and the policies.
+//
 // Copyright (c) 2015 Brenda Streiff
 //
 // This library is free software; you can redistribute it and/or modify it
@@ -17,540 +24,426 @@
 // along with this library; if not, write to the Free Software Foundation,
 // Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
 
-#include "enchant-provider.h"
+#include "windows_provider.h"
+
+#include "utf.h"
 
-#include <comdef.h>
-#include <future>
-#include <functional>
-#include <memory>
+#include <algorithm>
+#include <chrono>
 #include <mutex>
+#include <stdio.h>
 #include <stdlib.h>
-#include <spellcheck.h>
-#include <thread>
-#include <wtypes.h>
-#include <wrl.h>
+#include <string.h>
 
-// ATL has a wider array of COM smart pointer classes, but isn't available
-// in the Visual Studio Express editions. The WRL ComPtr works for us though.
-using Microsoft::WRL::ComPtr;
+std::unique_ptr<CoThreadDispatcher> WorkerDispatch::dispatcher;
+std::mutex InlineDispatch::mutex;
+
+static std::mutex com_dispatcher_mutex;
+static uint32_t com_dispatcher_refcount(0);
+static CoThreadDispatcher::Executor host_executor(nullptr);
+static void* host_executor_data(nullptr);
 
-ENCHANT_PLUGIN_DECLARE("windows")
+// How long a backend call may run before the worker is given up on.
+static const unsigned long kDefaultWatchdogMs = 10000;
 
-// RAII class to wrap CoIninitalizeEx.
-struct CoInitializer
+static std::chrono::milliseconds watchdog_timeout()
 {
-	CoInitializer() :
-		hr(CoInitializeEx(nullptr, COINIT_MULTITHREADED))
-	{}
-	~CoInitializer() _NOEXCEPT
-	{
-		if (SUCCEEDED(hr))
-			CoUninitialize();
-	}
-	HRESULT hr;
-};
-
-// COM thread dispatcher. We're a DLL, and thus we're not allowed to call
-// CoInitialize* on the application's thread. Larry Osterman has an article:
-// http://blogs.msdn.com/b/larryosterman/archive/2004/05/12/130541.aspx
-// So, punt all COM stuff to a worker thread under our control. This class
-// provides a single-object queue for serializing methods on a worker thread.
-// This could be replaced with a proper queue, but in practice this seems
-// to work well enough.
-class CoThreadDispatcher
-{
-public:
-	CoThreadDispatcher() :
-		running(false),
-		dispatch_thread(std::thread(&CoThreadDispatcher::threadProc, this))
-	{ }
-	~CoThreadDispatcher()
-	{
-		dispatch([&]() { running = false; });
-		dispatch_thread.join();
-	}
+	const char* ms = getenv("ENCHANT_WINDOWS_WATCHDOG_MS");
+	if (!ms || !*ms)
+		return std::chrono::milliseconds(kDefaultWatchdogMs);
+
+	char* end = nullptr;
+	unsigned long value = strtoul(ms, &end, 10);
+	if (*end != '\0')
+		return std::chrono::milliseconds(kDefaultWatchdogMs);
+	return std::chrono::milliseconds(value);
+}
 
-	// Dispatch callable object 'f' on the COM worker thread. Blocks until
-	// f returns.
-	template<typename F>
-	typename std::result_of<F()>::type dispatch(F&& f)
-	{
-		typedef typename std::result_of<F()>::type ResultType;
+// Everything holding backend objects, for the worker that replaces a hung one.
+static std::mutex live_mutex;
+static std::vector<ProviderUserData*> live_providers;
+static std::vector<BackendUser*> live_dicts;
+// Bumped whenever one of them goes.
+static unsigned long long live_generation(0);
 
-		// Package the callable object so we can get a future.
-		std::packaged_task<ResultType(void)> task(std::forward<F>(f));
-		auto result = task.get_future();
+void track_backend_user(ProviderUserData* provider)
+{
+	std::lock_guard<std::mutex> lock(live_mutex);
+	live_providers.push_back(provider);
+}
 
-		{
-			// Acquire the lock so we can queue the work.
-			std::unique_lock<std::mutex> lock(processing_mutex);
-			dispatched_function = [&task]() { task(); };
+void untrack_backend_user(ProviderUserData* provider)
+{
+	std::lock_guard<std::mutex> lock(live_mutex);
+	live_providers.erase(std::remove(live_providers.begin(), live_providers.end(), provider), live_providers.end());
+	++live_generation;
+}
 
-			// Tell the thread to go.
-			dispatch_begin.notify_all();
-		}
+void track_backend_user(BackendUser* dict)
+{
+	std::lock_guard<std::mutex> lock(live_mutex);
+	live_dicts.push_back(dict);
+}
 
-		// Wait for the future to have a result.
-		result.wait();
+void untrack_backend_user(BackendUser* dict)
+{
+	std::lock_guard<std::mutex> lock(live_mutex);
+	live_dicts.erase(std::remove(live_dicts.begin(), live_dicts.end(), dict), live_dicts.end());
+	++live_generation;
+}
 
-		return result.get();
-	}
+// Whether 'user', from the list as it was at 'generation', is still in it.
+template<typename T>
+static bool still_tracked(const std::vector<T*>& live, T* user, unsigned long long generation)
+{
+	std::lock_guard<std::mutex> lock(live_mutex);
+	return generation == live_generation || std::find(live.begin(), live.end(), user) != live.end();
+}
 
-private:
-	void threadProc()
+// Run first thing on the worker that replaces a hung one. The hung call may
+// be inside any backend object made so far, so none of them is touched again:
+// they are leaked, and everything is made anew in the new apartment.
+//
+// Making them can hang too, so the lock is only held to look at the list,
+// and requesting and disposing of dictionaries never waits on the backend.
+// Whatever is disposed of meanwhile is skipped. What it holds is only freed
+// by work queued behind this, so it stays put while this runs; unless the
+// watchdog gives up on this worker as well, and the next one starts over.
+static void recover_backend_users()
+{
+	std::vector<ProviderUserData*> providers;
+	std::vector<BackendUser*> dicts;
+	unsigned long long generation;
 	{
-		std::unique_lock<std::mutex> lock(processing_mutex);
-
-		// Initialize COM in this thread.
-		CoInitializer comInit;
-		// We're good to go.
-		running = true;
-
-		while (running)
-		{
-			// Wait for work.
-			dispatch_begin.wait(lock);
-			// Do the work.
-			dispatched_function();
-		}
+		std::lock_guard<std::mutex> lock(live_mutex);
+		providers = live_providers;
+		dicts = live_dicts;
+		generation = live_generation;
 	}
-	bool running;
-	std::mutex processing_mutex;
-	std::condition_variable dispatch_begin;
-	std::function<void(void)> dispatched_function;
-	std::thread dispatch_thread;
-};
 
-static std::mutex com_dispatcher_mutex;
-static std::unique_ptr<CoThreadDispatcher> com_dispatcher;
-static uint32_t com_dispatcher_refcount(0);
+	for (ProviderUserData* provider : providers)
+	{
+		if (CoThreadDispatcher::replaced())
+			return;
+		if (!still_tracked(live_providers, provider, generation))
+			continue;
+		provider->backend.release();
+		if (provider->create_backend)
+			provider->backend = provider->create_backend();
+	}
+	for (BackendUser* dict : dicts)
+	{
+		if (CoThreadDispatcher::replaced())
+			return;
+		if (still_tracked(live_dicts, dict, generation))
+			dict->recover();
+	}
+}
 
-static void com_dispatcher_addref()
+void WorkerDispatch::addref()
 {
 	std::lock_guard<std::mutex> lock(com_dispatcher_mutex);
 	if (com_dispatcher_refcount == 0)
-		com_dispatcher = std::make_unique<CoThreadDispatcher>();
+	{
+		if (host_executor)
+			dispatcher = std::make_unique<CoThreadDispatcher>(host_executor, host_executor_data);
+		else
+			dispatcher = std::make_unique<CoThreadDispatcher>(watchdog_timeout(), recover_backend_users);
+	}
 	++com_dispatcher_refcount;
 }
 
-static void com_dispatcher_release()
+void WorkerDispatch::release()
 {
 	std::lock_guard<std::mutex> lock(com_dispatcher_mutex);
 	if (com_dispatcher_refcount == 1)
-		com_dispatcher.reset();
+		dispatcher.reset();
 	--com_dispatcher_refcount;
 }
 
-// There is a MAX_WORD_LENGTH constant mentioned in the MSDN documentation
-// for ISpellChecker::Add and AutoCorrect, but it's not actually in a header.
-static const size_t kMaxWordLength = 128;
-static const size_t kMaxUTF8WordLengthInBytes = kMaxWordLength*4;
-
-struct ProviderUserData
-{
-	ComPtr<ISpellCheckerFactory> spellCheckerFactory;
-};
-
-struct DictUserData
+char** allocate_string_list(size_t count, const std::shared_ptr<MemoryAccount>& account)
 {
-	ComPtr<ISpellChecker> spellChecker;
-};
+	const size_t bytes = sizeof(StringListHeader) + (count + 1) * sizeof(char*);
+	char* block = new char[bytes];
+	StringListHeader* header = new (block) StringListHeader();
+	header->account = account;
+	header->bytes = bytes;
+	char** list = reinterpret_cast<char**>(block + sizeof(StringListHeader));
+	for (size_t i = 0; i <= count; ++i)
+		list[i] = nullptr;
+	return list;
+}
 
-static inline ProviderUserData* userdata(EnchantProvider* provider)
+StringListHeader* string_list_header(char** list)
 {
-	return reinterpret_cast<ProviderUserData*>(provider->user_data);
+	return reinterpret_cast<StringListHeader*>(reinterpret_cast<char*>(list) - sizeof(StringListHeader));
 }
 
-static inline DictUserData* userdata(EnchantDict* dict)
+void destroy_string_list(char** list)
 {
-	return reinterpret_cast<DictUserData*>(dict->user_data);
+	for (char** str = list; *str != nullptr; ++str)
+		std::default_delete<char[]>()(*str);
+
+	StringListHeader* header = string_list_header(list);
+	if (header->account)
+		header->account->discharge(ENCHANT_WINDOWS_MEMORY_STRING_ARENA, header->bytes);
+	header->~StringListHeader();
+	delete[] reinterpret_cast<char*>(header);
 }
 
-// Convert a UTF-8 string (from Enchant) to a new UTF-16 string (to pass into Windows API functions.)
-static std::unique_ptr<wchar_t[]> copy_utf8_to_utf16(
-	const char* u8str,
-	size_t len)
+static bool tag_fallback_enabled()
 {
-	if (len > kMaxUTF8WordLengthInBytes)
-		return nullptr;
-
-	int requiredLengthInCharacters = MultiByteToWideChar(CP_UTF8, 0, u8str, static_cast<int>(len), nullptr, 0);
-	auto newString = std::make_unique<wchar_t[]>(requiredLengthInCharacters+1);
-	if (!newString)
-		return nullptr;
-
-	MultiByteToWideChar(CP_UTF8, 0, u8str, static_cast<int>(len), newString.get(), requiredLengthInCharacters);
-	newString[requiredLengthInCharacters] = L'\0';
-	return newString;
+	const char* fallback = getenv("ENCHANT_WINDOWS_TAG_FALLBACK");
+	return !fallback || strcmp(fallback, "0") != 0;
 }
 
-// Convert a UTF-16 (from Windows) to a new UTF-8 string (to give back to Enchant).
-static std::unique_ptr<char[]> copy_utf16_to_utf8(
-	const wchar_t* u16str,
-	size_t len)
+std::unique_ptr<SpellChecker> create_spell_checker_for(SpellBackend& backend, const LanguageTag& tag)
 {
-	if (len > kMaxWordLength)
-		return nullptr;
+	std::unique_ptr<SpellChecker> checker = backend.create_spell_checker(tag.windows.c_str());
+	if (checker || !tag_fallback_enabled())
+		return checker;
 
-	int requiredLengthInCharacters = WideCharToMultiByte(CP_UTF8, 0, u16str, static_cast<int>(len), nullptr, 0, nullptr, nullptr);
-	auto newString = std::make_unique<char[]>(requiredLengthInCharacters+1);
-
-	if (!newString)
-		return nullptr;
-
-	WideCharToMultiByte(CP_UTF8, 0, u16str, static_cast<int>(len), newString.get(), requiredLengthInCharacters, nullptr, nullptr);
-	newString[requiredLengthInCharacters] = '\0';
-	return newString;
+	// Asking first is cheaper than failing to create one.
+	for (LanguageTagId fallback : tag.fallbacks)
+	{
+		const char16_t* windows = language_tag(fallback).windows.c_str();
+		if (backend.is_supported(windows) == 1)
+			return backend.create_spell_checker(windows);
+	}
+	return nullptr;
 }
 
-// Convert an enumerator represented by an IEnumString into a null-terminated vector
-// of null-terminated UTF-8 strings.
-static void copy_string_list_from_enumerator(
-	IEnumString* enumerator,
-	char*** string_list,
-	size_t* count)
+bool has_spell_checker_for(SpellBackend& backend, const LanguageTag& tag)
 {
-	// Count the number of entries.
-	size_t enumCount = 0;
-	while (S_OK == enumerator->Skip(1))
-		++enumCount;
-	enumerator->Reset();
+	if (backend.is_supported(tag.windows.c_str()) == 1)
+		return true;
+	if (!tag_fallback_enabled())
+		return false;
 
-	auto list = std::make_unique<char*[]>(enumCount + 1);
-	auto OleStringDeleter = [](LPOLESTR s) { CoTaskMemFree(s); };
-	for (size_t i = 0; i < enumCount; ++i)
+	for (LanguageTagId fallback : tag.fallbacks)
 	{
-		LPOLESTR nameRaw = nullptr;
-		HRESULT hr = enumerator->Next(1, &nameRaw, nullptr);
-		std::unique_ptr<OLECHAR, decltype(OleStringDeleter)> name(nameRaw, OleStringDeleter);
-
-		if (FAILED(hr))
-			return;
-
-		list[i] = copy_utf16_to_utf8(name.get(), wcsnlen_s(name.get(), kMaxWordLength) + 1).release();
+		if (backend.is_supported(language_tag(fallback).windows.c_str()) == 1)
+			return true;
 	}
-	list[enumCount] = nullptr;
+	return false;
+}
 
-	*string_list = list.release();
-	*count = enumCount;
+size_t default_suggest_max()
+{
+	const char* max = getenv("ENCHANT_WINDOWS_SUGGEST_MAX");
+	const unsigned long n = max ? strtoul(max, nullptr, 10) : 0;
+	return n ? n : SIZE_MAX;
 }
 
-// Enchant tags are of the form "en_US", Windows spellcheck languages are of the form "en-US".
-static std::unique_ptr<wchar_t[]> copy_from_enchant_tag_to_windows_language(const char* tag)
+void report_dict_memory(const DictUserDataBase& dictdata)
 {
-	auto langTag = copy_utf8_to_utf16(tag, strnlen_s(tag, kMaxUTF8WordLengthInBytes)+1);
-	if (!langTag)
-		return nullptr;
+	const char* path = getenv("ENCHANT_WINDOWS_MEMORY_REPORT");
+	if (!path || !*path)
+		return;
 
-	wchar_t* itr = langTag.get();
-	while (*itr != '\0')
+	FILE* out = stderr;
+	if (strcmp(path, "-") != 0)
 	{
-		if (*itr == L'_')
-			*itr = L'-';
-		++itr;
+#ifdef _MSC_VER
+		if (fopen_s(&out, path, "a") != 0)
+			out = nullptr;
+#else
+		out = fopen(path, "a");
+#endif
+		if (!out)
+			return;
 	}
 
-	return langTag;
-}
-
-// Returns 0 if word is correctly spelled, positive if not, negative if error.
-static int windows_dict_check(
-	EnchantDict* dict,
-	const char *const word,
-	size_t len)
-{
-	return com_dispatcher->dispatch([=]() -> int {
-		auto utf16Word = copy_utf8_to_utf16(word, len);
-		if (!utf16Word)
-			return -1;
-
-		ComPtr<IEnumSpellingError> errors;
-		HRESULT hr = userdata(dict)->spellChecker->Check(utf16Word.get(), errors.GetAddressOf());
-		if (FAILED(hr))
-			return -1;
-
-		// A correct 'test' returns an empty (not a null) enumeration.
-		ComPtr<ISpellingError> error;
-		hr = errors->Next(error.GetAddressOf());
-		if (hr == S_OK)
-		{
-			// At least one error.
-			return 1;
-		}
-		else
-		{
-			// No errors.
-			return 0;
-		}
-	});
-}
-
-// Return a vector of strings that are suggestions for a word. Return null
-// if no suggestions are available.
-static char** windows_dict_suggest(
-	EnchantDict* dict,
-	const char *const word,
-	size_t len,
-	size_t* out_n_suggs)
-{
-	return com_dispatcher->dispatch([=]() -> char** {
-		auto utf16Word = copy_utf8_to_utf16(word, len);
-		if (!utf16Word)
-			return nullptr;
-
-		ComPtr<IEnumString> suggestionEnumerator;
-		HRESULT hr = userdata(dict)->spellChecker->Suggest(utf16Word.get(), suggestionEnumerator.GetAddressOf());
-
-		if (FAILED(hr))
-			return nullptr;
-
-		// If we returned S_FALSE, the word was spelled correctly and there are no suggestions.
-		if (hr == S_FALSE)
-			return nullptr;
-
-		char** suggestions = nullptr;
-		copy_string_list_from_enumerator(suggestionEnumerator.Get(), &suggestions, out_n_suggs);
-		return suggestions;
-	});
-}
-
-// Add a word to the user's personal dictionary.
-static void windows_dict_add_to_personal(
-	EnchantDict* dict,
-	const char *const word,
-	size_t len)
-{
-	com_dispatcher->dispatch([=]() -> void {
-		auto utf16Word = copy_utf8_to_utf16(word, len);
-		if (!utf16Word)
-			return;
+	EnchantWindowsDictMemory usage;
+	dictdata.memory->snapshot(usage);
+	fprintf(out, "enchant_windows: dict %s: total %zu bytes (peak %zu)", dictdata.tag.c_str(), usage.total_bytes, usage.peak_total_bytes);
+	for (int i = 0; i < ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT; ++i)
+		fprintf(out, ", %s %zu (peak %zu)", enchant_windows_memory_category_name(i), usage.current_bytes[i], usage.peak_bytes[i]);
+	fputc('\n', out);
 
-		HRESULT hr = userdata(dict)->spellChecker->Add(utf16Word.get());
-		if (FAILED(hr))
-			return;
-	});
+	if (out != stderr)
+		fclose(out);
 }
 
-// Store a replacement for a particular spelling.
-static void windows_dict_store_replacement(
-	EnchantDict* dict,
-	const char* const mis,
-	size_t mis_len,
-	const char* const cor,
-	size_t cor_len)
-{
-	com_dispatcher->dispatch([=]() -> void {
-		auto from = copy_utf8_to_utf16(mis, mis_len);
-		if (!from)
-			return;
-
-		auto to = copy_utf8_to_utf16(cor, cor_len);
-		if (!to)
-			return;
+static std::mutex dict_checks_mutex;
+static std::vector<WindowsDictCheckFn> dict_checks;
 
-		HRESULT hr = userdata(dict)->spellChecker->AutoCorrect(from.get(), to.get());
-		if (FAILED(hr))
-			return;
-	});
+void register_dict_check(WindowsDictCheckFn check)
+{
+	std::lock_guard<std::mutex> lock(dict_checks_mutex);
+	if (std::find(dict_checks.begin(), dict_checks.end(), check) == dict_checks.end())
+		dict_checks.push_back(check);
 }
 
-// Add a word to the user's exclusion list.
-static void windows_dict_add_to_exclude(
-	EnchantDict* dict,
-	const char* const word,
-	size_t len)
+bool is_provider_dict(EnchantDict* dict)
 {
-	com_dispatcher->dispatch([=]() -> void {
-		auto utf16Word = copy_utf8_to_utf16(word, len);
-		if (!utf16Word)
-			return;
-
-		HRESULT hr = userdata(dict)->spellChecker->Ignore(utf16Word.get());
-		if (FAILED(hr))
-			return;
-	});
+	std::lock_guard<std::mutex> lock(dict_checks_mutex);
+	return dict->user_data &&
+		std::find(dict_checks.begin(), dict_checks.end(), dict->check) != dict_checks.end();
 }
 
-// Request dictionary with language tag (such as 'en_US').
-static EnchantDict* windows_provider_request_dict(
-	EnchantProvider* provider,
-	const char* const tag)
-{
-	return com_dispatcher->dispatch([=]() -> EnchantDict* {
-		if (!userdata(provider)->spellCheckerFactory)
-			return nullptr;
+const char* windows_provider_identify(EnchantProvider* provider) _NOEXCEPT
+{
+	return "windows";
+}
 
-		auto wtag = copy_from_enchant_tag_to_windows_language(tag);
-		if (!wtag)
-			return nullptr;
+const char* windows_provider_describe(EnchantProvider* self) _NOEXCEPT
+{
+	return "Windows Provider";
+}
 
-		auto dict = std::make_unique<EnchantDict>();
-		dict->check = windows_dict_check;
-		dict->suggest = windows_dict_suggest;
-		dict->add_to_personal = windows_dict_add_to_personal;
-		dict->add_to_session = nullptr;
-		dict->store_replacement = windows_dict_store_replacement;
-		dict->add_to_exclude = windows_dict_add_to_exclude;
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-		auto dictdata = std::make_unique<DictUserData>();
+ENCHANT_MODULE_EXPORT(int) enchant_windows_set_executor(EnchantWindowsExecutorFn executor, void* data)
+{
+	// The dispatcher keeps the executor it was made with.
+	std::lock_guard<std::mutex> lock(com_dispatcher_mutex);
+	if (com_dispatcher_refcount != 0)
+		return -1;
 
-		HRESULT hr = userdata(provider)->spellCheckerFactory->CreateSpellChecker(wtag.get(), dictdata->spellChecker.GetAddressOf());
-		if (FAILED(hr))
-			return nullptr;
+	host_executor = executor;
+	host_executor_data = data;
+	return 0;
+}
 
-		dict->user_data = dictdata.release();
+ENCHANT_MODULE_EXPORT(int) enchant_windows_dict_memory_usage(EnchantDict* dict, EnchantWindowsDictMemory* out)
+{
+	EpochGuard guard;
+	if (!dict || !out || !is_provider_dict(dict))
+		return -1;
 
-		return dict.release();
-	});
+	reinterpret_cast<DictUserDataBase*>(dict->user_data)->memory->snapshot(*out);
+	return 0;
 }
 
-// Destroy an EnchantDict.
-static void windows_provider_dispose_dict(
-	EnchantProvider* provider,
-	EnchantDict* dict)
+ENCHANT_MODULE_EXPORT(const char*) enchant_windows_memory_category_name(int category)
 {
-	com_dispatcher->dispatch([=]() -> void {
-		if (dict->user_data)
-		{
-			delete userdata(dict);
-		}
-		delete dict;
-	});
+	static const char* const names[ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT] = {
+		"dict_state",
+		"backend_handle",
+		"cache",
+		"filter",
+		"user_words",
+		"string_arena",
+	};
+	if (category < 0 || category >= ENCHANT_WINDOWS_MEMORY_CATEGORY_COUNT)
+		return nullptr;
+	return names[category];
 }
 
-// List all dictionary tags that are available from this provider.
-static char** windows_provider_list_dicts(
-	EnchantProvider* provider,
-	size_t* out_n_dicts)
+ENCHANT_MODULE_EXPORT(int) enchant_windows_dict_stats(EnchantDict* dict, EnchantWindowsDictStats* out)
 {
-	return com_dispatcher->dispatch([=]() -> char** {
-		if (!userdata(provider)->spellCheckerFactory)
-			return nullptr;
-
-		ComPtr<IEnumString> langEnumerator;
-		HRESULT hr = userdata(provider)->spellCheckerFactory->get_SupportedLanguages(langEnumerator.GetAddressOf());
-		if (FAILED(hr))
-			return nullptr;
+	EpochGuard guard;
+	if (!dict || !out || !is_provider_dict(dict))
+		return -1;
 
-		char** langs = nullptr;
-		copy_string_list_from_enumerator(langEnumerator.Get(), &langs, out_n_dicts);
-		return langs;
-	});
+	return reinterpret_cast<DictUserDataBase*>(dict->user_data)->stats(*out) ? 0 : -1;
 }
 
-// Return whether or not a dictionary with a particular tag exists.
-static int windows_provider_dictionary_exists(
-	EnchantProvider* provider,
-	const char* const tag)
+ENCHANT_MODULE_EXPORT(const char*) enchant_windows_stat_name(int stat)
 {
-	return com_dispatcher->dispatch([=]() -> int {
-		if (!userdata(provider)->spellCheckerFactory)
-			return -1;
+	static const char* const names[ENCHANT_WINDOWS_STAT_COUNT] = {
+		"check",
+		"misspelled",
+		"cache_hit",
+		"suggest",
+		"add_to_personal",
+		"add_to_exclude",
+		"store_replacement",
+		"reload",
+	};
+	if (stat < 0 || stat >= ENCHANT_WINDOWS_STAT_COUNT)
+		return nullptr;
+	return names[stat];
+}
 
-		auto wtag = copy_from_enchant_tag_to_windows_language(tag);
-		if (!wtag)
-			return -1;
+ENCHANT_MODULE_EXPORT(int) enchant_windows_dict_reload(EnchantDict* dict)
+{
+	EpochGuard guard;
+	if (!dict || !is_provider_dict(dict))
+		return -1;
 
-		BOOL isSupported = FALSE;
-		userdata(provider)->spellCheckerFactory->IsSupported(wtag.get(), &isSupported);
-		return (isSupported != FALSE);
-	});
+	return reinterpret_cast<DictUserDataBase*>(dict->user_data)->reload();
 }
 
-// Free a string list returned by windows_dict_suggest or windows_provider_list_dicts.
-// The list and the items within were allocated with make_unique, so use the same
-// deleter.
-static void windows_provider_free_string_list(
-	EnchantProvider* provider,
-	char** str_list)
+ENCHANT_MODULE_EXPORT(int) enchant_windows_dict_wait_for_reload(EnchantDict* dict)
 {
-	com_dispatcher->dispatch([=]() -> void {
-		if (str_list)
-		{
-			char** str = str_list;
-			while (*str != nullptr)
-			{
-				std::default_delete<char[]>()(*str);
-				++str;
-			}
-			std::default_delete<char*[]>()(str_list);
-		}
-	});
-}
-
-// Dispose a provider.
-//
-// Also decrements (and possibly destroys) the COM thread.
-static void windows_provider_dispose(EnchantProvider* provider)
-{
-	com_dispatcher->dispatch([=]() -> void {
-		if (provider->user_data)
-		{
-			ProviderUserData* providerdata = reinterpret_cast<ProviderUserData*>(provider->user_data);
-			delete providerdata;
-		}
-		delete provider;
-	});
+	EpochGuard guard;
+	if (!dict || !is_provider_dict(dict))
+		return -1;
 
-	// One less provider using the dispatcher.
-	com_dispatcher_release();
+	return reinterpret_cast<DictUserDataBase*>(dict->user_data)->wait_for_reload();
 }
 
-
-static const char* windows_provider_identify(EnchantProvider* provider) _NOEXCEPT
+ENCHANT_MODULE_EXPORT(int) enchant_windows_dict_check_async(EnchantDict* dict, const char* word, size_t len, void* cookie)
 {
-	return "windows";
+	EpochGuard guard;
+	if (!dict || !word || !is_provider_dict(dict))
+		return -1;
+
+	return reinterpret_cast<DictUserDataBase*>(dict->user_data)->check_async(dict, word, len, cookie);
 }
 
-static const char* windows_provider_describe(EnchantProvider* self) _NOEXCEPT
+ENCHANT_MODULE_EXPORT(char**) enchant_windows_dict_suggest_max(EnchantDict* dict, const char* word, size_t len, size_t max, size_t* out_n_suggs)
 {
-	return "Windows Provider";
-}
+	EpochGuard guard;
+	if (!dict || !word || !out_n_suggs || !is_provider_dict(dict))
+		return nullptr;
 
-#ifdef __cplusplus
-extern "C" {
-#endif
+	return reinterpret_cast<DictUserDataBase*>(dict->user_data)->suggest(dict, word, len, max, out_n_suggs);
+}
 
-// Create a new provider. Can also create the COM thread.
-__declspec(dllexport) EnchantProvider* init_enchant_provider() _NOEXCEPT
+ENCHANT_MODULE_EXPORT(char**) enchant_windows_dict_complete(EnchantDict* dict, const char* prefix, size_t len, size_t max, size_t* out_n_words)
 {
-	// We're creating a dispatcher.
-	com_dispatcher_addref();
-
-	auto newProvider = com_dispatcher->dispatch([&]() -> EnchantProvider* {
+	EpochGuard guard;
+	if (!dict || !prefix || !out_n_words || !is_provider_dict(dict))
+		return nullptr;
 
-		auto provider = std::make_unique<EnchantProvider>();
-		provider->dispose = windows_provider_dispose;
-		provider->request_dict = windows_provider_request_dict;
-		provider->dispose_dict = windows_provider_dispose_dict;
-		provider->dictionary_exists = windows_provider_dictionary_exists;
-		provider->identify = windows_provider_identify;
-		provider->describe = windows_provider_describe;
-		provider->list_dicts = windows_provider_list_dicts;
-		provider->free_string_list = windows_provider_free_string_list;
+	// No backend call, so no trip to the worker.
+	SlowCallScope scope(ENCHANT_WINDOWS_OP_COMPLETE);
+	DictUserDataBase* dictdata = reinterpret_cast<DictUserDataBase*>(dict->user_data);
+	thread_local std::vector<std::string> words;
+	if (dictdata->completion.complete(prefix, len, max, words) == 0)
+	{
+		scope.done(dictdata->tag.c_str(), prefix, len);
+		return nullptr;
+	}
 
-		auto userdata = std::make_unique<ProviderUserData>();
+	char** list = allocate_string_list(words.size(), dictdata->memory);
+	StringListHeader* header = string_list_header(list);
+	for (size_t i = 0; i < words.size(); ++i)
+	{
+		list[i] = new char[words[i].size() + 1];
+		memcpy(list[i], words[i].c_str(), words[i].size() + 1);
+		header->bytes += words[i].size() + 1;
+	}
+	dictdata->memory->charge(ENCHANT_WINDOWS_MEMORY_STRING_ARENA, header->bytes);
 
-		HRESULT hr = CoCreateInstance(
-			__uuidof(SpellCheckerFactory),
-			nullptr,
-			CLSCTX_INPROC_SERVER,
-			__uuidof(ISpellCheckerFactory),
-			reinterpret_cast<PVOID*>(userdata->spellCheckerFactory.GetAddressOf()));
+	*out_n_words = words.size();
+	scope.done(dictdata->tag.c_str(), prefix, len);
+	return list;
+}
 
-		provider->user_data = userdata.release();
+ENCHANT_MODULE_EXPORT(EnchantDict*) enchant_windows_request_dict_async(EnchantProvider* provider, const char* tag, void* cookie)
+{
+	if (!provider || !tag || provider->identify != windows_provider_identify || !provider->user_data)
+		return nullptr;
 
-		return provider.release();
-	});
+	ProviderUserData* providerdata = reinterpret_cast<ProviderUserData*>(provider->user_data);
+	return providerdata->request_dict_async(provider, tag, cookie);
+}
 
-	// We tried, but didn't get a new provider.
-	if (!newProvider)
-		com_dispatcher_release();
+ENCHANT_MODULE_EXPORT(int) enchant_windows_dict_load_state(EnchantDict* dict)
+{
+	EpochGuard guard;
+	if (!dict || !is_provider_dict(dict))
+		return -1;
 
-	return newProvider;
+	return reinterpret_cast<DictUserDataBase*>(dict->user_data)->loadState;
 }
 
 #ifdef __cplusplus
 }
 #endif
-
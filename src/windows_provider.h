@@ -0,0 +1,1194 @@
+// enchant_windows - provider core.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#ifndef ENCHANT_WINDOWS_PROVIDER_H
+#define ENCHANT_WINDOWS_PROVIDER_H
+
+#include "compat.h"
+#include "completion_index.h"
+#include "completion_queue.h"
+#include "edit_journal.h"
+#include "enchant-provider.h"
+#include "enchant-windows.h"
+#include "epoch.h"
+#include "language_tags.h"
+#include "memory_accounting.h"
+#include "provider_policies.h"
+#include "slow_call_log.h"
+#include "spell_backend.h"
+#include "typo_table.h"
+#include "unicode_script.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The Enchant function tables and what they share, as a template over the
+// policies in provider_policies.h. windows_provider.cpp has the parts that
+// don't depend on them.
+
+// There is a MAX_WORD_LENGTH constant mentioned in the MSDN documentation
+// for ISpellChecker::Add and AutoCorrect, but it's not actually in a header.
+static const size_t kMaxWordLength = 128;
+static const size_t kMaxUTF8WordLengthInBytes = kMaxWordLength*4;
+// Canonicalizing shortens UTF-8 by at most this much (U+2019 to an
+// apostrophe, or U+0390 from its three code points), so anything longer
+// can't be a word once canonical either.
+static const size_t kMaxCanonicalShrink = 3;
+
+struct ProviderUserData
+{
+	std::unique_ptr<SpellBackend> backend;
+	// Kept so dictionaries can build fresh backends when reloaded.
+	SpellBackendFactory create_backend;
+	// For enchant_windows_request_dict_async, which isn't in the provider's
+	// function table.
+	EnchantDict* (*request_dict_async)(EnchantProvider* provider, const char* tag, void* cookie);
+};
+
+// Something holding backend objects that a worker replacing a hung one has
+// to make anew; see track_backend_user.
+struct BackendUser
+{
+	virtual ~BackendUser() {}
+
+	// Make a new spell checker in place of one a hung call may be inside
+	// of. Called where backend calls run.
+	virtual void recover() = 0;
+};
+
+// What every dictionary has, whatever its policies; the exports only see this.
+struct DictUserDataBase : BackendUser
+{
+	DictUserDataBase() : loadState(ENCHANT_WINDOWS_DICT_READY), scripts(kAllScripts) {}
+	virtual ~DictUserDataBase() {}
+
+	// Fill 'out' if statistics are kept.
+	virtual bool stats(EnchantWindowsDictStats& out) const = 0;
+
+	// Start building a replacement spell checker, and wait for the last
+	// one started to be in use; see enchant_windows_dict_reload.
+	virtual int reload() = 0;
+	virtual int wait_for_reload() = 0;
+
+	// Queue a check whose result is posted as a completion; see
+	// enchant_windows_dict_check_async.
+	virtual int check_async(EnchantDict* dict, const char* word, size_t len, void* cookie) = 0;
+
+	// Up to 'max' suggestions, 0 for the dictionary's default; see
+	// enchant_windows_dict_suggest_max.
+	virtual char** suggest(EnchantDict* dict, const char* word, size_t len, size_t max, size_t* out_n_suggs) = 0;
+
+	// ENCHANT_WINDOWS_DICT_READY, _LOADING or _FAILED.
+	std::atomic<int> loadState;
+
+	std::string tag;
+	// 'tag', resolved; spell checkers are made for it or its fallbacks.
+	LanguageTagRef language;
+	// What the language is written in (unicode_script.h).
+	ScriptSet scripts;
+	// Shared with any suggestion lists still out, which credit it when freed.
+	std::shared_ptr<MemoryAccount> memory;
+	// Kept without the backend, which can't list its words.
+	CompletionIndex completion;
+};
+
+// String lists handed to Enchant are charged to the dictionary that produced
+// them until they come back through free_string_list, which is only given the
+// list. So each list is preceded by a header naming the account to credit.
+struct StringListHeader
+{
+	std::shared_ptr<MemoryAccount> account;
+	size_t bytes;
+};
+
+// A list of 'count' null entries plus the terminator, charged to 'account'
+// (if any) only once the caller adds the strings' bytes and charges it.
+char** allocate_string_list(size_t count, const std::shared_ptr<MemoryAccount>& account);
+StringListHeader* string_list_header(char** list);
+
+// Free a list from allocate_string_list and the strings in it, crediting
+// the account it was charged to.
+void destroy_string_list(char** list);
+
+// A spell checker from 'backend' for 'language', or if it has none, for the
+// first of the language's fallbacks that it has (language_tags.h). Only the
+// language itself is tried if ENCHANT_WINDOWS_TAG_FALLBACK is 0. Null if
+// there is none.
+std::unique_ptr<SpellChecker> create_spell_checker_for(SpellBackend& backend, const LanguageTag& language);
+
+// Whether create_spell_checker_for would find one. Errors count as not.
+bool has_spell_checker_for(SpellBackend& backend, const LanguageTag& language);
+
+// How many suggestions a dictionary returns unless asked for some other
+// number: ENCHANT_WINDOWS_SUGGEST_MAX, or all of them if that is unset or 0.
+size_t default_suggest_max();
+
+// If ENCHANT_WINDOWS_MEMORY_REPORT names a file ("-" for stderr), append a
+// line with the dictionary's memory use to it.
+void report_dict_memory(const DictUserDataBase& dictdata);
+
+// The exports accept a dictionary only if its check function belongs to a
+// provider created in this module.
+typedef int (*WindowsDictCheckFn)(EnchantDict*, const char* const, size_t);
+void register_dict_check(WindowsDictCheckFn check);
+bool is_provider_dict(EnchantDict* dict);
+
+// Providers and dictionaries, the plugin's and the embedding API's, are
+// tracked from creation to disposal, so a worker replacing one that hung can
+// make their backend objects anew. Providers are recovered first.
+void track_backend_user(ProviderUserData* provider);
+void untrack_backend_user(ProviderUserData* provider);
+void track_backend_user(BackendUser* dict);
+void untrack_backend_user(BackendUser* dict);
+
+const char* windows_provider_identify(EnchantProvider* provider) _NOEXCEPT;
+const char* windows_provider_describe(EnchantProvider* self) _NOEXCEPT;
+
+template<class Policies>
+class WindowsProvider
+{
+public:
+	typedef typename Policies::Dispatch Dispatch;
+	typedef typename Policies::Cache Cache;
+	typedef typename Policies::Conversion Conversion;
+	typedef typename Policies::Instrumentation Instrumentation;
+	typedef typename Policies::Canonicalization Canonicalization;
+
+	// Create a new provider. Can also create the COM thread.
+	static EnchantProvider* create(const SpellBackendFactory& create_backend) _NOEXCEPT
+	{
+		configure_slow_call_log();
+
+		// We're creating a dispatcher.
+		Dispatch::addref();
+
+		auto newProvider = Dispatch::dispatch([&]() -> EnchantProvider* {
+
+			auto provider = std::make_unique<EnchantProvider>();
+			provider->dispose = dispose;
+			provider->request_dict = request_dict;
+			provider->dispose_dict = dispose_dict;
+			provider->dictionary_exists = dictionary_exists;
+			provider->identify = windows_provider_identify;
+			provider->describe = windows_provider_describe;
+			provider->list_dicts = list_dicts;
+			provider->free_string_list = free_string_list;
+
+			auto userdata = std::make_unique<ProviderUserData>();
+
+			// A provider without a backend still loads; it just has no dictionaries.
+			userdata->backend = create_backend();
+			userdata->create_backend = create_backend;
+			userdata->request_dict_async = request_dict_async;
+			track_backend_user(userdata.get());
+
+			provider->user_data = userdata.release();
+
+			return provider.release();
+		});
+
+		// We tried, but didn't get a new provider.
+		if (!newProvider)
+		{
+			Dispatch::release();
+			return nullptr;
+		}
+
+		register_dict_check(dict_check);
+		return newProvider;
+	}
+
+private:
+	// Something done to a dictionary's spell checker that a replacement
+	// needs done again.
+	struct SessionEdit
+	{
+		enum Kind { Add, Ignore, AutoCorrect } kind;
+		std::u16string word;
+		std::u16string replacement;
+	};
+
+	// An asynchronous check waiting for the spell checker to load.
+	struct DeferredCheck
+	{
+		EnchantDict* dict;
+		void* cookie;
+		std::u16string word;
+	};
+
+	struct DictUserData : DictUserDataBase
+	{
+		DictUserData() : caseRules(), suggestMax(SIZE_MAX), typos(nullptr), onLoaded(nullptr), loadCookie(nullptr), flushQueued(false), recoveredEdits(0), reloadResult(-1) {}
+
+		bool stats(EnchantWindowsDictStats& out) const override
+		{
+			return Instrumentation::snapshot(counters, out);
+		}
+
+		// Read-copy-update, with the dispatcher as the only reader side: the
+		// replacement backend and spell checker are built on a thread of
+		// their own, while checks carry on against the current ones, and
+		// published by a swap that runs where backend calls run, so none is
+		// ever in flight on what it replaces. That thread then releases the
+		// old ones, keeping their teardown off the dispatcher as well.
+		int reload() override
+		{
+			std::lock_guard<std::mutex> lock(reloadMutex);
+			if (reloadThread.joinable())
+				reloadThread.join();
+
+			reloadResult = -1;
+			reloadThread = std::thread([this]() {
+				SlowCallScope scope(ENCHANT_WINDOWS_OP_RELOAD);
+				// COM objects made here must be gone before COM is uninitialized.
+				CoInitializer comInit;
+				std::unique_ptr<SpellBackend> backend = createBackend ? createBackend() : nullptr;
+				std::unique_ptr<SpellChecker> checker;
+				if (backend)
+					checker = create_spell_checker_for(*backend, *language);
+				if (!checker)
+				{
+					// A dictionary still loading has nothing to fall back on.
+					Dispatch::dispatch([&]() -> void {
+						if (loadState == ENCHANT_WINDOWS_DICT_LOADING)
+							loadState = ENCHANT_WINDOWS_DICT_FAILED;
+						finish_deferred_checks();
+					});
+					scope.done(tag.c_str());
+					reloadResult = 1;
+					loaded(-1);
+					return;
+				}
+
+				Dispatch::dispatch([&]() -> void {
+					for (const auto& edit : session)
+						apply(*checker, edit);
+					spellChecker.swap(checker);
+					reloadedBackend.swap(backend);
+					Cache::invalidate(cache);
+					recovered_applied();
+					loadState = ENCHANT_WINDOWS_DICT_READY;
+					finish_deferred_checks();
+				});
+				Instrumentation::count(counters, ENCHANT_WINDOWS_STAT_RELOAD);
+				scope.done(tag.c_str());
+				reloadResult = 0;
+				loaded(0);
+
+				checker.reset();
+				backend.reset();
+			});
+			return 0;
+		}
+
+		int wait_for_reload() override
+		{
+			std::lock_guard<std::mutex> lock(reloadMutex);
+			if (reloadThread.joinable())
+				reloadThread.join();
+			return reloadResult;
+		}
+
+		int check_async(EnchantDict* dict, const char* word, size_t len, void* cookie) override
+		{
+			return dict_check_async(dict, word, len, cookie);
+		}
+
+		char** suggest(EnchantDict* dict, const char* word, size_t len, size_t max, size_t* out_n_suggs) override
+		{
+			return dict_suggest_up_to(dict, word, len, max ? max : suggestMax, out_n_suggs);
+		}
+
+		// The old spell checker and backend are leaked, since the hung call
+		// may still be using them. A dictionary still loading is left to
+		// its load. If the hung call was flush_edits, its batch is recorded
+		// here instead, and so made on the new spell checker with the rest.
+		void recover() override
+		{
+			std::shared_ptr<std::vector<SessionEdit>> batch;
+			{
+				std::lock_guard<std::mutex> lock(editMutex);
+				batch.swap(flushing);
+			}
+			size_t journaled = 0;
+			for (size_t i = 0; batch && i < batch->size(); ++i)
+			{
+				if ((*batch)[i].kind != SessionEdit::Ignore)
+					++journaled;
+				record((*batch)[i]);
+			}
+
+			if (spellChecker)
+			{
+				spellChecker.release();
+				reloadedBackend.release();
+				reloadedBackend = createBackend ? createBackend() : nullptr;
+				if (reloadedBackend)
+					spellChecker = create_spell_checker_for(*reloadedBackend, *language);
+				if (!spellChecker)
+				{
+					// Left in the journal for the next process.
+					loadState = ENCHANT_WINDOWS_DICT_FAILED;
+					return;
+				}
+				for (const auto& edit : session)
+					apply(*spellChecker, edit);
+				Cache::invalidate(cache);
+			}
+			if (journal && journaled)
+				journal->applied(journaled);
+		}
+
+		// Answer for a check while there is no spell checker: words added or
+		// ignored meanwhile are known to be correct, and everything else
+		// has to wait. Called where backend calls run.
+		int check_unloaded(const char16_t* word) const
+		{
+			if (loadState == ENCHANT_WINDOWS_DICT_FAILED)
+				return -1;
+			for (const auto& edit : session)
+			{
+				if (edit.kind != SessionEdit::AutoCorrect && edit.word == word)
+					return 0;
+			}
+			return ENCHANT_WINDOWS_CHECK_PENDING;
+		}
+
+		// Complete asynchronous checks held back until the spell checker
+		// was loaded, or failed to. Called where backend calls run.
+		void finish_deferred_checks()
+		{
+			for (const auto& check : deferredChecks)
+			{
+				int result = spellChecker ? spellChecker->check(check.word.c_str()) : -1;
+				if (result > 0)
+					Instrumentation::count(counters, ENCHANT_WINDOWS_STAT_MISSPELLED);
+				post_completion({ check.dict, check.cookie, result });
+			}
+			deferredChecks.clear();
+			deferredChecks.shrink_to_fit();
+		}
+
+		// Tell whoever asked for an asynchronous load how it went, once.
+		// Called on the reload thread.
+		void loaded(int result)
+		{
+			if (onLoaded)
+				post_completion({ onLoaded, loadCookie, result });
+			onLoaded = nullptr;
+		}
+
+		// Queue 'edit' to be made behind everything dispatched so far.
+		// Edits queued before the last batch starts go with it.
+		void queue_edit(SessionEdit edit)
+		{
+			bool startFlush = false;
+			{
+				std::lock_guard<std::mutex> lock(editMutex);
+				pendingEdits.push_back(std::move(edit));
+				startFlush = !flushQueued;
+				flushQueued = true;
+			}
+			if (startFlush)
+				Dispatch::post([this]() { flush_edits(); });
+		}
+
+		// Make the queued edits as one batch, then tell the journal they
+		// have been. Called where backend calls run. Once the watchdog has
+		// given up on it, the batch is recover's, so nothing is recorded or
+		// acknowledged here.
+		void flush_edits()
+		{
+			auto batch = std::make_shared<std::vector<SessionEdit>>();
+			{
+				std::lock_guard<std::mutex> lock(editMutex);
+				batch->swap(pendingEdits);
+				flushQueued = false;
+				flushing = batch;
+			}
+
+			if (spellChecker)
+			{
+				for (const auto& edit : *batch)
+					apply(*spellChecker, edit);
+			}
+			if (!Dispatch::claim())
+				return;
+			{
+				std::lock_guard<std::mutex> lock(editMutex);
+				flushing.reset();
+			}
+
+			size_t journaled = 0;
+			for (auto& edit : *batch)
+			{
+				if (edit.kind != SessionEdit::Ignore)
+					++journaled;
+				record(std::move(edit));
+			}
+			if (journal)
+				journal->applied(journaled);
+		}
+
+		// Once a spell checker has had the session applied, the edits
+		// recovered from the journal into it have been made.
+		void recovered_applied()
+		{
+			if (journal && recoveredEdits)
+				journal->applied(recoveredEdits);
+			recoveredEdits = 0;
+		}
+
+		// Called where backend calls run.
+		void record(SessionEdit edit)
+		{
+			memory->charge(ENCHANT_WINDOWS_MEMORY_USER_WORDS,
+				sizeof(SessionEdit) + (edit.word.size() + edit.replacement.size()) * sizeof(char16_t));
+			session.push_back(std::move(edit));
+		}
+
+		// Set once the dictionary has been reloaded: where 'spellChecker'
+		// came from, which has to outlive it.
+		std::unique_ptr<SpellBackend> reloadedBackend;
+		std::unique_ptr<SpellChecker> spellChecker;
+		typename Cache::State cache;
+		CaseRules caseRules;
+		// Suggestions returned by dict_suggest.
+		size_t suggestMax;
+		// Common typos for the language, if there is a table for it.
+		const TypoTable* typos;
+		typename Instrumentation::State counters;
+
+		// Words added and ignored and replacements stored on this dictionary.
+		std::vector<SessionEdit> session;
+		std::vector<DeferredCheck> deferredChecks;
+		// The dictionary to post a completion for once loaded, if any.
+		EnchantDict* onLoaded;
+		void* loadCookie;
+
+		// Edits made but not yet passed on to the backend.
+		std::mutex editMutex;
+		std::vector<SessionEdit> pendingEdits;
+		bool flushQueued;
+		// The batch flush_edits is making, for recover should the watchdog
+		// give up on it.
+		std::shared_ptr<std::vector<SessionEdit>> flushing;
+		std::shared_ptr<EditJournal> journal;
+		// Edits in 'session' that came from the journal, until the spell
+		// checker has them.
+		size_t recoveredEdits;
+		SpellBackendFactory createBackend;
+		std::mutex reloadMutex;
+		std::thread reloadThread;
+		// For wait_for_reload: 0 if the last reload was published, 1 if it
+		// failed, -1 if there was none.
+		int reloadResult;
+	};
+
+	static void apply(SpellChecker& checker, const SessionEdit& edit)
+	{
+		switch (edit.kind)
+		{
+		case SessionEdit::Add: checker.add(edit.word.c_str()); break;
+		case SessionEdit::Ignore: checker.ignore(edit.word.c_str()); break;
+		case SessionEdit::AutoCorrect: checker.auto_correct(edit.word.c_str(), edit.replacement.c_str()); break;
+		}
+	}
+
+	static inline ProviderUserData* userdata(EnchantProvider* provider)
+	{
+		return reinterpret_cast<ProviderUserData*>(provider->user_data);
+	}
+
+	static inline DictUserData* userdata(EnchantDict* dict)
+	{
+		return static_cast<DictUserData*>(reinterpret_cast<DictUserDataBase*>(dict->user_data));
+	}
+
+	// Convert a UTF-8 string (from Enchant) to a new UTF-16 string (to pass into the backend.)
+	static std::unique_ptr<char16_t[]> copy_utf8_to_utf16(
+		const char* u8str,
+		size_t len)
+	{
+		if (len > kMaxUTF8WordLengthInBytes)
+			return nullptr;
+
+		size_t requiredLengthInCharacters = Conversion::to_utf16(u8str, len, nullptr);
+		auto newString = std::make_unique<char16_t[]>(requiredLengthInCharacters+1);
+		if (!newString)
+			return nullptr;
+
+		Conversion::to_utf16(u8str, len, newString.get());
+		newString[requiredLengthInCharacters] = 0;
+		return newString;
+	}
+
+	// Convert a UTF-16 (from the backend) to a new UTF-8 string (to give back to Enchant).
+	// If 'allocatedBytes' is given, it receives the size of the new buffer.
+	static std::unique_ptr<char[]> copy_utf16_to_utf8(
+		const char16_t* u16str,
+		size_t len,
+		size_t* allocatedBytes = nullptr)
+	{
+		if (len > kMaxWordLength)
+			return nullptr;
+
+		size_t requiredLengthInCharacters = Conversion::to_utf8(u16str, len, nullptr);
+		auto newString = std::make_unique<char[]>(requiredLengthInCharacters+1);
+
+		if (!newString)
+			return nullptr;
+
+		Conversion::to_utf8(u16str, len, newString.get());
+		newString[requiredLengthInCharacters] = '\0';
+		if (allocatedBytes)
+			*allocatedBytes = requiredLengthInCharacters + 1;
+		return newString;
+	}
+
+	// The strings from a StringEnumerator. Strings too long to be words are left out.
+	// Nothing more is pulled from the enumerator once there are 'max'. If 'first' is
+	// given it leads the list, and isn't repeated if the enumerator, which may then be
+	// null, has it too.
+	static std::unique_ptr<std::vector<std::u16string>> read_string_list(
+		StringEnumerator* enumerator,
+		size_t max = SIZE_MAX,
+		const std::u16string* first = nullptr)
+	{
+		auto entries = std::make_unique<std::vector<std::u16string>>();
+		if (first && max > 0)
+			entries->push_back(*first);
+		std::u16string entry;
+		while (entries->size() < max && enumerator && enumerator->next(entry))
+		{
+			if (entry.size() <= kMaxWordLength && !(first && entry == *first))
+				entries->push_back(std::move(entry));
+		}
+		return entries;
+	}
+
+	// Convert strings from read_string_list into a null-terminated vector of
+	// null-terminated UTF-8 strings. If 'account' is given, the list is charged to it.
+	static char** copy_string_list(
+		const std::vector<std::u16string>& entries,
+		size_t* count,
+		const std::shared_ptr<MemoryAccount>& account = nullptr)
+	{
+		char** list = allocate_string_list(entries.size(), account);
+		StringListHeader* header = string_list_header(list);
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			size_t stringBytes = 0;
+			list[i] = copy_utf16_to_utf8(entries[i].c_str(), entries[i].size(), &stringBytes).release();
+			header->bytes += stringBytes;
+		}
+
+		if (account)
+			account->charge(ENCHANT_WINDOWS_MEMORY_STRING_ARENA, header->bytes);
+
+		*count = entries.size();
+		return list;
+	}
+
+	// 'word' canonical, or null if it is too long to be a word. What could
+	// never come within the limit is turned away before it is read, so no
+	// call costs more than the longest word does.
+	static const char* canonical_word(const char* word, size_t& len, typename Canonicalization::Buffer& buffer)
+	{
+		if (len > kMaxUTF8WordLengthInBytes * kMaxCanonicalShrink)
+			return nullptr;
+		const char* canonical = Canonicalization::canonical(word, len, buffer);
+		return len <= kMaxUTF8WordLengthInBytes ? canonical : nullptr;
+	}
+
+	// Whether 'word' is written only in scripts the dictionary's language
+	// isn't (Han or emoji in an English dictionary). The backend has nothing
+	// to judge such a word by, so it is taken as correct without asking.
+	static bool outside_language(const DictUserData* dictdata, const char* word, size_t len)
+	{
+		return dictdata->scripts != kAllScripts && outside_scripts(word_scripts(word, len), dictdata->scripts);
+	}
+
+	// A cached verdict for 'word', or for it capitalized differently.
+	static bool cached_verdict(DictUserData* dictdata, const char* word, size_t len, int& result)
+	{
+		return Cache::lookup(dictdata->cache, word, len, result) ||
+			Cache::lookup_case_variant(dictdata->cache, word, len, dictdata->caseRules, result);
+	}
+
+	// Returns 0 if word is correctly spelled, positive if not, negative if error.
+	static int dict_check(
+		EnchantDict* dict,
+		const char *const word,
+		size_t len)
+	{
+		EpochGuard guard;
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_CHECK);
+		DictUserData* dictdata = userdata(dict);
+		Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_CHECK);
+		typename Canonicalization::Buffer buffer;
+		size_t canonicalLen = len;
+		const char* canonicalWord = canonical_word(word, canonicalLen, buffer);
+
+		int result = 0;
+		if (!canonicalWord)
+		{
+			result = -1;
+		}
+		else if (cached_verdict(dictdata, canonicalWord, canonicalLen, result))
+		{
+			Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_CACHE_HIT);
+		}
+		else if (outside_language(dictdata, canonicalWord, canonicalLen))
+		{
+			result = 0;
+		}
+		else
+		{
+			size_t generation = Cache::generation(dictdata->cache);
+			result = Dispatch::dispatch([=]() -> int {
+				auto utf16Word = copy_utf8_to_utf16(canonicalWord, canonicalLen);
+				if (!utf16Word)
+					return -1;
+
+				if (!dictdata->spellChecker)
+					return dictdata->check_unloaded(utf16Word.get());
+				return dictdata->spellChecker->check(utf16Word.get());
+			});
+			// Nothing is kept for a check still pending, or one that hung.
+			if (result >= 0)
+				Cache::store(dictdata->cache, generation, canonicalWord, canonicalLen, result);
+		}
+
+		if (result > 0)
+			Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_MISSPELLED);
+		scope.done(dictdata->tag.c_str(), word, len);
+		return result;
+	}
+
+	// dict_check without waiting: the result goes to the completion queue.
+	// The word is copied, since the caller's buffer may be gone by the time
+	// the check runs. A check that hangs completes with an error.
+	static int dict_check_async(
+		EnchantDict* dict,
+		const char* word,
+		size_t len,
+		void* cookie)
+	{
+		EpochGuard guard;
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_CHECK_ASYNC);
+		DictUserData* dictdata = userdata(dict);
+		queue_check(dict, dictdata, word, len, cookie);
+		scope.done(dictdata->tag.c_str(), word, len);
+		return 0;
+	}
+
+	// The check for dict_check_async, or its result if it needn't go to the
+	// backend.
+	static void queue_check(
+		EnchantDict* dict,
+		DictUserData* dictdata,
+		const char* word,
+		size_t len,
+		void* cookie)
+	{
+		Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_CHECK);
+		typename Canonicalization::Buffer buffer;
+		size_t canonicalLen = len;
+		const char* canonicalWord = canonical_word(word, canonicalLen, buffer);
+		if (!canonicalWord)
+		{
+			post_completion({ dict, cookie, -1 });
+			return;
+		}
+
+		int result = 0;
+		if (cached_verdict(dictdata, canonicalWord, canonicalLen, result))
+		{
+			Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_CACHE_HIT);
+			if (result > 0)
+				Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_MISSPELLED);
+			post_completion({ dict, cookie, result });
+			return;
+		}
+		if (outside_language(dictdata, canonicalWord, canonicalLen))
+		{
+			post_completion({ dict, cookie, 0 });
+			return;
+		}
+
+		size_t generation = Cache::generation(dictdata->cache);
+		Dispatch::post([=, copy = std::string(canonicalWord, canonicalLen)]() -> void {
+			int checked = -1;
+			auto utf16Word = copy_utf8_to_utf16(copy.data(), copy.size());
+			if (utf16Word && !dictdata->spellChecker)
+			{
+				checked = dictdata->check_unloaded(utf16Word.get());
+				if (checked == ENCHANT_WINDOWS_CHECK_PENDING)
+				{
+					if (!Dispatch::claim())
+						return;
+					dictdata->deferredChecks.push_back({ dict, cookie, utf16Word.get() });
+					return;
+				}
+			}
+			else if (utf16Word)
+				checked = dictdata->spellChecker->check(utf16Word.get());
+			if (!Dispatch::claim())
+				return;
+			Cache::store(dictdata->cache, generation, copy.data(), copy.size(), checked);
+			if (checked > 0)
+				Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_MISSPELLED);
+			post_completion({ dict, cookie, checked });
+		}, [=]() -> void {
+			post_completion({ dict, cookie, -1 });
+		});
+	}
+
+	// Return a vector of strings that are suggestions for a word. Return null
+	// if no suggestions are available.
+	static char** dict_suggest(
+		EnchantDict* dict,
+		const char *const word,
+		size_t len,
+		size_t* out_n_suggs)
+	{
+		return dict_suggest_up_to(dict, word, len, userdata(dict)->suggestMax, out_n_suggs);
+	}
+
+	// dict_suggest, stopping once there are 'max' suggestions. The backend
+	// ranks them, best first, so these are the best 'max'. A common typo's
+	// correction ranks ahead of them all, and if that is the one suggestion
+	// wanted, the backend isn't asked.
+	static char** dict_suggest_up_to(
+		EnchantDict* dict,
+		const char *const word,
+		size_t len,
+		size_t max,
+		size_t* out_n_suggs)
+	{
+		EpochGuard guard;
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_SUGGEST);
+		DictUserData* dictdata = userdata(dict);
+		Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_SUGGEST);
+		typename Canonicalization::Buffer buffer;
+		size_t canonicalLen = len;
+		const char* canonicalWord = canonical_word(word, canonicalLen, buffer);
+		if (!canonicalWord || outside_language(dictdata, canonicalWord, canonicalLen))
+		{
+			scope.done(dictdata->tag.c_str(), word, len);
+			return nullptr;
+		}
+
+		std::u16string correction;
+		std::string correctionUtf8;
+		if (correct_typo(dictdata->typos, canonicalWord, canonicalLen, dictdata->caseRules, correctionUtf8))
+		{
+			auto utf16Correction = copy_utf8_to_utf16(correctionUtf8.data(), correctionUtf8.size());
+			if (utf16Correction)
+				correction = utf16Correction.get();
+		}
+
+		// The list is made here rather than where the backend is called, so
+		// a call the watchdog has given up on, which may return after this
+		// one has, never writes to the caller or charges the dictionary.
+		std::unique_ptr<std::vector<std::u16string>> entries;
+		if (!correction.empty() && max <= 1)
+		{
+			entries = read_string_list(nullptr, max, &correction);
+		}
+		else
+		{
+			entries = Dispatch::dispatch([=]() -> std::unique_ptr<std::vector<std::u16string>> {
+				const std::u16string* first = correction.empty() ? nullptr : &correction;
+				auto utf16Word = copy_utf8_to_utf16(canonicalWord, canonicalLen);
+				if (!utf16Word)
+					return nullptr;
+
+				// While loading there is still the correction, if any.
+				std::unique_ptr<std::vector<std::u16string>> entries;
+				if (!dictdata->spellChecker)
+				{
+					if (first)
+						entries = read_string_list(nullptr, max, first);
+				}
+				// Null if the word was spelled correctly and there are no suggestions.
+				else if (auto suggestionEnumerator = dictdata->spellChecker->suggest(utf16Word.get()))
+				{
+					entries = read_string_list(suggestionEnumerator.get(), max, first);
+				}
+				if (!Dispatch::claim())
+					return nullptr;
+				return entries;
+			});
+		}
+		char** suggestions = entries ? copy_string_list(*entries, out_n_suggs, dictdata->memory) : nullptr;
+		scope.done(dictdata->tag.c_str(), word, len);
+		return suggestions;
+	}
+
+	// Add a word to the user's personal dictionary. This and the other
+	// changes below are write-behind: journaled and queued for the backend,
+	// and the caller is done. Checks still see them, since they are queued
+	// ahead of any check made afterwards.
+	static void dict_add_to_personal(
+		EnchantDict* dict,
+		const char *const word,
+		size_t len)
+	{
+		EpochGuard guard;
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_ADD_TO_PERSONAL);
+		DictUserData* dictdata = userdata(dict);
+		Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_ADD_TO_PERSONAL);
+		typename Canonicalization::Buffer buffer;
+		size_t canonicalLen = len;
+		const char* canonicalWord = canonical_word(word, canonicalLen, buffer);
+		auto utf16Word = canonicalWord ? copy_utf8_to_utf16(canonicalWord, canonicalLen) : nullptr;
+		if (!utf16Word)
+			return;
+
+		if (dictdata->journal)
+			dictdata->journal->append(EditJournal::Add, canonicalWord, canonicalLen);
+		dictdata->queue_edit({ SessionEdit::Add, utf16Word.get(), std::u16string() });
+		dictdata->completion.add(canonicalWord, canonicalLen);
+		Cache::invalidate(dictdata->cache);
+		scope.done(dictdata->tag.c_str(), word, len);
+	}
+
+	// Store a replacement for a particular spelling.
+	static void dict_store_replacement(
+		EnchantDict* dict,
+		const char* const mis,
+		size_t mis_len,
+		const char* const cor,
+		size_t cor_len)
+	{
+		EpochGuard guard;
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_STORE_REPLACEMENT);
+		DictUserData* dictdata = userdata(dict);
+		Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_STORE_REPLACEMENT);
+		// The misspelling is matched against checked words, so it takes
+		// their form; the correction is the user's text and is kept as is.
+		typename Canonicalization::Buffer buffer;
+		size_t canonicalLen = mis_len;
+		const char* canonicalMis = canonical_word(mis, canonicalLen, buffer);
+		auto from = canonicalMis ? copy_utf8_to_utf16(canonicalMis, canonicalLen) : nullptr;
+		if (!from)
+			return;
+
+		auto to = copy_utf8_to_utf16(cor, cor_len);
+		if (!to)
+			return;
+
+		if (dictdata->journal)
+			dictdata->journal->append(EditJournal::AutoCorrect, canonicalMis, canonicalLen, cor, cor_len);
+		dictdata->queue_edit({ SessionEdit::AutoCorrect, from.get(), to.get() });
+		Cache::invalidate(dictdata->cache);
+		scope.done(dictdata->tag.c_str(), mis, mis_len);
+	}
+
+	// Add a word to the user's exclusion list. Ignoring only lasts the
+	// session, so there is nothing to journal.
+	static void dict_add_to_exclude(
+		EnchantDict* dict,
+		const char* const word,
+		size_t len)
+	{
+		EpochGuard guard;
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_ADD_TO_EXCLUDE);
+		DictUserData* dictdata = userdata(dict);
+		Instrumentation::count(dictdata->counters, ENCHANT_WINDOWS_STAT_ADD_TO_EXCLUDE);
+		typename Canonicalization::Buffer buffer;
+		size_t canonicalLen = len;
+		const char* canonicalWord = canonical_word(word, canonicalLen, buffer);
+		auto utf16Word = canonicalWord ? copy_utf8_to_utf16(canonicalWord, canonicalLen) : nullptr;
+		if (!utf16Word)
+			return;
+
+		dictdata->queue_edit({ SessionEdit::Ignore, utf16Word.get(), std::u16string() });
+		dictdata->completion.exclude(canonicalWord, canonicalLen);
+		Cache::invalidate(dictdata->cache);
+		scope.done(dictdata->tag.c_str(), word, len);
+	}
+
+	// Request dictionary with language tag (such as 'en_US').
+	static EnchantDict* request_dict(
+		EnchantProvider* provider,
+		const char* const tag)
+	{
+		// Opt-in, since Enchant callers don't expect checks to come back
+		// pending.
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_REQUEST_DICT);
+		const char* asyncLoad = getenv("ENCHANT_WINDOWS_ASYNC_LOAD");
+		if (asyncLoad && strcmp(asyncLoad, "1") == 0)
+		{
+			EnchantDict* dict = start_loading(provider, tag, false, nullptr);
+			scope.done(tag);
+			return dict;
+		}
+
+		const LanguageTagRef language = resolve_language_tag(tag);
+		EnchantDict* requested = !language ? nullptr : Dispatch::dispatch([=]() -> EnchantDict* {
+			if (!userdata(provider)->backend)
+				return nullptr;
+
+			auto spellChecker = create_spell_checker_for(*userdata(provider)->backend, *language);
+			if (!spellChecker)
+				return nullptr;
+
+			// A call given up on would make a dictionary no one gets.
+			if (!Dispatch::claim())
+				return nullptr;
+			EnchantDict* dict = new_dict(provider, tag, language);
+			DictUserData* dictdata = userdata(dict);
+			for (const auto& edit : dictdata->session)
+				apply(*spellChecker, edit);
+			dictdata->spellChecker = std::move(spellChecker);
+			dictdata->recovered_applied();
+			return dict;
+		});
+		scope.done(tag);
+		return requested;
+	}
+
+	// See enchant_windows_request_dict_async.
+	static EnchantDict* request_dict_async(
+		EnchantProvider* provider,
+		const char* tag,
+		void* cookie)
+	{
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_REQUEST_DICT_ASYNC);
+		EnchantDict* dict = start_loading(provider, tag, true, cookie);
+		scope.done(tag);
+		return dict;
+	}
+
+	// A dictionary whose spell checker is built on a thread of its own, the
+	// way a reload builds its replacement, so the caller needn't wait. Each
+	// has its own thread and backend, so several load at once.
+	static EnchantDict* start_loading(
+		EnchantProvider* provider,
+		const char* tag,
+		bool notify,
+		void* cookie)
+	{
+		// Asking is cheap, and unlike loading it keeps Enchant from taking
+		// this provider for one that has the language.
+		if (!userdata(provider)->create_backend || dictionary_exists(provider, tag) != 1)
+			return nullptr;
+
+		EnchantDict* dict = new_dict(provider, tag, resolve_language_tag(tag));
+		DictUserData* dictdata = userdata(dict);
+		dictdata->loadState = ENCHANT_WINDOWS_DICT_LOADING;
+		if (notify)
+		{
+			dictdata->onLoaded = dict;
+			dictdata->loadCookie = cookie;
+		}
+		dictdata->reload();
+		return dict;
+	}
+
+	// An EnchantDict for 'tag', resolved as 'language', without a spell
+	// checker.
+	static EnchantDict* new_dict(
+		EnchantProvider* provider,
+		const char* tag,
+		const LanguageTagRef& language)
+	{
+		auto dict = std::make_unique<EnchantDict>();
+		dict->check = dict_check;
+		dict->suggest = dict_suggest;
+		dict->add_to_personal = dict_add_to_personal;
+		dict->add_to_session = nullptr;
+		dict->store_replacement = dict_store_replacement;
+		dict->add_to_exclude = dict_add_to_exclude;
+
+		auto dictdata = std::make_unique<DictUserData>();
+		dictdata->tag = tag;
+		dictdata->language = language;
+		dictdata->caseRules = case_rules_for(*language);
+		dictdata->suggestMax = default_suggest_max();
+		dictdata->typos = typo_table_for(*language);
+		dictdata->scripts = dictionary_scripts(language->bcp47);
+		dictdata->createBackend = userdata(provider)->create_backend;
+		dictdata->memory = std::make_shared<MemoryAccount>();
+		dictdata->memory->charge(ENCHANT_WINDOWS_MEMORY_DICT_STATE,
+			sizeof(EnchantDict) + sizeof(DictUserData) - sizeof(dictdata->spellChecker) - sizeof(dictdata->reloadedBackend) +
+			dictdata->tag.capacity() + 1 + sizeof(MemoryAccount));
+		dictdata->memory->charge(ENCHANT_WINDOWS_MEMORY_BACKEND_HANDLE, sizeof(dictdata->spellChecker) + sizeof(dictdata->reloadedBackend));
+		dictdata->memory->charge(ENCHANT_WINDOWS_MEMORY_CACHE, Cache::bytes(dictdata->cache));
+		dictdata->completion.configure(language, dictdata->caseRules, dictdata->memory);
+		dictdata->completion.start_loading();
+
+		// Changes a previous process made but the backend never got.
+		dictdata->journal = EditJournal::open(language->enchant);
+		if (dictdata->journal)
+		{
+			for (const auto& entry : dictdata->journal->take_recovered())
+			{
+				++dictdata->recoveredEdits;
+				auto word = copy_utf8_to_utf16(entry.word.data(), entry.word.size());
+				auto replacement = copy_utf8_to_utf16(entry.replacement.data(), entry.replacement.size());
+				if (word && replacement)
+					dictdata->record({ entry.kind == EditJournal::Add ? SessionEdit::Add : SessionEdit::AutoCorrect, word.get(), replacement.get() });
+				if (entry.kind == EditJournal::Add)
+					dictdata->completion.add(entry.word.data(), entry.word.size());
+			}
+		}
+
+		track_backend_user(dictdata.get());
+		dict->user_data = static_cast<DictUserDataBase*>(dictdata.release());
+		return dict.release();
+	}
+
+	// Destroy an EnchantDict.
+	static void dispose_dict(
+		EnchantProvider* provider,
+		EnchantDict* dict)
+	{
+		// A reload still going needs the dispatcher to finish.
+		if (dict->user_data)
+		{
+			userdata(dict)->wait_for_reload();
+			untrack_backend_user(userdata(dict));
+		}
+
+		// Backend objects go where they were made. The rest may still be
+		// in use by calls on other threads, which read the cache and
+		// counters without the dispatcher, so it is freed once they have
+		// all returned.
+		Dispatch::dispatch([=]() -> void {
+			if (dict->user_data)
+			{
+				report_dict_memory(*userdata(dict));
+				userdata(dict)->spellChecker.reset();
+				userdata(dict)->reloadedBackend.reset();
+			}
+		});
+		epoch_retire(dict, destroy_dict);
+	}
+
+	static void destroy_dict(void* p)
+	{
+		EnchantDict* dict = static_cast<EnchantDict*>(p);
+		if (dict->user_data)
+			delete userdata(dict);
+		delete dict;
+	}
+
+	// List all dictionary tags that are available from this provider.
+	static char** list_dicts(
+		EnchantProvider* provider,
+		size_t* out_n_dicts)
+	{
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_LIST_DICTS);
+		// Made into a list here, as dict_suggest_up_to does.
+		auto langs = Dispatch::dispatch([=]() -> std::unique_ptr<std::vector<std::u16string>> {
+			if (!userdata(provider)->backend)
+				return nullptr;
+
+			auto langEnumerator = userdata(provider)->backend->supported_languages();
+			if (!langEnumerator)
+				return nullptr;
+
+			auto entries = read_string_list(langEnumerator.get());
+			if (!Dispatch::claim())
+				return nullptr;
+			return entries;
+		});
+		char** dicts = langs ? copy_string_list(*langs, out_n_dicts) : nullptr;
+		scope.done(nullptr);
+		return dicts;
+	}
+
+	// Return whether or not a dictionary with a particular tag exists.
+	static int dictionary_exists(
+		EnchantProvider* provider,
+		const char* const tag)
+	{
+		SlowCallScope scope(ENCHANT_WINDOWS_OP_DICTIONARY_EXISTS);
+		const LanguageTagRef language = resolve_language_tag(tag);
+		int exists = !language ? 0 : Dispatch::dispatch([=]() -> int {
+			if (!userdata(provider)->backend)
+				return -1;
+
+			// Errors count as unsupported, as they always have.
+			return has_spell_checker_for(*userdata(provider)->backend, *language);
+		});
+		scope.done(tag);
+		return exists;
+	}
+
+	// Free a string list returned by dict_suggest or list_dicts.
+	// The list came from allocate_string_list and the items within were allocated with
+	// make_unique; destroy_string_list undoes both. Nothing in it belongs to the backend,
+	// so it is freed on the caller's thread rather than waiting behind backend calls.
+	static void free_string_list(
+		EnchantProvider* provider,
+		char** str_list)
+	{
+		if (str_list)
+			destroy_string_list(str_list);
+	}
+
+	// Dispose a provider.
+	//
+	// Also decrements (and possibly destroys) the COM thread.
+	static void dispose(EnchantProvider* provider)
+	{
+		// Free dictionaries still waiting on readers, before the module
+		// can go away.
+		epoch_barrier();
+
+		if (provider->user_data)
+			untrack_backend_user(userdata(provider));
+		Dispatch::dispatch([=]() -> void {
+			if (provider->user_data)
+			{
+				ProviderUserData* providerdata = reinterpret_cast<ProviderUserData*>(provider->user_data);
+				delete providerdata;
+			}
+			delete provider;
+		});
+
+		// One less provider using the dispatcher.
+		Dispatch::release();
+		report_slow_calls();
+	}
+};
+
+// Create a provider whose dictionaries come from the backend made by
+// 'create_backend'. The factory runs wherever Policies::Dispatch runs backend
+// calls (for the default, the provider's worker thread). Returns null on
+// failure.
+template<class Policies>
+EnchantProvider* windows_provider_create(const SpellBackendFactory& create_backend) _NOEXCEPT
+{
+	return WindowsProvider<Policies>::create(create_backend);
+}
+
+#endif
@@ -0,0 +1,413 @@
+// enchant_windows - SpellBackend over plain word lists.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#include "wordlist_spell_backend.h"
+
+#include "utf.h"
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdlib.h>
+#include <unordered_set>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+// Words and user changes for one language, shared by all of its checkers
+// the way the Windows user dictionary is.
+struct WordListLanguage
+{
+	std::unordered_set<std::u16string> words;
+	std::unordered_set<std::u16string> personal;
+	std::map<std::u16string, std::u16string> autocorrect;
+	// Every character used in 'words'; suggestions are built from these.
+	std::u16string alphabet;
+};
+
+static std::u16string to_utf16(const std::string& str)
+{
+	std::u16string out(utf8_to_utf16(str.data(), str.size(), nullptr), 0);
+	if (!out.empty())
+		utf8_to_utf16(str.data(), str.size(), &out[0]);
+	return out;
+}
+
+static std::string to_utf8(const std::u16string& str)
+{
+	std::string out(utf16_to_utf8(str.data(), str.size(), nullptr), '\0');
+	if (!out.empty())
+		utf16_to_utf8(str.data(), str.size(), &out[0]);
+	return out;
+}
+
+// "en_US" -> "en-US", and the reverse for file names.
+static std::string windows_tag(std::string tag)
+{
+	std::replace(tag.begin(), tag.end(), '_', '-');
+	return tag;
+}
+
+static std::string file_tag(std::string tag)
+{
+	std::replace(tag.begin(), tag.end(), '-', '_');
+	return tag;
+}
+
+// Lowercase ASCII and Latin-1 letters, which covers the capitalized forms
+// of most words in the languages these lists are for.
+static char16_t to_lower(char16_t c)
+{
+	if ((c >= 'A' && c <= 'Z') || (c >= 0xC0 && c <= 0xDE && c != 0xD7))
+		return static_cast<char16_t>(c + 0x20);
+	return c;
+}
+
+static std::u16string to_lower(std::u16string word)
+{
+	for (auto& c : word)
+		c = to_lower(c);
+	return word;
+}
+
+static void finish_language(WordListLanguage& language)
+{
+	std::set<char16_t> alphabet;
+	for (const auto& word : language.words)
+		alphabet.insert(word.begin(), word.end());
+	language.alphabet.assign(alphabet.begin(), alphabet.end());
+}
+
+// Read a .dic file: one word per line, with anything from a '/' on being
+// hunspell affix flags. A first line that is only a number is hunspell's
+// word count.
+static std::shared_ptr<WordListLanguage> load_language(const std::string& path)
+{
+	std::ifstream in(path, std::ios::binary);
+	if (!in)
+		return nullptr;
+
+	auto language = std::make_shared<WordListLanguage>();
+	std::string line;
+	bool first = true;
+	while (std::getline(in, line))
+	{
+		line = line.substr(0, line.find('/'));
+		while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t'))
+			line.pop_back();
+		if (first)
+		{
+			first = false;
+			if (!line.empty() && line.find_first_not_of("0123456789") == std::string::npos)
+				continue;
+		}
+		if (!line.empty())
+			language->words.insert(to_utf16(line));
+	}
+	finish_language(*language);
+	return language;
+}
+
+class WordListStringEnumerator : public StringEnumerator
+{
+public:
+	explicit WordListStringEnumerator(std::vector<std::u16string>&& strings) :
+		strings(std::move(strings)),
+		position(0)
+	{}
+
+	bool next(std::u16string& out) override
+	{
+		if (position >= strings.size())
+			return false;
+		out = strings[position++];
+		return true;
+	}
+
+private:
+	std::vector<std::u16string> strings;
+	size_t position;
+};
+
+class WordListSpellChecker : public SpellChecker
+{
+public:
+	explicit WordListSpellChecker(const std::shared_ptr<WordListLanguage>& language) :
+		language(language)
+	{}
+
+	int check(const char16_t* word) override
+	{
+		return is_correct(word) ? 0 : 1;
+	}
+
+	std::unique_ptr<StringEnumerator> suggest(const char16_t* word) override
+	{
+		const std::u16string misspelled(word);
+		if (is_correct(misspelled))
+			return nullptr;
+
+		std::vector<std::u16string> suggestions;
+		std::unordered_set<std::u16string> seen;
+		auto consider = [&](const std::u16string& candidate) {
+			if (known(candidate) && seen.insert(candidate).second)
+				suggestions.push_back(candidate);
+		};
+
+		auto replacement = language->autocorrect.find(misspelled);
+		if (replacement != language->autocorrect.end())
+		{
+			seen.insert(replacement->second);
+			suggestions.push_back(replacement->second);
+		}
+
+		// Everything one edit away: deletions, transpositions, replacements
+		// and insertions, in that order.
+		std::u16string candidate;
+		for (size_t i = 0; i < misspelled.size(); ++i)
+		{
+			candidate = misspelled;
+			candidate.erase(i, 1);
+			consider(candidate);
+		}
+		for (size_t i = 0; i + 1 < misspelled.size(); ++i)
+		{
+			candidate = misspelled;
+			std::swap(candidate[i], candidate[i + 1]);
+			consider(candidate);
+		}
+		for (size_t i = 0; i < misspelled.size(); ++i)
+		{
+			for (char16_t c : language->alphabet)
+			{
+				if (c == misspelled[i])
+					continue;
+				candidate = misspelled;
+				candidate[i] = c;
+				consider(candidate);
+			}
+		}
+		for (size_t i = 0; i <= misspelled.size(); ++i)
+		{
+			for (char16_t c : language->alphabet)
+			{
+				candidate = misspelled;
+				candidate.insert(candidate.begin() + i, c);
+				consider(candidate);
+			}
+		}
+
+		return std::make_unique<WordListStringEnumerator>(std::move(suggestions));
+	}
+
+	bool add(const char16_t* word) override
+	{
+		language->personal.insert(word);
+		return true;
+	}
+
+	bool ignore(const char16_t* word) override
+	{
+		ignored.insert(word);
+		return true;
+	}
+
+	bool auto_correct(const char16_t* from, const char16_t* to) override
+	{
+		language->autocorrect[from] = to;
+		return true;
+	}
+
+private:
+	bool known(const std::u16string& word) const
+	{
+		return language->words.count(word) || language->personal.count(word);
+	}
+
+	bool is_correct(const std::u16string& word) const
+	{
+		if (word.empty() || ignored.count(word))
+			return true;
+		if (language->autocorrect.count(word))
+			return false;
+		if (known(word))
+			return true;
+
+		// "The" and "THE" are fine if "the" is.
+		std::u16string lower = to_lower(word);
+		return lower != word && known(lower);
+	}
+
+	std::shared_ptr<WordListLanguage> language;
+	std::unordered_set<std::u16string> ignored;
+};
+
+WordListSpellBackend::WordListSpellBackend(const std::vector<std::string>& directories) :
+	directories(directories)
+{
+}
+
+WordListSpellBackend::~WordListSpellBackend()
+{
+}
+
+void WordListSpellBackend::add_language(const std::string& tag, const std::vector<std::string>& words)
+{
+	auto language = std::make_shared<WordListLanguage>();
+	for (const auto& word : words)
+		language->words.insert(to_utf16(word));
+	finish_language(*language);
+	languages[windows_tag(tag)] = language;
+}
+
+std::string WordListSpellBackend::find_file(const std::string& tag) const
+{
+	for (const auto& directory : directories)
+	{
+		std::string path = directory + "/" + file_tag(tag) + ".dic";
+		if (std::ifstream(path))
+			return path;
+	}
+	return std::string();
+}
+
+// Names of the .dic files in 'directory', without the extension.
+static std::vector<std::string> list_dic_files(const std::string& directory)
+{
+	static const std::string kExtension = ".dic";
+	std::vector<std::string> names;
+	auto add = [&](const std::string& name) {
+		if (name.size() > kExtension.size() &&
+			name.compare(name.size() - kExtension.size(), kExtension.size(), kExtension) == 0)
+			names.push_back(name.substr(0, name.size() - kExtension.size()));
+	};
+
+#ifdef _WIN32
+	WIN32_FIND_DATAA data;
+	HANDLE find = FindFirstFileA((directory + "\\*.dic").c_str(), &data);
+	if (find == INVALID_HANDLE_VALUE)
+		return names;
+	do
+	{
+		add(data.cFileName);
+	} while (FindNextFileA(find, &data));
+	FindClose(find);
+#else
+	DIR* dir = opendir(directory.c_str());
+	if (!dir)
+		return names;
+	while (dirent* entry = readdir(dir))
+		add(entry->d_name);
+	closedir(dir);
+#endif
+	return names;
+}
+
+std::unique_ptr<StringEnumerator> WordListSpellBackend::supported_languages()
+{
+	std::set<std::string> tags;
+	for (const auto& language : languages)
+		tags.insert(language.first);
+	for (const auto& directory : directories)
+	{
+		for (const auto& name : list_dic_files(directory))
+			tags.insert(windows_tag(name));
+	}
+
+	std::vector<std::u16string> strings;
+	for (const auto& tag : tags)
+		strings.push_back(to_utf16(tag));
+	return std::make_unique<WordListStringEnumerator>(std::move(strings));
+}
+
+int WordListSpellBackend::is_supported(const char16_t* tag)
+{
+	const std::string key = windows_tag(to_utf8(tag));
+	if (languages.count(key))
+		return 1;
+	return find_file(key).empty() ? 0 : 1;
+}
+
+std::unique_ptr<SpellChecker> WordListSpellBackend::create_spell_checker(const char16_t* tag)
+{
+	const std::string key = windows_tag(to_utf8(tag));
+	auto& language = languages[key];
+	if (!language)
+	{
+		std::string path = find_file(key);
+		if (!path.empty())
+			language = load_language(path);
+	}
+	if (!language)
+	{
+		languages.erase(key);
+		return nullptr;
+	}
+	return std::make_unique<WordListSpellChecker>(language);
+}
+
+// The directories in 'path', separated by ';' on Windows and ':' elsewhere.
+static std::vector<std::string> split_search_path(const char* path)
+{
+#ifdef _WIN32
+	const char separator = ';';
+#else
+	const char separator = ':';
+#endif
+	std::vector<std::string> directories;
+	std::istringstream in(path);
+	std::string directory;
+	while (std::getline(in, directory, separator))
+	{
+		if (!directory.empty())
+			directories.push_back(directory);
+	}
+	return directories;
+}
+
+std::vector<std::string> wordlist_search_path()
+{
+	const char* path = getenv("ENCHANT_WINDOWS_WORDLIST_PATH");
+	if (path && *path)
+		return split_search_path(path);
+
+	std::vector<std::string> directories;
+	directories.push_back("/usr/share/hunspell");
+	directories.push_back("/usr/share/myspell");
+	directories.push_back("/usr/share/myspell/dicts");
+	return directories;
+}
+
+std::vector<std::string> search_path_or_wordlists(const char* variable)
+{
+	const char* path = getenv(variable);
+	if (!path || !*path)
+		return wordlist_search_path();
+	return split_search_path(path);
+}
+
+std::unique_ptr<SpellBackend> create_wordlist_spell_backend()
+{
+	return std::make_unique<WordListSpellBackend>(wordlist_search_path());
+}
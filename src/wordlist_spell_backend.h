@@ -0,0 +1,74 @@
+// enchant_windows - SpellBackend over plain word lists.
+//
+// Copyright (c) 2015 Brenda Streiff
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 2.1 of the License, or (at
+// your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+#ifndef ENCHANT_WINDOWS_WORDLIST_SPELL_BACKEND_H
+#define ENCHANT_WINDOWS_WORDLIST_SPELL_BACKEND_H
+
+#include "spell_backend.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+struct WordListLanguage;
+
+// A backend for where the Windows spell checker isn't: each language is a
+// set of words, read from '<tag>.dic' (e.g. "en_US.dic") in one of the
+// search directories. Hunspell .dic files work, as their affix flags and
+// leading word count are skipped, but affixes are not expanded. Files are
+// expected to be UTF-8.
+//
+// Added words live as long as the backend; unlike the Windows user
+// dictionary they aren't saved anywhere.
+class WordListSpellBackend : public SpellBackend
+{
+public:
+	explicit WordListSpellBackend(const std::vector<std::string>& directories);
+	~WordListSpellBackend();
+
+	// Make 'tag' (either "en_US" or "en-US") available with 'words' (UTF-8),
+	// in place of any file for it.
+	void add_language(const std::string& tag, const std::vector<std::string>& words);
+
+	std::unique_ptr<StringEnumerator> supported_languages() override;
+	int is_supported(const char16_t* tag) override;
+	std::unique_ptr<SpellChecker> create_spell_checker(const char16_t* tag) override;
+
+private:
+	std::string find_file(const std::string& tag) const;
+
+	std::vector<std::string> directories;
+	// Keyed by Windows form tag; loaded on first use.
+	std::map<std::string, std::shared_ptr<WordListLanguage>> languages;
+};
+
+// The search directories: those in ENCHANT_WINDOWS_WORDLIST_PATH if it's set
+// (separated by ';' on Windows and ':' elsewhere), else where distributions
+// install hunspell and myspell dictionaries.
+std::vector<std::string> wordlist_search_path();
+
+// The directories in the environment variable 'variable', split the same
+// way, or else wordlist_search_path(): for data kept beside the word lists
+// unless put somewhere else.
+std::vector<std::string> search_path_or_wordlists(const char* variable);
+
+// A WordListSpellBackend over wordlist_search_path().
+std::unique_ptr<SpellBackend> create_wordlist_spell_backend();
+
+#endif
@@ -0,0 +1,384 @@
+#!/usr/bin/env python3
+# enchant_windows - builds '<tag>.ngram' language models from text.
+#
+# Copyright (c) 2015 Brenda Streiff
+#
+# This library is free software; you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation; either version 2.1 of the License, or (at
+# your option) any later version.
+#
+# This library is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+# License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library; if not, write to the Free Software Foundation,
+# Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+# Counts the word 1-, 2- and 3-grams of a corpus, a sentence or more per
+# line, and writes their log10 probabilities, quantized to a byte, as the
+# hashed table src/ngram_model.h maps, along with the confusion sets the
+# model is for. Splitting text into words, folding them and hashing must
+# match LanguageRouter (src/language_router.cpp) and src/ngram_model.cpp
+# exactly.
+#
+#   python3 tools/build_ngram_model.py [--check]
+#   python3 tools/build_ngram_model.py --corpus FILE --confusions FILE --out FILE
+#
+# With no files, rebuilds the sample models in data/ngram from
+# data/ngram/train and data/ngram/confusions. --check also reports, for
+# data/ngram/test, how many confusion words swapped for another in their
+# set are caught and how many correct ones are flagged.
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+# Sample models: the corpus language, and the dictionary tag they are for.
+LANGUAGES = [("en", "en_US")]
+
+MAGIC = b"EWNGRAM\0"
+VERSION = 1
+HEADER_BYTES = 64
+# Entries per bucket: a 64-byte cache line of 32-bit entries.
+BUCKET_ENTRIES = 16
+MAX_LOAD = 0.75
+# Stupid backoff: each order dropped costs a factor of 0.4.
+BACKOFF = math.log10(0.4)
+MASK64 = (1 << 64) - 1
+
+SENTENCE_START = b"<s>"
+SENTENCE_END = b"</s>"
+
+
+def char_length(b):
+    return 4 if b >= 0xF0 else 3 if b >= 0xE0 else 2 if b >= 0xC0 else 1
+
+
+def is_word_char(p):
+    # As LanguageRouter: letters, apostrophes (ASCII or U+2019) and anything
+    # non-ASCII but Latin-1 and general punctuation.
+    b = p[0]
+    if b < 0x80:
+        return 0x61 <= (b | 0x20) <= 0x7A or b == 0x27
+    if b == 0xC2:
+        return False
+    if b == 0xE2 and len(p) == 3 and p[1] in (0x80, 0x81):
+        return p[1] == 0x80 and p[2] == 0x99
+    return True
+
+
+def words(sentence):
+    out = []
+    i = 0
+    while i < len(sentence):
+        n = min(char_length(sentence[i]), len(sentence) - i)
+        if not is_word_char(sentence[i:i + n]):
+            i += n
+            continue
+        start = i
+        while i < len(sentence):
+            n = min(char_length(sentence[i]), len(sentence) - i)
+            if not is_word_char(sentence[i:i + n]):
+                break
+            i += n
+        word = sentence[start:i]
+        while True:
+            if word.startswith(b"'"):
+                word = word[1:]
+            elif len(word) >= 3 and word.startswith(b"\xE2\x80\x99"):
+                word = word[3:]
+            else:
+                break
+        while True:
+            if word.endswith(b"'"):
+                word = word[:-1]
+            elif len(word) >= 3 and word.endswith(b"\xE2\x80\x99"):
+                word = word[:-3]
+            else:
+                break
+        if word:
+            out.append(word)
+    return out
+
+
+def sentences(line):
+    # Split where LanguageRouter does; every line ends one too.
+    start = 0
+    for i, b in enumerate(line):
+        if b in b".!?":
+            yield line[start:i + 1]
+            start = i + 1
+    if start < len(line):
+        yield line[start:]
+
+
+def fold(word):
+    # ASCII and Latin-1 capitals to lowercase, and U+2019 to an ASCII
+    # apostrophe.
+    word = word.replace(b"\xE2\x80\x99", b"'")
+    out = bytearray()
+    for i, b in enumerate(word):
+        if 0x41 <= b <= 0x5A:
+            b += 0x20
+        elif i and word[i - 1] == 0xC3 and 0x80 <= b <= 0x9E and b != 0x97:
+            b += 0x20
+        out.append(b)
+    return bytes(out)
+
+
+def word_hash(word):
+    # 64-bit FNV-1a.
+    h = 0xCBF29CE484222325
+    for b in word:
+        h ^= b
+        h = (h * 0x100000001B3) & MASK64
+    return h
+
+
+def rotl(x, n):
+    return ((x << n) | (x >> (64 - n))) & MASK64
+
+
+def ngram_key(hashes):
+    k = hashes[0]
+    for h in hashes[1:]:
+        k = ((rotl(k, 23) ^ h) * 0x9E3779B97F4A7C15) & MASK64
+    k ^= len(hashes)
+    k ^= k >> 33
+    k = (k * 0xFF51AFD7ED558CCD) & MASK64
+    k ^= k >> 33
+    return k
+
+
+def fingerprint(key):
+    return ((key >> 8) & 0xFFFFFF) or 1
+
+
+def tokenize(path):
+    # Each sentence as folded word hashes between start and end markers.
+    start, end = word_hash(SENTENCE_START), word_hash(SENTENCE_END)
+    with open(path, "rb") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith(b"#"):
+                continue
+            for sentence in sentences(line):
+                w = [word_hash(fold(word)) for word in words(sentence)]
+                if w:
+                    yield [start] + w + [end]
+
+
+def count(corpus):
+    counts = {}
+    contexts = {}
+    tokens = 0
+    for s in tokenize(corpus):
+        tokens += len(s) - 1
+        for i in range(1, len(s)):
+            for n in (1, 2, 3):
+                if i - n + 1 < 0:
+                    break
+                gram = tuple(s[i - n + 1:i + 1])
+                counts[gram] = counts.get(gram, 0) + 1
+                context = gram[:-1]
+                contexts[context] = contexts.get(context, 0) + 1
+    return counts, contexts, tokens
+
+
+def probabilities(counts, contexts, tokens, min_count):
+    # Maximum likelihood, with n-grams above unigrams seen fewer than
+    # 'min_count' times left out.
+    out = {}
+    for gram, c in counts.items():
+        if len(gram) > 1 and c < min_count:
+            continue
+        out[gram] = math.log10(c / contexts[gram[:-1]])
+    return out
+
+
+def read_confusions(path):
+    sets = []
+    seen = set()
+    with open(path, "rb") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith(b"#"):
+                continue
+            words_ = [fold(w) for w in line.split()]
+            if len(words_) < 2:
+                sys.exit("%s: a set needs two words or more: %s" % (path, line.decode("utf-8")))
+            for w in words_:
+                if w in seen:
+                    sys.exit("%s: %s is in two sets" % (path, w.decode("utf-8")))
+                seen.add(w)
+            sets.append(words_)
+    return sets
+
+
+def build_table(logp):
+    scale = max(-v for v in logp.values()) / 255.0 or 1.0
+    bucket_bits = 0
+    while (1 << bucket_bits) * BUCKET_ENTRIES * MAX_LOAD < len(logp):
+        bucket_bits += 1
+    buckets = 1 << bucket_bits
+    table = [0] * (buckets * BUCKET_ENTRIES)
+    # Most probable first, so that if two n-grams' fingerprints ever meet
+    # on a probe path, the likelier one is found.
+    for gram, v in sorted(logp.items(), key=lambda item: (-item[1], item[0])):
+        key = ngram_key(list(gram))
+        bucket = (key >> 32) & (buckets - 1)
+        entry = (fingerprint(key) << 8) | min(255, int(round(-v / scale)))
+        while True:
+            slots = table[bucket * BUCKET_ENTRIES:(bucket + 1) * BUCKET_ENTRIES]
+            if 0 in slots:
+                table[bucket * BUCKET_ENTRIES + slots.index(0)] = entry
+                break
+            bucket = (bucket + 1) & (buckets - 1)
+    return table, bucket_bits, scale
+
+
+def lookup(model, key):
+    table, bucket_bits, scale = model["table"], model["bucket_bits"], model["scale"]
+    buckets = 1 << bucket_bits
+    bucket = (key >> 32) & (buckets - 1)
+    fp = fingerprint(key)
+    while True:
+        slots = table[bucket * BUCKET_ENTRIES:(bucket + 1) * BUCKET_ENTRIES]
+        for entry in slots:
+            if entry >> 8 == fp:
+                return -(entry & 0xFF) * scale
+        if 0 in slots:
+            return None
+        bucket = (bucket + 1) & (buckets - 1)
+
+
+def write_model(path, table, bucket_bits, scale, unknown, margin, confusions, tokens):
+    text = b"\n".join(b" ".join(s) for s in confusions) + b"\n"
+    offset = HEADER_BYTES + len(table) * 4
+    header = MAGIC + struct.pack("<IIffffIIII", VERSION, bucket_bits, scale, BACKOFF, unknown, margin,
+                                 len(confusions), offset, len(text), tokens)
+    header += b"\0" * (HEADER_BYTES - len(header))
+    with open(path, "wb") as f:
+        f.write(header)
+        f.write(struct.pack("<%dI" % len(table), *table))
+        f.write(text)
+
+
+def term(model, a, b, w):
+    # log10 P(w | a b) with stupid backoff, and whether an n-gram of two
+    # words or more ending in 'w' was found. 'a' is None at the start of a
+    # sentence.
+    if a is not None:
+        v = lookup(model, ngram_key([a, b, w]))
+        if v is not None:
+            return v, 3
+    v = lookup(model, ngram_key([b, w]))
+    drops = 1 if a is not None else 0
+    if v is not None:
+        return drops * BACKOFF + v, 2
+    v = lookup(model, ngram_key([w]))
+    return (drops + 1) * BACKOFF + (v if v is not None else model["unknown"]), 1
+
+
+def score(model, s, p, c):
+    # The terms of the sentence 's' that change when the word at 'p' is 'c',
+    # and how many of them found an n-gram including it.
+    total, evidence = 0.0, 0
+    v, order = term(model, s[p - 2] if p >= 2 else None, s[p - 1], c)
+    total += v
+    evidence += order >= 2
+    v, order = term(model, s[p - 1], c, s[p + 1])
+    total += v
+    evidence += order >= 2
+    if p + 2 < len(s):
+        v, order = term(model, c, s[p + 1], s[p + 2])
+        total += v
+        evidence += order >= 3
+    return total, evidence
+
+
+def detect(model, s, p):
+    # The set word that fits better than the one at 'p', or None.
+    alternatives = model["sets"].get(s[p])
+    if not alternatives:
+        return None
+    mine, _ = score(model, s, p, s[p])
+    best = None
+    for alt in alternatives:
+        if alt == s[p]:
+            continue
+        theirs, evidence = score(model, s, p, alt)
+        if evidence and theirs - mine >= model["margin"] and (best is None or theirs > best[0]):
+            best = (theirs, alt)
+    return best[1] if best else None
+
+
+def check(model, path):
+    caught = swapped = flagged = words_ = 0
+    for s in tokenize(path):
+        for p in range(1, len(s) - 1):
+            words_ += 1
+            if detect(model, s, p) is not None:
+                flagged += 1
+            for alt in model["sets"].get(s[p], []):
+                if alt == s[p]:
+                    continue
+                t = s[:p] + [alt] + s[p + 1:]
+                swapped += 1
+                if detect(model, t, p) == s[p]:
+                    caught += 1
+    print("%d of %d swapped words caught, %d of %d correct words flagged" % (caught, swapped, flagged, words_))
+
+
+def build(corpus, confusions_path, out, min_count, margin, check_path=None):
+    counts, contexts, tokens = count(corpus)
+    logp = probabilities(counts, contexts, tokens, min_count)
+    confusions = read_confusions(confusions_path)
+    table, bucket_bits, scale = build_table(logp)
+    unknown = math.log10(0.5 / tokens)
+    write_model(out, table, bucket_bits, scale, unknown, margin, confusions, tokens)
+    print("%s: %d tokens, %d n-grams, %d buckets, %d bytes" % (out, tokens, len(logp), 1 << bucket_bits, os.path.getsize(out)))
+
+    if check_path:
+        sets = {}
+        for s in confusions:
+            hashes = [word_hash(w) for w in s]
+            for h in hashes:
+                sets[h] = hashes
+        model = {"table": table, "bucket_bits": bucket_bits, "scale": scale, "unknown": unknown,
+                 "margin": margin, "sets": sets}
+        check(model, check_path)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--corpus")
+    parser.add_argument("--confusions")
+    parser.add_argument("--out")
+    parser.add_argument("--min-count", type=int, default=1)
+    # How much likelier, in log10, another word must make the sentence.
+    parser.add_argument("--margin", type=float, default=1.0)
+    parser.add_argument("--check", action="store_true")
+    args = parser.parse_args()
+
+    if args.corpus or args.confusions or args.out:
+        if not (args.corpus and args.confusions and args.out):
+            parser.error("--corpus, --confusions and --out go together")
+        build(args.corpus, args.confusions, args.out, args.min_count, args.margin)
+        return
+
+    for lang, tag in LANGUAGES:
+        data = os.path.join(ROOT, "data", "ngram")
+        build(os.path.join(data, "train", lang + ".txt"), os.path.join(data, "confusions", lang + ".txt"),
+              os.path.join(data, tag + ".ngram"), args.min_count, args.margin,
+              os.path.join(data, "test", lang + ".txt") if args.check else None)
+
+
+if __name__ == "__main__":
+    main()
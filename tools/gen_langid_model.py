@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# enchant_windows - generates src/langid_model.h from sample text.
+#
+# Copyright (c) 2015 Brenda Streiff
+#
+# This library is free software; you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation; either version 2.1 of the License, or (at
+# your option) any later version.
+#
+# This library is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+# License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library; if not, write to the Free Software Foundation,
+# Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+# Trains the language identifier on data/langid/train/<lang>.txt and writes
+# the quantized weights as a C++ header. The feature extraction here must
+# match LanguageIdentifier in src/langid.cpp exactly.
+#
+#   python3 tools/gen_langid_model.py [--check]
+#
+# --check also reports accuracy on data/langid/test.
+
+import math
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+LANGUAGES = ["en", "de", "fr", "es", "it", "nl", "pt", "sv"]
+BUCKET_BITS = 12
+BUCKETS = 1 << BUCKET_BITS
+SMOOTHING = 0.5
+
+
+def normalize(data):
+    # ASCII letters lowercased, anything else that is not part of a word
+    # (digits, punctuation, space) a separator. Latin-1 capitals encoded as
+    # C3 80..C3 9E fold onto C3 A0..C3 BE, except for C3 97 (multiplication
+    # sign). Other non-ASCII bytes pass through.
+    out = bytearray()
+    for i, b in enumerate(data):
+        prev = data[i - 1] if i else 0
+        if 0x41 <= b <= 0x5A:
+            b += 0x20
+        elif prev == 0xC3 and 0x80 <= b <= 0x9E and b != 0x97:
+            b += 0x20
+        elif b < 0x80 and not (0x61 <= b <= 0x7A) and b != 0x27:
+            b = 0x20
+        out.append(b)
+    return bytes(out)
+
+
+def fnv1a(seed, data):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for b in data:
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def bucket(h):
+    return (h ^ (h >> 16)) & (BUCKETS - 1)
+
+
+def features(text):
+    # Byte 1-, 2- and 3-grams of each word padded with a space either side.
+    for word in normalize(text).split(b" "):
+        if not word:
+            continue
+        padded = b" " + word + b" "
+        for i in range(len(padded)):
+            for n in (1, 2, 3):
+                if i + n > len(padded):
+                    break
+                gram = padded[i:i + n]
+                if gram == b" ":
+                    continue
+                yield bucket(fnv1a(n, gram))
+
+
+def read_lines(path):
+    with open(path, "rb") as f:
+        return [line.strip() for line in f if line.strip()]
+
+
+def train():
+    counts = []
+    for lang in LANGUAGES:
+        c = [0] * BUCKETS
+        for line in read_lines(os.path.join(ROOT, "data", "langid", "train", lang + ".txt")):
+            for b in features(line):
+                c[b] += 1
+        counts.append(c)
+
+    # Naive Bayes log-probabilities, centred per bucket (which leaves the
+    # ranking of languages unchanged) so the weights fit in int8.
+    logp = []
+    for c in counts:
+        total = sum(c) + SMOOTHING * BUCKETS
+        logp.append([math.log((x + SMOOTHING) / total) for x in c])
+    centred = []
+    for b in range(BUCKETS):
+        mean = sum(logp[l][b] for l in range(len(LANGUAGES))) / len(LANGUAGES)
+        centred.append([logp[l][b] - mean for l in range(len(LANGUAGES))])
+
+    magnitudes = sorted(abs(w) for row in centred for w in row)
+    limit = magnitudes[int(len(magnitudes) * 0.999)] or 1.0
+    scale = 127.0 / limit
+    weights = [[max(-127, min(127, int(round(w * scale)))) for w in row] for row in centred]
+    return weights, scale
+
+
+def identify(weights, text):
+    scores = [0] * len(LANGUAGES)
+    for b in features(text):
+        for l in range(len(LANGUAGES)):
+            scores[l] += weights[b][l]
+    return max(range(len(LANGUAGES)), key=lambda l: scores[l])
+
+
+def write_header(weights, scale, path):
+    with open(path, "w", newline="\n") as f:
+        f.write("// enchant_windows - language identification model.\n")
+        f.write("//\n")
+        f.write("// Generated by tools/gen_langid_model.py from data/langid/train. Do not edit.\n")
+        f.write("\n")
+        f.write("#ifndef ENCHANT_WINDOWS_LANGID_MODEL_H\n")
+        f.write("#define ENCHANT_WINDOWS_LANGID_MODEL_H\n")
+        f.write("\n")
+        f.write("#include <stdint.h>\n")
+        f.write("\n")
+        f.write("namespace langid_model {\n")
+        f.write("\n")
+        f.write("const unsigned kBucketBits = %d;\n" % BUCKET_BITS)
+        f.write("const unsigned kLanguageCount = %d;\n" % len(LANGUAGES))
+        f.write("\n")
+        f.write("// One scaled log-probability unit, in nats.\n")
+        f.write("const double kScale = %.6f;\n" % (1.0 / scale))
+        f.write("\n")
+        f.write("const char* const kLanguages[kLanguageCount] = {\n")
+        f.write("\t" + ", ".join('"%s"' % l for l in LANGUAGES) + "\n")
+        f.write("};\n")
+        f.write("\n")
+        f.write("// Weight of each bucket for each language, a row per bucket.\n")
+        f.write("alignas(16) const int8_t kWeights[%d * kLanguageCount] = {\n" % BUCKETS)
+        for row in weights:
+            f.write("\t" + ", ".join("%d" % w for w in row) + ",\n")
+        f.write("};\n")
+        f.write("\n")
+        f.write("} // namespace langid_model\n")
+        f.write("\n")
+        f.write("#endif\n")
+
+
+def main():
+    weights, scale = train()
+    write_header(weights, scale, os.path.join(ROOT, "src", "langid_model.h"))
+    if "--check" in sys.argv[1:]:
+        right = total = 0
+        for expected, lang in enumerate(LANGUAGES):
+            for line in read_lines(os.path.join(ROOT, "data", "langid", "test", lang + ".txt")):
+                got = identify(weights, line)
+                total += 1
+                if got == expected:
+                    right += 1
+                else:
+                    print("%s as %s: %s" % (lang, LANGUAGES[got], line.decode("utf-8")))
+        print("accuracy %d/%d" % (right, total))
+
+
+if __name__ == "__main__":
+    main()
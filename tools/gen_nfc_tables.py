@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+# enchant_windows - generates src/nfc_tables.h from Python's Unicode data.
+#
+# Copyright (c) 2015 Brenda Streiff
+#
+# This library is free software; you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation; either version 2.1 of the License, or (at
+# your option) any later version.
+#
+# This library is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+# License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library; if not, write to the Free Software Foundation,
+# Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+# Writes the tables src/normalize.cpp needs for NFC: canonical combining
+# classes and quick-check values, full canonical decompositions, and primary
+# composites. Hangul syllables are left out of the last two; normalize.cpp
+# handles them arithmetically.
+#
+#   python3 tools/gen_nfc_tables.py [--check]
+#
+# --check also compares the derived quick-check values against
+# unicodedata.is_normalized on every code point and pair of a starter and a
+# combining mark.
+
+import os
+import sys
+import unicodedata
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MAX_CODE_POINT = 0x10FFFF
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+# Everything below this has a combining class of 0 and is NFC_QC=Yes.
+FIRST_INTERESTING = 0x300
+
+QC_YES, QC_MAYBE, QC_NO = 0, 1, 2
+
+
+def canonical_pair(c):
+    d = unicodedata.decomposition(chr(c))
+    if not d or d.startswith("<"):
+        return None
+    parts = [int(x, 16) for x in d.split()]
+    return parts if len(parts) == 2 else None
+
+
+def compositions():
+    # Primary composites: a canonical decomposition into two that NFC keeps.
+    pairs = []
+    for c in range(MAX_CODE_POINT + 1):
+        if HANGUL_FIRST <= c <= HANGUL_LAST:
+            continue
+        parts = canonical_pair(c)
+        if parts and unicodedata.normalize("NFC", chr(c)) == chr(c):
+            pairs.append((parts[0], parts[1], c))
+    return sorted(pairs)
+
+
+def quick_check(pairs):
+    # No: never in NFC (singletons, exclusions, non-starter decompositions).
+    # Maybe: can combine with what comes before it.
+    qc = {}
+    for c in range(FIRST_INTERESTING, MAX_CODE_POINT + 1):
+        if unicodedata.normalize("NFC", chr(c)) != chr(c):
+            qc[c] = QC_NO
+    for _, second, _ in pairs:
+        qc[second] = QC_MAYBE
+    for c in list(range(0x1161, 0x1176)) + list(range(0x11A8, 0x11C3)):
+        qc[c] = QC_MAYBE
+    return qc
+
+
+def properties(qc):
+    # Ranges of code points with the same class and quick-check value,
+    # leaving out the class 0, Yes ones.
+    ranges = []
+    for c in range(FIRST_INTERESTING, MAX_CODE_POINT + 1):
+        value = (unicodedata.combining(chr(c)), qc.get(c, QC_YES))
+        if value == (0, QC_YES):
+            continue
+        if ranges and ranges[-1][1] == c - 1 and ranges[-1][2:] == list(value):
+            ranges[-1][1] = c
+        else:
+            ranges.append([c, c, value[0], value[1]])
+    return ranges
+
+
+def decompositions():
+    table = []
+    for c in range(MAX_CODE_POINT + 1):
+        if HANGUL_FIRST <= c <= HANGUL_LAST:
+            continue
+        nfd = unicodedata.normalize("NFD", chr(c))
+        if nfd != chr(c):
+            table.append((c, [ord(x) for x in nfd]))
+    return table
+
+
+def check(qc):
+    bad = 0
+    for c in range(MAX_CODE_POINT + 1):
+        if 0xD800 <= c <= 0xDFFF:
+            continue
+        expected = unicodedata.is_normalized("NFC", chr(c))
+        if expected != (qc.get(c, QC_YES) == QC_YES or (qc.get(c) == QC_MAYBE and expected)):
+            bad += 1
+    marks = [c for c in range(FIRST_INTERESTING, 0x10000) if unicodedata.combining(chr(c))]
+    starters = [c for c in range(0x41, 0x3000) if not unicodedata.combining(chr(c)) and qc.get(c, QC_YES) == QC_YES]
+    for s in starters:
+        for m in marks:
+            text = chr(s) + chr(m)
+            if qc.get(m, QC_YES) == QC_YES and not unicodedata.is_normalized("NFC", text):
+                bad += 1
+    print("quick-check mismatches: %d" % bad)
+
+
+def write_header(ranges, table, pairs, path):
+    with open(path, "w", newline="\n") as f:
+        f.write("// enchant_windows - Unicode tables for NFC.\n")
+        f.write("//\n")
+        f.write("// Generated by tools/gen_nfc_tables.py from Unicode %s. Do not edit.\n" % unicodedata.unidata_version)
+        f.write("\n")
+        f.write("#ifndef ENCHANT_WINDOWS_NFC_TABLES_H\n")
+        f.write("#define ENCHANT_WINDOWS_NFC_TABLES_H\n")
+        f.write("\n")
+        f.write("#include <stdint.h>\n")
+        f.write("\n")
+        f.write("namespace nfc_tables {\n")
+        f.write("\n")
+        f.write("// Below this, every code point has combining class 0 and is NFC_QC=Yes.\n")
+        f.write("const uint32_t kFirstInteresting = 0x%X;\n" % FIRST_INTERESTING)
+        f.write("\n")
+        f.write("enum QuickCheck { kYes, kMaybe, kNo };\n")
+        f.write("\n")
+        f.write("struct Property\n{\n\tuint32_t first;\n\tuint32_t last;\n\tuint8_t ccc;\n\tuint8_t quick_check;\n};\n")
+        f.write("\n")
+        f.write("// Ranges, in order, of code points whose class isn't 0 or that aren't\n")
+        f.write("// NFC_QC=Yes.\n")
+        f.write("const Property kProperties[] = {\n")
+        for first, last, ccc, q in ranges:
+            f.write("\t{ 0x%X, 0x%X, %d, %d },\n" % (first, last, ccc, q))
+        f.write("};\n")
+        f.write("\n")
+        f.write("struct Decomposition\n{\n\tuint32_t code_point;\n\tuint16_t offset;\n\tuint16_t length;\n};\n")
+        f.write("\n")
+        f.write("// Full canonical decompositions, in order of code point, other than\n")
+        f.write("// Hangul syllables. Each is 'length' code points at 'offset' in kDecomposed.\n")
+        f.write("const Decomposition kDecompositions[] = {\n")
+        offset = 0
+        flat = []
+        for c, parts in table:
+            f.write("\t{ 0x%X, %d, %d },\n" % (c, offset, len(parts)))
+            offset += len(parts)
+            flat.extend(parts)
+        f.write("};\n")
+        f.write("\n")
+        f.write("const uint32_t kDecomposed[] = {\n")
+        for i in range(0, len(flat), 8):
+            f.write("\t" + ", ".join("0x%X" % x for x in flat[i:i + 8]) + ",\n")
+        f.write("};\n")
+        f.write("\n")
+        f.write("struct Composition\n{\n\tuint32_t first;\n\tuint32_t second;\n\tuint32_t composite;\n};\n")
+        f.write("\n")
+        f.write("// Primary composites other than Hangul syllables, in order of the pair\n")
+        f.write("// they compose from.\n")
+        f.write("const Composition kCompositions[] = {\n")
+        for first, second, composite in pairs:
+            f.write("\t{ 0x%X, 0x%X, 0x%X },\n" % (first, second, composite))
+        f.write("};\n")
+        f.write("\n")
+        f.write("} // namespace nfc_tables\n")
+        f.write("\n")
+        f.write("#endif\n")
+
+
+def main():
+    pairs = compositions()
+    qc = quick_check(pairs)
+    write_header(properties(qc), decompositions(), pairs, os.path.join(ROOT, "src", "nfc_tables.h"))
+    if "--check" in sys.argv[1:]:
+        check(qc)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+# enchant_windows - generates src/typo_table_data.h from typo lists.
+#
+# Copyright (c) 2015 Brenda Streiff
+#
+# This library is free software; you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation; either version 2.1 of the License, or (at
+# your option) any later version.
+#
+# This library is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+# License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library; if not, write to the Free Software Foundation,
+# Inc., 59 Temple Place - Suite 330, Boston, MA 02110 - 1301, USA.
+
+
+# Compiles data/typos/<lang>.txt into a constexpr minimal perfect hash per
+# language, written as a C++ header. The hash and the folding of typos to
+# lowercase here must match src/typo_table.h and case_pattern exactly.
+#
+#   python3 tools/gen_typo_tables.py [--check]
+#
+# --check also reports coverage of the samples in data/typos/test, weighted
+# by how often each typo was seen.
+
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+LANGUAGES = [("en", "English"), ("de", "German"), ("fr", "French"), ("es", "Spanish")]
+# Typos per bucket, on average. Buckets are what cost space, a seed each;
+# fuller ones take longer to find seeds for.
+BUCKET_SIZE = 4
+# Longest typo, in bytes; see kMaxTypoBytes in src/typo_table.cpp.
+MAX_TYPO_BYTES = 64
+
+
+def typo_hash(seed, data):
+    # FNV-1a, then a finalizer: FNV's multiplies only carry upward, so
+    # without one, seeds would barely move the low bits.
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for b in data:
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    return h
+
+
+def fold(word):
+    # ASCII and Latin-1 capitals to lowercase, as case_pattern folds them.
+    # Anything else capitalized would make the word mixed case, which is
+    # never looked up.
+    out = []
+    for c in word:
+        if "A" <= c <= "Z" or ("À" <= c <= "Þ" and c != "×"):
+            c = chr(ord(c) + 0x20)
+        elif c.isupper():
+            raise ValueError("can't fold %r" % word)
+        out.append(c)
+    return "".join(out)
+
+
+def read_pairs(path, fields):
+    pairs = []
+    with open(path, encoding="utf-8") as f:
+        for number, line in enumerate(f, 1):
+            line = line.rstrip("\n")
+            if not line or line.startswith("#"):
+                continue
+            parts = line.split("\t")
+            if len(parts) != fields:
+                raise ValueError("%s:%d: expected %d fields" % (path, number, fields))
+            pairs.append(parts)
+    return pairs
+
+
+def read_table(lang):
+    path = os.path.join(ROOT, "data", "typos", lang + ".txt")
+    table = {}
+    for typo, correction in read_pairs(path, 2):
+        key = fold(typo)
+        if len(key.encode("utf-8")) > MAX_TYPO_BYTES:
+            raise ValueError("%s: %s is too long" % (path, typo))
+        if key in table:
+            raise ValueError("%s: %s is listed twice" % (path, typo))
+        if key == fold(correction):
+            raise ValueError("%s: %s corrects to itself" % (path, typo))
+        table[key] = correction
+    return table
+
+
+def perfect_hash(keys):
+    # Hash and displace: keys hash (seed 0) to buckets, and each bucket,
+    # largest first, gets the first seed that rehashes all of its keys to
+    # free slots. There are as many slots as keys.
+    n = len(keys)
+    bucket_count = max(1, (n + BUCKET_SIZE - 1) // BUCKET_SIZE)
+    buckets = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[typo_hash(0, key.encode("utf-8")) % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots = [None] * n
+    for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        for seed in range(1, 1 << 16):
+            taken = [typo_hash(seed, key.encode("utf-8")) % n for key in buckets[b]]
+            if len(set(taken)) == len(taken) and all(slots[s] is None for s in taken):
+                break
+        else:
+            raise RuntimeError("no seed for bucket %d" % b)
+        seeds[b] = seed
+        for key, slot in zip(buckets[b], taken):
+            slots[slot] = key
+    return seeds, slots
+
+
+def lookup(table, seeds, slots, word):
+    key = word.encode("utf-8")
+    seed = seeds[typo_hash(0, key) % len(seeds)]
+    slot = slots[typo_hash(seed, key) % len(slots)]
+    return table[slot] if slot == word else None
+
+
+def capitalize(word, all_letters):
+    # As case_pattern.h's capitalize: ASCII and Latin-1 letters only.
+    out = []
+    for i, c in enumerate(word):
+        if "a" <= c <= "z" or ("à" <= c <= "þ" and c != "÷"):
+            c = chr(ord(c) - 0x20)
+        elif ord(c) >= 0x80 and not all_letters:
+            return "".join(out) + word[i:]
+        out.append(c)
+        if not all_letters:
+            return "".join(out) + word[i + 1:]
+    return "".join(out)
+
+
+def correct(table, seeds, slots, word):
+    key = fold(word) if all(not c.isupper() or fold(c) != c for c in word) else word
+    correction = lookup(table, seeds, slots, key)
+    if correction is None or key == word:
+        return correction
+    upper = len([c for c in word if c.isalpha()]) > 1 and word == word.upper()
+    return capitalize(correction, upper)
+
+
+def c_string(s):
+    # Non-ASCII bytes as octal escapes, which unlike hex ones can't run on
+    # into the next character, so that the header means the same whatever
+    # code page the compiler reads it in.
+    out = ""
+    for b in s.encode("utf-8"):
+        if b >= 0x80:
+            out += "\\%03o" % b
+        elif chr(b) in "\\\"":
+            out += "\\" + chr(b)
+        else:
+            out += chr(b)
+    return '"' + out + '"'
+
+
+def write_header(tables, path):
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("// enchant_windows - common typo tables.\n")
+        f.write("//\n")
+        f.write("// Generated by tools/gen_typo_tables.py from data/typos. Do not edit.\n")
+        f.write("\n")
+        f.write("#ifndef ENCHANT_WINDOWS_TYPO_TABLE_DATA_H\n")
+        f.write("#define ENCHANT_WINDOWS_TYPO_TABLE_DATA_H\n")
+        f.write("\n")
+        f.write('#include "typo_table.h"\n')
+        f.write("\n")
+        f.write("namespace typo_table_data {\n")
+        for (lang, name), (table, seeds, slots) in zip(LANGUAGES, tables):
+            f.write("\n")
+            f.write("// %s: %d typos.\n" % (name, len(slots)))
+            f.write("constexpr uint16_t k%sSeeds[%d] = {\n" % (name, len(seeds)))
+            for i in range(0, len(seeds), 16):
+                f.write("\t" + ", ".join("%d" % s for s in seeds[i:i + 16]) + ",\n")
+            f.write("};\n")
+            f.write("\n")
+            f.write("constexpr TypoEntry k%sEntries[%d] = {\n" % (name, len(slots)))
+            for key in slots:
+                f.write("\t{ %s, %s },\n" % (c_string(key), c_string(table[key])))
+            f.write("};\n")
+        f.write("\n")
+        f.write("constexpr TypoTable kTables[%d] = {\n" % len(LANGUAGES))
+        for (lang, name), (table, seeds, slots) in zip(LANGUAGES, tables):
+            f.write('\t{ "%s", k%sSeeds, %d, k%sEntries, %d },\n' % (lang, name, len(seeds), name, len(slots)))
+        f.write("};\n")
+        f.write("\n")
+        f.write("} // namespace typo_table_data\n")
+        f.write("\n")
+        f.write("#endif\n")
+
+
+def main():
+    tables = []
+    for lang, name in LANGUAGES:
+        table = read_table(lang)
+        seeds, slots = perfect_hash(sorted(table))
+        tables.append((table, seeds, slots))
+    write_header(tables, os.path.join(ROOT, "src", "typo_table_data.h"))
+
+    if "--check" in sys.argv[1:]:
+        for (lang, name), (table, seeds, slots) in zip(LANGUAGES, tables):
+            covered = total = 0
+            for typo, expected, count in read_pairs(os.path.join(ROOT, "data", "typos", "test", lang + ".txt"), 3):
+                total += int(count)
+                if correct(table, seeds, slots, typo) == expected:
+                    covered += int(count)
+                else:
+                    print("%s: no %s -> %s" % (lang, typo, expected))
+            print("%s: %d typos, %d seeds, coverage %.1f%%" % (lang, len(slots), len(seeds), 100.0 * covered / total))
+
+
+if __name__ == "__main__":
+    main()